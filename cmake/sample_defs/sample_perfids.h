@@ -54,6 +54,21 @@
 #define CFE_MISSION_TIME_LOCAL1HZTASK_PERF_ID 10 /**< \brief Performance ID for 1 Hz Local Task */
 #define CFE_MISSION_TIME_TONE1HZTASK_PERF_ID  11 /**< \brief Performance ID for 1 Hz Tone Task */
 
+/*
+ * Markers placed inside the core service APIs themselves.  These are only
+ * compiled in when CFE_PLATFORM_CORE_PERF_MARKERS is enabled, and the "LOCK"
+ * markers bracket the wait for the internal lock of the respective service.
+ */
+#define CFE_MISSION_SB_TRANSMIT_PERF_ID    12 /**< \brief Performance ID for CFE_SB_TransmitMsg */
+#define CFE_MISSION_SB_RECEIVE_PERF_ID     13 /**< \brief Performance ID for CFE_SB_ReceiveBuffer */
+#define CFE_MISSION_SB_LOCK_PERF_ID        14 /**< \brief Performance ID for SB shared data lock wait */
+#define CFE_MISSION_EVS_SENDEVENT_PERF_ID  15 /**< \brief Performance ID for CFE_EVS_SendEvent */
+#define CFE_MISSION_EVS_LOCK_PERF_ID       16 /**< \brief Performance ID for EVS shared data lock wait */
+#define CFE_MISSION_TBL_GETADDRESS_PERF_ID 17 /**< \brief Performance ID for CFE_TBL_GetAddress */
+#define CFE_MISSION_TBL_LOCK_PERF_ID       18 /**< \brief Performance ID for TBL registry lock wait */
+#define CFE_MISSION_ES_GETPOOLBUF_PERF_ID  19 /**< \brief Performance ID for CFE_ES_GetPoolBuf */
+#define CFE_MISSION_ES_POOL_LOCK_PERF_ID   20 /**< \brief Performance ID for ES memory pool lock wait */
+
 /** \} */
 
 #endif /* SAMPLE_PERFIDS_H */
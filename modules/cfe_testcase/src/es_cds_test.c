@@ -142,9 +142,82 @@ void TestCopyRestoreCDS(void)
     UtAssert_INT32_EQ(CFE_ES_RestoreFromCDS(NULL, CDSHandlePtr), CFE_ES_BAD_ARGUMENT);
 }
 
+void TestCopyRangeCDS(void)
+{
+    CFE_ES_CDSHandle_t CDSHandlePtr;
+    size_t             BlockSize = 10;
+    const char *       Name      = "CDS_Range_Test";
+    CFE_Status_t       status;
+    char               Data[BlockSize];
+    char               DataBuff[BlockSize];
+
+    memset(DataBuff, 0, sizeof(DataBuff));
+
+    UtPrintf("Testing: CFE_ES_CopyToCDSRange");
+
+    snprintf(Data, BlockSize, "Test Data");
+
+    status = CFE_ES_RegisterCDS(&CDSHandlePtr, BlockSize, Name);
+    UtAssert_True(status == CFE_SUCCESS || status == CFE_ES_CDS_ALREADY_EXISTS, "Register CDS status = %d",
+                  (int)status);
+
+    /* The whole block must have valid contents first */
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDS(CDSHandlePtr, Data), CFE_SUCCESS);
+
+    /* Change one word and restore, the CRC of the block must still be valid */
+    memcpy(&Data[5], "Rang", 4);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandlePtr, 5, 4, &Data[5]), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_RestoreFromCDS(DataBuff, CDSHandlePtr), CFE_SUCCESS);
+    UtAssert_StrCmp(Data, DataBuff, "RestoreFromCDS = %s", DataBuff);
+
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CFE_ES_CDS_BAD_HANDLE, 0, 1, Data), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandlePtr, 0, 1, NULL), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandlePtr, 0, 0, Data), CFE_ES_CDS_INVALID_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandlePtr, 5, BlockSize, Data), CFE_ES_CDS_INVALID_SIZE);
+}
+
+void TestWriteBehindCDS(void)
+{
+    CFE_ES_CDSHandle_t CDSHandlePtr;
+    size_t             BlockSize = 10;
+    const char *       Name      = "CDS_WB_Test";
+    CFE_Status_t       status;
+    char               Data[BlockSize];
+    char               DataBuff[BlockSize];
+
+    memset(DataBuff, 0, sizeof(DataBuff));
+
+    UtPrintf("Testing: CFE_ES_SetCDSWriteBehind, CFE_ES_FlushCDS");
+
+    snprintf(Data, BlockSize, "Test Data");
+
+    status = CFE_ES_RegisterCDS(&CDSHandlePtr, BlockSize, Name);
+    UtAssert_True(status == CFE_SUCCESS || status == CFE_ES_CDS_ALREADY_EXISTS, "Register CDS status = %d",
+                  (int)status);
+
+    /* Writes go to the shadow, and reads see them before they are flushed */
+    UtAssert_INT32_EQ(CFE_ES_SetCDSWriteBehind(CDSHandlePtr, true), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDS(CDSHandlePtr, Data), CFE_SUCCESS);
+    memcpy(&Data[5], "Shad", 4);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandlePtr, 5, 4, &Data[5]), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_RestoreFromCDS(DataBuff, CDSHandlePtr), CFE_SUCCESS);
+    UtAssert_StrCmp(Data, DataBuff, "RestoreFromCDS = %s", DataBuff);
+
+    /* After leaving write-behind mode, the CDS itself must have the same content */
+    UtAssert_INT32_EQ(CFE_ES_FlushCDS(), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_SetCDSWriteBehind(CDSHandlePtr, false), CFE_SUCCESS);
+    memset(DataBuff, 0, sizeof(DataBuff));
+    UtAssert_INT32_EQ(CFE_ES_RestoreFromCDS(DataBuff, CDSHandlePtr), CFE_SUCCESS);
+    UtAssert_StrCmp(Data, DataBuff, "RestoreFromCDS = %s", DataBuff);
+
+    UtAssert_INT32_EQ(CFE_ES_SetCDSWriteBehind(CFE_ES_CDS_BAD_HANDLE, true), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+}
+
 void ESCDSTestSetup(void)
 {
     UtTest_Add(TestRegisterCDS, NULL, NULL, "Test Register CDS");
     UtTest_Add(TestCDSName, NULL, NULL, "Test CDS Name");
     UtTest_Add(TestCopyRestoreCDS, NULL, NULL, "Test Copy Restore CDS");
+    UtTest_Add(TestCopyRangeCDS, NULL, NULL, "Test Copy Range CDS");
+    UtTest_Add(TestWriteBehindCDS, NULL, NULL, "Test Write-Behind CDS");
 }
@@ -199,6 +199,50 @@ void TestMemPoolDelete(void)
     UtAssert_INT32_EQ(CFE_ES_PoolDelete(CFE_ES_MEMHANDLE_UNDEFINED), CFE_ES_ERR_RESOURCEID_NOT_VALID);
 }
 
+void TestMemPoolBuddy(void)
+{
+    CFE_ES_MemHandle_t    PoolID = CFE_ES_MEMHANDLE_UNDEFINED;
+    uint8                 Buffer[1024];
+    static const size_t   BlockSizes[2] = {32, 256};
+    CFE_ES_MemPoolBuf_t   SmallBufs[32];
+    CFE_ES_MemPoolBuf_t   LargeBuf;
+    CFE_ES_MemPoolStats_t Stats;
+    uint32                NumBufs;
+
+    UtPrintf("Testing: CFE_ES_PoolCreateBuddy");
+
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateBuddy(NULL, Buffer, sizeof(Buffer), 2, BlockSizes, CFE_ES_USE_MUTEX),
+                      CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateBuddy(&PoolID, NULL, sizeof(Buffer), 2, BlockSizes, CFE_ES_USE_MUTEX),
+                      CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateBuddy(&PoolID, Buffer, sizeof(Buffer), 2, BlockSizes, CFE_ES_USE_MUTEX),
+                      CFE_SUCCESS);
+
+    /* fill the whole pool with small buffers */
+    NumBufs = 0;
+    while (NumBufs < 32 && CFE_ES_GetPoolBuf(&SmallBufs[NumBufs], PoolID, 32) == 32)
+    {
+        ++NumBufs;
+    }
+    UtAssert_NONZERO(NumBufs);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&LargeBuf, PoolID, 256), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_GetMemPoolStats(&Stats, PoolID), CFE_SUCCESS);
+    UtAssert_ZERO(CFE_ES_MEMOFFSET_TO_SIZET(Stats.LargestFreeBlock));
+
+    /* once they are returned, the same memory can hold a large buffer */
+    while (NumBufs > 0)
+    {
+        --NumBufs;
+        UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, SmallBufs[NumBufs]), 32);
+    }
+    UtAssert_INT32_EQ(CFE_ES_GetMemPoolStats(&Stats, PoolID), CFE_SUCCESS);
+    UtAssert_UINT32_GTEQ(CFE_ES_MEMOFFSET_TO_SIZET(Stats.LargestFreeBlock), 256);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&LargeBuf, PoolID, 256), 256);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, LargeBuf), 256);
+
+    UtAssert_INT32_EQ(CFE_ES_PoolDelete(PoolID), CFE_SUCCESS);
+}
+
 void ESMemPoolTestSetup(void)
 {
     UtTest_Add(TestMemPoolCreate, NULL, NULL, "Test Mem Pool Create");
@@ -207,4 +251,5 @@ void ESMemPoolTestSetup(void)
     UtTest_Add(TestMemPoolBufInfo, NULL, NULL, "Test Mem Pool Buf Info");
     UtTest_Add(TestMemPoolPutBuf, NULL, NULL, "Test Mem Pool Put Buf");
     UtTest_Add(TestMemPoolDelete, NULL, NULL, "Test Mem Pool Delete");
+    UtTest_Add(TestMemPoolBuddy, NULL, NULL, "Test Mem Pool Buddy");
 }
@@ -56,6 +56,10 @@ void TestCalculateCRC(void)
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0, CFE_MISSION_ES_DEFAULT_CRC),
                        0xBB3D);
 
+    /* The CFE_ES_CrcType_32C algorithm check value result is 0xe3069283 */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0, CFE_ES_CrcType_32C),
+                       0xE3069283);
+
     /* Compute a secondary string - the reference value obtained using 3rd party tool implementing same algorithm */
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_OTHER_INPUT, sizeof(CRC_OTHER_INPUT) - 1, 0, CFE_ES_CrcType_16_ARC),
                        0x11E3);
@@ -70,6 +74,83 @@ void TestCalculateCRC(void)
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_OTHER_INPUT, 0, inputCrc, CFE_ES_CrcType_16_ARC), inputCrc);
 }
 
+/*
+ * Measures the time to compute each CRC algorithm over a large buffer.  This
+ * is not checked against a limit, as it depends on the CPU.
+ */
+void TestCalculateCRCPerformance(void)
+{
+    static uint8 CrcBuffer[65536];
+
+    static const struct
+    {
+        CFE_ES_CrcType_Enum_t CrcType;
+        const char *          Name;
+    } CRC_ALGORITHMS[] = {{CFE_ES_CrcType_16_ARC, "CRC-16/ARC"}, {CFE_ES_CrcType_32C, "CRC-32C"}};
+
+    OS_time_t StartTime;
+    OS_time_t ElapsedTime;
+    int64     Usec;
+    uint32    i;
+    uint32    Pass;
+    uint32    Crc;
+
+    UtPrintf("Testing: CFE_ES_CalculateCRC performance");
+
+    for (i = 0; i < sizeof(CrcBuffer); ++i)
+    {
+        CrcBuffer[i] = (uint8)((i * 37) + (i >> 8));
+    }
+
+    for (i = 0; i < (sizeof(CRC_ALGORITHMS) / sizeof(CRC_ALGORITHMS[0])); ++i)
+    {
+        Crc = 0;
+        CFE_PSP_GetTime(&StartTime);
+        for (Pass = 0; Pass < 16; ++Pass)
+        {
+            Crc = CFE_ES_CalculateCRC(CrcBuffer, sizeof(CrcBuffer), Crc, CRC_ALGORITHMS[i].CrcType);
+        }
+        CFE_PSP_GetTime(&ElapsedTime);
+        ElapsedTime = OS_TimeSubtract(ElapsedTime, StartTime);
+
+        Usec = OS_TimeGetTotalMicroseconds(ElapsedTime);
+        UtAssert_MIR("%s: %lu bytes in %ld usec, %ld KiB/sec", CRC_ALGORITHMS[i].Name,
+                     (unsigned long)(16 * sizeof(CrcBuffer)), (long)Usec,
+                     (Usec > 0) ? (long)(((int64)16 * sizeof(CrcBuffer) * 1000000) / (Usec * 1024)) : 0L);
+    }
+}
+
+void TestChunkedCRC(void)
+{
+    static uint8        CrcBuffer[4096];
+    CFE_ES_ChunkedCRC_t ChunkedCRC;
+    uint32              i;
+
+    UtPrintf("Testing: CFE_ES_CombineCRC, CFE_ES_ChunkedCRCInit, CFE_ES_ChunkedCRCUpdate");
+
+    for (i = 0; i < sizeof(CrcBuffer); ++i)
+    {
+        CrcBuffer[i] = (uint8)((i * 37) + (i >> 8));
+    }
+
+    UtAssert_UINT32_EQ(CFE_ES_CombineCRC(CFE_ES_CalculateCRC(CrcBuffer, 1000, 0, CFE_MISSION_ES_DEFAULT_CRC),
+                                         CFE_ES_CalculateCRC(&CrcBuffer[1000], 3096, 0, CFE_MISSION_ES_DEFAULT_CRC),
+                                         3096, CFE_MISSION_ES_DEFAULT_CRC),
+                       CFE_ES_CalculateCRC(CrcBuffer, sizeof(CrcBuffer), 0, CFE_MISSION_ES_DEFAULT_CRC));
+
+    UtAssert_UINT32_EQ(CFE_ES_ChunkedCRCInit(&ChunkedCRC, CrcBuffer, sizeof(CrcBuffer), CFE_MISSION_ES_DEFAULT_CRC),
+                       CFE_ES_CalculateCRC(CrcBuffer, sizeof(CrcBuffer), 0, CFE_MISSION_ES_DEFAULT_CRC));
+
+    /* Change a few bytes and only report those */
+    CrcBuffer[2049] ^= 0xA5;
+    CrcBuffer[2050] ^= 0x5A;
+    UtAssert_UINT32_EQ(CFE_ES_ChunkedCRCUpdate(&ChunkedCRC, CrcBuffer, 2049, 2),
+                       CFE_ES_CalculateCRC(CrcBuffer, sizeof(CrcBuffer), 0, CFE_MISSION_ES_DEFAULT_CRC));
+
+    UtAssert_ZERO(CFE_ES_ChunkedCRCInit(&ChunkedCRC, NULL, sizeof(CrcBuffer), CFE_MISSION_ES_DEFAULT_CRC));
+    UtAssert_ZERO(CFE_ES_ChunkedCRCUpdate(&ChunkedCRC, CrcBuffer, 0, 1));
+}
+
 void TestWriteToSysLog(void)
 {
     const char *TestString = "Test String for CFE_ES_WriteToSysLog Functional Test";
@@ -122,6 +203,8 @@ void TestBackgroundWakeup(void)
 void ESMiscTestSetup(void)
 {
     UtTest_Add(TestCalculateCRC, NULL, NULL, "Test Calculate CRC");
+    UtTest_Add(TestCalculateCRCPerformance, NULL, NULL, "Test Calculate CRC Performance");
+    UtTest_Add(TestChunkedCRC, NULL, NULL, "Test Chunked CRC");
     UtTest_Add(TestWriteToSysLog, NULL, NULL, "Test Write To Sys Log");
     UtTest_Add(TestProcessAsyncEvent, NULL, NULL, "Test Process Async Event");
     UtTest_Add(TestBackgroundWakeup, NULL, NULL, "Test Background Wakeup");
@@ -858,6 +858,18 @@ char *CFE_ES_StatusToString(CFE_Status_t status, CFE_StatusString_t *status_stri
  */
 #define CFE_SB_BUFFER_INVALID ((CFE_Status_t)0xca00000e)
 
+/**
+ * @brief Hold Limit Met
+ *
+ *  Will be returned when calling #CFE_SB_ReceiveBuffer on a pipe that has the
+ *  #CFE_SB_PIPEOPTS_HOLDBUFFERS option set if the application already holds
+ *  #CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS buffers received from that pipe.
+ *  One or more buffers must be released with #CFE_SB_ReleaseReceivedBuffer
+ *  before another message can be received.
+ *
+ */
+#define CFE_SB_HOLD_LIMIT_MET ((CFE_Status_t)0xca00000f)
+
 /**
  * @brief Not Implemented
  *
@@ -1007,6 +1007,92 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1, 2
 ******************************************************************************/
 uint32 CFE_ES_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, CFE_ES_CrcType_Enum_t TypeCRC);
 
+/*****************************************************************************/
+/**
+** \brief Combine the CRCs of two consecutive blocks of memory
+**
+** \par Description
+**        This routine computes the CRC of two consecutive blocks of memory from
+**        the CRC of each block, without accessing the blocks themselves.  The time
+**        it takes grows with the logarithm of the length of the second block.
+**
+** \par Assumptions, External Events, and Notes:
+**        Both CRCs must be computed by CFE_ES_CalculateCRC() with an InputCRC of zero.
+**
+** \param[in]   CrcA        The CRC of the first block.
+**
+** \param[in]   CrcB        The CRC of the second block.
+**
+** \param[in]   LengthB     The number of bytes in the second block.
+**
+** \param[in]   TypeCRC     One of the following CRC algorithm selections defined in CFE_ES_CrcType_Enum_t
+**
+** \return The CRC of the first block followed by the second block.
+**         If the TypeCRC is unimplemented will return 0.
+**
+******************************************************************************/
+uint32 CFE_ES_CombineCRC(uint32 CrcA, uint32 CrcB, size_t LengthB, CFE_ES_CrcType_Enum_t TypeCRC);
+
+/*****************************************************************************/
+/**
+** \brief Calculate a CRC on a block of memory, keeping the CRC of each chunk
+**
+** \par Description
+**        This routine divides a block of memory into at most #CFE_MISSION_ES_CRC_MAX_CHUNKS
+**        chunks, and keeps the CRC of each chunk in the given state.  After a part of the
+**        block has been changed, CFE_ES_ChunkedCRCUpdate() can then compute the CRC of the
+**        block again by computing the CRC of only the chunks that changed.
+**
+** \par Assumptions, External Events, and Notes:
+**        The result is the same as that of CFE_ES_CalculateCRC() with an InputCRC of zero.
+**
+** \param[out]  ChunkedCRC  Pointer to the state to initialize @nonnull
+**
+** \param[in]   DataPtr     Pointer to the base of the memory block.
+**
+** \param[in]   DataLength  The number of bytes in the memory block.
+**
+** \param[in]   TypeCRC     One of the following CRC algorithm selections defined in CFE_ES_CrcType_Enum_t
+**
+** \return The result of the CRC calculation on the specified memory block.
+**         If the TypeCRC is unimplemented will return 0.
+**         If ChunkedCRC or DataPtr is null or DataLength is 0, will return 0 and
+**         the state is not initialized.
+**
+******************************************************************************/
+uint32 CFE_ES_ChunkedCRCInit(CFE_ES_ChunkedCRC_t *ChunkedCRC, const void *DataPtr, size_t DataLength,
+                             CFE_ES_CrcType_Enum_t TypeCRC);
+
+/*****************************************************************************/
+/**
+** \brief Update the CRC of a block of memory after a part of it has changed
+**
+** \par Description
+**        This routine computes the CRC of the chunks of the block that overlap the
+**        changed range again, and combines the CRC of all chunks into the CRC of the
+**        whole block.  The time it takes depends on the size of the change, and not
+**        on the size of the block.
+**
+** \par Assumptions, External Events, and Notes:
+**        The state must have been initialized by CFE_ES_ChunkedCRCInit() for the same
+**        block, and every change to the block since then must have been reported by
+**        this routine.  A range that extends past the end of the block is limited to
+**        the end of the block.
+**
+** \param[in, out] ChunkedCRC  Pointer to the state of the block @nonnull
+**
+** \param[in]   DataPtr     Pointer to the base of the memory block (not the changed range).
+**
+** \param[in]   Offset      The offset of the changed range within the block.
+**
+** \param[in]   Length      The number of bytes in the changed range.
+**
+** \return The CRC of the whole block.
+**         If ChunkedCRC or DataPtr is null or the state is not initialized, will return 0.
+**
+******************************************************************************/
+uint32 CFE_ES_ChunkedCRCUpdate(CFE_ES_ChunkedCRC_t *ChunkedCRC, const void *DataPtr, size_t Offset, size_t Length);
+
 /*****************************************************************************/
 /**
 ** \ingroup CFEAPIESMisc
@@ -1152,6 +1238,103 @@ CFE_Status_t CFE_ES_GetCDSBlockName(char *BlockName, CFE_ES_CDSHandle_t BlockId,
 */
 CFE_Status_t CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, const void *DataToCopy);
 
+/*****************************************************************************/
+/**
+** \brief Save a range of a block of data in the Critical Data Store (CDS)
+**
+** \par Description
+**        This routine copies a specified block of memory into a range of a block in the Critical
+**        Data Store that had been previously registered via #CFE_ES_RegisterCDS.  Only the range
+**        is written to the CDS, along with the updated CRC of the whole block, so the rest of the
+**        block keeps its contents.  For an application that changes a small part of a large block,
+**        this writes much less to the CDS than #CFE_ES_CopyToCDS.
+**
+** \par Assumptions, External Events, and Notes:
+**        The old contents of the range are read from the CDS to update the CRC of the block.
+**        If the block in the CDS does not have valid contents, such as a newly registered block,
+**        the whole block must be written with #CFE_ES_CopyToCDS first, otherwise a following
+**        #CFE_ES_RestoreFromCDS will report a CRC error.
+**
+** \param[in]   Handle       The handle of the CDS block that was previously obtained from #CFE_ES_RegisterCDS.
+**
+** \param[in]   Offset       The offset of the range within the CDS block.
+**
+** \param[in]   Size         The number of bytes in the range @nonzero.
+**
+** \param[in]   DataToCopy   A Pointer to the new contents of the range (not of the whole block) @nonnull.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID   \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_CDS_INVALID_SIZE           The range is empty or not within the CDS block.
+**
+** \sa #CFE_ES_CopyToCDS, #CFE_ES_RestoreFromCDS
+**
+*/
+CFE_Status_t CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, size_t Offset, size_t Size, const void *DataToCopy);
+
+/*****************************************************************************/
+/**
+** \brief Enable or disable write-behind mode of a block in the Critical Data Store (CDS)
+**
+** \par Description
+**        In write-behind mode, #CFE_ES_CopyToCDS and #CFE_ES_CopyToCDSRange only copy the data
+**        into a shadow of the block in RAM and return, without computing the CRC or writing to
+**        the CDS.  The ES background task writes the changed part of the shadow to the CDS at the
+**        rate configured by \c CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE, so all changes made within
+**        that period are written together.  This takes the time and the jitter of the CDS access
+**        out of the loop of the application.  #CFE_ES_RestoreFromCDS returns the contents of the
+**        shadow once it is valid.
+**
+**        Disabling write-behind mode writes any pending changes to the CDS first.
+**
+** \par Assumptions, External Events, and Notes:
+**        Changes that were not written to the CDS yet are lost by a reset, unless #CFE_ES_FlushCDS
+**        is called first.  ES does this for a processor reset commanded through #CFE_ES_ResetCFE,
+**        but not for a reset caused by an exception.  #CFE_ES_CopyToCDSRange writes to the CDS
+**        directly until the shadow is valid, which is after the whole block has been written
+**        with #CFE_ES_CopyToCDS or successfully read with #CFE_ES_RestoreFromCDS.
+**
+**        The mode is kept in RAM only, so it must be enabled again after a restart of the
+**        processor.  It is also reset when the block is registered again with another size.
+**
+** \param[in]   Handle       The handle of the CDS block that was previously obtained from #CFE_ES_RegisterCDS.
+**
+** \param[in]   WriteBehind  true to enable write-behind mode, false to disable it.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID   \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_CDS_INSUFFICIENT_MEMORY    There is not enough memory left for the shadow of the block.
+** \retval #CFE_ES_CDS_ACCESS_ERROR           \copybrief CFE_ES_CDS_ACCESS_ERROR
+**
+** \sa #CFE_ES_CopyToCDS, #CFE_ES_FlushCDS
+**
+*/
+CFE_Status_t CFE_ES_SetCDSWriteBehind(CFE_ES_CDSHandle_t Handle, bool WriteBehind);
+
+/*****************************************************************************/
+/**
+** \brief Write all pending changes of CDS blocks in write-behind mode to the Critical Data Store
+**
+** \par Description
+**        This routine writes the changes of all blocks in write-behind mode that were not written
+**        to the CDS yet, and waits until they are written.  An application should call this before
+**        it exits or requests a reset, so its last changes are kept.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_CDS_ACCESS_ERROR           \copybrief CFE_ES_CDS_ACCESS_ERROR
+**
+** \sa #CFE_ES_SetCDSWriteBehind
+**
+*/
+CFE_Status_t CFE_ES_FlushCDS(void);
+
 /*****************************************************************************/
 /**
 ** \brief Recover a block of data from the Critical Data Store (CDS)
@@ -1308,6 +1491,46 @@ CFE_Status_t CFE_ES_PoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t
 CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
                                  const size_t *BlockSizes, bool UseMutex);
 
+/*****************************************************************************/
+/**
+** \brief Initializes a memory pool that splits and merges its blocks
+**
+** \par Description
+**        This routine initializes a pool of memory like #CFE_ES_PoolCreateEx, except that
+**        blocks are managed by the buddy system.  A block is taken from the smallest free
+**        block that fits, splitting larger blocks in halves as needed, and returned blocks
+**        are merged with their other half whenever both are free.  Unlike the other pools,
+**        memory used for many small buffers can later be reused for a large buffer.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The block sizes are rounded up to powers of two, including the block descriptor.
+**           The smallest and largest entries of \c BlockSizes only select the range of sizes,
+**           which must not span more than #CFE_PLATFORM_ES_POOL_MAX_BUCKETS powers of two.
+**        -# Every get and put of a buffer takes the mutex of the pool, if it has one.
+**        -# The free block and largest free block members of #CFE_ES_MemPoolStats_t show
+**           the fragmentation of this and any other pool.
+**
+** \param[out]  PoolID         A pointer to the variable the caller wishes to have the memory pool handle kept in
+**                             @nonnull.
+** \param[in]   MemPtr         A Pointer to the pool of memory created by the calling application @nonnull.
+** \param[in]   Size           The size of the pool of memory @nonzero.
+** \param[in]   NumBlockSizes  The number of different block sizes specified in the \c BlockSizes array.
+** \param[in]   BlockSizes     Pointer to an array of sizes, or NULL to use the default block sizes.
+** \param[in]   UseMutex       Flag indicating whether the new memory pool will be processing with mutex handling or
+**                             not. Valid parameter values are #CFE_ES_USE_MUTEX and #CFE_ES_NO_MUTEX
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_NO_RESOURCE_IDS_AVAILABLE  \copybrief CFE_ES_NO_RESOURCE_IDS_AVAILABLE
+** \retval #CFE_STATUS_EXTERNAL_RESOURCE_FAIL \covtest \copybrief CFE_STATUS_EXTERNAL_RESOURCE_FAIL
+**
+** \sa #CFE_ES_PoolCreateEx, #CFE_ES_GetPoolBuf, #CFE_ES_PutPoolBuf, #CFE_ES_GetMemPoolStats
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_PoolCreateBuddy(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                    const size_t *BlockSizes, bool UseMutex);
+
 /*****************************************************************************/
 /**
 ** \brief Deletes a memory pool that was previously created
@@ -1332,6 +1555,36 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
 ******************************************************************************/
 int32 CFE_ES_PoolDelete(CFE_ES_MemHandle_t PoolID);
 
+/*****************************************************************************/
+/**
+** \brief Enables per-task magazine caches for a memory pool
+**
+** \par Description
+**        After this call, each task keeps the buffers it returns to the pool with
+**        #CFE_ES_PutPoolBuf in small per-task caches ("magazines"), one for each
+**        block size it recently used, and #CFE_ES_GetPoolBuf takes buffers from
+**        these caches first.  Free buffers are exchanged between the caches and
+**        the shared pool in batches, so the pool mutex is taken only once per batch.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This should be called right after the pool is created, before it is
+**           used by any other task.
+**        -# Buffers held in the caches are reported as in use by #CFE_ES_GetMemPoolStats.
+**        -# The buffers cached by a task are returned to the pool when the task is deleted.
+**        -# At most #CFE_PLATFORM_ES_POOL_MAX_MAGAZINE_POOLS pools may have magazines.
+**
+** \param[in]   PoolID         The ID of the pool
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                      \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID  \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_NO_RESOURCE_IDS_AVAILABLE \copybrief CFE_ES_NO_RESOURCE_IDS_AVAILABLE
+**
+** \sa #CFE_ES_PoolCreateEx, #CFE_ES_GetPoolBuf, #CFE_ES_PutPoolBuf
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_PoolEnableMagazines(CFE_ES_MemHandle_t PoolID);
+
 /*****************************************************************************/
 /**
 ** \brief Gets a buffer from the memory pool created by #CFE_ES_PoolCreate or #CFE_ES_PoolCreateNoSem
@@ -86,7 +86,7 @@ typedef void *CFE_ES_StackPointer_t; /* aka osal_stackptr_t in proposed OSAL cha
 /**
  * \brief Checksum/CRC algorithm identifiers
  *
- * Currently only CFE_ES_CrcType_16_ARC is supported.
+ * Currently CFE_ES_CrcType_16_ARC and CFE_ES_CrcType_32C are supported.
  *
  * All defined CRC algorithms should include a check value, which is the accepted
  * result of computing the CRC across the fixed string "123456789"
@@ -112,11 +112,29 @@ typedef enum CFE_ES_CrcType_Enum
      */
     CFE_ES_CrcType_16_ARC = 1,
 
+    /**
+     * \brief Implementation of CRC-32C (Castagnoli)
+     *
+     * Uses the CRC-32C instructions of the CPU where the compiler targets
+     * a CPU that has them (SSE4.2 or ARMv8 CRC), and a software lookup
+     * table otherwise.  The initial value and final XOR are applied by the
+     * algorithm, so the result of a previous call can be passed as the
+     * input CRC to continue the computation over another block.
+     *
+     * \par
+     *   Polynomial: 0x1EDC6F41 <br>
+     *   Initialization: 0xFFFFFFFF <br>
+     *   Reflect Input/Output: true <br>
+     *   Check value: 0xe3069283 <br>
+     *   XorOut: 0xFFFFFFFF <br>
+     */
+    CFE_ES_CrcType_32C = 2,
+
     /**
      * Placeholder for end of normal enumeration list
      * This should reflect the number of algorithms defined.
      */
-    CFE_ES_CrcType_MAX = 2,
+    CFE_ES_CrcType_MAX = 3,
 
     /*
      * Backward compatibility values.
@@ -135,6 +153,28 @@ typedef enum CFE_ES_CrcType_Enum
 
 } CFE_ES_CrcType_Enum_t;
 
+/**
+ * \brief State of a CRC kept per chunk of a block of data
+ *
+ * Keeps the CRC of each chunk of a block, so that after a change to the
+ * block only the CRC of the changed chunks needs to be computed again.
+ * The CRC of the whole block is combined from the CRC of each chunk.
+ * See CFE_ES_ChunkedCRCInit() and CFE_ES_ChunkedCRCUpdate().
+ *
+ * The contents of this structure are managed by these functions, and an
+ * all zero structure is not initialized.
+ */
+typedef struct CFE_ES_ChunkedCRC
+{
+    CFE_ES_CrcType_Enum_t TypeCRC;    /**< CRC algorithm */
+    size_t                DataLength; /**< Length of the whole block */
+    size_t                ChunkSize;  /**< Length of each chunk, except the last which may be shorter */
+    uint32                NumChunks;  /**< Number of chunks, 0 if not initialized */
+    uint32                ChunkShift; /**< Operator to combine a CRC with the CRC of a full chunk */
+    uint32                LastShift;  /**< Operator to combine a CRC with the CRC of the last chunk */
+    uint32                ChunkCRC[CFE_MISSION_ES_CRC_MAX_CHUNKS]; /**< CRC of each chunk */
+} CFE_ES_ChunkedCRC_t;
+
 /**
  * \brief Pool Alignment
  *
@@ -460,7 +460,9 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
 **                          used as a read-only pointer (in systems with an MMU,
 **                          writes to this pointer may cause a memory protection fault).
 **                          The *BufPtr is valid only until the next call to
-**                          CFE_SB_ReceiveBuffer for the same pipe.
+**                          CFE_SB_ReceiveBuffer for the same pipe, unless the pipe
+**                          has the #CFE_SB_PIPEOPTS_HOLDBUFFERS option set, in which
+**                          case it is valid until passed to CFE_SB_ReleaseReceivedBuffer.
 **
 ** \param[in]  PipeId       The pipe ID of the pipe containing the message to be obtained.
 **
@@ -475,6 +477,7 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
 ** \retval #CFE_SB_TIME_OUT     \copybrief CFE_SB_TIME_OUT
 ** \retval #CFE_SB_PIPE_RD_ERR  \covtest \copybrief CFE_SB_PIPE_RD_ERR
 ** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
+** \retval #CFE_SB_HOLD_LIMIT_MET \copybrief CFE_SB_HOLD_LIMIT_MET
 **/
 CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut);
 
@@ -514,6 +517,64 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
 **/
 CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize);
 
+/*****************************************************************************/
+/**
+** \brief Get a chained buffer pointer to use for "zero copy" SB sends of large messages.
+**
+** \par Description
+**          This routine is similar to CFE_SB_AllocateMessageBuffer(), but permits
+**          messages larger than #CFE_MISSION_SB_MAX_SB_MSG_SIZE.  The returned buffer
+**          is the head of the message, and holds the message header along with up to
+**          #CFE_MISSION_SB_MAX_SB_MSG_SIZE bytes of content.  The remaining content is
+**          held in continuation segments which are accessed with CFE_SB_GetMessageSegment().
+**
+**          The entire chain is routed once by CFE_SB_TransmitBuffer() and delivered to
+**          each recipient as a single reference, which avoids splitting large products
+**          into many individually routed packets.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# The size in the message header describes the head buffer only, recipients
+**             that are not aware of chaining will see just the head.
+**          -# The same ownership rules as CFE_SB_AllocateMessageBuffer() apply, the buffer
+**             is released by CFE_SB_ReleaseMessageBuffer() or CFE_SB_TransmitBuffer().
+**          -# If MsgSize is not greater than #CFE_MISSION_SB_MAX_SB_MSG_SIZE this is identical
+**             to CFE_SB_AllocateMessageBuffer() and no segments are allocated.
+**
+** \param[in]  MsgSize  The total size of the message the caller wants, including the
+**                      SB message header and all continuation segments.
+**
+** \return A pointer to the head buffer that message data can be written to
+**         for use with CFE_SB_TransmitBuffer(), or NULL on failure.
+**/
+CFE_SB_Buffer_t *CFE_SB_AllocateChainedMessageBuffer(size_t MsgSize);
+
+/*****************************************************************************/
+/**
+** \brief Get a continuation segment of a chained message.
+**
+** \par Description
+**          This routine obtains the location and size of a continuation segment of a
+**          message buffer from CFE_SB_AllocateChainedMessageBuffer() or CFE_SB_ReceiveBuffer().
+**          Segments are numbered from 0, so recipients may iterate through all of the
+**          content by incrementing SegmentNum until this returns #CFE_SB_NO_MESSAGE.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# The segments are only valid for as long as the caller holds the head buffer.
+**          -# Buffers which are not chained have no continuation segments.
+**
+** \param[in]  BufPtr       A pointer to the head buffer @nonnull.
+** \param[in]  SegmentNum   Index of the continuation segment
+** \param[out] SegmentPtr   Set to the location of the segment content @nonnull
+** \param[out] SegmentSize  Set to the size of the segment content @nonnull
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_NO_MESSAGE   No segment with the given index
+**/
+CFE_Status_t CFE_SB_GetMessageSegment(CFE_SB_Buffer_t *BufPtr, uint32 SegmentNum, void **SegmentPtr,
+                                      size_t *SegmentSize);
+
 /*****************************************************************************/
 /**
 ** \brief Release an unused "zero copy" buffer pointer.
@@ -538,6 +599,34 @@ CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize);
 **/
 CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr);
 
+/*****************************************************************************/
+/**
+** \brief Release a buffer held from a pipe.
+**
+** \par Description
+**          This routine releases a buffer that was obtained with CFE_SB_ReceiveBuffer()
+**          from a pipe that has the #CFE_SB_PIPEOPTS_HOLDBUFFERS option set.  Such
+**          buffers are not released by the next receive, so an application can keep
+**          several messages at once (e.g. to reorder or correlate them) without
+**          copying them out of the software bus.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Buffers may be released in any order, but only by the app that owns the pipe.
+**          -# Up to #CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS buffers may be held per pipe,
+**             after which CFE_SB_ReceiveBuffer() returns #CFE_SB_HOLD_LIMIT_MET.
+**          -# Any buffers still held are released when the pipe is deleted.
+**
+** \param[in]  BufPtr  A pointer to the SB internal buffer @nonnull.  This must be a
+**                     pointer returned by a call to CFE_SB_ReceiveBuffer() on a pipe
+**                     with the #CFE_SB_PIPEOPTS_HOLDBUFFERS option set.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT   \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_BUFFER_INVALID \copybrief CFE_SB_BUFFER_INVALID
+**/
+CFE_Status_t CFE_SB_ReleaseReceivedBuffer(CFE_SB_Buffer_t *BufPtr);
+
 /*****************************************************************************/
 /**
 ** \brief Transmit a buffer
@@ -130,6 +130,8 @@
  */
 #define CFE_SB_PIPEOPTS_IGNOREMINE \
     0x00000001 /**< \brief Messages sent by the app that owns this pipe will not be sent to this pipe. */
+#define CFE_SB_PIPEOPTS_HOLDBUFFERS \
+    0x00000002 /**< \brief Received buffers are held until released with CFE_SB_ReleaseReceivedBuffer(). */
 /**@}*/
 
 #define CFE_SB_DEFAULT_QOS ((CFE_SB_Qos_t) {0}) /**< \brief Default Qos macro */
@@ -462,6 +462,41 @@ CFE_Status_t CFE_TBL_DumpToBuffer(CFE_TBL_Handle_t TblHandle);
 **
 ******************************************************************************/
 CFE_Status_t CFE_TBL_Modified(CFE_TBL_Handle_t TblHandle);
+
+/*****************************************************************************/
+/**
+** \brief Notify cFE Table Services that a range of the table contents has been modified by the Application
+**
+** \par Description
+**        This API is the same as #CFE_TBL_Modified, except that it also reports which bytes
+**        of the table have been modified.  Table Services then only recomputes the CRC of
+**        the part of the table that contains the modified range, so for a large table
+**        with a small change this is much less work than #CFE_TBL_Modified.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The CRC is only correct if every modification of the table contents by the
+**           Application is reported, using this API or #CFE_TBL_Modified.  Modifications
+**           in multiple ranges may be reported by calling this API for each range.
+**        -# If the range extends past the end of the table, it is limited to the end
+**           of the table.
+**
+** \param[in]  TblHandle      Handle of Table that was modified.
+**
+** \param[in]  Offset         Offset, in bytes, of the first modified byte of the table.
+**
+** \param[in]  Size           Number of modified bytes.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                     \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_TBL_ERR_NO_ACCESS           \copybrief CFE_TBL_ERR_NO_ACCESS
+** \retval #CFE_TBL_ERR_INVALID_HANDLE      \copybrief CFE_TBL_ERR_INVALID_HANDLE
+** \retval #CFE_TBL_ERR_INVALID_SIZE        \copybrief CFE_TBL_ERR_INVALID_SIZE
+**
+** \sa #CFE_TBL_Modified, #CFE_TBL_Manage
+**
+******************************************************************************/
+CFE_Status_t CFE_TBL_ModifiedRange(CFE_TBL_Handle_t TblHandle, size_t Offset, size_t Size);
 /**@}*/
 
 /** @defgroup CFEAPITBLAccess cFE Access Table Content APIs
@@ -92,6 +92,64 @@ uint32 CFE_ES_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputC
     return UT_GenStub_GetReturnValue(CFE_ES_CalculateCRC, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_ChunkedCRCInit()
+ * ----------------------------------------------------
+ */
+uint32 CFE_ES_ChunkedCRCInit(CFE_ES_ChunkedCRC_t *ChunkedCRC, const void *DataPtr, size_t DataLength,
+                             CFE_ES_CrcType_Enum_t TypeCRC)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_ChunkedCRCInit, uint32);
+
+    UT_GenStub_AddParam(CFE_ES_ChunkedCRCInit, CFE_ES_ChunkedCRC_t *, ChunkedCRC);
+    UT_GenStub_AddParam(CFE_ES_ChunkedCRCInit, const void *, DataPtr);
+    UT_GenStub_AddParam(CFE_ES_ChunkedCRCInit, size_t, DataLength);
+    UT_GenStub_AddParam(CFE_ES_ChunkedCRCInit, CFE_ES_CrcType_Enum_t, TypeCRC);
+
+    UT_GenStub_Execute(CFE_ES_ChunkedCRCInit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_ChunkedCRCInit, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_ChunkedCRCUpdate()
+ * ----------------------------------------------------
+ */
+uint32 CFE_ES_ChunkedCRCUpdate(CFE_ES_ChunkedCRC_t *ChunkedCRC, const void *DataPtr, size_t Offset, size_t Length)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_ChunkedCRCUpdate, uint32);
+
+    UT_GenStub_AddParam(CFE_ES_ChunkedCRCUpdate, CFE_ES_ChunkedCRC_t *, ChunkedCRC);
+    UT_GenStub_AddParam(CFE_ES_ChunkedCRCUpdate, const void *, DataPtr);
+    UT_GenStub_AddParam(CFE_ES_ChunkedCRCUpdate, size_t, Offset);
+    UT_GenStub_AddParam(CFE_ES_ChunkedCRCUpdate, size_t, Length);
+
+    UT_GenStub_Execute(CFE_ES_ChunkedCRCUpdate, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_ChunkedCRCUpdate, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_CombineCRC()
+ * ----------------------------------------------------
+ */
+uint32 CFE_ES_CombineCRC(uint32 CrcA, uint32 CrcB, size_t LengthB, CFE_ES_CrcType_Enum_t TypeCRC)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_CombineCRC, uint32);
+
+    UT_GenStub_AddParam(CFE_ES_CombineCRC, uint32, CrcA);
+    UT_GenStub_AddParam(CFE_ES_CombineCRC, uint32, CrcB);
+    UT_GenStub_AddParam(CFE_ES_CombineCRC, size_t, LengthB);
+    UT_GenStub_AddParam(CFE_ES_CombineCRC, CFE_ES_CrcType_Enum_t, TypeCRC);
+
+    UT_GenStub_Execute(CFE_ES_CombineCRC, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_CombineCRC, uint32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_CopyToCDS()
@@ -109,6 +167,25 @@ CFE_Status_t CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, const void *DataToCopy)
     return UT_GenStub_GetReturnValue(CFE_ES_CopyToCDS, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_CopyToCDSRange()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, size_t Offset, size_t Size, const void *DataToCopy)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_CopyToCDSRange, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_CopyToCDSRange, CFE_ES_CDSHandle_t, Handle);
+    UT_GenStub_AddParam(CFE_ES_CopyToCDSRange, size_t, Offset);
+    UT_GenStub_AddParam(CFE_ES_CopyToCDSRange, size_t, Size);
+    UT_GenStub_AddParam(CFE_ES_CopyToCDSRange, const void *, DataToCopy);
+
+    UT_GenStub_Execute(CFE_ES_CopyToCDSRange, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_CopyToCDSRange, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_CounterID_ToIndex()
@@ -221,6 +298,20 @@ void CFE_ES_ExitChildTask(void)
     UT_GenStub_Execute(CFE_ES_ExitChildTask, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_FlushCDS()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_FlushCDS(void)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_FlushCDS, CFE_Status_t);
+
+    UT_GenStub_Execute(CFE_ES_FlushCDS, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_FlushCDS, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_GetAppID()
@@ -671,6 +762,28 @@ CFE_Status_t CFE_ES_PoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t
     return UT_GenStub_GetReturnValue(CFE_ES_PoolCreate, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_PoolCreateBuddy()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_PoolCreateBuddy(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                    const size_t *BlockSizes, bool UseMutex)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_PoolCreateBuddy, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_PoolCreateBuddy, CFE_ES_MemHandle_t *, PoolID);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateBuddy, void *, MemPtr);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateBuddy, size_t, Size);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateBuddy, uint16, NumBlockSizes);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateBuddy, const size_t *, BlockSizes);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateBuddy, bool, UseMutex);
+
+    UT_GenStub_Execute(CFE_ES_PoolCreateBuddy, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_PoolCreateBuddy, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_PoolCreateEx()
@@ -727,6 +840,22 @@ int32 CFE_ES_PoolDelete(CFE_ES_MemHandle_t PoolID)
     return UT_GenStub_GetReturnValue(CFE_ES_PoolDelete, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_PoolEnableMagazines()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_PoolEnableMagazines(CFE_ES_MemHandle_t PoolID)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_PoolEnableMagazines, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_PoolEnableMagazines, CFE_ES_MemHandle_t, PoolID);
+
+    UT_GenStub_Execute(CFE_ES_PoolEnableMagazines, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_PoolEnableMagazines, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_ProcessAsyncEvent()
@@ -872,6 +1001,23 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
     return UT_GenStub_GetReturnValue(CFE_ES_RunLoop, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_SetCDSWriteBehind()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_SetCDSWriteBehind(CFE_ES_CDSHandle_t Handle, bool WriteBehind)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_SetCDSWriteBehind, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_SetCDSWriteBehind, CFE_ES_CDSHandle_t, Handle);
+    UT_GenStub_AddParam(CFE_ES_SetCDSWriteBehind, bool, WriteBehind);
+
+    UT_GenStub_Execute(CFE_ES_SetCDSWriteBehind, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_SetCDSWriteBehind, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_SetGenCount()
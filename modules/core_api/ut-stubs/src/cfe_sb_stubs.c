@@ -63,6 +63,22 @@ CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
     return UT_GenStub_GetReturnValue(CFE_SB_AllocateMessageBuffer, CFE_SB_Buffer_t *);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_AllocateChainedMessageBuffer()
+ * ----------------------------------------------------
+ */
+CFE_SB_Buffer_t *CFE_SB_AllocateChainedMessageBuffer(size_t MsgSize)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_AllocateChainedMessageBuffer, CFE_SB_Buffer_t *);
+
+    UT_GenStub_AddParam(CFE_SB_AllocateChainedMessageBuffer, size_t, MsgSize);
+
+    UT_GenStub_Execute(CFE_SB_AllocateChainedMessageBuffer, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_AllocateChainedMessageBuffer, CFE_SB_Buffer_t *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_CmdTopicIdToMsgId()
@@ -114,6 +130,26 @@ CFE_Status_t CFE_SB_DeletePipe(CFE_SB_PipeId_t PipeId)
     return UT_GenStub_GetReturnValue(CFE_SB_DeletePipe, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_GetMessageSegment()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_GetMessageSegment(CFE_SB_Buffer_t *BufPtr, uint32 SegmentNum, void **SegmentPtr,
+                                      size_t *SegmentSize)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_GetMessageSegment, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_GetMessageSegment, CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(CFE_SB_GetMessageSegment, uint32, SegmentNum);
+    UT_GenStub_AddParam(CFE_SB_GetMessageSegment, void **, SegmentPtr);
+    UT_GenStub_AddParam(CFE_SB_GetMessageSegment, size_t *, SegmentSize);
+
+    UT_GenStub_Execute(CFE_SB_GetMessageSegment, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_GetMessageSegment, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_GetPipeIdByName()
@@ -370,6 +406,22 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr)
     return UT_GenStub_GetReturnValue(CFE_SB_ReleaseMessageBuffer, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_ReleaseReceivedBuffer()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_ReleaseReceivedBuffer(CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_ReleaseReceivedBuffer, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_ReleaseReceivedBuffer, CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(CFE_SB_ReleaseReceivedBuffer, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_ReleaseReceivedBuffer, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_SetPipeOpts()
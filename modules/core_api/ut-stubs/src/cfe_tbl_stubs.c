@@ -161,6 +161,24 @@ CFE_Status_t CFE_TBL_Modified(CFE_TBL_Handle_t TblHandle)
     return UT_GenStub_GetReturnValue(CFE_TBL_Modified, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TBL_ModifiedRange()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TBL_ModifiedRange(CFE_TBL_Handle_t TblHandle, size_t Offset, size_t Size)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TBL_ModifiedRange, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TBL_ModifiedRange, CFE_TBL_Handle_t, TblHandle);
+    UT_GenStub_AddParam(CFE_TBL_ModifiedRange, size_t, Offset);
+    UT_GenStub_AddParam(CFE_TBL_ModifiedRange, size_t, Size);
+
+    UT_GenStub_Execute(CFE_TBL_ModifiedRange, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TBL_ModifiedRange, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TBL_NotifyByMessage()
@@ -67,4 +67,22 @@
 */
 #define CFE_PLATFORM_CORE_MAX_STARTUP_MSEC 30000
 
+/** \cfeescfg Enable performance markers inside the core services
+**
+**  \par Description:
+**      When set to 1, the core services log performance markers around their
+**      most frequently used API calls (CFE_SB_TransmitMsg, CFE_SB_ReceiveBuffer,
+**      CFE_EVS_SendEvent, CFE_TBL_GetAddress and CFE_ES_GetPoolBuf) and around
+**      the waits for their internal locks.  The marker IDs are the reserved core
+**      IDs 12-20, and like any other marker they are only recorded when selected
+**      by the performance filter mask.
+**
+**      When set to 0, the markers are removed from the build entirely.
+**
+**  \par Limits:
+**       Must be 0 or 1.
+**
+*/
+#define CFE_PLATFORM_CORE_PERF_MARKERS 1
+
 #endif
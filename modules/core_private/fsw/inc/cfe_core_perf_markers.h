@@ -0,0 +1,85 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Performance markers used inside the core services
+ *
+ * These wrap CFE_ES_PerfLogAdd() so the markers placed in the core service hot
+ * paths can be removed from the build by setting CFE_PLATFORM_CORE_PERF_MARKERS
+ * to 0.  When compiled in, they are subject to the normal filter mask like any
+ * other marker.
+ */
+
+#ifndef CFE_CORE_PERF_MARKERS_H
+#define CFE_CORE_PERF_MARKERS_H
+
+#include "cfe_es.h"
+#include "cfe_perfids.h"
+#include "cfe_platform_cfg.h" /* Required for CFE_PLATFORM_CORE_PERF_MARKERS */
+
+/*
+ * Defaults for mission perf ID headers that predate the core service markers.
+ * These match the values reserved in the sample cfe_perfids.h.
+ */
+#ifndef CFE_MISSION_SB_TRANSMIT_PERF_ID
+#define CFE_MISSION_SB_TRANSMIT_PERF_ID 12 /**< \brief Performance ID for CFE_SB_TransmitMsg */
+#endif
+
+#ifndef CFE_MISSION_SB_RECEIVE_PERF_ID
+#define CFE_MISSION_SB_RECEIVE_PERF_ID 13 /**< \brief Performance ID for CFE_SB_ReceiveBuffer */
+#endif
+
+#ifndef CFE_MISSION_SB_LOCK_PERF_ID
+#define CFE_MISSION_SB_LOCK_PERF_ID 14 /**< \brief Performance ID for SB shared data lock wait */
+#endif
+
+#ifndef CFE_MISSION_EVS_SENDEVENT_PERF_ID
+#define CFE_MISSION_EVS_SENDEVENT_PERF_ID 15 /**< \brief Performance ID for CFE_EVS_SendEvent */
+#endif
+
+#ifndef CFE_MISSION_EVS_LOCK_PERF_ID
+#define CFE_MISSION_EVS_LOCK_PERF_ID 16 /**< \brief Performance ID for EVS shared data lock wait */
+#endif
+
+#ifndef CFE_MISSION_TBL_GETADDRESS_PERF_ID
+#define CFE_MISSION_TBL_GETADDRESS_PERF_ID 17 /**< \brief Performance ID for CFE_TBL_GetAddress */
+#endif
+
+#ifndef CFE_MISSION_TBL_LOCK_PERF_ID
+#define CFE_MISSION_TBL_LOCK_PERF_ID 18 /**< \brief Performance ID for TBL registry lock wait */
+#endif
+
+#ifndef CFE_MISSION_ES_GETPOOLBUF_PERF_ID
+#define CFE_MISSION_ES_GETPOOLBUF_PERF_ID 19 /**< \brief Performance ID for CFE_ES_GetPoolBuf */
+#endif
+
+#ifndef CFE_MISSION_ES_POOL_LOCK_PERF_ID
+#define CFE_MISSION_ES_POOL_LOCK_PERF_ID 20 /**< \brief Performance ID for ES memory pool lock wait */
+#endif
+
+#if (CFE_PLATFORM_CORE_PERF_MARKERS != 0)
+#define CFE_CORE_PERF_ENTRY(id) CFE_ES_PerfLogEntry(id)
+#define CFE_CORE_PERF_EXIT(id)  CFE_ES_PerfLogExit(id)
+#else
+#define CFE_CORE_PERF_ENTRY(id) ((void)0)
+#define CFE_CORE_PERF_EXIT(id)  ((void)0)
+#endif
+
+#endif /* CFE_CORE_PERF_MARKERS_H */
@@ -35,6 +35,23 @@
 
 #include "common_types.h"
 #include "cfe_es_extern_typedefs.h"
+#include "cfe_es_lockprof_typedef.h"
+#include "cfe_platform_cfg.h" /* Required for CFE_PLATFORM_ES_LOCK_PROFILE */
+
+/*
+ * Hooks for the lock profiler, placed in the lock/unlock functions of the
+ * profiled core locks.  These compile to nothing unless the profiler is
+ * enabled with CFE_PLATFORM_ES_LOCK_PROFILE.
+ */
+#if (CFE_PLATFORM_ES_LOCK_PROFILE != 0)
+#define CFE_ES_LOCKPROF_BEGIN(StampPtr)                      CFE_ES_LockProfileBegin(StampPtr)
+#define CFE_ES_LOCKPROF_ACQUIRED(Lock, Func, Line, StampPtr) CFE_ES_LockProfileAcquired(Lock, Func, Line, StampPtr)
+#define CFE_ES_LOCKPROF_RELEASED(Lock)                       CFE_ES_LockProfileReleased(Lock)
+#else
+#define CFE_ES_LOCKPROF_BEGIN(StampPtr)                      ((void)(StampPtr))
+#define CFE_ES_LOCKPROF_ACQUIRED(Lock, Func, Line, StampPtr) ((void)(StampPtr))
+#define CFE_ES_LOCKPROF_RELEASED(Lock)                       ((void)0)
+#endif
 
 /*
  * The internal APIs prototyped within this block are only intended to be invoked from
@@ -135,6 +152,55 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
 ******************************************************************************/
 int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices);
 
+/*****************************************************************************/
+/**
+** \brief Samples the timebase before waiting for a profiled lock
+**
+** \par Assumptions, External Events, and Notes:
+**        Normally invoked through #CFE_ES_LOCKPROF_BEGIN, just before the
+**        lock is taken.
+**
+** \param[out] Stamp   Buffer to hold the timebase value, passed to CFE_ES_LockProfileAcquired()
+**
+******************************************************************************/
+void CFE_ES_LockProfileBegin(CFE_ES_LockProfileStamp_t *Stamp);
+
+/*****************************************************************************/
+/**
+** \brief Records the acquisition of a profiled lock
+**
+** \par Description
+**        Counts the acquisition against the call site and records the time
+**        spent waiting since CFE_ES_LockProfileBegin() was called.  The time
+**        of the acquisition is kept so that CFE_ES_LockProfileReleased() can
+**        record how long the lock was held.
+**
+** \par Assumptions, External Events, and Notes:
+**        Must only be called after the lock was successfully taken, and before
+**        it is given back.  The profile data of each lock is only modified by
+**        the task holding that lock, so no other locking is needed.
+**
+** \param[in]  LockId        The lock that was taken
+** \param[in]  FunctionName  Name of the calling function, must be a static string, may be NULL
+** \param[in]  LineNumber    Line number of the caller, 0 if not known
+** \param[in]  Stamp         Timebase value from CFE_ES_LockProfileBegin()
+**
+******************************************************************************/
+void CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_t LockId, const char *FunctionName, int32 LineNumber,
+                                const CFE_ES_LockProfileStamp_t *Stamp);
+
+/*****************************************************************************/
+/**
+** \brief Records the release of a profiled lock
+**
+** \par Assumptions, External Events, and Notes:
+**        Must be called before the lock is given back.
+**
+** \param[in]  LockId        The lock that is about to be released
+**
+******************************************************************************/
+void CFE_ES_LockProfileReleased(CFE_ES_LockProfileId_t LockId);
+
 /**@}*/
 
 #endif /* CFE_ES_CORE_INTERNAL_H */
@@ -0,0 +1,91 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Definition of the lock profiler types.
+ * These are referenced by every CFE core app that owns a profiled lock, and
+ * the file entry is the record format of the lock profile file.
+ */
+
+#ifndef CFE_ES_LOCKPROF_TYPEDEF_H
+#define CFE_ES_LOCKPROF_TYPEDEF_H
+
+#include "common_types.h"
+
+/*
+ * Number of histogram bins for the wait and hold times.
+ *
+ * Bin 0 counts durations of 0 ticks, and bin N counts durations of
+ * 2^(N-1) up to 2^N - 1 timebase ticks.  The last bin also counts
+ * everything longer.
+ */
+#define CFE_ES_LOCKPROF_HIST_BINS 32
+
+/*
+ * Maximum length of the function name of a call site in the file,
+ * including the terminator.  Longer names are truncated.
+ */
+#define CFE_ES_LOCKPROF_FUNC_NAME_LEN 48
+
+/*
+** Identifies the core locks that may be profiled
+**
+** The values are written to the lock profile file.
+*/
+typedef enum CFE_ES_LockProfileId
+{
+    CFE_ES_LockProfileId_ES_SHARED_DATA = 0, /* ES shared data, CFE_ES_LockSharedData() */
+    CFE_ES_LockProfileId_SB_SHARED_DATA = 1, /* SB shared data, CFE_SB_LockSharedData() */
+    CFE_ES_LockProfileId_TBL_REGISTRY   = 2, /* TBL registry, CFE_TBL_LockRegistry() */
+    CFE_ES_LockProfileId_FS_SHARED_DATA = 3, /* FS shared data, CFE_FS_LockSharedData() */
+    CFE_ES_LockProfileId_MAX
+} CFE_ES_LockProfileId_t;
+
+/*
+** Timebase value sampled before waiting for a profiled lock
+*/
+typedef struct
+{
+    uint32 Upper32;
+    uint32 Lower32;
+} CFE_ES_LockProfileStamp_t;
+
+/*
+** Lock Profile File Structure
+**
+** One entry is written for each call site of a profiled lock.  All times are
+** in timebase ticks, and TimerTicksPerSecond gives the conversion to seconds.
+*/
+typedef struct
+{
+    uint32 LockId;                                      /* CFE_ES_LockProfileId_t of the lock */
+    uint32 LineNumber;                                  /* Line of the call site, 0 if not known */
+    char   FunctionName[CFE_ES_LOCKPROF_FUNC_NAME_LEN]; /* Function of the call site */
+    uint32 TimerTicksPerSecond;                         /* Timebase rate */
+    uint32 Count;                                       /* Number of acquisitions */
+    uint32 MaxWaitTicks;                                /* Longest wait for the lock */
+    uint32 MaxHoldTicks;                                /* Longest time the lock was held */
+    uint64 TotalWaitTicks;                              /* Sum of all waits */
+    uint64 TotalHoldTicks;                              /* Sum of all hold times */
+    uint32 WaitHistogram[CFE_ES_LOCKPROF_HIST_BINS];    /* Distribution of the waits */
+    uint32 HoldHistogram[CFE_ES_LOCKPROF_HIST_BINS];    /* Distribution of the hold times */
+} CFE_ES_LockProfile_FileEntry_t;
+
+#endif /* CFE_ES_LOCKPROF_TYPEDEF_H */
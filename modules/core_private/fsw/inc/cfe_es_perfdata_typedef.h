@@ -31,6 +31,35 @@
 
 #define CFE_ES_PERF_32BIT_WORDS_IN_MASK ((CFE_MISSION_ES_PERF_MAX_IDS) / 32)
 
+/* share of the performance data buffer for each task */
+#define CFE_ES_PERF_TASK_BUFFER_SHARE (CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS)
+
+/*
+ * number of entries in each per-task buffer, the share rounded down to a power of two.
+ * The entry counters are free running and wrap at 2^32, which keeps the slot they
+ * select continuous across the wrap.
+ */
+#define CFE_ES_PERF_TASK_BUFFER_SIZE                         \
+    ((CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x1000000) ? 0x1000000 \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x800000) ? 0x800000 \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x400000) ? 0x400000 \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x200000) ? 0x200000 \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x100000) ? 0x100000 \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x80000)  ? 0x80000  \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x40000)  ? 0x40000  \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x20000)  ? 0x20000  \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x10000)  ? 0x10000  \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x8000)   ? 0x8000   \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x4000)   ? 0x4000   \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x2000)   ? 0x2000   \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x1000)   ? 0x1000   \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x800)    ? 0x800    \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x400)    ? 0x400    \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x200)    ? 0x200    \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x100)    ? 0x100    \
+     : (CFE_ES_PERF_TASK_BUFFER_SHARE >= 0x80)     ? 0x80     \
+                                                   : 0x40)
+
 typedef struct
 {
     uint32 Data;
@@ -46,28 +75,49 @@ typedef struct
     uint32 TimerTicksPerSecond;
     uint32 TimerLow32Rollover;
     /*
-     * The "State" member is marked volatile to help
-     * ensure that an optimizing compiler does not rearrange
-     * or eliminate reads/writes of this value.  It is read
-     * outside of any locking to determine whether or not
-     * the performance log function is enabled.
+     * The "State" member is read outside of any locking to
+     * determine whether or not the performance log function
+     * is enabled, and any task may change it on a trigger.  It
+     * is only accessed through the cfe_es_atomic.h functions.
      */
-    volatile uint32 State;
-    uint32          Mode;
-    uint32          TriggerCount;
-    uint32          DataStart;
-    uint32          DataEnd;
-    uint32          DataCount;
-    uint32          InvalidMarkerReported;
-    uint32          FilterTriggerMaskSize;
-    uint32          FilterMask[CFE_ES_PERF_32BIT_WORDS_IN_MASK];
-    uint32          TriggerMask[CFE_ES_PERF_32BIT_WORDS_IN_MASK];
+    uint32 State;
+    uint32 Mode;
+    uint32 TriggerCount;
+    uint32 DataStart;
+    uint32 DataEnd;
+    uint32 DataCount;
+    uint32 InvalidMarkerReported;
+    uint32 FilterTriggerMaskSize;
+    uint32 FilterMask[CFE_ES_PERF_32BIT_WORDS_IN_MASK];
+    uint32 TriggerMask[CFE_ES_PERF_32BIT_WORDS_IN_MASK];
 } CFE_ES_PerfMetaData_t;
 
+/*
+ * Each task buffer has exactly one writer, the task that claimed it.
+ * The header is only reset by that task (or by the start command while
+ * no task is writing), so no lock is needed to record an entry.
+ *
+ * In the STREAM mode the ES background task is the only reader, and it is
+ * the only one that updates ReadCount.  The writer never overwrites entries
+ * that have not been read yet, it counts them as overflows instead.
+ */
+typedef struct
+{
+    uint32                 Generation;    /* collection run this buffer was claimed in */
+    uint32                 WriteCount;    /* entries written in this run, the newest are kept */
+    uint32                 ReadCount;     /* entries written out so far in the STREAM mode */
+    uint32                 TriggerCount;  /* entries written since this task saw the trigger */
+    uint32                 OverflowCount; /* entries dropped because the buffer was full in the STREAM mode */
+    uint32                 TaskId;        /* OSAL task ID of the writer, as an integer */
+    CFE_ES_PerfDataEntry_t Entries[CFE_ES_PERF_TASK_BUFFER_SIZE];
+} CFE_ES_PerfTaskBuffer_t;
+
 typedef struct
 {
-    CFE_ES_PerfMetaData_t  MetaData;
-    CFE_ES_PerfDataEntry_t DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE];
+    CFE_ES_PerfMetaData_t   MetaData;
+    uint32                  Generation;   /* incremented on every start command */
+    uint32                  BuffersInUse; /* number of task buffers claimed in this run */
+    CFE_ES_PerfTaskBuffer_t TaskBuffer[CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS];
 } CFE_ES_PerfData_t;
 
 #endif /* CFE_ES_PERFDATA_TYPEDEF_H */
@@ -0,0 +1,73 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Definition of the pool size profile types.
+ * The file entry is the record format of the pool profile file, which is
+ * also read by the pool sizing tool on the development host.
+ */
+
+#ifndef CFE_ES_POOLPROF_TYPEDEF_H
+#define CFE_ES_POOLPROF_TYPEDEF_H
+
+#include "common_types.h"
+
+/*
+ * Sizes below this are each counted in a bin of their own
+ */
+#define CFE_ES_POOLPROF_EXACT_SIZES 16
+
+/*
+ * Number of bins each power of two above CFE_ES_POOLPROF_EXACT_SIZES is
+ * divided into, so the width of a bin is at most 1/8 of its sizes.
+ */
+#define CFE_ES_POOLPROF_SUB_BINS 8
+
+/*
+ * Number of bins of requested sizes kept for each pool.
+ *
+ * With the values above these cover the sizes up to 256 KiB, and the last
+ * bin also counts all larger sizes.
+ */
+#define CFE_ES_POOLPROF_HIST_BINS 128
+
+/*
+** Pool Profile File Structure
+**
+** One entry is written for each size bin of a pool that has had requests.
+** The entries are in the byte order of the target that wrote them.  The
+** AlignSize field is never 0 and below 65536, which tells readers on
+** another host which byte order that was.
+*/
+typedef struct
+{
+    uint32 PoolId;       /* Handle of the pool, 0 for the CDS pool */
+    uint32 PoolSize;     /* Total size of the pool */
+    uint32 AlignSize;    /* Alignment of the blocks of the pool */
+    uint32 BinIndex;     /* Index of the size bin */
+    uint32 BinMinSize;   /* Smallest size counted in the bin */
+    uint32 MaxSize;      /* Largest size that was requested in the bin */
+    uint32 RequestCount; /* Number of requests that were given a block */
+    uint32 FailCount;    /* Number of requests that could not be given a block */
+    uint32 InUse;        /* Number of blocks of the bin currently allocated */
+    uint32 PeakInUse;    /* Highest number of blocks of the bin allocated at once */
+} CFE_ES_PoolProfile_FileEntry_t;
+
+#endif /* CFE_ES_POOLPROF_TYPEDEF_H */
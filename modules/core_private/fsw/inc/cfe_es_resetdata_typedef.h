@@ -54,6 +54,12 @@ typedef struct
 */
 typedef struct
 {
+    /*
+    ** System Log state, first so that the 64 bit atomic operations find it aligned
+    */
+    uint64 SystemLogState;     /* Write index, end index and appends in progress, updated atomically */
+    uint64 SystemLogCommitted; /* SystemLogState when the last append in progress was completed */
+
     /*
     ** Exception and Reset log declaration
     */
@@ -66,9 +72,8 @@ typedef struct
     ** System Log declaration
     */
     char   SystemLog[CFE_PLATFORM_ES_SYSTEM_LOG_SIZE];
-    size_t SystemLogWriteIdx;
-    size_t SystemLogEndIdx;
     uint32 SystemLogMode;
+    uint32 SystemLogFormat; /* Text or binary, see CFE_PLATFORM_ES_SYSLOG_BINARY_FORMAT */
     uint32 SystemLogEntryNum;
 
     /*
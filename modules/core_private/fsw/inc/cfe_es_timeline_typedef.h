@@ -0,0 +1,105 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Definition of the startup timeline types.
+ * The file entry is the record format of the startup timeline file.
+ */
+
+#ifndef CFE_ES_TIMELINE_TYPEDEF_H
+#define CFE_ES_TIMELINE_TYPEDEF_H
+
+#include "common_types.h"
+#include "cfe_mission_cfg.h" /* Required for CFE_MISSION_MAX_API_LEN */
+
+/*
+ * Number of times in each file entry, enough for either the
+ * boot phases or the milestones of a module
+ */
+#define CFE_ES_TIMELINE_MAX_TIMES 8
+
+/*
+ * Time written to the file for a phase or milestone that was not reached
+ */
+#define CFE_ES_TIMELINE_NOT_REACHED 0xFFFFFFFF
+
+/*
+** Identifies the boot phases, in the order they are entered
+**
+** The time of each phase is the time it is entered, so the duration of a
+** phase is the difference to the next one.  The values are written to the
+** startup timeline file.
+*/
+typedef enum CFE_ES_TimelinePhase
+{
+    CFE_ES_TimelinePhase_EARLY_INIT   = 0, /* CFE_ES_Main() entered, the reference of all times */
+    CFE_ES_TimelinePhase_FILESYSTEMS  = 1, /* Mounting the file systems */
+    CFE_ES_TimelinePhase_CORE_STARTUP = 2, /* Creating the core apps, CFE_ES_CreateObjects() */
+    CFE_ES_TimelinePhase_CORE_READY   = 3, /* Running the startup script, CFE_ES_StartApplications() */
+    CFE_ES_TimelinePhase_APPS_LOADED  = 4, /* Waiting for the apps to reach LATE_INIT */
+    CFE_ES_TimelinePhase_APPS_INIT    = 5, /* Waiting for the apps to reach RUNNING */
+    CFE_ES_TimelinePhase_OPERATIONAL  = 6, /* Startup complete */
+    CFE_ES_TimelinePhase_MAX
+} CFE_ES_TimelinePhase_t;
+
+/*
+** Identifies the milestones of an app or library during startup
+**
+** The values are written to the startup timeline file.
+*/
+typedef enum CFE_ES_TimelineMilestone
+{
+    CFE_ES_TimelineMilestone_CREATE    = 0, /* Table entry allocated, start of the load */
+    CFE_ES_TimelineMilestone_LOADED    = 1, /* Module file loaded and entry point found */
+    CFE_ES_TimelineMilestone_STARTED   = 2, /* Main task created, or library init function returned */
+    CFE_ES_TimelineMilestone_LATE_INIT = 3, /* App waits for the APPS_INIT system state */
+    CFE_ES_TimelineMilestone_RUNNING   = 4, /* App waits for the OPERATIONAL system state */
+    CFE_ES_TimelineMilestone_MAX
+} CFE_ES_TimelineMilestone_t;
+
+/*
+** Identifies the kind of a startup timeline file entry
+*/
+typedef enum CFE_ES_TimelineRecordType
+{
+    CFE_ES_TimelineRecordType_UNUSED   = 0, /* Not a valid entry */
+    CFE_ES_TimelineRecordType_PHASES   = 1, /* Boot phases, indexed by CFE_ES_TimelinePhase_t */
+    CFE_ES_TimelineRecordType_CORE_APP = 2, /* Core app, indexed by CFE_ES_TimelineMilestone_t */
+    CFE_ES_TimelineRecordType_APP      = 3, /* App from the startup script, as above */
+    CFE_ES_TimelineRecordType_LIB      = 4  /* Library from the startup script, as above */
+} CFE_ES_TimelineRecordType_t;
+
+/*
+** Startup Timeline File Structure
+**
+** The first entry holds the boot phases, followed by one entry for each app
+** and library created during startup.  The times are in microseconds since
+** CFE_ES_Main() was entered, or CFE_ES_TIMELINE_NOT_REACHED.  The entries are
+** in the byte order of the target that wrote them.
+*/
+typedef struct
+{
+    char   Name[CFE_MISSION_MAX_API_LEN];       /* Name of the app or library, "CFE_ES_Main" for the phases */
+    uint32 RecordType;                          /* CFE_ES_TimelineRecordType_t of the entry */
+    uint32 ResourceId;                          /* ID of the app or library, 0 for the phases */
+    uint32 TimeUsec[CFE_ES_TIMELINE_MAX_TIMES]; /* Time of each phase or milestone */
+} CFE_ES_Timeline_FileEntry_t;
+
+#endif /* CFE_ES_TIMELINE_TYPEDEF_H */
@@ -61,6 +61,28 @@ void CFE_SBR_Init(void);
  */
 CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr);
 
+/**
+ *  \brief Get the size of the next routing table extension
+ *
+ *  The routing table starts with #CFE_PLATFORM_SB_INITIAL_MSG_IDS entries and
+ *  may be extended in blocks of the same size up to #CFE_PLATFORM_SB_MAX_MSG_IDS.
+ *
+ *  \returns Size in bytes of the memory needed for the next extension, or
+ *           zero if the table still has free entries or is at its maximum size
+ */
+size_t CFE_SBR_GetExtensionSize(void);
+
+/**
+ *  \brief Extend the routing table using the supplied memory
+ *
+ *  The memory is initialized and then made available for new routes.  It must
+ *  be at least CFE_SBR_GetExtensionSize() bytes, remain valid for the life of
+ *  the routing table, and is never moved, so existing route entries stay put.
+ *
+ *  \param[in] MemPtr Memory for the extension
+ */
+void CFE_SBR_Extend(void *MemPtr);
+
 /**
  *  \brief Obtain the route id given a message id
  *
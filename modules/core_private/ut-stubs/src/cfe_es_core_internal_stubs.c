@@ -58,6 +58,46 @@ int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices)
     return UT_GenStub_GetReturnValue(CFE_ES_DeleteCDS, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_LockProfileAcquired()
+ * ----------------------------------------------------
+ */
+void CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_t LockId, const char *FunctionName, int32 LineNumber,
+                                const CFE_ES_LockProfileStamp_t *Stamp)
+{
+    UT_GenStub_AddParam(CFE_ES_LockProfileAcquired, CFE_ES_LockProfileId_t, LockId);
+    UT_GenStub_AddParam(CFE_ES_LockProfileAcquired, const char *, FunctionName);
+    UT_GenStub_AddParam(CFE_ES_LockProfileAcquired, int32, LineNumber);
+    UT_GenStub_AddParam(CFE_ES_LockProfileAcquired, const CFE_ES_LockProfileStamp_t *, Stamp);
+
+    UT_GenStub_Execute(CFE_ES_LockProfileAcquired, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_LockProfileBegin()
+ * ----------------------------------------------------
+ */
+void CFE_ES_LockProfileBegin(CFE_ES_LockProfileStamp_t *Stamp)
+{
+    UT_GenStub_AddParam(CFE_ES_LockProfileBegin, CFE_ES_LockProfileStamp_t *, Stamp);
+
+    UT_GenStub_Execute(CFE_ES_LockProfileBegin, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_LockProfileReleased()
+ * ----------------------------------------------------
+ */
+void CFE_ES_LockProfileReleased(CFE_ES_LockProfileId_t LockId)
+{
+    UT_GenStub_AddParam(CFE_ES_LockProfileReleased, CFE_ES_LockProfileId_t, LockId);
+
+    UT_GenStub_Execute(CFE_ES_LockProfileReleased, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_RegisterCDSEx()
@@ -562,6 +562,10 @@ typedef struct CFE_ES_MemPoolStats
                                                                           \brief Number of bytes never allocated to a block */
     CFE_ES_BlockStats_t BlockStats[CFE_MISSION_ES_POOL_MAX_BUCKETS]; /**< \cfetlmmnemonic \ES_BLKSTATS
                                                                           \brief Contains stats on each block size */
+    CFE_ES_MemOffset_t FreeBlockBytes;                               /**< \cfetlmmnemonic \ES_FREEBLKBYTES
+                                                                          \brief Number of bytes in blocks that are free for reuse */
+    CFE_ES_MemOffset_t LargestFreeBlock;                             /**< \cfetlmmnemonic \ES_LARGESTFREEBLK
+                                                                          \brief Largest block size that can be allocated now */
 } CFE_ES_MemPoolStats_t;
 
 #endif /* CFE_ES_EXTERN_TYPEDEFS_H */
@@ -587,6 +587,12 @@
 **  \par Description
 **       This command causes the Performance Analyzer to begin collecting data using the specified trigger mode.
 **
+**       In the STREAM mode the trigger masks are not used.  Data is collected continuously and the
+**       ES background task periodically writes the collected entries to a rolling set of
+**       #CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES files, named after
+**       #CFE_PLATFORM_ES_DEFAULT_PERF_STREAM_FILENAME, until the Stop Performance Analyzer
+**       command is received.  The filter masks remain in effect.
+**
 **  \cfecmdmnemonic \ES_STARTLADATA
 **
 **  \par Command Structure
@@ -601,7 +607,7 @@
 **         either WAITING FOR TRIGGER or, if conditions are appropriate fast enough,
 **         TRIGGERED.
 **       - \b \c \ES_PERFMODE - Performance Analyzer Mode will change to the commanded trigger mode (TRIGGER START,
-**         TRIGGER CENTER, or TRIGGER END).
+**         TRIGGER CENTER, TRIGGER END, or STREAM).
 **       - \b \c \ES_PERFTRIGCNT - Performance Trigger Count will go to zero
 **       - \b \c \ES_PERFDATASTART - Data Start Index will go to zero
 **       - \b \c \ES_PERFDATAEND - Data End Index will go to zero
@@ -612,6 +618,7 @@
 **  \par Error Conditions
 **       This command may fail for the following reason(s):
 **       - A previous #CFE_ES_STOP_PERF_DATA_CC command has not completely finished.
+**       - The final files of a previous STREAM mode collection are still being written.
 **       - An invalid trigger mode is requested.
 **
 **       Evidence of failure may be found in the following telemetry:
@@ -633,10 +640,23 @@
 **       This command stops the Performance Analyzer from collecting any more data,
 **       and writes all previously collected performance data to a log file.
 **
+**       The file is written in the format selected in the command.  The BINARY format
+**       holds the raw entries for the traditional performance analysis tools.  The
+**       TRACE_JSON format is a Trace Event JSON file that common trace viewers can open
+**       directly: each task that logged entries is shown as its own track, entry and
+**       exit markers form duration slices, and markers are named according to the
+**       #CFE_PLATFORM_ES_PERF_MARKER_NAMES table.
+**
+**       If collection was started in the STREAM mode, the file name and format in the
+**       command are not used.  The entries that have not been streamed yet are written to the
+**       next file of the rolling set, and a #CFE_ES_PERF_STREAM_STOPPED_EID event is
+**       generated once the final file is written.
+**
 **  \cfecmdmnemonic \ES_STOPLADATA
 **
 **  \par Command Structure
-**       #CFE_ES_StopPerfDataCmd_t
+**       #CFE_ES_StopPerfDataCmd_t.  The DumpFormat field is new, so the command is
+**       longer than in earlier versions, see #CFE_ES_StopPerfCmd_Payload_t.
 **
 **  \par Command Verification
 **       Successful execution of this command may be verified with
@@ -656,7 +676,10 @@
 **
 **  \par Error Conditions
 **       This command may fail for the following reason(s):
+**       - The command length is not valid, including a command of the length
+**         used before the DumpFormat field was added
 **       - The file name specified could not be parsed
+**       - The file format specified is not valid
 **       - Log data from a previous Stop Performance Analyzer command is still
 **         being written to a file.
 **
@@ -1031,6 +1054,222 @@
 */
 #define CFE_ES_QUERY_ALL_TASKS_CC 24
 
+/** \cfeescmd Set Performance Marker Statistics Masks
+**
+**  \par Description
+**       This command sets the masks that select the performance markers for
+**       which Executive Services keeps entry to exit latency statistics.  The
+**       statistics are kept whether or not the Performance Analyzer is
+**       collecting data.  All statistics collected so far are cleared.
+**
+**  \cfecmdmnemonic \ES_PERFSTATSMASK
+**
+**  \par Command Structure
+**       #CFE_ES_SetPerfStatsMaskCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - The #CFE_ES_PERF_STATSMSKCMD_EID debug event message will be
+**         generated.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The Statistics Mask ID number is out of range
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       Each selected marker adds a small amount of time to every entry and
+**       exit of the marker in the task that logs it.
+**
+**  \sa #CFE_ES_SEND_PERF_STATS_CC, #CFE_ES_SET_PERF_FILTER_MASK_CC
+*/
+#define CFE_ES_SET_PERF_STATS_MASK_CC 25
+
+/** \cfeescmd Telemeter Performance Marker Statistics
+**
+**  \par Description
+**       This command sends a snapshot of the entry to exit latency statistics
+**       kept for the performance markers selected with
+**       #CFE_ES_SET_PERF_STATS_MASK_CC.
+**
+**  \cfecmdmnemonic \ES_TLMPERFSTATS
+**
+**  \par Command Structure
+**       #CFE_ES_SendPerfStatsCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - The #CFE_ES_PERF_STATS_TLM_EID debug event message will be
+**         generated.
+**       - The \link #CFE_ES_PerfStatsTlm_t Performance Marker Statistics Telemetry Packet \endlink
+**         is produced
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The command packet length is incorrect
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**
+**  \par Criticality
+**       None
+**
+**  \sa #CFE_ES_SET_PERF_STATS_MASK_CC
+*/
+#define CFE_ES_SEND_PERF_STATS_CC 26
+
+/** \cfeescmd Writes the Lock Profile to a File
+**
+**  \par Description
+**       This command causes the call site statistics kept by the lock profiler
+**       for the ES, SB, TBL and FS core locks to be written to the specified
+**       file.  Each entry gives the number of acquisitions and histograms of the
+**       time spent waiting for and holding the lock.  The profiler is enabled with
+**       the #CFE_PLATFORM_ES_LOCK_PROFILE configuration parameter; when it is not
+**       enabled the file has no entries.
+**
+**  \cfecmdmnemonic \ES_WRITELOCKPROF2FILE
+**
+**  \par Command Structure
+**       #CFE_ES_WriteLockProfileCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - The #CFE_ES_LOCKPROF_EID debug event message will be
+**         generated.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_ES_DEFAULT_LOCK_PROFILE_FILE configuration parameter) will be
+**         updated with the latest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - A previous request to write the lock profile has not yet completed
+**       - The specified FileName cannot be parsed
+**       - An Error occurs while trying to write to the file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system (or overwrite an existing one) and could,
+**       if performed repeatedly without sufficient file management by the
+**       operator, fill the file system.
+**
+**  \sa #CFE_ES_WRITE_ER_LOG_CC
+*/
+#define CFE_ES_WRITE_LOCK_PROFILE_CC 27
+
+/** \cfeescmd Writes the Pool Size Profile to a File
+**
+**  \par Description
+**       This command causes the size profile of every memory pool and of the
+**       CDS pool to be written to the specified file.  Each entry gives, for
+**       one bin of requested sizes of a pool, the number of requests and the
+**       highest number of blocks allocated at once.  The pool sizing tool turns
+**       the file into a list of block sizes.  The profiler is enabled with the
+**       #CFE_PLATFORM_ES_POOL_SIZE_PROFILE configuration parameter; when it is
+**       not enabled the file has no entries.
+**
+**  \cfecmdmnemonic \ES_WRITEPOOLPROF2FILE
+**
+**  \par Command Structure
+**       #CFE_ES_WritePoolProfileCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - The #CFE_ES_POOLPROF_EID debug event message will be
+**         generated.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_ES_DEFAULT_POOL_PROFILE_FILE configuration parameter) will be
+**         updated with the latest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - A previous request to write the pool profile has not yet completed
+**       - The specified FileName cannot be parsed
+**       - An Error occurs while trying to write to the file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system (or overwrite an existing one) and could,
+**       if performed repeatedly without sufficient file management by the
+**       operator, fill the file system.
+**
+**  \sa #CFE_ES_WRITE_LOCK_PROFILE_CC, #CFE_ES_SEND_MEM_POOL_STATS_CC
+*/
+#define CFE_ES_WRITE_POOL_PROFILE_CC 28
+
+/** \cfeescmd Writes the Startup Timeline to a File
+**
+**  \par Description
+**       This command causes the startup timeline to be written to the specified
+**       file.  The first entry gives the time each boot phase was entered, and
+**       each following entry the times an app or library created during startup
+**       was loaded, started, and reached the LATE_INIT and RUNNING states.  The
+**       timeline is also written to the default file once the system is
+**       OPERATIONAL, together with the #CFE_ES_TIMELINE_INF_EID summary event.
+**
+**  \cfecmdmnemonic \ES_WRITETIMELINE2FILE
+**
+**  \par Command Structure
+**       #CFE_ES_WriteStartupTimelineCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - The #CFE_ES_TIMELINE_EID debug event message will be
+**         generated.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_ES_DEFAULT_STARTUP_TIMELINE_FILE configuration parameter) will be
+**         updated with the latest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - A previous request to write the startup timeline has not yet completed
+**       - The specified FileName cannot be parsed
+**       - An Error occurs while trying to write to the file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system (or overwrite an existing one) and could,
+**       if performed repeatedly without sufficient file management by the
+**       operator, fill the file system.
+**
+**  \sa #CFE_ES_WRITE_POOL_PROFILE_CC, #CFE_ES_WRITE_SYS_LOG_CC
+*/
+#define CFE_ES_WRITE_STARTUP_TIMELINE_CC 29
+
 /** \} */
 
 #endif
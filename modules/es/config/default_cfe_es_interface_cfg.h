@@ -91,6 +91,23 @@
 */
 #define CFE_MISSION_ES_POOL_MAX_BUCKETS 17
 
+/** \cfeescfg Maximum number of performance marker statistics
+**
+**  \par Description:
+**      The number of marker/task combinations for which Executive Services
+**      keeps running entry to exit latency statistics.  This definition is
+**      used as the array size of the performance statistics telemetry packet,
+**      and therefore should be consistent across all CPUs in a mission, as
+**      well as with the ground station.
+**
+**  \par Limits:
+**       Must be at least one.  Each entry also reserves a histogram of
+**       about 500 bytes in the ES global data.
+**
+**
+*/
+#define CFE_MISSION_ES_PERF_MAX_STATS 16
+
 /**
 **  \cfeescfg Maximum Length of CDS Name
 **
@@ -117,11 +134,29 @@
 **      Table Image data integrity values.
 **
 **  \par Limits
-**      Currently only CFE_ES_CrcType_16_ARC is supported (see brief in CFE_ES_CrcType_Enum
-**      definition in cfe_es_api_typedefs.h)
+**      Currently CFE_ES_CrcType_16_ARC and CFE_ES_CrcType_32C are supported (see brief in
+**      CFE_ES_CrcType_Enum definition in cfe_es_api_typedefs.h).  CFE_ES_CrcType_32C is
+**      much faster on CPUs with CRC-32C instructions.  Changing this changes the CRC
+**      of CDS blocks and table images, so CDS data saved before the change fails validation.
 */
 #define CFE_MISSION_ES_DEFAULT_CRC CFE_ES_CrcType_16_ARC
 
+/**
+**  \cfeescfg Maximum number of chunks of a chunked CRC
+**
+**  \par Description:
+**      The number of chunks a block of data is divided into by
+**      CFE_ES_ChunkedCRCInit().  After a change to the data, only the CRC of the
+**      chunks that were changed is computed again, and the CRC of the whole
+**      block is combined from the CRC of each chunk.  More chunks make the
+**      update after a small change faster, but make combining the chunks slower
+**      and use 4 more bytes of memory per chunk in each CFE_ES_ChunkedCRC_t.
+**
+**  \par Limits
+**      Must be at least 1.
+*/
+#define CFE_MISSION_ES_CRC_MAX_CHUNKS 16
+
 /**
 **  \cfeescfg Maximum Length of Full CDS Name in messages
 **
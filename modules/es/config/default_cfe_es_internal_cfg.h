@@ -152,9 +152,10 @@
 **       character.
 **
 **  \par Limits
-**       There is a lower limit of 512.  There are no restrictions on the upper limit
-**       however, the maximum system log size is system dependent and should be
-**       verified.
+**       There is a lower limit of 512 and an upper limit of 1048575, since the
+**       indices of the log are packed into a single word so that they can be
+**       updated atomically.  The maximum system log size is also system dependent
+**       and should be verified.
 */
 #define CFE_PLATFORM_ES_SYSTEM_LOG_SIZE 3072
 
@@ -450,6 +451,64 @@
 */
 #define CFE_PLATFORM_ES_DEFAULT_PERF_DUMP_FILENAME "/ram/cfe_es_perf.dat"
 
+/**
+**  \cfeescfg Default Performance Data Stream Filename
+**
+**  \par Description:
+**       The value of this constant defines the base filename used to store the
+**       Performance Data collected in the STREAM mode.  The index of the file
+**       within the rolling set and the ".dat" extension are appended, for
+**       example "/ram/cfe_es_perf_stream_00.dat".
+**
+**  \par Limits
+**       The length of each string, including the appended index and extension
+**       and the NULL terminator, cannot exceed the #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_PERF_STREAM_FILENAME "/ram/cfe_es_perf_stream"
+
+/**
+**  \cfeescfg Default Lock Profile Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the lock
+**       profile.  This filename is used only when no filename is specified in
+**       the command to write the lock profile.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_LOCK_PROFILE_FILE "/ram/cfe_es_lockprof.dat"
+
+/**
+**  \cfeescfg Default Pool Profile Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the pool
+**       size profile.  This filename is used only when no filename is specified
+**       in the command to write the pool profile.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_POOL_PROFILE_FILE "/ram/cfe_es_poolprof.dat"
+
+/**
+**  \cfeescfg Default Startup Timeline Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the startup
+**       timeline.  The timeline is written to this file once the system is
+**       OPERATIONAL, and when no filename is specified in the command to write
+**       the startup timeline.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_STARTUP_TIMELINE_FILE "/ram/cfe_es_timeline.dat"
+
 /**
 **  \cfeescfg Default Critical Data Store Registry Filename
 **
@@ -500,6 +559,25 @@
 */
 #define CFE_PLATFORM_ES_DEFAULT_PR_SYSLOG_MODE 1
 
+/**
+**  \cfeescfg Define the Format of the System Log
+**
+**  \par Description:
+**       Defines whether messages are formatted when they are written to the ES
+**       System log (text format = 0), or stored as the time, format string and
+**       arguments and only formatted when the log is read or written to a file
+**       (binary format = 1).  The binary format keeps the cost of formatting off
+**       the task that writes the message, but these messages are not echoed to
+**       the console, and the file written by the Write System Log command is
+**       still in text format.  If the format in the reset area does not match
+**       this after a processor reset, the system log is cleared.
+**
+**  \par Limits
+**       There is a lower limit of 0 and an upper limit of 1 on this configuration
+**       parameter.
+*/
+#define CFE_PLATFORM_ES_SYSLOG_BINARY_FORMAT 0
+
 /**
 **  \cfeescfg Define Max Size of Performance Data Buffer
 **
@@ -516,6 +594,82 @@
 */
 #define CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE 10000
 
+/**
+**  \cfeescfg Define Number of Per-Task Performance Data Buffers
+**
+**  \par Description:
+**       The performance data buffer is divided into this many equal per-task
+**       buffers.  Each task that records a performance marker is given its own
+**       buffer the first time it logs an entry after a start command, and is the
+**       only writer of that buffer, so entries are recorded without locking.
+**       Entries from tasks that log after all buffers are in use are dropped.
+**       The buffers are merged in time order when the log is written to a file.
+**       Each per-task buffer holds #CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE divided
+**       by this value, rounded down to a power of two, so the default of 10000
+**       entries in 16 buffers leaves 512 entries per task.
+**
+**  \par Limits
+**       There is a lower limit of 1.  Each per-task buffer, that is
+**       #CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE divided by this value, must hold at
+**       least 64 entries and at most 16777216 entries.
+*/
+#define CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS 16
+
+/**
+**  \cfeescfg Define Number of Performance Data Stream Files
+**
+**  \par Description:
+**       Performance Data collected in the STREAM mode is written to a rolling set
+**       of this many files.  Once the last file of the set is written, the next
+**       one overwrites the first.
+**
+**  \par Limits
+**       There is a lower limit of 1 and an upper limit of 100.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES 8
+
+/**
+**  \cfeescfg Define Performance Data Stream Period
+**
+**  \par Description:
+**       In the STREAM mode, the collected entries are written to the next file of
+**       the rolling set at least this often, in milliseconds.  A file is written
+**       sooner if any per-task buffer becomes half full.
+**
+**  \par Limits
+**       There is a lower limit of #CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_MS_PERIOD 1000
+
+/**
+**  \cfeescfg Define Performance Marker Names
+**
+**  \par Description:
+**       Optional list of names for the performance markers, used when the
+**       performance log is written in the TRACE_JSON format.  Each item is an
+**       initializer of the form {MarkerId, "Name"} followed by a comma.
+**       Markers that are not listed are written as "Marker<id>".
+**
+**  \par Limits
+**       The list may be empty.  The marker IDs should be within
+**       #CFE_MISSION_ES_PERF_MAX_IDS, and each name should be a short
+**       identifier that does not need escaping in JSON.
+*/
+#define CFE_PLATFORM_ES_PERF_MARKER_NAMES                                                                         \
+    {CFE_MISSION_ES_MAIN_PERF_ID, "ES_Main"}, {CFE_MISSION_EVS_MAIN_PERF_ID, "EVS_Main"},                         \
+        {CFE_MISSION_TBL_MAIN_PERF_ID, "TBL_Main"}, {CFE_MISSION_SB_MAIN_PERF_ID, "SB_Main"},                     \
+        {CFE_MISSION_SB_MSG_LIM_PERF_ID, "SB_MsgLimit"}, {CFE_MISSION_SB_PIPE_OFLOW_PERF_ID, "SB_PipeOverflow"}, \
+        {CFE_MISSION_TIME_MAIN_PERF_ID, "TIME_Main"}, {CFE_MISSION_TIME_TONE1HZISR_PERF_ID, "TIME_Tone1HzISR"},   \
+        {CFE_MISSION_TIME_LOCAL1HZISR_PERF_ID, "TIME_Local1HzISR"},                                               \
+        {CFE_MISSION_TIME_SENDMET_PERF_ID, "TIME_SendMET"},                                                       \
+        {CFE_MISSION_TIME_LOCAL1HZTASK_PERF_ID, "TIME_Local1HzTask"},                                             \
+        {CFE_MISSION_TIME_TONE1HZTASK_PERF_ID, "TIME_Tone1HzTask"},                                               \
+        {CFE_MISSION_SB_TRANSMIT_PERF_ID, "SB_TransmitMsg"}, {CFE_MISSION_SB_LOCK_PERF_ID, "SB_Lock"},            \
+        {CFE_MISSION_SB_RECEIVE_PERF_ID, "SB_ReceiveBuffer"}, {CFE_MISSION_EVS_LOCK_PERF_ID, "EVS_Lock"},         \
+        {CFE_MISSION_EVS_SENDEVENT_PERF_ID, "EVS_SendEvent"}, {CFE_MISSION_TBL_LOCK_PERF_ID, "TBL_Lock"},         \
+        {CFE_MISSION_TBL_GETADDRESS_PERF_ID, "TBL_GetAddress"},                                                   \
+        {CFE_MISSION_ES_GETPOOLBUF_PERF_ID, "ES_GetPoolBuf"}, {CFE_MISSION_ES_POOL_LOCK_PERF_ID, "ES_PoolLock"},
+
 /**
 **  \cfeescfg Define Filter Mask Setting for Disabling All Performance Entries
 **
@@ -580,6 +734,69 @@
 */
 #define CFE_PLATFORM_ES_PERF_TRIGMASK_INIT CFE_PLATFORM_ES_PERF_TRIGMASK_NONE
 
+/**
+**  \cfeescfg Define Default Statistics Mask Setting for Performance Markers
+**
+**  \par Description:
+**       Defines the default statistics mask for the performance markers. The value is a
+**       32-bit mask.  For each bit, 0 means no latency statistics are kept for the
+**       corresponding marker and 1 means entry to exit statistics are kept.  Statistics
+**       are kept whether or not the performance log is collecting data.
+**
+*/
+#define CFE_PLATFORM_ES_PERF_STATSMASK_INIT CFE_PLATFORM_ES_PERF_TRIGMASK_NONE
+
+/**
+**  \cfeescfg Enable the Lock Profiler
+**
+**  \par Description:
+**       When set to 1, the ES, SB, TBL and FS core locks record, for each call
+**       site, the number of acquisitions and histograms of the time spent waiting
+**       for and holding the lock, measured with the PSP timebase.  The profile is
+**       written to a file with the #CFE_ES_WRITE_LOCK_PROFILE_CC command.
+**
+**       When set to 0, the profiling hooks are removed from the lock functions and
+**       the written profile has no entries.
+**
+**  \par Limits
+**       Must be 0 or 1.
+*/
+#define CFE_PLATFORM_ES_LOCK_PROFILE 0
+
+/**
+**  \cfeescfg Maximum Number of Call Sites Profiled per Lock
+**
+**  \par Description:
+**       Defines the number of distinct call sites of each lock for which the lock
+**       profiler keeps data.  Acquisitions from any further call sites are combined
+**       into one additional entry.
+**
+**  \par Limits
+**       There is a lower limit of 1.  Each call site takes about 300 bytes of
+**       memory for each of the profiled locks.
+*/
+#define CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES 16
+
+/**
+**  \cfeescfg Enable the Pool Size Profiler
+**
+**  \par Description:
+**       When set to 1, every memory pool and the CDS pool count the requested
+**       block sizes in bins, keeping for each bin the number of requests and the
+**       highest number of blocks allocated at once.  The profile is written to a
+**       file with the #CFE_ES_WRITE_POOL_PROFILE_CC command, and the pool sizing
+**       tool turns it into a list of block sizes for #CFE_ES_PoolCreateEx or the
+**       #CFE_PLATFORM_ES_MEM_BLOCK_SIZE_01 configuration parameters.
+**
+**       When set to 0, the pools are not profiled and the written profile has no
+**       entries.
+**
+**  \par Limits
+**       Must be 0 or 1.  When set to 1 each pool takes about 2.5 KiB of memory
+**       for its profile.
+*/
+#define CFE_PLATFORM_ES_POOL_SIZE_PROFILE 0
+
 /**
 **  \cfeescfg Define Performance Analyzer Child Task Priority
 **
@@ -693,6 +910,62 @@
 */
 #define CFE_PLATFORM_ES_POOL_MAX_BUCKETS 17
 
+/** \cfeescfg Return and recycle memory pool blocks without the pool mutex
+**
+**  \par Description:
+**      When set to 1, the free block lists of memory pools are updated with
+**      atomic operations, so CFE_ES_PutPoolBuf and CFE_ES_GetPoolBuf (when a
+**      previously returned block can be recycled) do not take the pool mutex.
+**      The mutex is then only taken to create new blocks.
+**
+**      This only has an effect if the compiler provides native atomic
+**      operations (GCC or Clang on a target with 64 bit compare-and-swap)
+**      and the pool is smaller than 4 GiB.  Other pools always use the mutex.
+**      The Critical Data Store pool is not affected.
+**
+**  \par Limits
+**       Must be 0 or 1.
+*/
+#define CFE_PLATFORM_ES_POOL_LOCK_FREE 1
+
+/** \cfeescfg Maximum number of memory pools with per-task magazine caches
+**
+**  \par Description:
+**      The number of memory pools that may concurrently have per-task
+**      magazine caches, enabled with CFE_ES_PoolEnableMagazines.  Each of
+**      these pools keeps a set of magazines for every possible OSAL task,
+**      so this should be kept to the pools that are used at a high rate.
+**
+**  \par Limits
+**       Must be at least 1 and no more than #CFE_PLATFORM_ES_MAX_MEMORY_POOLS.
+*/
+#define CFE_PLATFORM_ES_POOL_MAX_MAGAZINE_POOLS 2
+
+/** \cfeescfg Number of blocks in a memory pool magazine
+**
+**  \par Description:
+**      The number of free blocks of one size that a task may keep cached in
+**      a magazine.  Blocks are exchanged with the shared pool in batches of
+**      half this number, so the pool mutex is taken at most once for that
+**      many buffer gets or puts.
+**
+**  \par Limits
+**       Must be an even number, at least 2.
+*/
+#define CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE 8
+
+/** \cfeescfg Number of memory pool magazines per task
+**
+**  \par Description:
+**      The number of magazines each task keeps for a pool, and therefore the
+**      number of block sizes it may have cached at once.  Buffers of other
+**      sizes are taken from the shared pool directly.
+**
+**  \par Limits
+**       Must be at least 1 and no more than #CFE_PLATFORM_ES_POOL_MAX_BUCKETS.
+*/
+#define CFE_PLATFORM_ES_POOL_MAGAZINES_PER_TASK 4
+
 /** \cfeescfg Maximum number of memory pools
 **
 **  \par Description:
@@ -773,19 +1046,57 @@
 #define CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_16 32768
 #define CFE_PLATFORM_ES_CDS_MAX_BLOCK_SIZE    80000
 
+/**
+**  \cfeescfg Define ES Critical Data Store Write-Behind Memory Size
+**
+**  \par Description:
+**       Size, in bytes, of the RAM used for the shadows of the CDS blocks that
+**       are in write-behind mode, see CFE_ES_SetCDSWriteBehind().  Each such block
+**       takes a block of this memory of at least its own size, from the same list
+**       of block sizes as the CDS memory pool.  The same amount of RAM again is
+**       reserved to stage one block while it is written to the CDS.
+**
+**       A value of 0 does not reserve any memory, and write-behind mode can then
+**       not be enabled for any block.
+**
+**  \par Limits
+**       Must be an integral multiple of 4.  If not 0, this must be large enough
+**       for the block descriptor of the pool and at least one block.
+*/
+#define CFE_PLATFORM_ES_CDS_WRITE_BEHIND_SIZE 16384
+
+/**
+**  \cfeescfg Define ES Critical Data Store Write-Behind Flush Rate
+**
+**  \par Description:
+**       The rate, in milliseconds, at which the ES background task writes the
+**       shadows of the CDS blocks in write-behind mode to the CDS, if they were
+**       changed.  All changes made to a block within this period are written
+**       together.  This is the longest time that a change may be lost in case of
+**       a reset that does not call CFE_ES_FlushCDS() first.
+**
+**  \par Limits
+**       There is a lower limit of 10 and an upper limit of 60000 on this
+**       configuration parameter. millisecond units.
+*/
+#define CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE 1000
+
 /** \cfeescfg Poll timer for startup sync delay
 **
 **  \par Description:
 **      During startup, some tasks may need to synchronize their own initialization
 **      with the initialization of other applications in the system.
 **
-**      CFE ES implements an API to accomplish this, that performs a task delay (sleep)
-**      while polling the overall system state until other tasks are ready.
+**      CFE ES implements an API to accomplish this.  Tasks calling
+**      CFE_ES_WaitForSystemState() block on a semaphore that is given when the
+**      system state changes, so they do not poll.  The ES main task still polls
+**      the state of the apps until they are all ready.
 **
-**      This value controls the amount of time that the CFE_ES_ApplicationSyncDelay
-**      will sleep between each check of the system state.  This should be large enough
-**      to allow other tasks to run, but not so large as to noticeably delay the startup
-**      completion.
+**      This value controls the amount of time that the ES main task will sleep
+**      between each check of the app states, and that CFE_ES_WaitForSystemState()
+**      sleeps between each check of the system state if the semaphore could not be
+**      created.  This should be large enough to allow other tasks to run, but not so
+**      large as to noticeably delay the startup completion.
 **
 **      Units are in milliseconds
 **
@@ -813,4 +1124,28 @@
 */
 #define CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC 1000
 
+/** \cfeescfg Number of startup script worker tasks
+**
+**  \par Description:
+**      The number of worker tasks, in addition to the ES startup task itself, that
+**      load and start the entries of the CFE ES startup script concurrently.
+**
+**      If zero, the entries are loaded and started one after the other in script
+**      order, which is the traditional behavior.  If nonzero, the entries are queued
+**      while parsing the script, and an entry is started as soon as all of the entries
+**      it depends on have finished loading.  The dependencies of an entry are listed
+**      in the optional ninth column of the startup script, separated by ':', or as
+**      NONE.  An entry without this column waits for all preceding entries, so scripts
+**      without the column behave as in the serial mode.
+**
+**      The worker tasks use the same priority and stack size as the ES task, see
+**      #CFE_PLATFORM_ES_START_TASK_PRIORITY and #CFE_PLATFORM_ES_START_TASK_STACK_SIZE.
+**      Note that library init functions run in the context of the worker tasks.
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than
+**       or equal to zero, and less than or equal to 16.
+*/
+#define CFE_PLATFORM_ES_STARTUP_WORKERS 0
+
 #endif
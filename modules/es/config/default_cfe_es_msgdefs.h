@@ -151,11 +151,24 @@ enum CFE_ES_PerfMode
 {
     CFE_ES_PerfTrigger_START = 0,
     CFE_ES_PerfTrigger_CENTER,
-    CFE_ES_PerfTrigger_END
+    CFE_ES_PerfTrigger_END,
+    CFE_ES_PerfTrigger_STREAM /**< Continuously write entries to a rolling set of files until stopped */
 };
 
 typedef uint32 CFE_ES_PerfMode_Enum_t;
 
+/**
+ * @brief Labels for values to use in #CFE_ES_StopPerfCmd_Payload.DumpFormat
+ * @sa CFE_ES_StopPerfCmd_Payload
+ */
+enum CFE_ES_PerfDumpFormat
+{
+    CFE_ES_PerfDumpFormat_BINARY = 0, /**< cFE file header, metadata and raw entries */
+    CFE_ES_PerfDumpFormat_TRACE_JSON  /**< Trace Event JSON, for use with common trace viewers */
+};
+
+typedef uint32 CFE_ES_PerfDumpFormat_Enum_t;
+
 /**
 ** \brief Start Performance Analyzer Command Payload
 **
@@ -173,11 +186,18 @@ typedef struct CFE_ES_StartPerfCmd_Payload
 **
 ** For command details, see #CFE_ES_STOP_PERF_DATA_CC
 **
+** \note The DumpFormat field makes this payload 4 bytes longer than in earlier
+**       versions.  A command of the old length is rejected with a length error,
+**       so ground command definitions must be updated.  A DumpFormat of
+**       #CFE_ES_PerfDumpFormat_BINARY writes the same file as before.
+**
 **/
 typedef struct CFE_ES_StopPerfCmd_Payload
 {
     char DataFileName[CFE_MISSION_MAX_PATH_LEN]; /**< \brief ASCII text string of full path and filename
                                                     of file Performance Analyzer data is to be written */
+    CFE_ES_PerfDumpFormat_Enum_t
+        DumpFormat; /**< \brief Format of the file to write. Values defined by #CFE_ES_PerfDumpFormat. */
 } CFE_ES_StopPerfCmd_Payload_t;
 
 /**
@@ -204,6 +224,18 @@ typedef struct CFE_ES_SetPerfTrigMaskCmd_Payload
     uint32 TriggerMask;    /**< \brief New Mask for specified entry in array of Trigger Masks */
 } CFE_ES_SetPerfTrigMaskCmd_Payload_t;
 
+/**
+** \brief Set Performance Statistics Mask Command Payload
+**
+** For command details, see #CFE_ES_SET_PERF_STATS_MASK_CC
+**
+**/
+typedef struct CFE_ES_SetPerfStatsMaskCmd_Payload
+{
+    uint32 StatsMaskNum; /**< \brief Index into array of Statistics Masks */
+    uint32 StatsMask;    /**< \brief New Mask for specified entry in array of Statistics Masks */
+} CFE_ES_SetPerfStatsMaskCmd_Payload_t;
+
 /**
 ** \brief Send Memory Pool Statistics Command Payload
 **
@@ -255,6 +287,36 @@ typedef struct CFE_ES_PoolStatsTlm_Payload
     CFE_ES_MemPoolStats_t PoolStats; /**< \brief For more info, see #CFE_ES_MemPoolStats_t */
 } CFE_ES_PoolStatsTlm_Payload_t;
 
+/**
+** \brief Entry to exit latency statistics of one performance marker in one task
+**
+** All times are in microseconds.  The 99th percentile is taken from a histogram
+** with four bins per power of two, so it is an upper bound within 25% of the
+** actual value.
+**/
+typedef struct CFE_ES_PerfMarkerStats
+{
+    uint32          Marker;  /**< \brief Performance marker ID */
+    CFE_ES_TaskId_t TaskId;  /**< \brief Task that logged the marker */
+    uint32          Count;   /**< \brief Number of entry/exit pairs measured */
+    uint32          MinTime; /**< \brief Shortest time from entry to exit */
+    uint32          AvgTime; /**< \brief Mean time from entry to exit */
+    uint32          MaxTime; /**< \brief Longest time from entry to exit */
+    uint32          P99Time; /**< \brief 99th percentile time from entry to exit */
+} CFE_ES_PerfMarkerStats_t;
+
+/**
+**  \cfeestlm Performance Marker Statistics Packet
+**/
+typedef struct CFE_ES_PerfStatsTlm_Payload
+{
+    uint32 NumStats;       /**< \cfetlmmnemonic \ES_PERFNUMSTATS
+                                \brief Number of valid entries in Stats */
+    uint32 UntrackedCount; /**< \cfetlmmnemonic \ES_PERFUNTRACKED
+                                \brief Markers not measured because all entries were in use */
+    CFE_ES_PerfMarkerStats_t Stats[CFE_MISSION_ES_PERF_MAX_STATS]; /**< \brief Statistics of each marker and task */
+} CFE_ES_PerfStatsTlm_Payload_t;
+
 /*************************************************************************/
 
 /**
@@ -355,6 +417,10 @@ typedef struct CFE_ES_HousekeepingTlm_Payload
                                             \brief Number of free blocks remaining in the OS heap */
     CFE_ES_MemOffset_t HeapMaxBlockSize; /**< \cfetlmmnemonic \ES_HEAPMAXBLK
                                             \brief Number of bytes in the largest free block */
+    uint32 PerfDroppedCount;    /**< \cfetlmmnemonic \ES_PERFDROPCNT
+                                     \brief Number of Performance Analyzer Log Entries Dropped in the current collection */
+    uint32 PerfStreamFileCount; /**< \cfetlmmnemonic \ES_PERFSTREAMFILES
+                                     \brief Number of Performance Analyzer Stream Files Written in the current collection */
 } CFE_ES_HousekeepingTlm_Payload_t;
 
 #endif
@@ -35,8 +35,9 @@
 /*
 ** CFE ES Telemetry Message Id's
 */
-#define CFE_ES_HK_TLM_MID       CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_ES_HK_TLM_TOPICID)       /* 0x0800 */
-#define CFE_ES_APP_TLM_MID      CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_ES_APP_TLM_TOPICID)      /* 0x080B */
-#define CFE_ES_MEMSTATS_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_ES_MEMSTATS_TLM_TOPICID) /* 0x0810 */
+#define CFE_ES_HK_TLM_MID        CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_ES_HK_TLM_TOPICID)        /* 0x0800 */
+#define CFE_ES_APP_TLM_MID       CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_ES_APP_TLM_TOPICID)       /* 0x080B */
+#define CFE_ES_MEMSTATS_TLM_MID  CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_ES_MEMSTATS_TLM_TOPICID)  /* 0x0810 */
+#define CFE_ES_PERFSTATS_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_ES_PERFSTATS_TLM_TOPICID) /* 0x0811 */
 
 #endif
@@ -80,6 +80,11 @@ typedef struct CFE_ES_SendHkCmd
     CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
 } CFE_ES_SendHkCmd_t;
 
+typedef struct CFE_ES_SendPerfStatsCmd
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} CFE_ES_SendPerfStatsCmd_t;
+
 /**
  * \brief Restart cFE Command
  */
@@ -127,6 +132,24 @@ typedef struct CFE_ES_WriteERLogCmd
     CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
 } CFE_ES_WriteERLogCmd_t;
 
+typedef struct CFE_ES_WriteLockProfileCmd
+{
+    CFE_MSG_CommandHeader_t      CommandHeader; /**< \brief Command header */
+    CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_ES_WriteLockProfileCmd_t;
+
+typedef struct CFE_ES_WritePoolProfileCmd
+{
+    CFE_MSG_CommandHeader_t      CommandHeader; /**< \brief Command header */
+    CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_ES_WritePoolProfileCmd_t;
+
+typedef struct CFE_ES_WriteStartupTimelineCmd
+{
+    CFE_MSG_CommandHeader_t      CommandHeader; /**< \brief Command header */
+    CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_ES_WriteStartupTimelineCmd_t;
+
 /**
  * \brief Overwrite/Discard System Log Configuration Command Payload
  */
@@ -231,6 +254,15 @@ typedef struct CFE_ES_SetPerfTriggerMaskCmd
     CFE_ES_SetPerfTrigMaskCmd_Payload_t Payload;       /**< \brief Command payload */
 } CFE_ES_SetPerfTriggerMaskCmd_t;
 
+/**
+ * \brief Set Performance Statistics Mask Command
+ */
+typedef struct CFE_ES_SetPerfStatsMaskCmd
+{
+    CFE_MSG_CommandHeader_t              CommandHeader; /**< \brief Command header */
+    CFE_ES_SetPerfStatsMaskCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_ES_SetPerfStatsMaskCmd_t;
+
 /**
  * \brief Send Memory Pool Statistics Command
  */
@@ -273,6 +305,15 @@ typedef struct CFE_ES_MemStatsTlm
     CFE_ES_PoolStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
 } CFE_ES_MemStatsTlm_t;
 
+/**
+**  \cfeestlm Performance Marker Statistics Packet
+**/
+typedef struct CFE_ES_PerfStatsTlm
+{
+    CFE_MSG_TelemetryHeader_t     TelemetryHeader; /**< \brief Telemetry header */
+    CFE_ES_PerfStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_ES_PerfStatsTlm_t;
+
 /**
 **  \cfeestlm Executive Services Housekeeping Packet
 **/
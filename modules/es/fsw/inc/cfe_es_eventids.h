@@ -739,7 +739,8 @@
  *  \par Cause:
  *
  *  \link #CFE_ES_STOP_PERF_DATA_CC ES Stop Performance Analyzer Data Collection Command \endlink failed
- *  either parsing the file name or during open/creation of the file. OVERLOADED
+ *  either parsing the file name or during open/creation of the file, or a task was still recording
+ *  an entry when the log was to be written. OVERLOADED
  */
 #define CFE_ES_PERF_LOG_ERR_EID 67
 
@@ -1057,6 +1058,184 @@
  *  a write already being in progress.
  */
 #define CFE_ES_ERLOG_PENDING_ERR_EID 93
+
+/**
+ * \brief Performance Log Stream File Write Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  A file of the rolling set was written while the performance log is collected
+ *  in the STREAM mode.
+ */
+#define CFE_ES_PERF_STREAM_EID 94
+
+/**
+ * \brief Performance Log Stream Stopped Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_STOP_PERF_DATA_CC ES Stop Performance Analyzer Data Collection Command \endlink
+ *  stopped a STREAM mode collection and the final file of the rolling set was written.
+ */
+#define CFE_ES_PERF_STREAM_STOPPED_EID 95
+
+/**
+ * \brief ES Set Performance Statistics Mask Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_SET_PERF_STATS_MASK_CC ES Set Performance Statistics Mask Command \endlink success.
+ */
+#define CFE_ES_PERF_STATSMSKCMD_EID 96
+
+/**
+ * \brief ES Set Performance Statistics Mask Command Invalid Index Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_SET_PERF_STATS_MASK_CC ES Set Performance Statistics Mask Command \endlink failed
+ *  the mask index range check.
+ */
+#define CFE_ES_PERF_STATSMSKERR_EID 97
+
+/**
+ * \brief ES Send Performance Statistics Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_SEND_PERF_STATS_CC ES Send Performance Statistics Command \endlink success.
+ */
+#define CFE_ES_PERF_STATS_TLM_EID 98
+
+/**
+ * \brief ES Write Lock Profile Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_LOCK_PROFILE_CC ES Write Lock Profile Command \endlink success.
+ */
+#define CFE_ES_LOCKPROF_EID 99
+
+/**
+ * \brief ES Write Lock Profile Command Request or File Creation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_LOCK_PROFILE_CC ES Write Lock Profile Command \endlink request failed or
+ *  file creation failed. OVERLOADED
+ */
+#define CFE_ES_LOCKPROF_ERR_EID 100
+
+/**
+ * \brief ES Write Lock Profile Command Already In Progress Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_LOCK_PROFILE_CC ES Write Lock Profile Command \endlink failure due to
+ *  a write already being in progress.
+ */
+#define CFE_ES_LOCKPROF_PENDING_ERR_EID 101
+
+/**
+ * \brief ES Write Pool Profile Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_POOL_PROFILE_CC ES Write Pool Profile Command \endlink success.
+ */
+#define CFE_ES_POOLPROF_EID 102
+
+/**
+ * \brief ES Write Pool Profile Command Request or File Creation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_POOL_PROFILE_CC ES Write Pool Profile Command \endlink request failed or
+ *  file creation failed. OVERLOADED
+ */
+#define CFE_ES_POOLPROF_ERR_EID 103
+
+/**
+ * \brief ES Write Pool Profile Command Already In Progress Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_POOL_PROFILE_CC ES Write Pool Profile Command \endlink failure due to
+ *  a write already being in progress.
+ */
+#define CFE_ES_POOLPROF_PENDING_ERR_EID 104
+
+/**
+ * \brief ES Write Startup Timeline Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_STARTUP_TIMELINE_CC ES Write Startup Timeline Command \endlink success,
+ *  or the startup timeline written once the system is OPERATIONAL.
+ */
+#define CFE_ES_TIMELINE_EID 105
+
+/**
+ * \brief ES Write Startup Timeline Command Request or File Creation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_STARTUP_TIMELINE_CC ES Write Startup Timeline Command \endlink request failed or
+ *  file creation failed. OVERLOADED
+ */
+#define CFE_ES_TIMELINE_ERR_EID 106
+
+/**
+ * \brief ES Write Startup Timeline Command Already In Progress Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_STARTUP_TIMELINE_CC ES Write Startup Timeline Command \endlink failure due to
+ *  a write already being in progress.
+ */
+#define CFE_ES_TIMELINE_PENDING_ERR_EID 107
+
+/**
+ * \brief ES Startup Timeline Summary Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  The system reached the OPERATIONAL state.  The event gives the total startup
+ *  time, the time spent starting the core apps, running the startup script and
+ *  waiting for the apps to initialize, and the app that took the longest from
+ *  its creation to CFE_ES_WaitForStartupSync().
+ */
+#define CFE_ES_TIMELINE_INF_EID 108
 /**\}*/
 
 #endif /* CFE_ES_EVENTS_H */
@@ -68,6 +68,12 @@ CFE_Status_t CFE_ES_ResetCFE(uint32 ResetType)
 
     if (ResetType == CFE_PSP_RST_TYPE_PROCESSOR)
     {
+        /*
+        ** The CDS is kept over a processor reset, so write the changes
+        ** of the blocks in write-behind mode before they are lost
+        */
+        CFE_ES_FlushCDS();
+
         /*
         ** Increment the processor reset count
         */
@@ -450,6 +456,10 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
         if (AppRecPtr->AppState < CFE_ES_AppState_RUNNING)
         {
             AppRecPtr->AppState = CFE_ES_AppState_RUNNING;
+
+            /* apps that never call WaitForSystemState() reach RUNNING here */
+            CFE_ES_TimelineMarkModule(CFE_RESOURCEID_UNWRAP(CFE_ES_AppRecordGetID(AppRecPtr)),
+                                      CFE_ES_TimelineMilestone_RUNNING);
         }
 
         /*
@@ -496,10 +506,14 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
 CFE_Status_t CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMilliseconds)
 {
     int32               Status = CFE_SUCCESS;
+    int32               OsStatus;
     CFE_ES_AppRecord_t *AppRecPtr;
     uint32              RequiredAppState;
     uint32              WaitTime;
     uint32              WaitRemaining;
+    int64               TimeRemaining;
+    OS_time_t           AbsTimeout;
+    OS_time_t           TimeNow;
 
     /*
      * Calling app is assumed to have completed its own initialization up to the point
@@ -553,37 +567,107 @@ CFE_Status_t CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMill
         if (AppRecPtr->AppState < RequiredAppState)
         {
             AppRecPtr->AppState = RequiredAppState;
+
+            if (RequiredAppState >= CFE_ES_AppState_LATE_INIT)
+            {
+                CFE_ES_TimelineMarkModule(CFE_RESOURCEID_UNWRAP(CFE_ES_AppRecordGetID(AppRecPtr)),
+                                          CFE_ES_TimelineMilestone_LATE_INIT);
+            }
+            if (RequiredAppState >= CFE_ES_AppState_RUNNING)
+            {
+                CFE_ES_TimelineMarkModule(CFE_RESOURCEID_UNWRAP(CFE_ES_AppRecordGetID(AppRecPtr)),
+                                          CFE_ES_TimelineMilestone_RUNNING);
+            }
         }
     }
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
     /*
-     * Do the actual delay loop.
-     *
-     * This is only dependent on the main (startup) task updating the global variable
-     * to be at least the state requested.
+     * Block until the main (startup) task advances the system state to at least
+     * the state requested.  The state is checked and the task registered as a
+     * waiter under the same lock that CFE_ES_SetSystemState() changes it under,
+     * so a change cannot be missed between checking and blocking.
      */
-    WaitRemaining = TimeOutMilliseconds;
-    while (CFE_ES_Global.SystemState < MinSystemState)
+    if (OS_ObjectIdDefined(CFE_ES_Global.SystemStateSemId))
     {
-        /* TBD: Very Crude timing here, but not sure if it matters,
-         * as this is only done during startup, not real work */
-        if (WaitRemaining > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
-        {
-            WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
-        }
-        else if (WaitRemaining > 0)
+        CFE_PSP_GetTime(&AbsTimeout);
+        AbsTimeout = OS_TimeAdd(AbsTimeout, OS_TimeFromTotalMilliseconds(TimeOutMilliseconds));
+
+        while (true)
         {
-            WaitTime = WaitRemaining;
+            CFE_ES_LockSharedData(__func__, __LINE__);
+
+            if (CFE_ES_Global.SystemState >= MinSystemState)
+            {
+                CFE_ES_UnlockSharedData(__func__, __LINE__);
+                break;
+            }
+
+            CFE_PSP_GetTime(&TimeNow);
+            TimeRemaining = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(AbsTimeout, TimeNow));
+            if (TimeRemaining <= 0)
+            {
+                CFE_ES_UnlockSharedData(__func__, __LINE__);
+                Status = CFE_ES_OPERATION_TIMED_OUT;
+                break;
+            }
+
+            ++CFE_ES_Global.SystemStateWaiters;
+
+            CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+            OsStatus = OS_CountSemTimedWait(CFE_ES_Global.SystemStateSemId, (uint32)TimeRemaining);
+            if (OsStatus != OS_SUCCESS)
+            {
+                /*
+                 * Not woken by a state change, so unregister.  If the state changed
+                 * just now, this task was already removed from the count, and the
+                 * give it did not take only makes another waiter check the state.
+                 */
+                CFE_ES_LockSharedData(__func__, __LINE__);
+                if (CFE_ES_Global.SystemStateWaiters > 0)
+                {
+                    --CFE_ES_Global.SystemStateWaiters;
+                }
+                if (CFE_ES_Global.SystemState < MinSystemState)
+                {
+                    Status = CFE_ES_OPERATION_TIMED_OUT;
+                }
+                CFE_ES_UnlockSharedData(__func__, __LINE__);
+                break;
+            }
         }
-        else
+    }
+    else
+    {
+        /*
+         * Without the semaphore, poll the state in a delay loop.
+         *
+         * This is only dependent on the main (startup) task updating the global variable
+         * to be at least the state requested.
+         */
+        WaitRemaining = TimeOutMilliseconds;
+        while (CFE_ES_Global.SystemState < MinSystemState)
         {
-            Status = CFE_ES_OPERATION_TIMED_OUT;
-            break;
-        }
+            /* TBD: Very Crude timing here, but not sure if it matters,
+             * as this is only done during startup, not real work */
+            if (WaitRemaining > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
+            {
+                WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
+            }
+            else if (WaitRemaining > 0)
+            {
+                WaitTime = WaitRemaining;
+            }
+            else
+            {
+                Status = CFE_ES_OPERATION_TIMED_OUT;
+                break;
+            }
 
-        OS_TaskDelay(WaitTime);
-        WaitRemaining -= WaitTime;
+            OS_TaskDelay(WaitTime);
+            WaitRemaining -= WaitTime;
+        }
     }
 
     return Status;
@@ -1400,6 +1484,12 @@ CFE_Status_t CFE_ES_DeleteChildTask(CFE_ES_TaskId_t TaskId)
         }
 
         CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        /* The task is no longer running, return the pool blocks it had cached */
+        if (ReturnCode == CFE_SUCCESS)
+        {
+            CFE_ES_MemPoolFlushTaskCaches(TaskId);
+        }
     }
     else
     {
@@ -1422,6 +1512,7 @@ void CFE_ES_ExitChildTask(void)
 {
     CFE_ES_AppRecord_t * AppRecPtr;
     CFE_ES_TaskRecord_t *TaskRecPtr;
+    CFE_ES_TaskId_t      TaskId;
 
     CFE_ES_LockSharedData(__func__, __LINE__);
 
@@ -1440,11 +1531,15 @@ void CFE_ES_ExitChildTask(void)
             /*
             ** Invalidate the task table entry
             */
+            TaskId = CFE_ES_TaskRecordGetID(TaskRecPtr);
             CFE_ES_TaskRecordSetFree(TaskRecPtr);
             CFE_ES_Global.RegisteredTasks--;
 
             CFE_ES_UnlockSharedData(__func__, __LINE__);
 
+            /* Return the pool blocks this task had cached */
+            CFE_ES_MemPoolFlushTaskCaches(TaskId);
+
             /*
             ** Call the OS AL routine
             */
@@ -1485,17 +1580,41 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
         return CFE_ES_BAD_ARGUMENT;
     }
 
+    /*
+     * Append to the syslog buffer.  This only needs the lock if the
+     * state of the log cannot be updated atomically on this platform.
+     */
+    if (CFE_ES_Global.ResetDataPtr->SystemLogFormat == CFE_ES_SYSLOG_FORMAT_BINARY)
+    {
+        /* the message is formatted when the log is read, it is not output to the console */
+        if (!CFE_ES_ATOMIC_LOCK_FREE)
+        {
+            CFE_ES_LockSharedData(__func__, __LINE__);
+        }
+        va_start(ArgPtr, SpecStringPtr);
+        ReturnCode = CFE_ES_SysLogAppendBinary(SpecStringPtr, ArgPtr);
+        va_end(ArgPtr);
+        if (!CFE_ES_ATOMIC_LOCK_FREE)
+        {
+            CFE_ES_UnlockSharedData(__func__, __LINE__);
+        }
+
+        return ReturnCode;
+    }
+
     va_start(ArgPtr, SpecStringPtr);
     CFE_ES_SysLog_vsnprintf(TmpString, sizeof(TmpString), SpecStringPtr, ArgPtr);
     va_end(ArgPtr);
 
-    /*
-     * Append to the syslog buffer, which must be done while locked.
-     * Only one thread can actively write into the buffer at time.
-     */
-    CFE_ES_LockSharedData(__func__, __LINE__);
-    ReturnCode = CFE_ES_SysLogAppend_Unsync(TmpString);
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+    if (!CFE_ES_ATOMIC_LOCK_FREE)
+    {
+        CFE_ES_LockSharedData(__func__, __LINE__);
+    }
+    ReturnCode = CFE_ES_SysLogAppend(TmpString);
+    if (!CFE_ES_ATOMIC_LOCK_FREE)
+    {
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+    }
 
     /* Output the entry to the console */
     OS_printf("%s", TmpString);
@@ -1529,6 +1648,158 @@ uint32 CFE_ES_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputC
     return CrcResult;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_CombineCRC(uint32 CrcA, uint32 CrcB, size_t LengthB, CFE_ES_CrcType_Enum_t TypeCRC)
+{
+    CFE_ES_ComputeCRC_Params_t *CrcParams;
+
+    /* This always returns a valid object, even if it is not implemented */
+    CrcParams = CFE_ES_ComputeCRC_GetParams(TypeCRC);
+
+    return CFE_ES_ComputeCRC_Combine(CrcParams, CrcA, CrcB, CFE_ES_ComputeCRC_ShiftOperator(CrcParams, LengthB));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Computes the CRC of one chunk of a chunked CRC
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_ChunkedCRCComputeChunk(CFE_ES_ComputeCRC_Params_t *CrcParams, CFE_ES_ChunkedCRC_t *ChunkedCRC,
+                                          const uint8 *DataPtr, uint32 ChunkIdx)
+{
+    size_t ChunkOffset;
+    size_t ChunkLength;
+
+    ChunkOffset = ChunkIdx * ChunkedCRC->ChunkSize;
+    ChunkLength = ChunkedCRC->DataLength - ChunkOffset;
+    if (ChunkLength > ChunkedCRC->ChunkSize)
+    {
+        ChunkLength = ChunkedCRC->ChunkSize;
+    }
+
+    ChunkedCRC->ChunkCRC[ChunkIdx] = CrcParams->Algorithm(&DataPtr[ChunkOffset], ChunkLength, 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Combines the CRC of all chunks of a chunked CRC into the CRC of the block
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_ChunkedCRCCombineAll(CFE_ES_ComputeCRC_Params_t *CrcParams, const CFE_ES_ChunkedCRC_t *ChunkedCRC)
+{
+    uint32 CrcResult;
+    uint32 ChunkIdx;
+
+    CrcResult = ChunkedCRC->ChunkCRC[0];
+    for (ChunkIdx = 1; ChunkIdx < ChunkedCRC->NumChunks; ++ChunkIdx)
+    {
+        if (ChunkIdx == (ChunkedCRC->NumChunks - 1))
+        {
+            CrcResult = CFE_ES_ComputeCRC_Combine(CrcParams, CrcResult, ChunkedCRC->ChunkCRC[ChunkIdx],
+                                                  ChunkedCRC->LastShift);
+        }
+        else
+        {
+            CrcResult = CFE_ES_ComputeCRC_Combine(CrcParams, CrcResult, ChunkedCRC->ChunkCRC[ChunkIdx],
+                                                  ChunkedCRC->ChunkShift);
+        }
+    }
+
+    return CrcResult;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_ChunkedCRCInit(CFE_ES_ChunkedCRC_t *ChunkedCRC, const void *DataPtr, size_t DataLength,
+                             CFE_ES_CrcType_Enum_t TypeCRC)
+{
+    CFE_ES_ComputeCRC_Params_t *CrcParams;
+    size_t                      ChunkSize;
+    uint32                      ChunkIdx;
+
+    if (ChunkedCRC == NULL)
+    {
+        return 0;
+    }
+
+    memset(ChunkedCRC, 0, sizeof(*ChunkedCRC));
+
+    if (DataPtr == NULL || DataLength == 0)
+    {
+        return 0;
+    }
+
+    /* This always returns a valid object, even if it is not implemented */
+    CrcParams = CFE_ES_ComputeCRC_GetParams(TypeCRC);
+
+    /* Use chunks of a multiple of the minimum size, and no more chunks than there is room for */
+    ChunkSize = (DataLength + CFE_MISSION_ES_CRC_MAX_CHUNKS - 1) / CFE_MISSION_ES_CRC_MAX_CHUNKS;
+    ChunkSize = (ChunkSize + CFE_ES_CRC_MIN_CHUNK_SIZE - 1) & ~((size_t)CFE_ES_CRC_MIN_CHUNK_SIZE - 1);
+
+    ChunkedCRC->TypeCRC    = TypeCRC;
+    ChunkedCRC->DataLength = DataLength;
+    ChunkedCRC->ChunkSize  = ChunkSize;
+    ChunkedCRC->NumChunks  = (DataLength + ChunkSize - 1) / ChunkSize;
+    ChunkedCRC->ChunkShift = CFE_ES_ComputeCRC_ShiftOperator(CrcParams, ChunkSize);
+    ChunkedCRC->LastShift =
+        CFE_ES_ComputeCRC_ShiftOperator(CrcParams, DataLength - ((ChunkedCRC->NumChunks - 1) * ChunkSize));
+
+    for (ChunkIdx = 0; ChunkIdx < ChunkedCRC->NumChunks; ++ChunkIdx)
+    {
+        CFE_ES_ChunkedCRCComputeChunk(CrcParams, ChunkedCRC, DataPtr, ChunkIdx);
+    }
+
+    return CFE_ES_ChunkedCRCCombineAll(CrcParams, ChunkedCRC);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_ChunkedCRCUpdate(CFE_ES_ChunkedCRC_t *ChunkedCRC, const void *DataPtr, size_t Offset, size_t Length)
+{
+    CFE_ES_ComputeCRC_Params_t *CrcParams;
+    uint32                      ChunkIdx;
+    uint32                      LastChunkIdx;
+
+    if (ChunkedCRC == NULL || DataPtr == NULL || ChunkedCRC->NumChunks == 0)
+    {
+        return 0;
+    }
+
+    CrcParams = CFE_ES_ComputeCRC_GetParams(ChunkedCRC->TypeCRC);
+
+    if (Offset < ChunkedCRC->DataLength && Length != 0)
+    {
+        if (Length > (ChunkedCRC->DataLength - Offset))
+        {
+            Length = ChunkedCRC->DataLength - Offset;
+        }
+
+        /* Only the chunks that overlap the changed range need to be computed again */
+        LastChunkIdx = (Offset + Length - 1) / ChunkedCRC->ChunkSize;
+        for (ChunkIdx = Offset / ChunkedCRC->ChunkSize; ChunkIdx <= LastChunkIdx; ++ChunkIdx)
+        {
+            CFE_ES_ChunkedCRCComputeChunk(CrcParams, ChunkedCRC, DataPtr, ChunkIdx);
+        }
+    }
+
+    return CFE_ES_ChunkedCRCCombineAll(CrcParams, ChunkedCRC);
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -1707,6 +1978,50 @@ CFE_Status_t CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, const void *DataToCopy)
     return CFE_ES_CDSBlockWrite(Handle, DataToCopy);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, size_t Offset, size_t Size, const void *DataToCopy)
+{
+    if (DataToCopy == NULL)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    return CFE_ES_CDSBlockWriteRange(Handle, Offset, Size, DataToCopy);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_SetCDSWriteBehind(CFE_ES_CDSHandle_t Handle, bool WriteBehind)
+{
+    return CFE_ES_CDSBlockSetWriteBehind(Handle, WriteBehind);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_FlushCDS(void)
+{
+    /* Without a CDS, no block can be in write-behind mode */
+    if (!CFE_ES_Global.CDSIsAvailable)
+    {
+        return CFE_SUCCESS;
+    }
+
+    return CFE_ES_CDSWriteBehindFlush();
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -2037,7 +2352,10 @@ CFE_Status_t CFE_ES_CounterID_ToIndex(CFE_ES_CounterId_t CounterId, uint32 *Idx)
  *-----------------------------------------------------------------*/
 void CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber)
 {
-    int32 OsStatus;
+    int32                     OsStatus;
+    CFE_ES_LockProfileStamp_t Stamp;
+
+    CFE_ES_LOCKPROF_BEGIN(&Stamp);
 
     OsStatus = OS_MutSemTake(CFE_ES_Global.SharedDataMutex);
     if (OsStatus != OS_SUCCESS)
@@ -2049,6 +2367,10 @@ void CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber)
         CFE_ES_SysLogWrite_Unsync("%s: SharedData Mutex Take Err Stat=%ld,Func=%s,Line=%d\n", __func__, (long)OsStatus,
                                   FunctionName, (int)LineNumber);
     }
+    else
+    {
+        CFE_ES_LOCKPROF_ACQUIRED(CFE_ES_LockProfileId_ES_SHARED_DATA, FunctionName, LineNumber, &Stamp);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -2061,6 +2383,8 @@ void CFE_ES_UnlockSharedData(const char *FunctionName, int32 LineNumber)
 {
     int32 OsStatus;
 
+    CFE_ES_LOCKPROF_RELEASED(CFE_ES_LockProfileId_ES_SHARED_DATA);
+
     OsStatus = OS_MutSemGive(CFE_ES_Global.SharedDataMutex);
     if (OsStatus != OS_SUCCESS)
     {
@@ -50,6 +50,9 @@
 */
 #define ES_START_BUFF_SIZE 128
 
+#define CFE_ES_STARTUP_SEM_NAME    "ES_StartupWake"
+#define CFE_ES_STARTUP_WORKER_NAME "ES_Startup"
+
 /*
 **
 **  Global Variables
@@ -199,6 +202,13 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
     {
         CFE_ES_WriteToSysLog("%s: Opened ES App Startup file: %s\n", __func__, ScriptFileName);
 
+        /*
+        ** With worker tasks, the entries are only queued while parsing,
+        ** and are all loaded/started after the end of the script.
+        */
+        CFE_ES_Global.StartupQueue.IsActive   = (CFE_PLATFORM_ES_STARTUP_WORKERS != 0);
+        CFE_ES_Global.StartupQueue.NumEntries = 0;
+
         memset(ES_AppLoadBuffer, 0x0, ES_START_BUFF_SIZE);
         BuffLen      = 0;
         NumTokens    = 0;
@@ -316,6 +326,11 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
         ** close the file
         */
         OS_close(AppFile);
+
+        if (CFE_ES_Global.StartupQueue.IsActive)
+        {
+            CFE_ES_RunStartupQueue(CFE_PLATFORM_ES_STARTUP_WORKERS);
+        }
     }
 }
 
@@ -329,6 +344,7 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
 {
     const char *  ModuleName;
     const char *  EntryType;
+    const char *  DepList;
     unsigned long ParsedValue;
     union
     {
@@ -353,6 +369,19 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
     EntryType  = TokenList[0];
     ModuleName = TokenList[3];
 
+    /*
+     * The dependency list (8) is optional.  It only matters to the startup
+     * tasks, as the serial startup always follows the script order.
+     */
+    if (NumTokens > 8)
+    {
+        DepList = TokenList[8];
+    }
+    else
+    {
+        DepList = NULL;
+    }
+
     /*
      * Other tokens will need to be scrubbed/converted.
      * Both Libraries and Apps use File Name (1) and Symbol Name (2) fields so copy those now
@@ -408,18 +437,32 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
         }
 
         /*
-        ** Now create the application
+        ** Now create the application, or queue it for the startup tasks
         */
-        Status = CFE_ES_AppCreate(&IdBuf.AppId, ModuleName, &ParamBuf);
+        if (CFE_ES_Global.StartupQueue.IsActive)
+        {
+            Status = CFE_ES_StartupQueueAdd(ModuleName, false, &ParamBuf, DepList);
+        }
+        else
+        {
+            Status = CFE_ES_AppCreate(&IdBuf.AppId, ModuleName, &ParamBuf);
+        }
     }
     else if (strcmp(EntryType, "CFE_LIB") == 0)
     {
         CFE_ES_WriteToSysLog("%s: Loading shared library: %s\n", __func__, ParamBuf.BasicInfo.FileName);
 
         /*
-        ** Now load the library
+        ** Now load the library, or queue it for the startup tasks
         */
-        Status = CFE_ES_LoadLibrary(&IdBuf.LibId, ModuleName, &ParamBuf.BasicInfo);
+        if (CFE_ES_Global.StartupQueue.IsActive)
+        {
+            Status = CFE_ES_StartupQueueAdd(ModuleName, true, &ParamBuf, DepList);
+        }
+        else
+        {
+            Status = CFE_ES_LoadLibrary(&IdBuf.LibId, ModuleName, &ParamBuf.BasicInfo);
+        }
     }
     else
     {
@@ -430,6 +473,306 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_StartupQueueAdd(const char *ModuleName, bool IsLibrary, const CFE_ES_AppStartParams_t *Params,
+                             const char *DepList)
+{
+    CFE_ES_StartupQueue_t *QueuePtr = &CFE_ES_Global.StartupQueue;
+    CFE_ES_StartupEntry_t *EntryPtr;
+    const char *           NamePtr;
+    size_t                 NameLen;
+    uint32                 i;
+
+    /*
+     * Entries are only added while parsing the script, before any startup
+     * task runs, so the queue is not locked here.
+     */
+    if (QueuePtr->NumEntries >= CFE_ES_STARTUP_QUEUE_SIZE)
+    {
+        CFE_ES_WriteToSysLog("%s: Startup queue full, cannot queue %s\n", __func__, ModuleName);
+        return CFE_ES_NO_RESOURCE_IDS_AVAILABLE;
+    }
+
+    EntryPtr = &QueuePtr->Entries[QueuePtr->NumEntries];
+    memset(EntryPtr, 0, sizeof(*EntryPtr));
+
+    strncpy(EntryPtr->ModuleName, ModuleName, sizeof(EntryPtr->ModuleName) - 1);
+    EntryPtr->IsLibrary  = IsLibrary;
+    EntryPtr->WaitForAll = (DepList == NULL);
+    EntryPtr->State      = CFE_ES_STARTUP_ENTRY_PENDING;
+    EntryPtr->Params     = *Params;
+
+    /*
+     * Resolve the names in the dependency list to preceding entries.  As an
+     * entry can only depend on preceding entries, there are no cycles.
+     * "NONE" (or an empty list) means the entry does not depend on any entry.
+     */
+    if (DepList != NULL && strcmp(DepList, "NONE") != 0)
+    {
+        NamePtr = DepList;
+        while (*NamePtr != 0 && !EntryPtr->WaitForAll)
+        {
+            NameLen = strcspn(NamePtr, ":");
+            if (NameLen > 0)
+            {
+                for (i = 0; i < QueuePtr->NumEntries; ++i)
+                {
+                    if (NameLen < sizeof(EntryPtr->ModuleName) &&
+                        strncmp(QueuePtr->Entries[i].ModuleName, NamePtr, NameLen) == 0 &&
+                        QueuePtr->Entries[i].ModuleName[NameLen] == 0)
+                    {
+                        break;
+                    }
+                }
+
+                if (i >= QueuePtr->NumEntries || EntryPtr->NumDeps >= CFE_ES_STARTSCRIPT_MAX_DEPENDENCIES)
+                {
+                    CFE_ES_WriteToSysLog("%s: Cannot resolve dependencies of %s, waiting for all preceding entries\n",
+                                         __func__, ModuleName);
+                    EntryPtr->WaitForAll = true;
+                }
+                else
+                {
+                    EntryPtr->DepIndex[EntryPtr->NumDeps] = (uint16)i;
+                    ++EntryPtr->NumDeps;
+                }
+            }
+
+            NamePtr += NameLen;
+            if (*NamePtr == ':')
+            {
+                ++NamePtr;
+            }
+        }
+    }
+
+    ++QueuePtr->NumEntries;
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Checks if all dependencies of a startup queue entry are done.
+ * Must be called with the ES lock held.
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_StartupEntryIsReady(const CFE_ES_StartupQueue_t *QueuePtr, uint32 EntryIdx)
+{
+    const CFE_ES_StartupEntry_t *EntryPtr = &QueuePtr->Entries[EntryIdx];
+    uint32                       i;
+    bool                         IsReady;
+
+    IsReady = true;
+    if (EntryPtr->WaitForAll)
+    {
+        for (i = 0; i < EntryIdx && IsReady; ++i)
+        {
+            IsReady = (QueuePtr->Entries[i].State == CFE_ES_STARTUP_ENTRY_DONE);
+        }
+    }
+    else
+    {
+        for (i = 0; i < EntryPtr->NumDeps && IsReady; ++i)
+        {
+            IsReady = (QueuePtr->Entries[EntryPtr->DepIndex[i]].State == CFE_ES_STARTUP_ENTRY_DONE);
+        }
+    }
+
+    return IsReady;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupQueueProcess(void)
+{
+    CFE_ES_StartupQueue_t *QueuePtr = &CFE_ES_Global.StartupQueue;
+    CFE_ES_StartupEntry_t *EntryPtr;
+    union
+    {
+        CFE_ES_AppId_t AppId;
+        CFE_ES_LibId_t LibId;
+    } IdBuf;
+    int32  Status;
+    uint32 i;
+    bool   AllDone;
+
+    while (true)
+    {
+        /*
+         * Claim the first pending entry whose dependencies are done,
+         * so that entries are started in script order where possible
+         */
+        EntryPtr = NULL;
+
+        CFE_ES_LockSharedData(__func__, __LINE__);
+
+        for (i = 0; i < QueuePtr->NumEntries; ++i)
+        {
+            if (QueuePtr->Entries[i].State == CFE_ES_STARTUP_ENTRY_PENDING && CFE_ES_StartupEntryIsReady(QueuePtr, i))
+            {
+                EntryPtr        = &QueuePtr->Entries[i];
+                EntryPtr->State = CFE_ES_STARTUP_ENTRY_LOADING;
+                break;
+            }
+        }
+        AllDone = (QueuePtr->NumDone >= QueuePtr->NumEntries);
+
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        if (EntryPtr != NULL)
+        {
+            if (EntryPtr->IsLibrary)
+            {
+                Status = CFE_ES_LoadLibrary(&IdBuf.LibId, EntryPtr->ModuleName, &EntryPtr->Params.BasicInfo);
+            }
+            else
+            {
+                Status = CFE_ES_AppCreate(&IdBuf.AppId, EntryPtr->ModuleName, &EntryPtr->Params);
+            }
+
+            /*
+             * As in the serial startup, a failed entry does not stop the
+             * entries depending on it; the failure was already logged.
+             */
+            CFE_ES_LockSharedData(__func__, __LINE__);
+            EntryPtr->Status = Status;
+            EntryPtr->State  = CFE_ES_STARTUP_ENTRY_DONE;
+            ++QueuePtr->NumDone;
+            OS_BinSemFlush(QueuePtr->WakeSemId);
+            CFE_ES_UnlockSharedData(__func__, __LINE__);
+        }
+        else if (AllDone)
+        {
+            break;
+        }
+        else
+        {
+            /*
+             * Wait for another task to finish an entry.  The timeout covers
+             * an entry finished between the check above and this wait.
+             */
+            OS_BinSemTimedWait(QueuePtr->WakeSemId, CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupWorkerMain(void)
+{
+    CFE_ES_StartupQueueProcess();
+
+    /*
+     * Flush while still holding the lock, as the startup task
+     * deletes the semaphore as soon as no worker is active.
+     */
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    --CFE_ES_Global.StartupQueue.ActiveWorkers;
+    OS_BinSemFlush(CFE_ES_Global.StartupQueue.WakeSemId);
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_RunStartupQueue(uint32 NumWorkers)
+{
+    CFE_ES_StartupQueue_t *QueuePtr = &CFE_ES_Global.StartupQueue;
+    char                   TaskName[OS_MAX_API_NAME];
+    osal_id_t              TaskId;
+    uint32                 i;
+    int32                  OsStatus;
+    bool                   WorkersDone;
+
+    QueuePtr->NumDone       = 0;
+    QueuePtr->ActiveWorkers = 0;
+
+    OsStatus = OS_BinSemCreate(&QueuePtr->WakeSemId, CFE_ES_STARTUP_SEM_NAME, 0, 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        /* Without the semaphore, the entries are all started by this task, in order */
+        CFE_ES_WriteToSysLog("%s: Cannot create startup semaphore, starting entries serially. EC = %ld\n", __func__,
+                             (long)OsStatus);
+        QueuePtr->WakeSemId = OS_OBJECT_ID_UNDEFINED;
+        NumWorkers          = 0;
+    }
+
+    for (i = 0; i < NumWorkers; ++i)
+    {
+        snprintf(TaskName, sizeof(TaskName), CFE_ES_STARTUP_WORKER_NAME "%u", (unsigned int)i);
+
+        /* Counted before the creation, as the worker may finish right away */
+        CFE_ES_LockSharedData(__func__, __LINE__);
+        ++QueuePtr->ActiveWorkers;
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        /*
+         * The workers stand in for the ES main task, which runs the startup
+         * script outside of any app, so they are plain OSAL tasks rather than
+         * ES child tasks: a child task needs a registered parent app, and
+         * would be listed, and cleaned up, as part of it.  They exit before
+         * this function returns, ahead of the first app table scan.
+         */
+        OsStatus = OS_TaskCreate(&TaskId, TaskName, CFE_ES_StartupWorkerMain, CFE_ES_TASK_STACK_ALLOCATE,
+                                 CFE_PLATFORM_ES_START_TASK_STACK_SIZE, CFE_PLATFORM_ES_START_TASK_PRIORITY,
+                                 OS_FP_ENABLED);
+        if (OsStatus != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Cannot create startup worker %s. EC = %ld\n", __func__, TaskName,
+                                 (long)OsStatus);
+
+            CFE_ES_LockSharedData(__func__, __LINE__);
+            --QueuePtr->ActiveWorkers;
+            CFE_ES_UnlockSharedData(__func__, __LINE__);
+        }
+    }
+
+    /* This task works on the queue as well */
+    CFE_ES_StartupQueueProcess();
+
+    /* All entries are done, but the workers may not have noticed yet */
+    while (true)
+    {
+        CFE_ES_LockSharedData(__func__, __LINE__);
+        WorkersDone = (QueuePtr->ActiveWorkers == 0);
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        if (WorkersDone)
+        {
+            break;
+        }
+
+        OS_BinSemTimedWait(QueuePtr->WakeSemId, CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC);
+    }
+
+    if (OS_ObjectIdDefined(QueuePtr->WakeSemId))
+    {
+        OS_BinSemDelete(QueuePtr->WakeSemId);
+        QueuePtr->WakeSemId = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    QueuePtr->IsActive   = false;
+    QueuePtr->NumEntries = 0;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -800,6 +1143,8 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
         return Status;
     }
 
+    CFE_ES_TimelineAddModule(PendingResourceId, AppName, CFE_ES_TimelineRecordType_APP);
+
     /*
      * Load the module based on StartParams configured above.
      */
@@ -810,6 +1155,8 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
      */
     if (Status == CFE_SUCCESS)
     {
+        CFE_ES_TimelineMarkModule(PendingResourceId, CFE_ES_TimelineMilestone_LOADED);
+
         Status =
             CFE_ES_StartAppTask(&AppRecPtr->MainTaskId, /* Task ID (output) stored in App Record as main task */
                                 AppName,                /* Main Task name matches app name */
@@ -819,6 +1166,11 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
                                 CFE_ES_APPID_C(PendingResourceId));          /* Parent App ID */
     }
 
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_ES_TimelineMarkModule(PendingResourceId, CFE_ES_TimelineMilestone_STARTED);
+    }
+
     /*
      * Finalize data in the app table entry, which must be done under lock.
      * This transitions the entry from being RESERVED to the real ID.
@@ -968,12 +1320,16 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t *LibraryIdPtr, const char *LibName, cons
         return Status;
     }
 
+    CFE_ES_TimelineAddModule(PendingResourceId, LibName, CFE_ES_TimelineRecordType_LIB);
+
     /*
      * Load the module based on StartParams configured above.
      */
     Status = CFE_ES_LoadModule(PendingResourceId, LibName, &LibSlotPtr->LoadParams, &LibSlotPtr->LoadStatus);
     if (Status == CFE_SUCCESS)
     {
+        CFE_ES_TimelineMarkModule(PendingResourceId, CFE_ES_TimelineMilestone_LOADED);
+
         FunctionPointer = (CFE_ES_LibraryEntryFuncPtr_t)LibSlotPtr->LoadStatus.InitSymbolAddress;
         if (FunctionPointer != NULL)
         {
@@ -985,6 +1341,11 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t *LibraryIdPtr, const char *LibName, cons
         }
     }
 
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_ES_TimelineMarkModule(PendingResourceId, CFE_ES_TimelineMilestone_STARTED);
+    }
+
     /*
      * Finalize data in the app table entry, which must be done under lock.
      * This transitions the entry from being RESERVED to the real type,
@@ -1734,6 +2095,9 @@ int32 CFE_ES_CleanupTaskResources(CFE_ES_TaskId_t TaskId)
     OsStatus = OS_TaskDelete(OsalId);
     if (OsStatus == OS_SUCCESS || OsStatus == OS_ERR_INVALID_ID)
     {
+        /* The task is no longer running, return the pool blocks it had cached */
+        CFE_ES_MemPoolFlushTaskCaches(TaskId);
+
         Result = CleanState.OverallStatus;
         if (Result == CFE_SUCCESS && CleanState.FoundObjects > 0)
         {
@@ -36,6 +36,7 @@
 ** Include Files
 */
 #include "common_types.h"
+#include "cfe_platform_cfg.h"
 
 #include "cfe_es_api_typedefs.h"
 #include "cfe_fs_api_typedefs.h"
@@ -43,7 +44,21 @@
 /*
 ** Macro Definitions
 */
-#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE 8
+#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE 9
+#define CFE_ES_STARTSCRIPT_MAX_DEPENDENCIES    8
+
+/*
+ * The startup queue holds every entry of the startup script when
+ * the script is run by worker tasks (CFE_PLATFORM_ES_STARTUP_WORKERS)
+ */
+#define CFE_ES_STARTUP_QUEUE_SIZE (CFE_PLATFORM_ES_MAX_APPLICATIONS + CFE_PLATFORM_ES_MAX_LIBRARIES)
+
+/*
+ * States of a startup queue entry
+ */
+#define CFE_ES_STARTUP_ENTRY_PENDING 0 /* Waiting for its dependencies */
+#define CFE_ES_STARTUP_ENTRY_LOADING 1 /* Claimed by a task, being loaded/started */
+#define CFE_ES_STARTUP_ENTRY_DONE    2 /* Finished, successfully or not */
 
 /*
 ** Type Definitions
@@ -174,6 +189,37 @@ typedef struct
     uint8  LastScanCommandCount;
 } CFE_ES_AppTableScanState_t;
 
+/*
+** CFE_ES_StartupEntry_t is an internal structure holding a parsed
+** startup script entry until a startup task loads/starts it.
+*/
+typedef struct
+{
+    char                    ModuleName[OS_MAX_API_NAME]; /* The CFE name of the app or library */
+    bool                    IsLibrary;                   /* CFE_LIB entry, rather than CFE_APP */
+    bool                    WaitForAll;                  /* No dependency list, wait for all preceding entries */
+    uint8                   State;                       /* One of the CFE_ES_STARTUP_ENTRY_ values */
+    uint8                   NumDeps;                     /* Number of valid entries in DepIndex */
+    uint16                  DepIndex[CFE_ES_STARTSCRIPT_MAX_DEPENDENCIES]; /* Queue index of each dependency */
+    int32                   Status;                                        /* Result of the load/start */
+    CFE_ES_AppStartParams_t Params;                                        /* Start parameters from the script */
+} CFE_ES_StartupEntry_t;
+
+/*
+** CFE_ES_StartupQueue_t is an internal structure used to keep state of
+** running the startup script on worker tasks.  The entries and counters
+** are protected by the ES shared data lock.
+*/
+typedef struct
+{
+    bool                  IsActive;      /* Script entries are queued rather than started directly */
+    uint32                NumEntries;    /* Number of queued entries */
+    uint32                NumDone;       /* Number of entries in the DONE state */
+    uint32                ActiveWorkers; /* Number of worker tasks that did not finish yet */
+    osal_id_t             WakeSemId;     /* Flushed whenever an entry is done or a worker finishes */
+    CFE_ES_StartupEntry_t Entries[CFE_ES_STARTUP_QUEUE_SIZE];
+} CFE_ES_StartupQueue_t;
+
 /*****************************************************************************/
 /*
 ** Function prototypes
@@ -191,6 +237,53 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath);
  */
 int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Adds a parsed startup script entry to the startup queue
+ *
+ * The dependency list holds the CFE names of preceding entries, separated by ':'.
+ * If the list is NULL, or it cannot be resolved, the entry waits for all of the
+ * preceding entries.
+ *
+ * \param[in] ModuleName The CFE name of the app or library
+ * \param[in] IsLibrary  Whether the entry is a library, rather than an app
+ * \param[in] Params     The start parameters of the entry
+ * \param[in] DepList    The dependency list of the entry, may be NULL
+ *
+ * \retval #CFE_SUCCESS if the entry was queued
+ * \retval #CFE_ES_NO_RESOURCE_IDS_AVAILABLE if the queue is full
+ */
+int32 CFE_ES_StartupQueueAdd(const char *ModuleName, bool IsLibrary, const CFE_ES_AppStartParams_t *Params,
+                             const char *DepList);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Loads/starts the entries of the startup queue
+ *
+ * Claims entries whose dependencies are done, in queue order, and loads/starts
+ * them until all entries of the queue are done.  This is run by the ES startup
+ * task as well as by each of the worker tasks.
+ */
+void CFE_ES_StartupQueueProcess(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Entry point of the startup script worker tasks
+ */
+void CFE_ES_StartupWorkerMain(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Runs the startup queue on worker tasks
+ *
+ * Creates the given number of worker tasks, helps them process the queue, and
+ * returns once all entries are done and all worker tasks finished.  The queue
+ * is then empty and inactive.
+ *
+ * \param[in] NumWorkers The number of worker tasks to create, may be zero
+ */
+void CFE_ES_RunStartupQueue(uint32 NumWorkers);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * Helper function to load + configure (but not start) a new app/lib module
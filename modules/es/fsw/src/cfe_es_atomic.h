@@ -0,0 +1,234 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ *  Purpose:
+ *  Atomic memory operations used by the lock-free parts of ES.
+ *
+ *  Notes:
+ *  Neither C99 nor OSAL provide atomic operations, so these use the
+ *  GCC/Clang atomic builtins where the target supports them natively.
+ *
+ *  On other compilers and targets CFE_ES_ATOMIC_LOCK_FREE is 0 and
+ *  the functions fall back to plain memory accesses.  Callers must then
+ *  keep the data under a lock, so the fallbacks only exist to keep the
+ *  callers free of conditional compilation.
+ */
+
+#ifndef CFE_ES_ATOMIC_H
+#define CFE_ES_ATOMIC_H
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+/*
+** Macro Definitions
+*/
+#if defined(__ATOMIC_ACQ_REL) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2) && \
+    defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+#define CFE_ES_ATOMIC_LOCK_FREE 1
+#else
+#define CFE_ES_ATOMIC_LOCK_FREE 0
+#endif
+
+/*
+** Function Definitions
+*/
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Reads a 64 bit value shared with other tasks
+ *
+ * \param[in] Ptr  Value to read
+ * \return The value
+ */
+static inline uint64 CFE_ES_AtomicLoad64(const uint64 *Ptr)
+{
+#if CFE_ES_ATOMIC_LOCK_FREE
+    return __atomic_load_n(Ptr, __ATOMIC_ACQUIRE);
+#else
+    return *Ptr;
+#endif
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Reads a 32 bit value shared with other tasks
+ *
+ * \param[in] Ptr  Value to read
+ * \return The value
+ */
+static inline uint32 CFE_ES_AtomicLoad32(const uint32 *Ptr)
+{
+#if CFE_ES_ATOMIC_LOCK_FREE
+    return __atomic_load_n(Ptr, __ATOMIC_ACQUIRE);
+#else
+    return *Ptr;
+#endif
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Publishes a 32 bit value shared with other tasks
+ *
+ * Writes made before the store are visible to a task that reads the value with
+ * CFE_ES_AtomicLoad32().
+ *
+ * \param[out] Ptr    Value to write
+ * \param[in]  Value  New value
+ */
+static inline void CFE_ES_AtomicStore32(uint32 *Ptr, uint32 Value)
+{
+#if CFE_ES_ATOMIC_LOCK_FREE
+    __atomic_store_n(Ptr, Value, __ATOMIC_RELEASE);
+#else
+    *Ptr = Value;
+#endif
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Replaces a 32 bit value shared with other tasks, and gets the old value
+ *
+ * This is a full barrier: no read made after the exchange is done before it.
+ * Two tasks that each exchange one value and then read the other's value are
+ * guaranteed that at least one of them sees the other's new value.
+ *
+ * \param[inout] Ptr    Value to replace
+ * \param[in]    Value  New value
+ * \return The value before the exchange
+ */
+static inline uint32 CFE_ES_AtomicExchange32(uint32 *Ptr, uint32 Value)
+{
+#if CFE_ES_ATOMIC_LOCK_FREE
+    return __atomic_exchange_n(Ptr, Value, __ATOMIC_SEQ_CST);
+#else
+    uint32 OldValue = *Ptr;
+    *Ptr            = Value;
+    return OldValue;
+#endif
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Replaces a 64 bit value if it still holds the expected value
+ *
+ * \param[inout] Ptr       Value to replace
+ * \param[inout] Expected  Expected value, updated to the current value if it did not match
+ * \param[in]    Desired   New value
+ * \return true if the value was replaced
+ */
+static inline bool CFE_ES_AtomicCompareExchange64(uint64 *Ptr, uint64 *Expected, uint64 Desired)
+{
+#if CFE_ES_ATOMIC_LOCK_FREE
+    return __atomic_compare_exchange_n(Ptr, Expected, Desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#else
+    if (*Ptr != *Expected)
+    {
+        *Expected = *Ptr;
+        return false;
+    }
+    *Ptr = Desired;
+    return true;
+#endif
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Replaces a 32 bit value if it still holds the expected value
+ *
+ * \param[inout] Ptr       Value to replace
+ * \param[inout] Expected  Expected value, updated to the current value if it did not match
+ * \param[in]    Desired   New value
+ * \return true if the value was replaced
+ */
+static inline bool CFE_ES_AtomicCompareExchange32(uint32 *Ptr, uint32 *Expected, uint32 Desired)
+{
+#if CFE_ES_ATOMIC_LOCK_FREE
+    return __atomic_compare_exchange_n(Ptr, Expected, Desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#else
+    if (*Ptr != *Expected)
+    {
+        *Expected = *Ptr;
+        return false;
+    }
+    *Ptr = Desired;
+    return true;
+#endif
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Replaces a 16 bit value if it still holds the expected value
+ *
+ * \param[inout] Ptr       Value to replace
+ * \param[inout] Expected  Expected value, updated to the current value if it did not match
+ * \param[in]    Desired   New value
+ * \return true if the value was replaced
+ */
+static inline bool CFE_ES_AtomicCompareExchange16(uint16 *Ptr, uint16 *Expected, uint16 Desired)
+{
+#if CFE_ES_ATOMIC_LOCK_FREE
+    return __atomic_compare_exchange_n(Ptr, Expected, Desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#else
+    if (*Ptr != *Expected)
+    {
+        *Expected = *Ptr;
+        return false;
+    }
+    *Ptr = Desired;
+    return true;
+#endif
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Increments a 32 bit counter shared with other tasks
+ *
+ * \param[inout] Ptr  Counter to increment
+ */
+static inline void CFE_ES_AtomicIncrement32(uint32 *Ptr)
+{
+#if CFE_ES_ATOMIC_LOCK_FREE
+    __atomic_fetch_add(Ptr, 1, __ATOMIC_RELAXED);
+#else
+    ++(*Ptr);
+#endif
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Increments a 32 bit counter shared with other tasks, and gets the new value
+ *
+ * \param[inout] Ptr  Counter to increment
+ * \return The value after the increment
+ */
+static inline uint32 CFE_ES_AtomicIncrementFetch32(uint32 *Ptr)
+{
+#if CFE_ES_ATOMIC_LOCK_FREE
+    return __atomic_add_fetch(Ptr, 1, __ATOMIC_ACQ_REL);
+#else
+    return ++(*Ptr);
+#endif
+}
+
+#endif /* CFE_ES_ATOMIC_H */
@@ -74,6 +74,11 @@ const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[] = {
      .JobArg       = &CFE_ES_Global.BackgroundPerfDumpState,
      .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
      .IdlePeriod   = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000},
+    {/* Performance Log Data Streaming to rolling files */
+     .RunFunc      = CFE_ES_RunPerfLogStream,
+     .JobArg       = &CFE_ES_Global.BackgroundPerfStreamState,
+     .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
+     .IdlePeriod   = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000},
     {/* Check for exceptions stored in the PSP */
      .RunFunc      = CFE_ES_RunExceptionScan,
      .JobArg       = NULL,
@@ -83,7 +88,12 @@ const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[] = {
      .RunFunc      = CFE_FS_RunBackgroundFileDump,
      .JobArg       = NULL,
      .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
-     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE}};
+     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE},
+    {/* Write the changes of CDS blocks in write-behind mode to the CDS */
+     .RunFunc      = CFE_ES_RunCDSWriteBehind,
+     .JobArg       = &CFE_ES_Global.CDSVars,
+     .ActivePeriod = CFE_ES_CDS_WRITE_BEHIND_POLL,
+     .IdlePeriod   = CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE}};
 
 #define CFE_ES_BACKGROUND_NUM_JOBS (sizeof(CFE_ES_BACKGROUND_JOB_TABLE) / sizeof(CFE_ES_BACKGROUND_JOB_TABLE[0]))
 
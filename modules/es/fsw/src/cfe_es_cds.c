@@ -67,6 +67,14 @@ int32 CFE_ES_CDS_EarlyInit(void)
         return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
     }
 
+    /* Create the mutex that keeps blocks from being freed while they are flushed */
+    OsStatus = OS_MutSemCreate(&CDS->FlushMutex, CFE_ES_CDS_MUT_FLUSH_NAME, CFE_ES_CDS_MUT_FLUSH_VALUE);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_SysLogWrite_Unsync("%s: Failed to create flush mutex with error %ld\n", __func__, (long)OsStatus);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
     CDS->LastCDSBlockId = CFE_ResourceId_FromInteger(CFE_ES_CDSBLOCKID_BASE);
 
     /* Get CDS size from PSP.  Note that the PSP interface
@@ -199,6 +207,32 @@ CFE_ES_CDS_RegRec_t *CFE_ES_LocateCDSBlockRecordByID(CFE_ES_CDSHandle_t BlockID)
     return CDSRegRecPtr;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_ChunkedCRC_t *CFE_ES_CDSBlockRecordGetCrcState(const CFE_ES_CDS_RegRec_t *CDSBlockRecPtr)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+
+    return &CDS->BlockCrc[CDSBlockRecPtr - CDS->Registry];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_CDS_WriteBehind_t *CFE_ES_CDSBlockRecordGetWriteBehind(const CFE_ES_CDS_RegRec_t *CDSBlockRecPtr)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+
+    return &CDS->WriteBehind[CDSBlockRecPtr - CDS->Registry];
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -327,6 +361,12 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
         return CFE_ES_CDS_INVALID_SIZE;
     }
 
+    /*
+     * A block that is reallocated must not be in the middle of a write-behind
+     * flush, which writes to the CDS without holding the CDS access mutex.
+     */
+    OS_MutSemTake(CDS->FlushMutex);
+
     /* Lock Registry for update.  This prevents two applications from */
     /* trying to register CDSs at the same location at the same time  */
     CFE_ES_LockCDS();
@@ -381,6 +421,11 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
              */
             if (Status == CFE_SUCCESS)
             {
+                CFE_ES_GenPoolProfileRelease(&CDS->Pool, OldBlockSize);
+
+                /* The shadow has the old size, so write-behind mode must be enabled again */
+                CFE_ES_CDSWriteBehindRelease(RegRecPtr);
+
                 RegRecPtr->BlockOffset = 0;
                 RegRecPtr->BlockSize   = 0;
             }
@@ -391,12 +436,16 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
         {
             /* Allocate the block for the CDS */
             Status = CFE_ES_GenPoolGetBlock(&CDS->Pool, &BlockOffset, NewBlockSize);
+            CFE_ES_GenPoolProfileRequest(&CDS->Pool, NewBlockSize, Status == CFE_SUCCESS);
             if (Status == CFE_SUCCESS)
             {
                 /* Save the size of the CDS */
                 RegRecPtr->BlockOffset = BlockOffset;
                 RegRecPtr->BlockSize   = NewBlockSize;
                 IsNewOffset            = true;
+
+                /* The content of the new block is not known until it is written */
+                memset(CFE_ES_CDSBlockRecordGetCrcState(RegRecPtr), 0, sizeof(CFE_ES_ChunkedCRC_t));
             }
         }
 
@@ -413,13 +462,14 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
 
         if (Status == CFE_SUCCESS && IsNewOffset)
         {
-            /* If we succeeded at creating a CDS, save updated registry in the CDS */
-            RegUpdateStatus = CFE_ES_UpdateCDSRegistry();
+            /* If we succeeded at creating a CDS, save updated registry entry in the CDS */
+            RegUpdateStatus = CFE_ES_UpdateCDSRegistryEntry(RegRecPtr);
         }
     }
 
     /* Unlock Registry for update */
     CFE_ES_UnlockCDS();
+    OS_MutSemGive(CDS->FlushMutex);
 
     /* Log any failures AFTER releasing the lock */
     if (RegUpdateStatus != CFE_SUCCESS)
@@ -561,7 +611,7 @@ int32 CFE_ES_InitCDSSignatures(void)
     if (Status != CFE_SUCCESS)
     {
         /* BSP reported an error writing to CDS */
-        CFE_ES_WriteToSysLog("%s: '_CDSBeg_' write failed. Status=0x%08X\n", __func__,
+        CFE_ES_WriteToSysLog("%s: '%s' write failed. Status=0x%08X\n", __func__, CFE_ES_CDS_SIGNATURE_BEGIN,
                              (unsigned int)CDS->Cache.AccessStatus);
         return Status;
     }
@@ -573,7 +623,7 @@ int32 CFE_ES_InitCDSSignatures(void)
     Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
     if (Status != CFE_SUCCESS)
     {
-        CFE_ES_WriteToSysLog("%s: '_CDSEnd_' write failed. Status=0x%08X\n", __func__,
+        CFE_ES_WriteToSysLog("%s: '%s' write failed. Status=0x%08X\n", __func__, CFE_ES_CDS_SIGNATURE_END,
                              (unsigned int)CDS->Cache.AccessStatus);
         return Status;
     }
@@ -601,6 +651,7 @@ int32 CFE_ES_InitCDSRegistry(void)
     if (Status == CFE_SUCCESS)
     {
         memset(CDS->Registry, 0, sizeof(CDS->Registry));
+        memset(CDS->BlockCrc, 0, sizeof(CDS->BlockCrc));
 
         Status = CFE_ES_UpdateCDSRegistry();
     }
@@ -622,14 +673,47 @@ int32 CFE_ES_InitCDSRegistry(void)
 int32 CFE_ES_UpdateCDSRegistry(void)
 {
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
-    int32                  PspStatus;
+    int32                  Status;
+    uint32                 i;
+
+    /* Copy the contents of the local registry to the CDS, one entry at a time */
+    Status = CFE_SUCCESS;
+    for (i = 0; i < CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES && Status == CFE_SUCCESS; ++i)
+    {
+        Status = CFE_ES_UpdateCDSRegistryEntry(&CDS->Registry[i]);
+    }
 
-    /* Copy the contents of the local registry to the CDS */
-    PspStatus = CFE_PSP_WriteToCDS(CDS->Registry, CDS_REG_OFFSET, sizeof(CDS->Registry));
+    return Status;
+}
 
-    if (PspStatus != CFE_PSP_SUCCESS)
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_UpdateCDSRegistryEntry(const CFE_ES_CDS_RegRec_t *RegRecPtr)
+{
+    CFE_ES_CDS_Instance_t *        CDS = &CFE_ES_Global.CDSVars;
+    CFE_ES_CDS_PersistentRegRec_t *PersistentRecPtr;
+    size_t                         Offset;
+    int32                          Status;
+
+    PersistentRecPtr = &CDS->Cache.Data.RegRecord;
+    Offset           = CDS_REG_OFFSET + ((RegRecPtr - CDS->Registry) * sizeof(CFE_ES_CDS_PersistentRegRec_t));
+
+    memcpy(&PersistentRecPtr->Entry, RegRecPtr, sizeof(PersistentRecPtr->Entry));
+    PersistentRecPtr->Crc = CFE_ES_CalculateCRC(&PersistentRecPtr->Entry, sizeof(PersistentRecPtr->Entry), 0,
+                                                CFE_MISSION_ES_DEFAULT_CRC);
+
+    /* Only the record of this entry is written */
+    CFE_ES_CDS_CachePreload(&CDS->Cache, PersistentRecPtr, Offset, sizeof(*PersistentRecPtr));
+    Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
+
+    if (Status != CFE_SUCCESS)
     {
-        CFE_ES_WriteToSysLog("%s: Failed to write CDS Registry. Status=0x%08X\n", __func__, (unsigned int)PspStatus);
+        CFE_ES_WriteToSysLog("%s: Failed to write CDS Registry. Status=0x%08X\n", __func__,
+                             (unsigned int)CDS->Cache.AccessStatus);
         return CFE_ES_CDS_ACCESS_ERROR;
     }
 
@@ -758,7 +842,9 @@ int32 CFE_ES_RebuildCDS(void)
 {
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
     int32                  Status;
-    int32                  PspStatus;
+    uint32                 i;
+    uint32                 Crc;
+    uint32                 NumDiscarded;
 
     /* First, determine if the CDS registry stored in the CDS is smaller or equal */
     /* in size to the CDS registry we are currently configured for                */
@@ -779,20 +865,46 @@ int32 CFE_ES_RebuildCDS(void)
         return CFE_ES_CDS_INVALID;
     }
 
-    PspStatus = CFE_PSP_ReadFromCDS(&CDS->Registry, CDS_REG_OFFSET, sizeof(CDS->Registry));
-
-    if (PspStatus == CFE_PSP_SUCCESS)
+    /*
+     * Recover the registry one entry at a time.  An entry that fails its
+     * CRC is discarded, the other entries are still recovered.  The CDS
+     * memory of a discarded entry can not be used until the CDS is cleared.
+     */
+    NumDiscarded = 0;
+    for (i = 0; i < CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES; ++i)
     {
-        /* Scan the memory pool and identify the created but currently unused memory blocks */
-        Status = CFE_ES_RebuildCDSPool(CDS->DataSize, CDS_POOL_OFFSET);
+        Status = CFE_ES_CDS_CacheFetch(&CDS->Cache, CDS_REG_OFFSET + (i * sizeof(CFE_ES_CDS_PersistentRegRec_t)),
+                                       sizeof(CFE_ES_CDS_PersistentRegRec_t));
+        if (Status != CFE_SUCCESS)
+        {
+            /* Registry in CDS is unreadable */
+            CFE_ES_WriteToSysLog("%s: Registry in CDS is unreadable, PSP error %lx\n", __func__,
+                                 (unsigned long)CDS->Cache.AccessStatus);
+            return CFE_ES_CDS_INVALID;
+        }
+
+        Crc = CFE_ES_CalculateCRC(&CDS->Cache.Data.RegRecord.Entry, sizeof(CDS->Cache.Data.RegRecord.Entry), 0,
+                                  CFE_MISSION_ES_DEFAULT_CRC);
+        if (Crc == CDS->Cache.Data.RegRecord.Crc)
+        {
+            memcpy(&CDS->Registry[i], &CDS->Cache.Data.RegRecord.Entry, sizeof(CDS->Registry[i]));
+        }
+        else
+        {
+            memset(&CDS->Registry[i], 0, sizeof(CDS->Registry[i]));
+            ++NumDiscarded;
+        }
     }
-    else
+
+    if (NumDiscarded != 0)
     {
-        /* Registry in CDS is unreadable */
-        CFE_ES_WriteToSysLog("%s: Registry in CDS is unreadable, PSP error %lx\n", __func__, (unsigned long)PspStatus);
-        Status = CFE_ES_CDS_INVALID;
+        CFE_ES_WriteToSysLog("%s: Discarded %lu CDS Registry entries with bad CRC\n", __func__,
+                             (unsigned long)NumDiscarded);
     }
 
+    /* Scan the memory pool and identify the created but currently unused memory blocks */
+    Status = CFE_ES_RebuildCDSPool(CDS->DataSize, CDS_POOL_OFFSET);
+
     return Status;
 }
 
@@ -815,6 +927,9 @@ int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices)
 
     LogMessage[0] = 0;
 
+    /* A block that is freed must not be in the middle of a write-behind flush */
+    OS_MutSemTake(CDS->FlushMutex);
+
     /* Lock Registry for update.  This prevents two applications from */
     /* trying to change the CDS registry at the same time  */
     CFE_ES_LockCDS();
@@ -863,10 +978,14 @@ int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices)
                 }
                 else
                 {
+                    CFE_ES_GenPoolProfileRelease(&CDS->Pool, OldBlockSize);
+
                     /* Remove entry from the CDS Registry */
+                    CFE_ES_CDSWriteBehindRelease(RegRecPtr);
                     CFE_ES_CDSBlockRecordSetFree(RegRecPtr);
+                    memset(CFE_ES_CDSBlockRecordGetCrcState(RegRecPtr), 0, sizeof(CFE_ES_ChunkedCRC_t));
 
-                    Status = CFE_ES_UpdateCDSRegistry();
+                    Status = CFE_ES_UpdateCDSRegistryEntry(RegRecPtr);
 
                     if (Status != CFE_SUCCESS)
                     {
@@ -888,6 +1007,7 @@ int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices)
 
     /* Unlock Registry for future updates */
     CFE_ES_UnlockCDS();
+    OS_MutSemGive(CDS->FlushMutex);
 
     /* Output the message to syslog once the CDS registry resource is unlocked */
     if (LogMessage[0] != 0)
@@ -38,6 +38,7 @@
 ** Include Files
 */
 #include "common_types.h"
+#include "cfe_es_api_typedefs.h"
 #include "cfe_es_generic_pool.h"
 
 /*
@@ -48,13 +49,30 @@
 /**  \{ */
 #define CFE_ES_CDS_MUT_REG_NAME  "CDS_MUTEX" /**< \brief Name of Mutex controlling CDS Access */
 #define CFE_ES_CDS_MUT_REG_VALUE 0           /**< \brief Initial Value of CDS Access Mutex */
+
+#define CFE_ES_CDS_MUT_FLUSH_NAME  "CDS_FLUSH_MUTEX" /**< \brief Name of Mutex serializing write-behind flushes */
+#define CFE_ES_CDS_MUT_FLUSH_VALUE 0                 /**< \brief Initial Value of CDS Flush Mutex */
 /** \} */
 
-/** \name Registry Signature Definitions */
+/**
+ * \brief Longest interval between calls of the write-behind background job while blocks are dirty
+ *
+ * The flush timer is shortened by this much, so that a change is written
+ * within CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE of being made.
+ */
+#define CFE_ES_CDS_WRITE_BEHIND_POLL (CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE / 4)
+
+/** \name Registry Signature Definitions
+ *
+ * The signatures also identify the layout of the CDS, and must be changed whenever
+ * that layout changes, so that a CDS left by an older version is reinitialized
+ * rather than misread.  Version 2 stores the registry as CFE_ES_CDS_PersistentRegRec_t
+ * records, each with its own CRC.
+ */
 /**  \{ */
 #define CFE_ES_CDS_SIGNATURE_LEN   8          /**< \brief Length of CDS signature field. */
-#define CFE_ES_CDS_SIGNATURE_BEGIN "_CDSBeg_" /**< \brief Fixed signature at beginning of CDS */
-#define CFE_ES_CDS_SIGNATURE_END   "_CDSEnd_" /**< \brief Fixed signature at end of CDS */
+#define CFE_ES_CDS_SIGNATURE_BEGIN "_CDSBg2_" /**< \brief Fixed signature at beginning of CDS */
+#define CFE_ES_CDS_SIGNATURE_END   "_CDSEn2_" /**< \brief Fixed signature at end of CDS */
 /** \} */
 
 /*
@@ -110,6 +128,35 @@ typedef struct
     bool               Table; /**< \brief Flag that indicates whether CDS contains a Critical Table */
 } CFE_ES_CDS_RegRec_t;
 
+/**
+ * The layout of a registry entry in the CDS non-volatile memory
+ *
+ * Each entry has its own CRC, so that a single entry can be written
+ * when a block is registered or deleted, and a corrupted entry can be
+ * detected (and discarded) without losing the rest of the registry.
+ */
+typedef struct
+{
+    CFE_ES_CDS_RegRec_t Entry; /**< Copy of the registry entry */
+    uint32              Crc;   /**< CRC of the entry */
+} CFE_ES_CDS_PersistentRegRec_t;
+
+/**
+ * The write-behind state of a CDS block, see CFE_ES_SetCDSWriteBehind()
+ *
+ * This is only kept in RAM, so write-behind mode must be enabled again
+ * after a (re)start.
+ */
+typedef struct
+{
+    bool   Enabled;      /**< Writes to the block go to the shadow */
+    bool   Valid;        /**< The shadow holds the current content of the block */
+    bool   Dirty;        /**< The shadow has changes that are not in the CDS yet */
+    size_t ShadowOffset; /**< Offset of the shadow in the write-behind pool */
+    size_t DirtyStart;   /**< Start of the range of the user data that was changed */
+    size_t DirtyEnd;     /**< End (exclusive) of the range of the user data that was changed */
+} CFE_ES_CDS_WriteBehind_t;
+
 typedef struct CFE_ES_CDSBlockHeader
 {
     uint32 Crc; /**< CRC of content */
@@ -121,12 +168,13 @@ typedef struct CFE_ES_CDSBlockHeader
  */
 typedef union CFE_ES_CDS_AccessCacheData
 {
-    char                     Sig[CFE_ES_CDS_SIGNATURE_LEN]; /**< A signature field (beginning or end) */
-    uint32                   RegistrySize;                  /**< Registry Size Field */
-    uint32                   Zero[4];                       /**< Used when clearing CDS content */
-    CFE_ES_GenPoolBD_t       Desc;                          /**< A generic block descriptor */
-    CFE_ES_CDS_BlockHeader_t BlockHeader;                   /**< A user block header */
-    CFE_ES_CDS_RegRec_t      RegEntry;                      /**< A registry entry */
+    char                          Sig[CFE_ES_CDS_SIGNATURE_LEN]; /**< A signature field (beginning or end) */
+    uint32                        RegistrySize;                  /**< Registry Size Field */
+    uint32                        Zero[4];                       /**< Used when clearing CDS content */
+    CFE_ES_GenPoolBD_t            Desc;                          /**< A generic block descriptor */
+    CFE_ES_CDS_BlockHeader_t      BlockHeader;                   /**< A user block header */
+    CFE_ES_CDS_RegRec_t           RegEntry;                      /**< A registry entry */
+    CFE_ES_CDS_PersistentRegRec_t RegRecord;                     /**< A registry entry as stored in the CDS */
 } CFE_ES_CDS_AccessCacheData_t;
 
 typedef struct CFE_ES_CDS_AccessCache
@@ -159,10 +207,39 @@ typedef struct
     CFE_ES_CDS_AccessCache_t Cache;
 
     osal_id_t           GenMutex;       /**< \brief Mutex that controls access to CDS and registry */
+    osal_id_t           FlushMutex;     /**< \brief Mutex held while a write-behind block is written to CDS */
     size_t              TotalSize;      /**< \brief Total size of the CDS as reported by BSP */
     size_t              DataSize;       /**< \brief Size of actual user data pool */
     CFE_ResourceId_t    LastCDSBlockId; /**< \brief Last issued CDS block ID */
     CFE_ES_CDS_RegRec_t Registry[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES]; /**< \brief CDS Registry (Local Copy) */
+
+    /*
+     * Chunk CRCs of the user data of each block, parallel to the registry.
+     * These are only kept in RAM, so they are not valid until the block
+     * has been written or successfully read after a (re)start.
+     */
+    CFE_ES_ChunkedCRC_t BlockCrc[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES];
+
+    /*
+     * Write-behind state of each block, parallel to the registry.
+     * The shadows of the blocks are allocated from a pool in RAM,
+     * and are written to the CDS by the ES background task.
+     */
+    CFE_ES_CDS_WriteBehind_t WriteBehind[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES];
+    CFE_ES_GenPoolRecord_t   ShadowPool;  /**< \brief Pool of the shadows of the write-behind blocks */
+    uint32                   DirtyBlocks; /**< \brief Number of blocks with changes that are not in the CDS yet */
+    uint32                   FlushTimer;  /**< \brief Time until the next flush of the dirty blocks */
+
+    /*
+     * A block being flushed is copied here under the CDS access mutex,
+     * so the CRC and the CDS writes can be done without holding it.
+     * Only used while the FlushMutex is held.
+     */
+    CFE_ES_ChunkedCRC_t FlushCrc; /**< \brief Chunk CRCs of the block being flushed */
+#if (CFE_PLATFORM_ES_CDS_WRITE_BEHIND_SIZE > 0)
+    CDS_RESERVE_SPACE(ShadowMem, CFE_PLATFORM_ES_CDS_WRITE_BEHIND_SIZE); /**< \brief Memory of the shadow pool */
+    CDS_RESERVE_SPACE(FlushMem, CFE_PLATFORM_ES_CDS_WRITE_BEHIND_SIZE);  /**< \brief Copy of the block being flushed */
+#endif
 } CFE_ES_CDS_Instance_t;
 
 /*
@@ -179,7 +256,7 @@ typedef struct CFE_ES_CDS_PersistentHeader
 {
     CDS_RESERVE_SPACE(SignatureBegin, CFE_ES_CDS_SIGNATURE_LEN);
     CDS_RESERVE_SPACE(RegistrySize, sizeof(uint32));
-    CDS_RESERVE_SPACE(RegistryContent, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES * sizeof(CFE_ES_CDS_RegRec_t));
+    CDS_RESERVE_SPACE(RegistryContent, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES * sizeof(CFE_ES_CDS_PersistentRegRec_t));
 } CFE_ES_CDS_PersistentHeader_t;
 
 typedef struct CFE_ES_CDS_PersistentTrailer
@@ -419,6 +496,36 @@ static inline size_t CFE_ES_CDSBlockRecordGetUserSize(const CFE_ES_CDS_RegRec_t
     return (CDSBlockRecPtr->BlockSize - sizeof(CFE_ES_CDS_BlockHeader_t));
 }
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Gets the chunk CRC state of the user data of a given registry record
+ *
+ * As this dereferences fields within the record, CDS access mutex must be
+ * locked prior to invoking this function.
+ *
+ * @note This internal helper function must only be used on record pointers
+ * that are known to refer to an actual table location (i.e. non-null).
+ *
+ * @param[in]   CDSBlockRecPtr   pointer to registry table entry
+ * @returns     Pointer to the chunk CRC state of the block
+ */
+CFE_ES_ChunkedCRC_t *CFE_ES_CDSBlockRecordGetCrcState(const CFE_ES_CDS_RegRec_t *CDSBlockRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Gets the write-behind state of a given registry record
+ *
+ * As this dereferences fields within the record, CDS access mutex must be
+ * locked prior to invoking this function.
+ *
+ * @note This internal helper function must only be used on record pointers
+ * that are known to refer to an actual table location (i.e. non-null).
+ *
+ * @param[in]   CDSBlockRecPtr   pointer to registry table entry
+ * @returns     Pointer to the write-behind state of the block
+ */
+CFE_ES_CDS_WriteBehind_t *CFE_ES_CDSBlockRecordGetWriteBehind(const CFE_ES_CDS_RegRec_t *CDSBlockRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Check if a CDS Block ID table slot is used
@@ -494,17 +601,37 @@ int32 CFE_ES_RebuildCDS(void);
 ** \brief Copies the local version of the CDS Registry to the actual CDS
 **
 ** \par Description
-**        Copies the local working copy of the CDS Registry to the CDS.
+**        Copies every entry of the local working copy of the CDS Registry to the CDS.
 **
 ** \par Assumptions, External Events, and Notes:
-**          None
+**          This is only needed when the whole registry is (re)initialized, changes
+**          of a single entry should use CFE_ES_UpdateCDSRegistryEntry().
 **
 ** \return #CFE_SUCCESS                     \copydoc CFE_SUCCESS
-** \return Any of the return values from #CFE_PSP_WriteToCDS
+** \return #CFE_ES_CDS_ACCESS_ERROR          \copydoc CFE_ES_CDS_ACCESS_ERROR
 **
 ******************************************************************************/
 int32 CFE_ES_UpdateCDSRegistry(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Copies a single entry of the local CDS Registry to the actual CDS
+**
+** \par Description
+**        Computes the CRC of the entry and writes the entry and its CRC to
+**        the location of the entry in the CDS.  Only this entry is written.
+**
+** \par Assumptions, External Events, and Notes:
+**          The CDS must be locked by the caller, as this uses the access cache.
+**
+** \param[in]  RegRecPtr  Pointer to the entry in the local CDS Registry
+**
+** \return #CFE_SUCCESS                     \copydoc CFE_SUCCESS
+** \return #CFE_ES_CDS_ACCESS_ERROR          \copydoc CFE_ES_CDS_ACCESS_ERROR
+**
+******************************************************************************/
+int32 CFE_ES_UpdateCDSRegistryEntry(const CFE_ES_CDS_RegRec_t *RegRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Creates a Full CDS name from application name and CDS name
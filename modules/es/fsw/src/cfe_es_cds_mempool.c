@@ -95,6 +95,270 @@ int32 CFE_ES_CDS_PoolCommit(CFE_ES_GenPoolRecord_t *GenPoolRecPtr, size_t Offset
     return CFE_ES_CDS_CacheFlush(&CDS->Cache);
 }
 
+#if (CFE_PLATFORM_ES_CDS_WRITE_BEHIND_SIZE > 0)
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Obtains a block descriptor from the write-behind shadow pool.
+ * The shadow pool is in RAM, so the descriptor is accessed directly.
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDS_ShadowRetrieve(CFE_ES_GenPoolRecord_t *GenPoolRecPtr, size_t Offset, CFE_ES_GenPoolBD_t **BdPtr)
+{
+    *BdPtr = (CFE_ES_GenPoolBD_t *)((cpuaddr)CFE_ES_Global.CDSVars.ShadowMem + Offset);
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Writes a block descriptor to the write-behind shadow pool.
+ * Nothing to do, the descriptor was modified in place.
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDS_ShadowCommit(CFE_ES_GenPoolRecord_t *GenPoolRecPtr, size_t Offset, const CFE_ES_GenPoolBD_t *BdPtr)
+{
+    return CFE_SUCCESS;
+}
+#endif
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Gets the address of the shadow of a write-behind block
+ *
+ *-----------------------------------------------------------------*/
+static uint8 *CFE_ES_CDSWriteBehindGetShadow(const CFE_ES_CDS_WriteBehind_t *WriteBehindPtr)
+{
+#if (CFE_PLATFORM_ES_CDS_WRITE_BEHIND_SIZE > 0)
+    return (uint8 *)CFE_ES_Global.CDSVars.ShadowMem + WriteBehindPtr->ShadowOffset;
+#else
+    /* write-behind mode cannot be enabled without memory for the shadows */
+    return NULL;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Stores a write into the shadow of a write-behind block, if it can be
+ *
+ * Returns true if the data was stored in the shadow, in which case
+ * the block is dirty and the data will be written to the CDS later.
+ * Returns false if the write must be done to the CDS directly.
+ * The CDS access mutex must be locked.
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_CDSWriteBehindStore(const CFE_ES_CDS_RegRec_t *CDSRegRecPtr, size_t Offset, size_t Size,
+                                       const void *DataToWrite)
+{
+    CFE_ES_CDS_Instance_t *   CDS = &CFE_ES_Global.CDSVars;
+    CFE_ES_CDS_WriteBehind_t *WriteBehindPtr;
+    size_t                    UserDataSize;
+
+    WriteBehindPtr = CFE_ES_CDSBlockRecordGetWriteBehind(CDSRegRecPtr);
+    UserDataSize   = CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr);
+
+    if (!WriteBehindPtr->Enabled)
+    {
+        return false;
+    }
+
+    /*
+     * A range can only be stored once the shadow holds the rest of the block.
+     * An invalid range is left to the direct write, which reports the error.
+     */
+    if (Offset != 0 || Size != UserDataSize)
+    {
+        if (!WriteBehindPtr->Valid || Size == 0 || Offset >= UserDataSize || Size > (UserDataSize - Offset))
+        {
+            return false;
+        }
+    }
+
+    memcpy(CFE_ES_CDSWriteBehindGetShadow(WriteBehindPtr) + Offset, DataToWrite, Size);
+    WriteBehindPtr->Valid = true;
+
+    /* Coalesce with the changes that were not written yet */
+    if (!WriteBehindPtr->Dirty)
+    {
+        WriteBehindPtr->Dirty      = true;
+        WriteBehindPtr->DirtyStart = Offset;
+        WriteBehindPtr->DirtyEnd   = Offset + Size;
+        ++CDS->DirtyBlocks;
+    }
+    else
+    {
+        if (Offset < WriteBehindPtr->DirtyStart)
+        {
+            WriteBehindPtr->DirtyStart = Offset;
+        }
+        if ((Offset + Size) > WriteBehindPtr->DirtyEnd)
+        {
+            WriteBehindPtr->DirtyEnd = Offset + Size;
+        }
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Gets the address of the copy of the block being flushed
+ *
+ *-----------------------------------------------------------------*/
+static uint8 *CFE_ES_CDSWriteBehindGetFlushCopy(void)
+{
+#if (CFE_PLATFORM_ES_CDS_WRITE_BEHIND_SIZE > 0)
+    return (uint8 *)CFE_ES_Global.CDSVars.FlushMem;
+#else
+    /* write-behind mode cannot be enabled without memory for the shadows */
+    return NULL;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Writes the changed range of the shadow of a write-behind block to CDS
+ *
+ * The CDS flush mutex must be locked, which keeps the block from being
+ * freed or reallocated, and the CDS access mutex must not be.  The block
+ * is copied out while holding the access mutex, and the CRC and the CDS
+ * writes are done on the copy, so the owner of the block can keep
+ * writing to the shadow meanwhile.  The block is marked dirty again if
+ * the write fails, so it is tried again on the next flush.
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_CDSWriteBehindFlushBlock(const CFE_ES_CDS_RegRec_t *CDSRegRecPtr, char *LogMessage,
+                                             size_t LogMessageSize)
+{
+    CFE_ES_CDS_Instance_t *   CDS = &CFE_ES_Global.CDSVars;
+    CFE_ES_CDS_WriteBehind_t *WriteBehindPtr;
+    CFE_ES_CDS_AccessCache_t  HeaderCache;
+    uint8 *                   CopyPtr;
+    int32                     Status;
+    int32                     PspStatus;
+    size_t                    BlockSize;
+    size_t                    UserDataSize;
+    size_t                    UserDataOffset;
+    size_t                    DirtyStart;
+    size_t                    DirtyEnd;
+
+    WriteBehindPtr = CFE_ES_CDSBlockRecordGetWriteBehind(CDSRegRecPtr);
+    CopyPtr        = CFE_ES_CDSWriteBehindGetFlushCopy();
+
+    CFE_ES_LockCDS();
+
+    if (!CFE_ES_CDSBlockRecordIsUsed(CDSRegRecPtr) || !WriteBehindPtr->Dirty)
+    {
+        CFE_ES_UnlockCDS();
+        return CFE_SUCCESS;
+    }
+
+    /* Validate the block descriptor, the same as a direct write does */
+    Status = CFE_ES_GenPoolGetBlockSize(&CDS->Pool, &BlockSize, CDSRegRecPtr->BlockOffset);
+    if (Status != CFE_SUCCESS)
+    {
+        snprintf(LogMessage, LogMessageSize, "Invalid Handle or Block Descriptor.\n");
+    }
+    else if (BlockSize <= sizeof(CFE_ES_CDS_BlockHeader_t) || BlockSize != CDSRegRecPtr->BlockSize)
+    {
+        snprintf(LogMessage, LogMessageSize, "Block size %lu invalid, expected %lu\n", (unsigned long)BlockSize,
+                 (unsigned long)CDSRegRecPtr->BlockSize);
+        Status = CFE_ES_CDS_INVALID_SIZE;
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_UnlockCDS();
+        return Status;
+    }
+
+    /* Take the changes, any made from here on are written by the next flush */
+    UserDataSize   = CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr);
+    UserDataOffset = CDSRegRecPtr->BlockOffset;
+    UserDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
+    DirtyStart = WriteBehindPtr->DirtyStart;
+    DirtyEnd   = WriteBehindPtr->DirtyEnd;
+    memcpy(CopyPtr, CFE_ES_CDSWriteBehindGetShadow(WriteBehindPtr), UserDataSize);
+    CDS->FlushCrc         = *CFE_ES_CDSBlockRecordGetCrcState(CDSRegRecPtr);
+    WriteBehindPtr->Dirty = false;
+    --CDS->DirtyBlocks;
+
+    CFE_ES_UnlockCDS();
+
+    /* The whole block is in RAM, so the chunk CRCs can be brought up to date for just the changed range */
+    memset(&HeaderCache, 0, sizeof(HeaderCache));
+    if (CDS->FlushCrc.NumChunks != 0 && CDS->FlushCrc.DataLength == UserDataSize &&
+        CDS->FlushCrc.TypeCRC == CFE_MISSION_ES_DEFAULT_CRC)
+    {
+        HeaderCache.Data.BlockHeader.Crc =
+            CFE_ES_ChunkedCRCUpdate(&CDS->FlushCrc, CopyPtr, DirtyStart, DirtyEnd - DirtyStart);
+    }
+    else
+    {
+        HeaderCache.Data.BlockHeader.Crc =
+            CFE_ES_ChunkedCRCInit(&CDS->FlushCrc, CopyPtr, UserDataSize, CFE_MISSION_ES_DEFAULT_CRC);
+    }
+    HeaderCache.Offset = CDSRegRecPtr->BlockOffset;
+    HeaderCache.Size   = sizeof(CFE_ES_CDS_BlockHeader_t);
+
+    Status = CFE_ES_CDS_CacheFlush(&HeaderCache);
+    if (Status != CFE_SUCCESS)
+    {
+        snprintf(LogMessage, LogMessageSize, "Err writing header data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                 (unsigned int)HeaderCache.AccessStatus, (unsigned long)CDSRegRecPtr->BlockOffset);
+    }
+    else
+    {
+        PspStatus = CFE_PSP_WriteToCDS(CopyPtr + DirtyStart, UserDataOffset + DirtyStart, DirtyEnd - DirtyStart);
+        if (PspStatus != CFE_PSP_SUCCESS)
+        {
+            snprintf(LogMessage, LogMessageSize, "Err writing user data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                     (unsigned int)PspStatus, (unsigned long)(UserDataOffset + DirtyStart));
+
+            Status = CFE_ES_CDS_ACCESS_ERROR;
+        }
+    }
+
+    CFE_ES_LockCDS();
+
+    /* The chunk CRCs match the copy, the changes made since are outside of them or still dirty */
+    *CFE_ES_CDSBlockRecordGetCrcState(CDSRegRecPtr) = CDS->FlushCrc;
+
+    if (Status != CFE_SUCCESS)
+    {
+        /* Merge the range back with the changes made while it was written */
+        if (!WriteBehindPtr->Dirty)
+        {
+            WriteBehindPtr->Dirty      = true;
+            WriteBehindPtr->DirtyStart = DirtyStart;
+            WriteBehindPtr->DirtyEnd   = DirtyEnd;
+            ++CDS->DirtyBlocks;
+        }
+        else
+        {
+            if (DirtyStart < WriteBehindPtr->DirtyStart)
+            {
+                WriteBehindPtr->DirtyStart = DirtyStart;
+            }
+            if (DirtyEnd > WriteBehindPtr->DirtyEnd)
+            {
+                WriteBehindPtr->DirtyEnd = DirtyEnd;
+            }
+        }
+    }
+
+    CFE_ES_UnlockCDS();
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -125,6 +389,37 @@ int32 CFE_ES_CreateCDSPool(size_t CDSPoolSize, size_t StartOffset)
                                       CFE_ES_CDS_NUM_BLOCK_SIZES, CFE_ES_CDSMemPoolDefSize, CFE_ES_CDS_PoolRetrieve,
                                       CFE_ES_CDS_PoolCommit);
 
+    /*
+     * No block is in write-behind mode after a (re)start.  The shadow pool is only
+     * initialized if it has memory, so write-behind mode cannot be enabled otherwise.
+     */
+    memset(CDS->WriteBehind, 0, sizeof(CDS->WriteBehind));
+    memset(&CDS->ShadowPool, 0, sizeof(CDS->ShadowPool));
+    CDS->DirtyBlocks = 0;
+    CDS->FlushTimer  = CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE - CFE_ES_CDS_WRITE_BEHIND_POLL;
+
+#if (CFE_PLATFORM_ES_CDS_WRITE_BEHIND_SIZE > 0)
+    if (Status == CFE_SUCCESS &&
+        CFE_ES_GenPoolInitialize(&CDS->ShadowPool, 0, sizeof(CDS->ShadowMem), 4, CFE_ES_CDS_NUM_BLOCK_SIZES,
+                                 CFE_ES_CDSMemPoolDefSize, CFE_ES_CDS_ShadowRetrieve,
+                                 CFE_ES_CDS_ShadowCommit) != CFE_SUCCESS)
+    {
+        /* the CDS itself is still usable, only without write-behind mode */
+        CFE_ES_SysLogWrite_Unsync("%s: Err initializing CDS write-behind pool\n", __func__);
+        memset(&CDS->ShadowPool, 0, sizeof(CDS->ShadowPool));
+    }
+#endif
+
+#if (CFE_PLATFORM_ES_POOL_SIZE_PROFILE == 1)
+    /*
+     * Count the requested sizes, for the CFE_ES_WRITE_POOL_PROFILE_CC command
+     */
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_ES_GenPoolEnableProfile(&CDS->Pool, &CFE_ES_Global.PoolProfile.CDSPool);
+    }
+#endif
+
     return Status;
 }
 
@@ -188,7 +483,13 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
      */
     CFE_ES_LockCDS();
 
-    if (CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, Handle))
+    if (CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, Handle) &&
+        CFE_ES_CDSWriteBehindStore(CDSRegRecPtr, 0, CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr), DataToWrite))
+    {
+        /* The block is in write-behind mode, the background task writes the shadow to CDS later */
+        Status = CFE_SUCCESS;
+    }
+    else if (CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, Handle))
     {
         /*
          * Getting the buffer size via this function retrieves it from the
@@ -213,8 +514,10 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
             UserDataOffset = CDSRegRecPtr->BlockOffset;
             UserDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
 
-            CDS->Cache.Data.BlockHeader.Crc =
-                CFE_ES_CalculateCRC(DataToWrite, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+            /* Keep the chunk CRCs of the new content, so later range updates are incremental */
+            CDS->Cache.Data.BlockHeader.Crc = CFE_ES_ChunkedCRCInit(CFE_ES_CDSBlockRecordGetCrcState(CDSRegRecPtr),
+                                                                    DataToWrite, UserDataSize,
+                                                                    CFE_MISSION_ES_DEFAULT_CRC);
             CDS->Cache.Offset = CDSRegRecPtr->BlockOffset;
             CDS->Cache.Size   = sizeof(CFE_ES_CDS_BlockHeader_t);
 
@@ -262,17 +565,24 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle)
+int32 CFE_ES_CDSBlockWriteRange(CFE_ES_CDSHandle_t Handle, size_t Offset, size_t Size, const void *DataToWrite)
 {
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+    char                   LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
     int32                  Status;
     int32                  PspStatus;
-    uint32                 CrcOfCDSData;
+    uint32                 OldBlockCrc;
+    uint32                 OldRangeCrc;
     size_t                 BlockSize;
     size_t                 UserDataSize;
     size_t                 UserDataOffset;
+    size_t                 ReadOffset;
+    size_t                 ReadSize;
     CFE_ES_CDS_RegRec_t *  CDSRegRecPtr;
 
+    /* Ensure the log message is an empty string in case it is never written to */
+    LogMessage[0] = 0;
+
     CDSRegRecPtr = CFE_ES_LocateCDSBlockRecordByID(Handle);
 
     /*
@@ -281,7 +591,169 @@ int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle)
      */
     CFE_ES_LockCDS();
 
+    if (CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, Handle) &&
+        CFE_ES_CDSWriteBehindStore(CDSRegRecPtr, Offset, Size, DataToWrite))
+    {
+        /* The block is in write-behind mode, the background task writes the shadow to CDS later */
+        Status = CFE_SUCCESS;
+    }
+    else if (CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, Handle))
+    {
+        /*
+         * Getting the buffer size via this function retrieves it from the
+         * internal descriptor, and validates the descriptor as part of the operation.
+         * This should always agree with the size in the registry for this block.
+         */
+        Status = CFE_ES_GenPoolGetBlockSize(&CDS->Pool, &BlockSize, CDSRegRecPtr->BlockOffset);
+        if (Status != CFE_SUCCESS)
+        {
+            snprintf(LogMessage, sizeof(LogMessage), "Invalid Handle or Block Descriptor.\n");
+        }
+        else if (BlockSize <= sizeof(CFE_ES_CDS_BlockHeader_t) || BlockSize != CDSRegRecPtr->BlockSize)
+        {
+            snprintf(LogMessage, sizeof(LogMessage), "Block size %lu invalid, expected %lu\n", (unsigned long)BlockSize,
+                     (unsigned long)CDSRegRecPtr->BlockSize);
+            Status = CFE_ES_CDS_INVALID_SIZE;
+        }
+        else if (Size == 0 || Offset >= CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr) ||
+                 Size > (CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr) - Offset))
+        {
+            /* not logged, this is a caller error that is reported via the return code */
+            Status = CFE_ES_CDS_INVALID_SIZE;
+        }
+        else
+        {
+            UserDataSize = CDSRegRecPtr->BlockSize;
+            UserDataSize -= sizeof(CFE_ES_CDS_BlockHeader_t);
+            UserDataOffset = CDSRegRecPtr->BlockOffset;
+            UserDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
+
+            /* Read the header, to get the CRC of the old contents of the block */
+            Status = CFE_ES_CDS_CacheFetch(&CDS->Cache, CDSRegRecPtr->BlockOffset, sizeof(CFE_ES_CDS_BlockHeader_t));
+
+            /* Compute the CRC of the old contents of the range, a piece at a time through the cache */
+            OldBlockCrc = CDS->Cache.Data.BlockHeader.Crc;
+            OldRangeCrc = 0;
+            ReadOffset  = 0;
+            while (Status == CFE_SUCCESS && ReadOffset < Size)
+            {
+                ReadSize = Size - ReadOffset;
+                if (ReadSize > sizeof(CDS->Cache.Data))
+                {
+                    ReadSize = sizeof(CDS->Cache.Data);
+                }
+
+                Status = CFE_ES_CDS_CacheFetch(&CDS->Cache, UserDataOffset + Offset + ReadOffset, ReadSize);
+                if (Status == CFE_SUCCESS)
+                {
+                    OldRangeCrc =
+                        CFE_ES_CalculateCRC(&CDS->Cache.Data, ReadSize, OldRangeCrc, CFE_MISSION_ES_DEFAULT_CRC);
+                    ReadOffset += ReadSize;
+                }
+            }
+
+            if (Status != CFE_SUCCESS)
+            {
+                snprintf(LogMessage, sizeof(LogMessage),
+                         "Err reading data from CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                         (unsigned int)CDS->Cache.AccessStatus, (unsigned long)CDSRegRecPtr->BlockOffset);
+            }
+            else
+            {
+                /*
+                 * A CRC is linear in the data, so the change of the CRC of the block is the change of
+                 * the CRC of the range, followed by as many zeros as there are bytes after the range.
+                 * This is the same as combining it with the CRC of the block, which is done below.
+                 */
+                CDS->Cache.Data.BlockHeader.Crc = CFE_ES_CombineCRC(
+                    OldRangeCrc ^ CFE_ES_CalculateCRC(DataToWrite, Size, 0, CFE_MISSION_ES_DEFAULT_CRC), OldBlockCrc,
+                    UserDataSize - Offset - Size, CFE_MISSION_ES_DEFAULT_CRC);
+                CDS->Cache.Offset = CDSRegRecPtr->BlockOffset;
+                CDS->Cache.Size   = sizeof(CFE_ES_CDS_BlockHeader_t);
+
+                /* The chunk CRCs cannot be updated without the rest of each chunk, they are not valid anymore */
+                memset(CFE_ES_CDSBlockRecordGetCrcState(CDSRegRecPtr), 0, sizeof(CFE_ES_ChunkedCRC_t));
+
+                /* Write the new block descriptor for the data coming from the Application */
+                Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
+                if (Status != CFE_SUCCESS)
+                {
+                    snprintf(LogMessage, sizeof(LogMessage),
+                             "Err writing header data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                             (unsigned int)CDS->Cache.AccessStatus, (unsigned long)CDSRegRecPtr->BlockOffset);
+                }
+                else
+                {
+                    PspStatus = CFE_PSP_WriteToCDS(DataToWrite, UserDataOffset + Offset, Size);
+                    if (PspStatus != CFE_PSP_SUCCESS)
+                    {
+                        snprintf(LogMessage, sizeof(LogMessage),
+                                 "Err writing user data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                                 (unsigned int)PspStatus, (unsigned long)(UserDataOffset + Offset));
+
+                        Status = CFE_ES_CDS_ACCESS_ERROR;
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    CFE_ES_UnlockCDS();
+
+    /* Do the actual syslog if something went wrong */
+    if (LogMessage[0] != 0)
+    {
+        CFE_ES_WriteToSysLog("%s: %s", __func__, LogMessage);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle)
+{
+    CFE_ES_CDS_Instance_t *   CDS = &CFE_ES_Global.CDSVars;
+    int32                     Status;
+    int32                     PspStatus;
+    uint32                    CrcOfCDSData;
+    size_t                    BlockSize;
+    size_t                    UserDataSize;
+    size_t                    UserDataOffset;
+    CFE_ES_CDS_RegRec_t *     CDSRegRecPtr;
+    CFE_ES_ChunkedCRC_t *     CrcStatePtr;
+    CFE_ES_CDS_WriteBehind_t *WriteBehindPtr;
+
+    CDSRegRecPtr = CFE_ES_LocateCDSBlockRecordByID(Handle);
+
+    /*
+     * A CDS block ID must be accessed by only one thread at a time.
+     * Checking the validity of the block requires access to the registry.
+     */
+    CFE_ES_LockCDS();
+
+    WriteBehindPtr = NULL;
     if (CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, Handle))
+    {
+        WriteBehindPtr = CFE_ES_CDSBlockRecordGetWriteBehind(CDSRegRecPtr);
+    }
+
+    if (WriteBehindPtr != NULL && WriteBehindPtr->Enabled && WriteBehindPtr->Valid)
+    {
+        /* The shadow is at least as recent as the CDS, which may not have the last changes yet */
+        memcpy(DataRead, CFE_ES_CDSWriteBehindGetShadow(WriteBehindPtr),
+               CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr));
+        Status = CFE_SUCCESS;
+    }
+    else if (WriteBehindPtr != NULL)
     {
         /*
          * Getting the buffer size via this function retrieves it from the
@@ -313,15 +785,26 @@ int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle)
                     if (PspStatus == CFE_PSP_SUCCESS)
                     {
                         /* Compute the CRC for the data read from the CDS and determine if the data is still valid */
-                        CrcOfCDSData = CFE_ES_CalculateCRC(DataRead, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+                        CrcStatePtr  = CFE_ES_CDSBlockRecordGetCrcState(CDSRegRecPtr);
+                        CrcOfCDSData = CFE_ES_ChunkedCRCInit(CrcStatePtr, DataRead, UserDataSize,
+                                                             CFE_MISSION_ES_DEFAULT_CRC);
 
                         /* If the CRCs do not match, report an error */
                         if (CrcOfCDSData != CDS->Cache.Data.BlockHeader.Crc)
                         {
+                            /* the chunk CRCs must not be used to make corrupted data look valid */
+                            memset(CrcStatePtr, 0, sizeof(*CrcStatePtr));
                             Status = CFE_ES_CDS_BLOCK_CRC_ERR;
                         }
                         else
                         {
+                            /* A block in write-behind mode keeps the good data, so range writes can use it */
+                            if (WriteBehindPtr->Enabled)
+                            {
+                                memcpy(CFE_ES_CDSWriteBehindGetShadow(WriteBehindPtr), DataRead, UserDataSize);
+                                WriteBehindPtr->Valid = true;
+                            }
+
                             Status = CFE_SUCCESS;
                         }
                     }
@@ -343,6 +826,206 @@ int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDSBlockSetWriteBehind(CFE_ES_CDSHandle_t Handle, bool WriteBehind)
+{
+    CFE_ES_CDS_Instance_t *   CDS = &CFE_ES_Global.CDSVars;
+    char                      LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    int32                     Status;
+    size_t                    ShadowOffset;
+    CFE_ES_CDS_RegRec_t *     CDSRegRecPtr;
+    CFE_ES_CDS_WriteBehind_t *WriteBehindPtr;
+
+    /* Ensure the log message is an empty string in case it is never written to */
+    LogMessage[0] = 0;
+
+    CDSRegRecPtr = CFE_ES_LocateCDSBlockRecordByID(Handle);
+
+    /* The shadow must not be released while the block is being flushed */
+    OS_MutSemTake(CDS->FlushMutex);
+    CFE_ES_LockCDS();
+
+    if (!CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, Handle))
+    {
+        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+    else
+    {
+        WriteBehindPtr = CFE_ES_CDSBlockRecordGetWriteBehind(CDSRegRecPtr);
+        Status         = CFE_SUCCESS;
+
+        if (WriteBehind && !WriteBehindPtr->Enabled)
+        {
+            /* The shadow pool has no block sizes if there is no memory for it */
+            if (CDS->ShadowPool.NumBuckets == 0)
+            {
+                Status = CFE_ES_CDS_INSUFFICIENT_MEMORY;
+            }
+            else
+            {
+                Status = CFE_ES_GenPoolGetBlock(&CDS->ShadowPool, &ShadowOffset,
+                                                CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr));
+                if (Status != CFE_SUCCESS)
+                {
+                    Status = CFE_ES_CDS_INSUFFICIENT_MEMORY;
+                }
+            }
+
+            if (Status == CFE_SUCCESS)
+            {
+                /* The shadow is not valid until the block is written or read */
+                memset(WriteBehindPtr, 0, sizeof(*WriteBehindPtr));
+                WriteBehindPtr->Enabled      = true;
+                WriteBehindPtr->ShadowOffset = ShadowOffset;
+            }
+        }
+        else if (!WriteBehind && WriteBehindPtr->Enabled)
+        {
+            /*
+             * Pending changes must not be lost by leaving write-behind mode.  The
+             * flush does not hold the access mutex, so the owner may make more
+             * changes meanwhile, which are flushed as well.
+             */
+            while (Status == CFE_SUCCESS && WriteBehindPtr->Dirty)
+            {
+                CFE_ES_UnlockCDS();
+                Status = CFE_ES_CDSWriteBehindFlushBlock(CDSRegRecPtr, LogMessage, sizeof(LogMessage));
+                CFE_ES_LockCDS();
+            }
+
+            if (Status == CFE_SUCCESS)
+            {
+                CFE_ES_CDSWriteBehindRelease(CDSRegRecPtr);
+            }
+        }
+    }
+
+    CFE_ES_UnlockCDS();
+    OS_MutSemGive(CDS->FlushMutex);
+
+    /* Do the actual syslog if something went wrong */
+    if (LogMessage[0] != 0)
+    {
+        CFE_ES_WriteToSysLog("%s: %s", __func__, LogMessage);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CDSWriteBehindRelease(const CFE_ES_CDS_RegRec_t *CDSRegRecPtr)
+{
+    CFE_ES_CDS_Instance_t *   CDS = &CFE_ES_Global.CDSVars;
+    CFE_ES_CDS_WriteBehind_t *WriteBehindPtr;
+    size_t                    ShadowSize;
+
+    WriteBehindPtr = CFE_ES_CDSBlockRecordGetWriteBehind(CDSRegRecPtr);
+
+    if (WriteBehindPtr->Enabled)
+    {
+        CFE_ES_GenPoolPutBlock(&CDS->ShadowPool, &ShadowSize, WriteBehindPtr->ShadowOffset);
+
+        if (WriteBehindPtr->Dirty)
+        {
+            --CDS->DirtyBlocks;
+        }
+    }
+
+    memset(WriteBehindPtr, 0, sizeof(*WriteBehindPtr));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDSWriteBehindFlush(void)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+    char                   LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    int32                  Status;
+    int32                  BlockStatus;
+    uint32                 i;
+    CFE_ES_CDS_RegRec_t *  CDSRegRecPtr;
+
+    Status = CFE_SUCCESS;
+
+    OS_MutSemTake(CDS->FlushMutex);
+
+    for (i = 0; i < CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES && CDS->DirtyBlocks != 0; ++i)
+    {
+        LogMessage[0] = 0;
+        CDSRegRecPtr  = &CDS->Registry[i];
+
+        /* the block is checked again with the access mutex held */
+        if (CDS->WriteBehind[i].Dirty)
+        {
+            BlockStatus = CFE_ES_CDSWriteBehindFlushBlock(CDSRegRecPtr, LogMessage, sizeof(LogMessage));
+            if (BlockStatus != CFE_SUCCESS && Status == CFE_SUCCESS)
+            {
+                Status = BlockStatus;
+            }
+        }
+
+        if (LogMessage[0] != 0)
+        {
+            CFE_ES_WriteToSysLog("%s: %s", __func__, LogMessage);
+        }
+    }
+
+    OS_MutSemGive(CDS->FlushMutex);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_RunCDSWriteBehind(uint32 ElapsedTime, void *Arg)
+{
+    CFE_ES_CDS_Instance_t *CDS = (CFE_ES_CDS_Instance_t *)Arg;
+
+    /*
+     * The timer restarts on every call without dirty blocks and before every
+     * flush, so it never starts later than the change it is timing.  While
+     * blocks are dirty the job is called at least every CFE_ES_CDS_WRITE_BEHIND_POLL,
+     * and the timer is shortened by that much, so a change is written to the CDS
+     * within CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE of being made.
+     */
+    if (CDS->DirtyBlocks == 0)
+    {
+        CDS->FlushTimer = CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE - CFE_ES_CDS_WRITE_BEHIND_POLL;
+        return false;
+    }
+
+    if (CDS->FlushTimer > ElapsedTime)
+    {
+        CDS->FlushTimer -= ElapsedTime;
+        return true;
+    }
+
+    CDS->FlushTimer = CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE - CFE_ES_CDS_WRITE_BEHIND_POLL;
+
+    /* errors are reported to the syslog, and the blocks are tried again next time */
+    CFE_ES_CDSWriteBehindFlush();
+
+    return (CDS->DirtyBlocks != 0);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -85,12 +85,63 @@ int32 CFE_ES_RebuildCDSPool(size_t CDSPoolSize, size_t StartOffset);
  */
 int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes a range of a block of data to CDS
+ *
+ * Only the range and the block header are written.  The CRC in the header
+ * is updated from the CRC of the old and the new contents of the range,
+ * so only the old contents of the range need to be read from the CDS.
+ */
+int32 CFE_ES_CDSBlockWriteRange(CFE_ES_CDSHandle_t Handle, size_t Offset, size_t Size, const void *DataToWrite);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Reads a block of data from CDS
  */
 int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Enables or disables write-behind mode of a CDS block
+ *
+ * Enabling allocates a shadow of the block from the write-behind pool.  Disabling
+ * writes any pending changes to the CDS first, and then frees the shadow.
+ */
+int32 CFE_ES_CDSBlockSetWriteBehind(CFE_ES_CDSHandle_t Handle, bool WriteBehind);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Releases the shadow of a CDS block, discarding any pending changes
+ *
+ * This is used when the block itself is freed or reallocated.
+ * The CDS flush mutex and the CDS access mutex must be locked prior
+ * to invoking this function.
+ */
+void CFE_ES_CDSWriteBehindRelease(const CFE_ES_CDS_RegRec_t *CDSRegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes the pending changes of all write-behind blocks to CDS
+ *
+ * The CDS flush mutex is held for the whole flush, which keeps the blocks
+ * from being freed or reallocated.  The CDS access mutex is only held to
+ * copy each block out, the CRC and the CDS writes are done on the copy,
+ * so the owners of the blocks are not held up by the flush.
+ *
+ * @returns #CFE_SUCCESS if all blocks were written, or the first error.
+ */
+int32 CFE_ES_CDSWriteBehindFlush(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Background job to write the pending changes of write-behind blocks to CDS
+ *
+ * A change is written within the CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE,
+ * so several changes to a block are written to the CDS together.
+ */
+bool CFE_ES_RunCDSWriteBehind(uint32 ElapsedTime, void *Arg);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Computes the minimum required size for a CDS pool
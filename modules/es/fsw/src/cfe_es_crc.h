@@ -21,7 +21,8 @@
  *  Implemention of the CRC algorithm(s) for CFE ES
  *
  *  Notes:
- *    Historically only CRC-16/ARC is defined, but this can be expanded.
+ *    Historically only CRC-16/ARC is defined, CRC-32C was added to make use
+ *    of the CRC instructions of newer CPUs.
  *
  */
 
@@ -34,6 +35,12 @@
 #include "common_types.h"
 #include "cfe_es.h"
 
+/*
+ * Smallest chunk of a chunked CRC, so that small blocks are not divided
+ * into chunks that are not worth combining.  Must be a power of two.
+ */
+#define CFE_ES_CRC_MIN_CHUNK_SIZE 64
+
 typedef uint32 (*const CFE_ES_ComputeCRC_Algo_t)(const void *DataPtr, size_t DataLength, uint32 InputCRC);
 
 typedef const struct CFE_ES_ComputeCRC_Params
@@ -46,8 +53,45 @@ typedef const struct CFE_ES_ComputeCRC_Params
      */
     CFE_ES_ComputeCRC_Algo_t Algorithm;
 
+    /**
+     * Number of bits of the CRC, and its polynomial in bit reversed order,
+     * used to combine CRCs.  The width is 0 for algorithms that cannot be combined.
+     */
+    uint32 Width;
+    uint32 ReflectedPoly;
+
 } CFE_ES_ComputeCRC_Params_t;
 
 CFE_ES_ComputeCRC_Params_t *CFE_ES_ComputeCRC_GetParams(CFE_ES_CrcType_Enum_t CrcType);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Gets the operator to combine a CRC with the CRC of a following block
+ *
+ * This is the polynomial x^(8 * Length) modulo the polynomial of the CRC,
+ * in the same bit order as the CRC.  See CFE_ES_ComputeCRC_Combine().
+ *
+ * @param[in] Params   The parameters of the CRC algorithm
+ * @param[in] Length   The number of bytes of the following block
+ * @returns The operator for the length
+ */
+uint32 CFE_ES_ComputeCRC_ShiftOperator(CFE_ES_ComputeCRC_Params_t *Params, size_t Length);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Combines the CRC of a block with the CRC of a following block
+ *
+ * The CRC of the first block is multiplied by the operator for the length
+ * of the second block, as if it was continued over as many zero bytes, and
+ * the CRC of the second block is added.  This holds for CRCs with an initial
+ * value that is the same as the final XOR, as for all implemented algorithms.
+ *
+ * @param[in] Params   The parameters of the CRC algorithm
+ * @param[in] CrcA     The CRC of the first block
+ * @param[in] CrcB     The CRC of the second block
+ * @param[in] ShiftOp  The operator for the length of the second block, from CFE_ES_ComputeCRC_ShiftOperator()
+ * @returns The CRC of both blocks
+ */
+uint32 CFE_ES_ComputeCRC_Combine(CFE_ES_ComputeCRC_Params_t *Params, uint32 CrcA, uint32 CrcB, uint32 ShiftOp);
+
 #endif /* CFE_ES_CRC_H */
@@ -203,6 +203,27 @@ void CFE_ES_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
                     }
                     break;
 
+                case CFE_ES_WRITE_LOCK_PROFILE_CC:
+                    if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WriteLockProfileCmd_t)))
+                    {
+                        CFE_ES_WriteLockProfileCmd((const CFE_ES_WriteLockProfileCmd_t *)SBBufPtr);
+                    }
+                    break;
+
+                case CFE_ES_WRITE_POOL_PROFILE_CC:
+                    if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WritePoolProfileCmd_t)))
+                    {
+                        CFE_ES_WritePoolProfileCmd((const CFE_ES_WritePoolProfileCmd_t *)SBBufPtr);
+                    }
+                    break;
+
+                case CFE_ES_WRITE_STARTUP_TIMELINE_CC:
+                    if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WriteStartupTimelineCmd_t)))
+                    {
+                        CFE_ES_WriteStartupTimelineCmd((const CFE_ES_WriteStartupTimelineCmd_t *)SBBufPtr);
+                    }
+                    break;
+
                 case CFE_ES_START_PERF_DATA_CC:
                     if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_StartPerfDataCmd_t)))
                     {
@@ -231,6 +252,20 @@ void CFE_ES_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
                     }
                     break;
 
+                case CFE_ES_SET_PERF_STATS_MASK_CC:
+                    if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_SetPerfStatsMaskCmd_t)))
+                    {
+                        CFE_ES_SetPerfStatsMaskCmd((const CFE_ES_SetPerfStatsMaskCmd_t *)SBBufPtr);
+                    }
+                    break;
+
+                case CFE_ES_SEND_PERF_STATS_CC:
+                    if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_SendPerfStatsCmd_t)))
+                    {
+                        CFE_ES_SendPerfStatsCmd((const CFE_ES_SendPerfStatsCmd_t *)SBBufPtr);
+                    }
+                    break;
+
                 case CFE_ES_RESET_PR_COUNT_CC:
                     if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_ResetPRCountCmd_t)))
                     {
@@ -43,6 +43,47 @@
 ** Functions
 */
 
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Gets the size class of a block size, which is its number of significant bits
+ *
+ *-----------------------------------------------------------------*/
+static uint16 CFE_ES_GenPoolSizeClass(size_t Size)
+{
+    uint16 SizeClass;
+
+    /* find the highest bit set by halving, so this takes the same few steps for any size */
+    SizeClass = 0;
+    while (Size >= 0x10000)
+    {
+        Size >>= 16;
+        SizeClass += 16;
+    }
+    if (Size >= 0x100)
+    {
+        Size >>= 8;
+        SizeClass += 8;
+    }
+    if (Size >= 0x10)
+    {
+        Size >>= 4;
+        SizeClass += 4;
+    }
+    if (Size >= 0x4)
+    {
+        Size >>= 2;
+        SizeClass += 2;
+    }
+    if (Size >= 0x2)
+    {
+        Size >>= 1;
+        SizeClass += 1;
+    }
+
+    return (uint16)(SizeClass + Size);
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -54,13 +95,14 @@ uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSi
 {
     uint16 Index;
 
-    for (Index = 0; Index < PoolRecPtr->NumBuckets; ++Index)
+    /*
+     * Start at the first bucket that may fit the size class of the request.
+     * Only the buckets within the same size class need to be checked from here.
+     */
+    Index = PoolRecPtr->SizeClassStart[CFE_ES_GenPoolSizeClass(ReqSize)];
+    while (Index < PoolRecPtr->NumBuckets && ReqSize > PoolRecPtr->Buckets[Index].BlockSize)
     {
-        if (ReqSize <= PoolRecPtr->Buckets[Index].BlockSize)
-        {
-            /* it fits - stop here */
-            break;
-        }
+        ++Index;
     }
 
     /*
@@ -90,6 +132,483 @@ CFE_ES_GenPoolBucket_t *CFE_ES_GenPoolGetBucketState(CFE_ES_GenPoolRecord_t *Poo
     return &PoolRecPtr->Buckets[Index];
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Pops a block off the free stack of a lock-free pool
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_GenPoolPopFreeStack(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_GenPoolBucket_t *BucketPtr,
+                                        uint16 BucketId, size_t NewSize, size_t *BlockOffsetPtr)
+{
+    uint64              Top;
+    uint64              CurrentTop;
+    size_t              DescOffset;
+    size_t              BlockOffset;
+    CFE_ES_GenPoolBD_t *BdPtr;
+    int32               Status;
+
+    Top = CFE_ES_AtomicLoad64(&BucketPtr->FreeStackTop);
+    while (true)
+    {
+        BlockOffset = CFE_ES_GENERIC_POOL_STACK_OFFSET(Top);
+        if (BlockOffset == 0)
+        {
+            /* no buffers in pool to recycle */
+            return CFE_ES_BUFFER_NOT_IN_POOL;
+        }
+
+        DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+        Status     = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+        if (Status != CFE_SUCCESS)
+        {
+            return Status;
+        }
+
+        if (BdPtr->CheckBits == CFE_ES_CHECK_PATTERN &&
+            BdPtr->Allocated == (uint16)(CFE_ES_MEMORY_DEALLOCATED + BucketId))
+        {
+            /*
+             * If another task pops this block first, the next offset read here may be
+             * stale, but the tag of the top has changed then, so the exchange fails
+             * and this tries again with the new top.
+             */
+            if (CFE_ES_AtomicCompareExchange64(&BucketPtr->FreeStackTop, &Top,
+                                               CFE_ES_GENERIC_POOL_STACK_NEXT(Top, BdPtr->NextOffset)))
+            {
+                break;
+            }
+        }
+        else
+        {
+            /* the block may have been taken by another task since the top was read */
+            CurrentTop = CFE_ES_AtomicLoad64(&BucketPtr->FreeStackTop);
+            if (CurrentTop == Top)
+            {
+                /* sanity check failed - possible pool corruption? */
+                return CFE_ES_BUFFER_NOT_IN_POOL;
+            }
+            Top = CurrentTop;
+        }
+    }
+
+    /* The block now belongs to this task alone */
+    BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId; /* Flag memory block as allocated */
+    BdPtr->ActualSize = NewSize;
+    BdPtr->NextOffset = 0;
+
+    *BlockOffsetPtr = BlockOffset;
+    CFE_ES_AtomicIncrement32(&BucketPtr->RecycleCount);
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Pushes a validated block onto the free stack of a lock-free pool
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_GenPoolPushFreeStack(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_GenPoolBucket_t *BucketPtr,
+                                         uint16 BucketId, size_t BlockOffset, CFE_ES_GenPoolBD_t *BdPtr)
+{
+    uint16 Allocated;
+    uint64 Top;
+
+    /* If the same block is returned by two tasks at once, only one of them gets to push it */
+    Allocated = CFE_ES_MEMORY_ALLOCATED + BucketId;
+    if (!CFE_ES_AtomicCompareExchange16(&BdPtr->Allocated, &Allocated, CFE_ES_MEMORY_DEALLOCATED + BucketId))
+    {
+        CFE_ES_AtomicIncrement32(&PoolRecPtr->ValidationErrorCount);
+        return CFE_ES_POOL_BLOCK_INVALID;
+    }
+
+    Top = CFE_ES_AtomicLoad64(&BucketPtr->FreeStackTop);
+    do
+    {
+        BdPtr->NextOffset = CFE_ES_GENERIC_POOL_STACK_OFFSET(Top);
+    } while (!CFE_ES_AtomicCompareExchange64(&BucketPtr->FreeStackTop, &Top,
+                                             CFE_ES_GENERIC_POOL_STACK_NEXT(Top, BlockOffset)));
+
+    CFE_ES_AtomicIncrement32(&BucketPtr->ReleaseCount);
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Gets the space reserved for the descriptor at the start of every block of a buddy pool
+ *
+ *-----------------------------------------------------------------*/
+static size_t CFE_ES_GenPoolBuddyHeaderSize(const CFE_ES_GenPoolRecord_t *PoolRecPtr)
+{
+    return (CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE + PoolRecPtr->AlignMask) & ~PoolRecPtr->AlignMask;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Puts a block on the front of the free list of a buddy pool bucket
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_GenPoolBuddyPush(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t BlockOffset)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    int32                   Status;
+
+    BucketPtr = &PoolRecPtr->Buckets[PoolRecPtr->NumBuckets - BucketId];
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        BdPtr->CheckBits  = CFE_ES_CHECK_PATTERN;
+        BdPtr->Allocated  = CFE_ES_MEMORY_DEALLOCATED + BucketId;
+        BdPtr->ActualSize = 0; /* no previous block */
+        BdPtr->NextOffset = BucketPtr->FirstOffset;
+
+        Status = PoolRecPtr->Commit(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+    }
+
+    if (Status == CFE_SUCCESS && BucketPtr->FirstOffset != 0)
+    {
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, BucketPtr->FirstOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE,
+                                      &BdPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            BdPtr->ActualSize = BlockOffset;
+            Status = PoolRecPtr->Commit(PoolRecPtr, BucketPtr->FirstOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE,
+                                        BdPtr);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        BucketPtr->FirstOffset = BlockOffset;
+        ++BucketPtr->ReleaseCount;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Takes a block out of the free list of a buddy pool bucket, given its neighbors in the list
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_GenPoolBuddyUnlink(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_GenPoolBucket_t *BucketPtr,
+                                       size_t NextOffset, size_t PrevOffset)
+{
+    CFE_ES_GenPoolBD_t *BdPtr;
+    int32               Status;
+
+    Status = CFE_SUCCESS;
+
+    if (PrevOffset == 0)
+    {
+        BucketPtr->FirstOffset = NextOffset;
+    }
+    else
+    {
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, PrevOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            BdPtr->NextOffset = NextOffset;
+            Status = PoolRecPtr->Commit(PoolRecPtr, PrevOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+        }
+    }
+
+    if (Status == CFE_SUCCESS && NextOffset != 0)
+    {
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, NextOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            BdPtr->ActualSize = PrevOffset;
+            Status = PoolRecPtr->Commit(PoolRecPtr, NextOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        ++BucketPtr->RecycleCount;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Takes the first block off the free list of a buddy pool bucket
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_GenPoolBuddyPop(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t *BlockOffsetPtr)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    size_t                  BlockOffset;
+    int32                   Status;
+
+    BucketPtr   = &PoolRecPtr->Buckets[PoolRecPtr->NumBuckets - BucketId];
+    BlockOffset = BucketPtr->FirstOffset;
+    if (BlockOffset == 0)
+    {
+        /* no buffers in pool to recycle */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN ||
+            BdPtr->Allocated != (uint16)(CFE_ES_MEMORY_DEALLOCATED + BucketId))
+        {
+            /* sanity check failed - possible pool corruption? */
+            Status = CFE_ES_BUFFER_NOT_IN_POOL;
+        }
+        else
+        {
+            Status = CFE_ES_GenPoolBuddyUnlink(PoolRecPtr, BucketPtr, BdPtr->NextOffset, 0);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        *BlockOffsetPtr = BlockOffset;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Frees a block of a buddy pool, merging it with its buddy as long as that is free too
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_GenPoolBuddyRelease(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t BlockOffset)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    size_t                  HeaderSize;
+    size_t                  BuddyOffset;
+    uint16                  Index;
+    int32                   Status;
+
+    HeaderSize = CFE_ES_GenPoolBuddyHeaderSize(PoolRecPtr);
+    Index      = PoolRecPtr->NumBuckets - BucketId;
+    Status     = CFE_SUCCESS;
+
+    /* the largest blocks have no buddy */
+    while (Index < (PoolRecPtr->NumBuckets - 1))
+    {
+        BucketPtr = &PoolRecPtr->Buckets[Index];
+
+        /*
+         * The blocks of each size start at a multiple of that size from the base,
+         * so the buddy is found by flipping the bit of the size in the position.
+         */
+        BuddyOffset = PoolRecPtr->BuddyBaseOffset +
+                      ((BlockOffset - HeaderSize - PoolRecPtr->BuddyBaseOffset) ^ (BucketPtr->BlockSize + HeaderSize)) +
+                      HeaderSize;
+        if (BuddyOffset >= PoolRecPtr->TailPosition)
+        {
+            /* the buddy has not been created yet */
+            break;
+        }
+
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, BuddyOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        if (Status != CFE_SUCCESS)
+        {
+            break;
+        }
+
+        /* if the buddy was split into smaller blocks, its position holds the descriptor of a smaller block */
+        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN ||
+            BdPtr->Allocated != (uint16)(CFE_ES_MEMORY_DEALLOCATED + PoolRecPtr->NumBuckets - Index))
+        {
+            break;
+        }
+
+        Status = CFE_ES_GenPoolBuddyUnlink(PoolRecPtr, BucketPtr, BdPtr->NextOffset, BdPtr->ActualSize);
+        if (Status != CFE_SUCCESS)
+        {
+            break;
+        }
+
+        /*
+         * The descriptor of the upper half becomes part of the merged block.
+         * Clear it, so putting that offset again is detected as invalid.
+         */
+        if (BuddyOffset < BlockOffset)
+        {
+            BuddyOffset ^= BlockOffset;
+            BlockOffset ^= BuddyOffset;
+            BuddyOffset ^= BlockOffset;
+        }
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, BuddyOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        if (Status != CFE_SUCCESS)
+        {
+            break;
+        }
+        BdPtr->CheckBits = 0;
+        BdPtr->Allocated = 0;
+        Status           = PoolRecPtr->Commit(PoolRecPtr, BuddyOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+        if (Status != CFE_SUCCESS)
+        {
+            break;
+        }
+
+        BucketPtr->AllocationCount -= 2;
+        ++Index;
+        ++PoolRecPtr->Buckets[Index].AllocationCount;
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_ES_GenPoolBuddyPush(PoolRecPtr, PoolRecPtr->NumBuckets - Index, BlockOffset);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Creates a free block at the tail of a buddy pool
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_GenPoolBuddyCarve(CFE_ES_GenPoolRecord_t *PoolRecPtr)
+{
+    CFE_ES_GenPoolBD_t *BdPtr;
+    size_t              HeaderSize;
+    size_t              Position;
+    size_t              TotalSize;
+    size_t              BlockOffset;
+    uint16              Index;
+    int32               Status;
+
+    HeaderSize = CFE_ES_GenPoolBuddyHeaderSize(PoolRecPtr);
+    Position   = PoolRecPtr->TailPosition - PoolRecPtr->BuddyBaseOffset;
+
+    /*
+     * Use the largest block that fits and starts at a multiple of its size.
+     * The tail is always a multiple of the smallest block size, and each
+     * smaller block moves it closer to the start of a larger one.
+     */
+    Index = PoolRecPtr->NumBuckets;
+    do
+    {
+        if (Index == 0)
+        {
+            /* can't fit in remaining mem */
+            return CFE_ES_ERR_MEM_BLOCK_SIZE;
+        }
+        --Index;
+        TotalSize = PoolRecPtr->Buckets[Index].BlockSize + HeaderSize;
+    } while ((Position & (TotalSize - 1)) != 0 ||
+             TotalSize > (PoolRecPtr->PoolMaxOffset - PoolRecPtr->TailPosition));
+
+    BlockOffset = PoolRecPtr->TailPosition + HeaderSize;
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        BdPtr->CheckBits  = CFE_ES_CHECK_PATTERN;
+        BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + PoolRecPtr->NumBuckets - Index;
+        BdPtr->ActualSize = 0;
+        BdPtr->NextOffset = 0;
+
+        Status = PoolRecPtr->Commit(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        PoolRecPtr->TailPosition += TotalSize;
+        ++PoolRecPtr->Buckets[Index].AllocationCount;
+        ++PoolRecPtr->AllocationCount;
+
+        Status = CFE_ES_GenPoolBuddyRelease(PoolRecPtr, PoolRecPtr->NumBuckets - Index, BlockOffset);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Gets a block of a buddy pool by splitting a larger free block
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_GenPoolBuddyCreate(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t NewSize,
+                                       size_t *BlockOffsetPtr)
+{
+    CFE_ES_GenPoolBD_t *BdPtr;
+    size_t              HeaderSize;
+    size_t              BlockOffset;
+    uint16              Index;
+    uint16              SplitIndex;
+    int32               Status;
+
+    HeaderSize = CFE_ES_GenPoolBuddyHeaderSize(PoolRecPtr);
+    Index      = PoolRecPtr->NumBuckets - BucketId;
+
+    /* find the smallest free block that fits, and make new blocks at the tail until there is one */
+    while (true)
+    {
+        SplitIndex = Index;
+        while (SplitIndex < PoolRecPtr->NumBuckets && PoolRecPtr->Buckets[SplitIndex].FirstOffset == 0)
+        {
+            ++SplitIndex;
+        }
+        if (SplitIndex < PoolRecPtr->NumBuckets)
+        {
+            break;
+        }
+
+        Status = CFE_ES_GenPoolBuddyCarve(PoolRecPtr);
+        if (Status != CFE_SUCCESS)
+        {
+            return Status;
+        }
+    }
+
+    Status = CFE_ES_GenPoolBuddyPop(PoolRecPtr, PoolRecPtr->NumBuckets - SplitIndex, &BlockOffset);
+
+    /* keep the lower half of the block, and free the upper half */
+    while (Status == CFE_SUCCESS && SplitIndex > Index)
+    {
+        --PoolRecPtr->Buckets[SplitIndex].AllocationCount;
+        --SplitIndex;
+        PoolRecPtr->Buckets[SplitIndex].AllocationCount += 2;
+
+        Status = CFE_ES_GenPoolBuddyPush(PoolRecPtr, PoolRecPtr->NumBuckets - SplitIndex,
+                                         BlockOffset + PoolRecPtr->Buckets[SplitIndex].BlockSize + HeaderSize);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+    }
+    if (Status == CFE_SUCCESS)
+    {
+        BdPtr->CheckBits  = CFE_ES_CHECK_PATTERN;
+        BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId; /* Flag memory block as allocated */
+        BdPtr->ActualSize = NewSize;
+        BdPtr->NextOffset = 0;
+
+        Status = PoolRecPtr->Commit(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, BdPtr);
+    }
+    if (Status == CFE_SUCCESS)
+    {
+        *BlockOffsetPtr = BlockOffset;
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -109,6 +628,38 @@ int32 CFE_ES_GenPoolRecyclePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16
     int32                   Status;
 
     BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+    if (BucketPtr != NULL && PoolRecPtr->LockFree)
+    {
+        return CFE_ES_GenPoolPopFreeStack(PoolRecPtr, BucketPtr, BucketId, NewSize, BlockOffsetPtr);
+    }
+
+    if (BucketPtr != NULL && PoolRecPtr->Buddy)
+    {
+        /* only a free block of the same size is recycled, splitting larger blocks is done on create */
+        Status = CFE_ES_GenPoolBuddyPop(PoolRecPtr, BucketId, &BlockOffset);
+        if (Status != CFE_SUCCESS)
+        {
+            return Status;
+        }
+
+        DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+        Status     = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId; /* Flag memory block as allocated */
+            BdPtr->ActualSize = NewSize;
+            BdPtr->NextOffset = 0;
+
+            Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+        }
+        if (Status == CFE_SUCCESS)
+        {
+            *BlockOffsetPtr = BlockOffset;
+        }
+
+        return Status;
+    }
+
     if (BucketPtr == NULL || BucketPtr->RecycleCount == BucketPtr->ReleaseCount || BucketPtr->FirstOffset == 0)
     {
         /* no buffers in pool to recycle */
@@ -174,6 +725,11 @@ int32 CFE_ES_GenPoolCreatePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 B
         return CFE_ES_BUFFER_NOT_IN_POOL;
     }
 
+    if (PoolRecPtr->Buddy)
+    {
+        return CFE_ES_GenPoolBuddyCreate(PoolRecPtr, BucketId, NewSize, BlockOffsetPtr);
+    }
+
     /*
      * Determine the offsets of the new user block,
      * which must be aligned according to the AlignMask member.
@@ -225,6 +781,38 @@ int32 CFE_ES_GenPoolCreatePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 B
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Builds the size class lookup table from the sorted bucket sizes
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_GenPoolSetSizeClasses(CFE_ES_GenPoolRecord_t *PoolRecPtr)
+{
+    uint32 i;
+    uint16 j;
+    size_t MinSize;
+
+    /*
+     * The smallest size in class i is 2^(i-1), so buckets
+     * smaller than that never fit a size of the class.
+     */
+    j       = 0;
+    MinSize = 0;
+    for (i = 0; i < CFE_ES_GENERIC_POOL_SIZE_CLASSES; ++i)
+    {
+        if (i > 0)
+        {
+            MinSize = (size_t)1 << (i - 1);
+        }
+        while (j < PoolRecPtr->NumBuckets && PoolRecPtr->Buckets[j].BlockSize < MinSize)
+        {
+            ++j;
+        }
+        PoolRecPtr->SizeClassStart[i] = j;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -307,14 +895,93 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
     } while (j > 0);
 
     /*
-     * Additional sanity check - after sorting the list,
-     * confirm that the smallest block size (first entry)
-     * is not zero.
+     * Additional sanity check - after sorting the list,
+     * confirm that the smallest block size (first entry)
+     * is not zero.
+     */
+    if (PoolRecPtr->Buckets[0].BlockSize == 0)
+    {
+        return CFE_ES_ERR_MEM_BLOCK_SIZE;
+    }
+
+    CFE_ES_GenPoolSetSizeClasses(PoolRecPtr);
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_GenPoolEnableLockFree(CFE_ES_GenPoolRecord_t *PoolRecPtr)
+{
+    /* the tagged free stacks only have room for 32 bit offsets */
+    PoolRecPtr->LockFree = (CFE_ES_ATOMIC_LOCK_FREE && (uint64)PoolRecPtr->PoolMaxOffset <= 0xFFFFFFFF);
+
+    return PoolRecPtr->LockFree;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolEnableBuddy(CFE_ES_GenPoolRecord_t *PoolRecPtr)
+{
+    size_t HeaderSize;
+    size_t MinTotalSize;
+    size_t MaxTotalSize;
+    size_t TotalSize;
+    uint16 NumOrders;
+    uint16 i;
+
+    /*
+     * Every block size is a power of two, including the descriptor.  The smallest
+     * one holds the smallest configured size, and the number of sizes is chosen
+     * so the largest one holds the largest configured size.
      */
-    if (PoolRecPtr->Buckets[0].BlockSize == 0)
+    HeaderSize   = CFE_ES_GenPoolBuddyHeaderSize(PoolRecPtr);
+    MinTotalSize = PoolRecPtr->Buckets[0].BlockSize + HeaderSize;
+    MaxTotalSize = PoolRecPtr->Buckets[PoolRecPtr->NumBuckets - 1].BlockSize + HeaderSize;
+
+    TotalSize = PoolRecPtr->AlignMask + 1;
+    while (TotalSize < MinTotalSize)
     {
-        return CFE_ES_ERR_MEM_BLOCK_SIZE;
+        TotalSize <<= 1;
+    }
+
+    NumOrders = 1;
+    while ((TotalSize << (NumOrders - 1)) < MaxTotalSize)
+    {
+        ++NumOrders;
+        if (NumOrders > CFE_PLATFORM_ES_POOL_MAX_BUCKETS)
+        {
+            CFE_ES_WriteToSysLog("%s: Block sizes %lu-%lu need more than %d buddy sizes\n", __func__,
+                                 (unsigned long)PoolRecPtr->Buckets[0].BlockSize,
+                                 (unsigned long)PoolRecPtr->Buckets[PoolRecPtr->NumBuckets - 1].BlockSize,
+                                 CFE_PLATFORM_ES_POOL_MAX_BUCKETS);
+            return CFE_ES_BAD_ARGUMENT;
+        }
+    }
+
+    memset(PoolRecPtr->Buckets, 0, sizeof(PoolRecPtr->Buckets));
+    for (i = 0; i < NumOrders; ++i)
+    {
+        PoolRecPtr->Buckets[i].BlockSize = (TotalSize << i) - HeaderSize;
     }
+    PoolRecPtr->NumBuckets = NumOrders;
+    CFE_ES_GenPoolSetSizeClasses(PoolRecPtr);
+
+    /* the blocks are placed relative to an aligned base */
+    PoolRecPtr->TailPosition += PoolRecPtr->AlignMask;
+    PoolRecPtr->TailPosition &= ~PoolRecPtr->AlignMask;
+    PoolRecPtr->BuddyBaseOffset = PoolRecPtr->TailPosition;
+
+    PoolRecPtr->Buddy    = true;
+    PoolRecPtr->LockFree = false;
 
     return CFE_SUCCESS;
 }
@@ -349,6 +1016,22 @@ size_t CFE_ES_GenPoolCalcMinSize(uint16 NumBlockSizes, const size_t *BlockSizeLi
     return (NumBlocks * MinBlockSize);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolGetFreeBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOffsetPtr, size_t ReqSize)
+{
+    uint16 BucketId;
+
+    /* if no bucket fits, the bucket ID is 0 and there is nothing to recycle */
+    BucketId = CFE_ES_GenPoolFindBucket(PoolRecPtr, ReqSize);
+
+    return CFE_ES_GenPoolRecyclePoolBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -455,9 +1138,22 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSi
             BucketPtr->BlockSize < BdPtr->ActualSize)
         {
             /* This does not appear to be a valid data buffer */
-            ++PoolRecPtr->ValidationErrorCount;
+            CFE_ES_AtomicIncrement32(&PoolRecPtr->ValidationErrorCount);
             Status = CFE_ES_POOL_BLOCK_INVALID;
         }
+        else if (PoolRecPtr->LockFree)
+        {
+            /* the block may be recycled as soon as it is pushed, so get the size first */
+            *BlockSizePtr = BdPtr->ActualSize;
+
+            Status = CFE_ES_GenPoolPushFreeStack(PoolRecPtr, BucketPtr, BucketId, BlockOffset, BdPtr);
+        }
+        else if (PoolRecPtr->Buddy)
+        {
+            *BlockSizePtr = BdPtr->ActualSize;
+
+            Status = CFE_ES_GenPoolBuddyRelease(PoolRecPtr, BucketId, BlockOffset);
+        }
         else
         {
             BdPtr->Allocated  = CFE_ES_MEMORY_DEALLOCATED + BucketId;
@@ -476,6 +1172,107 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSi
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolCacheBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSizePtr, uint16 *BucketIdPtr,
+                               size_t BlockOffset)
+{
+    size_t                  DescOffset;
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    int32                   Status;
+    uint16                  BucketId;
+    uint16                  Allocated;
+
+    if (BlockOffset >= PoolRecPtr->TailPosition || BlockOffset < CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE)
+    {
+        /* outside the bounds of the pool */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        BucketId  = BdPtr->Allocated - CFE_ES_MEMORY_ALLOCATED;
+        BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+        Allocated = CFE_ES_MEMORY_ALLOCATED + BucketId;
+
+        /* as with a lock-free put, only one of two tasks returning the same block gets it */
+        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN || BucketPtr == NULL || BdPtr->ActualSize == 0 ||
+            BucketPtr->BlockSize < BdPtr->ActualSize ||
+            !CFE_ES_AtomicCompareExchange16(&BdPtr->Allocated, &Allocated, CFE_ES_MEMORY_CACHED + BucketId))
+        {
+            /* This does not appear to be a valid data buffer */
+            CFE_ES_AtomicIncrement32(&PoolRecPtr->ValidationErrorCount);
+            Status = CFE_ES_POOL_BLOCK_INVALID;
+        }
+        else
+        {
+            *BlockSizePtr = BdPtr->ActualSize;
+            *BucketIdPtr  = BucketId;
+
+            Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolUncacheBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t BlockOffset, size_t NewSize)
+{
+    size_t                  DescOffset;
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    int32                   Status;
+    uint16                  BucketId;
+
+    if (BlockOffset >= PoolRecPtr->TailPosition || BlockOffset < CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE)
+    {
+        /* outside the bounds of the pool */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        BucketId  = BdPtr->Allocated - CFE_ES_MEMORY_CACHED;
+        BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+
+        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN || BucketPtr == NULL || BucketPtr->BlockSize < NewSize)
+        {
+            /* the cached block was overwritten */
+            CFE_ES_AtomicIncrement32(&PoolRecPtr->ValidationErrorCount);
+            Status = CFE_ES_POOL_BLOCK_INVALID;
+        }
+        else
+        {
+            BdPtr->Allocated = CFE_ES_MEMORY_ALLOCATED + BucketId;
+            if (NewSize != 0)
+            {
+                BdPtr->ActualSize = NewSize;
+            }
+
+            Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+        }
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -666,3 +1463,227 @@ void CFE_ES_GenPoolGetBucketUsage(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 Buc
         BlockStatsBuf->NumFree    = BucketPtr->ReleaseCount - BucketPtr->RecycleCount;
     }
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_GenPoolGetFragmentation(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_MemOffset_t *FreeBlockBytesBuf,
+                                    CFE_ES_MemOffset_t *LargestFreeBlockBuf)
+{
+    const CFE_ES_GenPoolBucket_t *BucketPtr;
+    size_t                        FreeBlockBytes;
+    size_t                        LargestFreeBlock;
+    size_t                        BlockOffset;
+    size_t                        TotalSize;
+    uint16                        i;
+
+    FreeBlockBytes   = 0;
+    LargestFreeBlock = 0;
+
+    for (i = 0; i < PoolRecPtr->NumBuckets; ++i)
+    {
+        BucketPtr = &PoolRecPtr->Buckets[i];
+
+        FreeBlockBytes += BucketPtr->BlockSize * (BucketPtr->ReleaseCount - BucketPtr->RecycleCount);
+
+        if (BucketPtr->ReleaseCount != BucketPtr->RecycleCount)
+        {
+            /* a free block of this size can be reused */
+            LargestFreeBlock = BucketPtr->BlockSize;
+        }
+        else if (PoolRecPtr->Buddy)
+        {
+            /* smaller blocks are made at the tail until one of this size starts at a multiple of its size */
+            TotalSize   = BucketPtr->BlockSize + CFE_ES_GenPoolBuddyHeaderSize(PoolRecPtr);
+            BlockOffset = PoolRecPtr->TailPosition - PoolRecPtr->BuddyBaseOffset;
+            BlockOffset = (BlockOffset + TotalSize - 1) & ~(TotalSize - 1);
+            if (TotalSize <= (PoolRecPtr->PoolMaxOffset - PoolRecPtr->BuddyBaseOffset) &&
+                BlockOffset <= (PoolRecPtr->PoolMaxOffset - PoolRecPtr->BuddyBaseOffset - TotalSize))
+            {
+                LargestFreeBlock = BucketPtr->BlockSize;
+            }
+        }
+        else
+        {
+            /* a new block of this size can still be created */
+            BlockOffset = PoolRecPtr->TailPosition + CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+            BlockOffset += PoolRecPtr->AlignMask;
+            BlockOffset &= ~PoolRecPtr->AlignMask;
+            if (BlockOffset <= PoolRecPtr->PoolMaxOffset &&
+                BucketPtr->BlockSize <= (PoolRecPtr->PoolMaxOffset - BlockOffset))
+            {
+                LargestFreeBlock = BucketPtr->BlockSize;
+            }
+        }
+    }
+
+    if (FreeBlockBytesBuf != NULL)
+    {
+        *FreeBlockBytesBuf = CFE_ES_MEMOFFSET_C(FreeBlockBytes);
+    }
+    if (LargestFreeBlockBuf != NULL)
+    {
+        *LargestFreeBlockBuf = CFE_ES_MEMOFFSET_C(LargestFreeBlock);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_GenPoolEnableProfile(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_GenPoolProfile_t *ProfilePtr)
+{
+    memset(ProfilePtr, 0, sizeof(*ProfilePtr));
+
+    PoolRecPtr->Profile = ProfilePtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_GenPoolProfileBin(size_t Size)
+{
+    uint32 Octave;
+    uint32 Bin;
+
+    if (Size < CFE_ES_POOLPROF_EXACT_SIZES)
+    {
+        return Size;
+    }
+
+    /* scale the size into the first octave above the exact sizes */
+    Octave = 0;
+    while (Size >= (2 * CFE_ES_POOLPROF_EXACT_SIZES))
+    {
+        Size >>= 1;
+        ++Octave;
+    }
+
+    if (Octave >= (CFE_ES_POOLPROF_HIST_BINS - CFE_ES_POOLPROF_EXACT_SIZES) / CFE_ES_POOLPROF_SUB_BINS)
+    {
+        return CFE_ES_POOLPROF_HIST_BINS - 1;
+    }
+
+    Bin = CFE_ES_POOLPROF_EXACT_SIZES + (Octave * CFE_ES_POOLPROF_SUB_BINS);
+    Bin += (Size - CFE_ES_POOLPROF_EXACT_SIZES) / (CFE_ES_POOLPROF_EXACT_SIZES / CFE_ES_POOLPROF_SUB_BINS);
+
+    return Bin;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+size_t CFE_ES_GenPoolProfileBinMinSize(uint32 Bin)
+{
+    size_t SubBin;
+    size_t Octave;
+
+    if (Bin < CFE_ES_POOLPROF_EXACT_SIZES)
+    {
+        return Bin;
+    }
+
+    Octave = (Bin - CFE_ES_POOLPROF_EXACT_SIZES) / CFE_ES_POOLPROF_SUB_BINS;
+    SubBin = (Bin - CFE_ES_POOLPROF_EXACT_SIZES) % CFE_ES_POOLPROF_SUB_BINS;
+
+    return (CFE_ES_POOLPROF_EXACT_SIZES + (SubBin * (CFE_ES_POOLPROF_EXACT_SIZES / CFE_ES_POOLPROF_SUB_BINS)))
+           << Octave;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Raises a value shared with other tasks to at least the given value
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_GenPoolProfileRaise(uint32 *Ptr, uint32 Value)
+{
+    uint32 Current;
+
+    Current = CFE_ES_AtomicLoad32(Ptr);
+    while (Value > Current)
+    {
+        /* on failure Current is updated, and the check is repeated against it */
+        if (CFE_ES_AtomicCompareExchange32(Ptr, &Current, Value))
+        {
+            break;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_GenPoolProfileRequest(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize, bool Success)
+{
+    CFE_ES_GenPoolProfileBin_t *BinPtr;
+    uint32                      Size;
+
+    if (PoolRecPtr->Profile == NULL)
+    {
+        return;
+    }
+
+    BinPtr = &PoolRecPtr->Profile->Bins[CFE_ES_GenPoolProfileBin(ReqSize)];
+
+    /* the sizes of the last bin are not limited, so keep the largest one that fits the file */
+    Size = 0xFFFFFFFF;
+    if ((uint64)ReqSize < Size)
+    {
+        Size = ReqSize;
+    }
+    CFE_ES_GenPoolProfileRaise(&BinPtr->MaxSize, Size);
+
+    if (Success)
+    {
+        CFE_ES_AtomicIncrement32(&BinPtr->RequestCount);
+        CFE_ES_GenPoolProfileRaise(&BinPtr->PeakInUse, CFE_ES_AtomicIncrementFetch32(&BinPtr->InUse));
+    }
+    else
+    {
+        CFE_ES_AtomicIncrement32(&BinPtr->FailCount);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_GenPoolProfileRelease(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t BlockSize)
+{
+    CFE_ES_GenPoolProfileBin_t *BinPtr;
+    uint32                      InUse;
+
+    if (PoolRecPtr->Profile == NULL)
+    {
+        return;
+    }
+
+    BinPtr = &PoolRecPtr->Profile->Bins[CFE_ES_GenPoolProfileBin(BlockSize)];
+
+    InUse = CFE_ES_AtomicLoad32(&BinPtr->InUse);
+    while (InUse != 0)
+    {
+        /* on failure InUse is updated, and the check is repeated against it */
+        if (CFE_ES_AtomicCompareExchange32(&BinPtr->InUse, &InUse, InUse - 1))
+        {
+            break;
+        }
+    }
+}
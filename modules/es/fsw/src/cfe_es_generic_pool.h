@@ -38,6 +38,7 @@
 ** Include Files
 */
 #include "common_types.h"
+#include "cfe_es_poolprof_typedef.h"
 
 /*
 ** Macro Definitions
@@ -45,10 +46,27 @@
 #define CFE_ES_CHECK_PATTERN      ((uint16)0x5a5a)
 #define CFE_ES_MEMORY_ALLOCATED   ((uint16)0xaaaa)
 #define CFE_ES_MEMORY_DEALLOCATED ((uint16)0xdddd)
+#define CFE_ES_MEMORY_CACHED      ((uint16)0xcccc)
 
 #define CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE \
     sizeof(CFE_ES_GenPoolBD_t) /* amount of space to reserve with every allocation */
 
+/*
+ * Number of size classes in the bucket lookup table.  The class of a size is
+ * its number of significant bits, so there is one for each bit plus one for 0.
+ */
+#define CFE_ES_GENERIC_POOL_SIZE_CLASSES ((sizeof(size_t) * 8) + 1)
+
+/*
+ * The top of a lock-free free stack combines the offset of the first block
+ * (lower 32 bits) with a tag that is changed on every update (upper 32 bits).
+ * The tag makes the compare-and-swap fail if the top block was popped and
+ * pushed back by another task in the meantime (the "ABA" problem).
+ */
+#define CFE_ES_GENERIC_POOL_STACK_OFFSET(Top) ((size_t)((Top)&0xFFFFFFFF))
+#define CFE_ES_GENERIC_POOL_STACK_NEXT(Top, Offset) \
+    ((((Top) + ((uint64)1 << 32)) & ~(uint64)0xFFFFFFFF) | (uint64)(Offset))
+
 /*
 ** Type Definitions
 */
@@ -57,7 +75,7 @@ typedef struct CFE_ES_GenPoolBD
 {
     uint16 CheckBits;  /**< Set to a fixed bit pattern after init */
     uint16 Allocated;  /**< Set to a bit pattern depending on allocation state */
-    size_t ActualSize; /**< The actual requested size of the block */
+    size_t ActualSize; /**< The actual requested size of the block, or the previous free block in buddy pools */
     size_t NextOffset; /**< The offset of the next descriptor in the free stack */
 } CFE_ES_GenPoolBD_t;
 
@@ -65,11 +83,32 @@ typedef struct CFE_ES_GenPoolBucket
 {
     size_t BlockSize;
     size_t FirstOffset;     /**< Top of the "free stack" of buffers which have been returned */
+    uint64 FreeStackTop;    /**< Tagged top of the free stack, used instead of FirstOffset in lock-free pools */
     uint32 AllocationCount; /**< Total number of buffers of this block size that exist (initial get) */
     uint32 ReleaseCount;    /**< Total number of buffers that have been released (put back) */
     uint32 RecycleCount;    /**< Total number of buffers that have been recycled (get after put) */
 } CFE_ES_GenPoolBucket_t;
 
+/**
+ * \brief Size profile counters of one bin of requested sizes
+ */
+typedef struct CFE_ES_GenPoolProfileBin
+{
+    uint32 RequestCount; /**< Number of requests that were given a block */
+    uint32 FailCount;    /**< Number of requests that could not be given a block */
+    uint32 InUse;        /**< Number of blocks currently allocated */
+    uint32 PeakInUse;    /**< Highest number of blocks allocated at once */
+    uint32 MaxSize;      /**< Largest size requested */
+} CFE_ES_GenPoolProfileBin_t;
+
+/**
+ * \brief Size profile of a pool, see CFE_ES_GenPoolEnableProfile()
+ */
+typedef struct CFE_ES_GenPoolProfile
+{
+    CFE_ES_GenPoolProfileBin_t Bins[CFE_ES_POOLPROF_HIST_BINS];
+} CFE_ES_GenPoolProfile_t;
+
 /*
  * Forward struct typedef so it can be used in retrieve/commit prototype
  */
@@ -112,8 +151,21 @@ struct CFE_ES_GenPoolRecord
     uint32 AllocationCount;      /**< Total number of block allocations of any size */
     uint32 ValidationErrorCount; /**< Count of validation errors */
 
+    bool LockFree; /**< Free stacks are updated with atomic operations, see CFE_ES_GenPoolEnableLockFree() */
+    bool Buddy;    /**< Blocks are split and merged by the buddy system, see CFE_ES_GenPoolEnableBuddy() */
+
+    size_t BuddyBaseOffset; /**< Position that buddy pool blocks are aligned to their size from */
+
+    CFE_ES_GenPoolProfile_t *Profile; /**< Size profile updated by the pool, NULL if not profiled */
+
     uint16                 NumBuckets; /**< Number of entries in the "Buckets" array that are valid */
     CFE_ES_GenPoolBucket_t Buckets[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Bucket States */
+
+    /**
+     * First bucket that may fit a size of each size class.  The bucket for a size
+     * is found by a short scan from here, instead of from the smallest bucket.
+     */
+    uint16 SizeClassStart[CFE_ES_GENERIC_POOL_SIZE_CLASSES];
 };
 
 /*****************************************************************************/
@@ -143,6 +195,141 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
                                size_t AlignSize, uint16 NumBlockSizes, const size_t *BlockSizeList,
                                CFE_ES_PoolRetrieve_Func_t RetrieveFunc, CFE_ES_PoolCommit_Func_t CommitFunc);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Updates the free stacks of a pool with atomic operations
+ *
+ * After this, blocks can be returned to the pool and recycled from the
+ * free stacks by several tasks at once without a lock, using
+ * CFE_ES_GenPoolPutBlock() and CFE_ES_GenPoolGetFreeBlock().  Only
+ * CFE_ES_GenPoolGetBlock(), which may create new blocks, and the
+ * functions that read the pool state still need to be serialized.
+ *
+ * This must be called right after CFE_ES_GenPoolInitialize(), and is only
+ * possible for pools whose descriptors are accessed directly in memory.
+ * It has no effect if the target has no native atomic operations or the
+ * pool is too large for the tagged free stacks (4 GiB).
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ *
+ * \return true if the free stacks are lock-free
+ */
+bool CFE_ES_GenPoolEnableLockFree(CFE_ES_GenPoolRecord_t *PoolRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Splits and merges the blocks of a pool by the buddy system
+ *
+ * The bucket sizes are replaced by powers of two (including the descriptor)
+ * from the smallest to the largest configured size.  A block is taken from
+ * the smallest free block that fits, splitting it in halves as needed, and a
+ * returned block is merged with its other half (its "buddy") whenever both
+ * are free.  Memory that was used for small blocks can therefore be reused
+ * for larger ones.
+ *
+ * Free blocks are kept in doubly linked lists, the previous block is stored
+ * in the ActualSize member of the descriptor of a free block.  The lists are
+ * not lock-free, and a buddy pool cannot be rebuilt by CFE_ES_GenPoolRebuild().
+ *
+ * This must be called right after CFE_ES_GenPoolInitialize().
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolEnableBuddy(CFE_ES_GenPoolRecord_t *PoolRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Records the sizes requested from a pool
+ *
+ * After this, the requests and returns reported with
+ * CFE_ES_GenPoolProfileRequest() and CFE_ES_GenPoolProfileRelease() are
+ * counted in the bin of the requested size in the given profile.  Each bin
+ * keeps the number of requests, the number of blocks allocated at the moment
+ * and the highest number allocated at once.
+ *
+ * The counts are kept by the users of the pool rather than by the block
+ * functions, as blocks also move between the pool and the magazines of
+ * CFE_ES_MemPoolMagazineGet() while they are not in use.
+ *
+ * This must be called after CFE_ES_GenPoolInitialize().
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[out]   ProfilePtr     Profile to update, which is reset here
+ */
+void CFE_ES_GenPoolEnableProfile(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_GenPoolProfile_t *ProfilePtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Counts a block request in the size profile of a pool
+ *
+ * Does nothing if the pool is not profiled.  The counters are updated with
+ * atomic operations, so this may be called without holding the lock of the pool.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[in]    ReqSize        Size of block requested
+ * \param[in]    Success        Whether the request was given a block
+ */
+void CFE_ES_GenPoolProfileRequest(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize, bool Success);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Counts a returned block in the size profile of a pool
+ *
+ * Does nothing if the pool is not profiled.  The count of allocated blocks does
+ * not go below zero when blocks that were allocated before the profile was
+ * enabled, such as those found by CFE_ES_GenPoolRebuild(), are returned.  This
+ * may be called without holding the lock of the pool.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[in]    BlockSize      Requested size of the returned block
+ */
+void CFE_ES_GenPoolProfileRelease(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t BlockSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets the profile bin of a requested size
+ *
+ * \note Internal helper routine only, not part of API.
+ *
+ * Sizes below #CFE_ES_POOLPROF_EXACT_SIZES have a bin of their own, and each
+ * power of two above that is divided into #CFE_ES_POOLPROF_SUB_BINS bins.
+ *
+ * \param[in] Size     Requested size
+ *
+ * \return Bin index, limited to the last bin
+ */
+uint32 CFE_ES_GenPoolProfileBin(size_t Size);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets the smallest size counted in a profile bin
+ *
+ * \note Internal helper routine only, not part of API.
+ *
+ * \param[in] Bin      Bin index, see CFE_ES_GenPoolProfileBin()
+ *
+ * \return Smallest size of the bin
+ */
+size_t CFE_ES_GenPoolProfileBinMinSize(uint32 Bin);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets a previously returned block from the pool
+ *
+ * This only recycles blocks from the free stacks, and does not
+ * create new blocks.  In a lock-free pool it may be called
+ * without holding the lock of the pool.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[out]   BlockOffsetPtr  Location to output new block offset
+ * \param[in]    ReqSize        Size of block requested
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolGetFreeBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOffsetPtr, size_t ReqSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Gets a block from the pool
@@ -158,6 +345,19 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
  */
 int32 CFE_ES_GenPoolGetBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOffsetPtr, size_t ReqSize);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Find the bucket for a block of the given size
+ *
+ * \note Internal helper routine only, not part of API.
+ *
+ * \param[in] PoolRecPtr     Pointer to pool structure
+ * \param[in] ReqSize        Size of block requested
+ *
+ * \return ID of the smallest bucket that fits the size, or 0 if none fits
+ */
+uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Create a new block of the given size.
@@ -198,6 +398,9 @@ int32 CFE_ES_GenPoolRecyclePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16
  * This marks the previously allocated block as deallocated,
  * and allows it to be recycled on a future get request.
  *
+ * In a lock-free pool this may be called without holding the
+ * lock of the pool.
+ *
  * \param[inout] PoolRecPtr     Pointer to pool structure
  * \param[out]   BlockSizePtr   Location to output original allocation size
  * \param[in]    BlockOffset    Offset of data block
@@ -206,6 +409,42 @@ int32 CFE_ES_GenPoolRecyclePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16
  */
 int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSizePtr, size_t BlockOffset);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Marks an allocated block as held in a cache
+ *
+ * The block stays out of the free lists of the pool, but it is no longer
+ * valid for the user.  Returning it again is detected as a validation error.
+ *
+ * This may be called without holding the lock of the pool.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[out]   BlockSizePtr   Location to output original allocation size
+ * \param[out]   BucketIdPtr    Location to output the bucket ID of the block
+ * \param[in]    BlockOffset    Offset of data block
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolCacheBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSizePtr, uint16 *BucketIdPtr,
+                               size_t BlockOffset);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Marks a block held in a cache as allocated again
+ *
+ * This reverses CFE_ES_GenPoolCacheBlock(), either to give the block to a user
+ * or to return it to the pool with CFE_ES_GenPoolPutBlock().
+ *
+ * This may be called without holding the lock of the pool.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[in]    BlockOffset    Offset of data block
+ * \param[in]    NewSize        New size of the block, or 0 to keep the size it had when cached
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolUncacheBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t BlockOffset, size_t NewSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Rebuild list of free blocks in pool
@@ -301,6 +540,21 @@ void CFE_ES_GenPoolGetCounts(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 *NumBuck
 void CFE_ES_GenPoolGetBucketUsage(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId,
                                   CFE_ES_BlockStats_t *BlockStatsBuf);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Query the fragmentation of the pool structure
+ *
+ * Obtain the free space held in blocks for telemetry/statistics reporting.
+ * Together with the never allocated space from CFE_ES_GenPoolGetUsage(), this
+ * shows how much of the free space is usable for the largest requests.
+ *
+ * \param[in]  PoolRecPtr           Pointer to pool structure
+ * \param[out] FreeBlockBytesBuf    Buffer to store the size of all free blocks
+ * \param[out] LargestFreeBlockBuf  Buffer to store the largest size that can be allocated now
+ */
+void CFE_ES_GenPoolGetFragmentation(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_MemOffset_t *FreeBlockBytesBuf,
+                                    CFE_ES_MemOffset_t *LargestFreeBlockBuf);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Calculate the pool size required for the specified number of blocks
@@ -117,6 +117,11 @@ typedef struct
     */
     CFE_ES_MemStatsTlm_t MemStatsPacket;
 
+    /*
+    ** Performance marker statistics telemetry
+    */
+    CFE_ES_PerfStatsTlm_t PerfStatsPacket;
+
     /*
     ** ES Task operational data (not reported in housekeeping)
     */
@@ -142,13 +147,30 @@ typedef struct
 
     /*
     ** Performance Data Mutex
+    ** Only taken when a task claims its performance log buffer, not for each entry
     */
     osal_id_t PerfDataMutex;
 
+    /*
+    ** Performance log task buffer assignments
+    */
+    CFE_ES_PerfTaskMap_t PerfTaskMap[OS_MAX_TASKS];
+
+    /*
+    ** Performance marker latency statistics
+    */
+    CFE_ES_PerfStatsGlobal_t PerfStats;
+
     /*
     ** Startup Sync
+    **
+    ** Tasks waiting for the system state register in SystemStateWaiters, under the
+    ** shared data lock, and block on SystemStateSemId.  Each change of the system
+    ** state gives the semaphore once for every registered waiter.
     */
     volatile sig_atomic_t SystemState;
+    osal_id_t             SystemStateSemId;
+    uint32                SystemStateWaiters;
 
     /*
     ** ES Task Table
@@ -192,8 +214,9 @@ typedef struct
     /*
     ** Memory Pools
     */
-    CFE_ResourceId_t       LastMemPoolId;
-    CFE_ES_MemPoolRecord_t MemPoolTable[CFE_PLATFORM_ES_MAX_MEMORY_POOLS];
+    CFE_ResourceId_t         LastMemPoolId;
+    CFE_ES_MemPoolRecord_t   MemPoolTable[CFE_PLATFORM_ES_MAX_MEMORY_POOLS];
+    CFE_ES_PoolMagazineSet_t PoolMagazineSets[CFE_PLATFORM_ES_POOL_MAX_MAGAZINE_POOLS];
 
     /*
     ** ES Task initialization data (not reported in housekeeping)
@@ -205,11 +228,36 @@ typedef struct
      */
     CFE_ES_PerfDumpGlobal_t BackgroundPerfDumpState;
 
+    /*
+     * Persistent state data associated with performance log streaming
+     */
+    CFE_ES_PerfStreamGlobal_t BackgroundPerfStreamState;
+
     /*
      * Persistent state data associated with background app table scans
      */
     CFE_ES_AppTableScanState_t BackgroundAppScanState;
 
+    /*
+     * State of running the startup script on worker tasks
+     */
+    CFE_ES_StartupQueue_t StartupQueue;
+
+    /*
+     * Lock profiler data, and the state of its file writes
+     */
+    CFE_ES_LockProfileGlobal_t LockProfile;
+
+    /*
+     * Pool size profiles, and the state of their file writes
+     */
+    CFE_ES_PoolProfileGlobal_t PoolProfile;
+
+    /*
+     * Startup timeline, and the state of its file writes
+     */
+    CFE_ES_TimelineGlobal_t Timeline;
+
     /*
      * Task global data (formerly a separate global).
      */
@@ -0,0 +1,421 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+**  File:
+**    cfe_es_lockprof.c
+**
+**  Purpose:
+**    This file implements the cFE Executive Services lock profiler, which
+**    keeps wait and hold time statistics for each call site of the core locks.
+**
+**  References:
+**     Flight Software Branch C Coding Standard Version 1.0a
+**     cFE Flight Software Application Developers Guide
+**
+**  Notes:
+**
+*/
+
+/*
+** Required header files.
+*/
+#include "cfe_es_module_all.h"
+
+#include <string.h>
+#include <stdio.h>
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Reads the timebase as a single tick count
+ *
+ *-----------------------------------------------------------------*/
+static uint64 CFE_ES_LockProfileTicks(uint32 Upper32, uint32 Lower32)
+{
+    uint32 Rollover;
+
+    /* a rollover of 0 means the lower word uses all 32 bits */
+    Rollover = CFE_PSP_GetTimerLow32Rollover();
+    if (Rollover != 0)
+    {
+        return ((uint64)Upper32 * Rollover) + Lower32;
+    }
+
+    return ((uint64)Upper32 << 32) + Lower32;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Limits a tick count to 32 bits
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_LockProfileClamp(uint64 Ticks)
+{
+    if (Ticks > 0xFFFFFFFF)
+    {
+        return 0xFFFFFFFF;
+    }
+
+    return Ticks;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Finds the entry of a call site, adding it if needed
+ *
+ *-----------------------------------------------------------------*/
+static CFE_ES_LockProfileSite_t *CFE_ES_LockProfileFindSite(CFE_ES_LockProfileRecord_t *RecPtr,
+                                                            const char *FunctionName, int32 LineNumber)
+{
+    CFE_ES_LockProfileSite_t *SitePtr;
+    uint32                    i;
+
+    /* the function names are static strings, so comparing the pointer is enough */
+    for (i = 0; i < RecPtr->NumSites; ++i)
+    {
+        SitePtr = &RecPtr->Sites[i];
+        if (SitePtr->FunctionName == FunctionName && SitePtr->LineNumber == LineNumber)
+        {
+            return SitePtr;
+        }
+    }
+
+    if (RecPtr->NumSites < CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES)
+    {
+        SitePtr               = &RecPtr->Sites[RecPtr->NumSites];
+        SitePtr->FunctionName = FunctionName;
+        SitePtr->LineNumber   = LineNumber;
+        ++RecPtr->NumSites;
+    }
+    else
+    {
+        /* table is full, use the combined entry */
+        SitePtr = &RecPtr->Sites[CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES];
+    }
+
+    return SitePtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_LockProfileBin(uint64 Ticks)
+{
+    uint32 Bin;
+
+    Bin = 0;
+    while (Ticks != 0 && Bin < (CFE_ES_LOCKPROF_HIST_BINS - 1))
+    {
+        Ticks >>= 1;
+        ++Bin;
+    }
+
+    return Bin;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LockProfileBegin(CFE_ES_LockProfileStamp_t *Stamp)
+{
+    CFE_PSP_Get_Timebase(&Stamp->Upper32, &Stamp->Lower32);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_t LockId, const char *FunctionName, int32 LineNumber,
+                                const CFE_ES_LockProfileStamp_t *Stamp)
+{
+    CFE_ES_LockProfileRecord_t *RecPtr;
+    CFE_ES_LockProfileSite_t *  SitePtr;
+    uint32                      Upper32;
+    uint32                      Lower32;
+    uint64                      StartTicks;
+    uint64                      NowTicks;
+    uint64                      WaitTicks;
+
+    if (LockId >= CFE_ES_LockProfileId_MAX)
+    {
+        return;
+    }
+
+    CFE_PSP_Get_Timebase(&Upper32, &Lower32);
+    NowTicks   = CFE_ES_LockProfileTicks(Upper32, Lower32);
+    StartTicks = CFE_ES_LockProfileTicks(Stamp->Upper32, Stamp->Lower32);
+
+    WaitTicks = 0;
+    if (NowTicks > StartTicks)
+    {
+        WaitTicks = NowTicks - StartTicks;
+    }
+
+    /* The caller holds the lock, so nothing else modifies this record */
+    RecPtr  = &CFE_ES_Global.LockProfile.Locks[LockId];
+    SitePtr = CFE_ES_LockProfileFindSite(RecPtr, FunctionName, LineNumber);
+
+    ++SitePtr->Count;
+    SitePtr->TotalWaitTicks += WaitTicks;
+    if (WaitTicks > SitePtr->MaxWaitTicks)
+    {
+        SitePtr->MaxWaitTicks = CFE_ES_LockProfileClamp(WaitTicks);
+    }
+    ++SitePtr->WaitHistogram[CFE_ES_LockProfileBin(WaitTicks)];
+
+    /* the hold time is measured from the outermost acquisition, if the lock is taken recursively */
+    if (RecPtr->HoldDepth == 0)
+    {
+        RecPtr->HolderSite   = SitePtr;
+        RecPtr->AcquireTicks = NowTicks;
+    }
+    ++RecPtr->HoldDepth;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LockProfileReleased(CFE_ES_LockProfileId_t LockId)
+{
+    CFE_ES_LockProfileRecord_t *RecPtr;
+    CFE_ES_LockProfileSite_t *  SitePtr;
+    uint32                      Upper32;
+    uint32                      Lower32;
+    uint64                      NowTicks;
+    uint64                      HoldTicks;
+
+    if (LockId >= CFE_ES_LockProfileId_MAX)
+    {
+        return;
+    }
+
+    RecPtr = &CFE_ES_Global.LockProfile.Locks[LockId];
+
+    /* acquisitions that were not recorded (e.g. failed takes) are not paired */
+    if (RecPtr->HoldDepth == 0)
+    {
+        return;
+    }
+
+    --RecPtr->HoldDepth;
+    if (RecPtr->HoldDepth == 0)
+    {
+        CFE_PSP_Get_Timebase(&Upper32, &Lower32);
+        NowTicks = CFE_ES_LockProfileTicks(Upper32, Lower32);
+
+        HoldTicks = 0;
+        if (NowTicks > RecPtr->AcquireTicks)
+        {
+            HoldTicks = NowTicks - RecPtr->AcquireTicks;
+        }
+
+        SitePtr = RecPtr->HolderSite;
+        SitePtr->TotalHoldTicks += HoldTicks;
+        if (HoldTicks > SitePtr->MaxHoldTicks)
+        {
+            SitePtr->MaxHoldTicks = CFE_ES_LockProfileClamp(HoldTicks);
+        }
+        ++SitePtr->HoldHistogram[CFE_ES_LockProfileBin(HoldTicks)];
+
+        RecPtr->HolderSite = NULL;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_WriteLockProfileCmd(const CFE_ES_WriteLockProfileCmd_t *data)
+{
+    const CFE_ES_FileNameCmd_Payload_t *CmdPtr = &data->Payload;
+    CFE_ES_LockProfileDumpState_t *     StatePtr;
+    int32                               Status;
+
+    StatePtr = &CFE_ES_Global.LockProfile.BackgroundDumpState;
+
+    /* check if pending before overwriting fields in the structure */
+    if (CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite))
+    {
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+    else
+    {
+        /* Reset the entire state object (just for good measure, ensure no stale data) */
+        memset(StatePtr, 0, sizeof(*StatePtr));
+
+        StatePtr->FileWrite.FileSubType = CFE_FS_SubType_ES_LOCKPROF;
+        snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), CFE_ES_LOCKPROF_LOG_DESC);
+
+        StatePtr->FileWrite.GetData = CFE_ES_BackgroundLockProfileDataGetter;
+        StatePtr->FileWrite.OnEvent = CFE_ES_BackgroundLockProfileEventHandler;
+
+        /*
+        ** Copy the filename into local buffer with default name/path/extension if not specified
+        */
+        Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName, CmdPtr->FileName,
+                                             sizeof(StatePtr->FileWrite.FileName), sizeof(CmdPtr->FileName),
+                                             CFE_PLATFORM_ES_DEFAULT_LOCK_PROFILE_FILE,
+                                             CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                             CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_FS_BackgroundFileDumpRequest(&StatePtr->FileWrite);
+        }
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        if (Status == CFE_STATUS_REQUEST_ALREADY_PENDING)
+        {
+            CFE_EVS_SendEvent(CFE_ES_LOCKPROF_PENDING_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Lock profile write already in progress");
+        }
+        else
+        {
+            CFE_EVS_SendEvent(CFE_ES_LOCKPROF_ERR_EID, CFE_EVS_EventType_ERROR, "Error creating file, RC = %d",
+                              (int)Status);
+        }
+
+        /* background dump did not start, consider this an error */
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+    }
+    else
+    {
+        CFE_ES_Global.TaskData.CommandCounter++;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_BackgroundLockProfileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_ES_LockProfileDumpState_t * StatePtr;
+    CFE_ES_LockProfile_FileEntry_t *FileBufferPtr;
+    CFE_ES_LockProfileSite_t *      SitePtr;
+    uint32                          LockId;
+    uint32                          SiteIdx;
+
+    StatePtr      = (CFE_ES_LockProfileDumpState_t *)Meta;
+    FileBufferPtr = &StatePtr->EntryBuffer;
+
+    /* each lock has its call sites followed by the combined entry */
+    LockId  = RecordNum / (CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES + 1);
+    SiteIdx = RecordNum % (CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES + 1);
+
+    *Buffer  = NULL;
+    *BufSize = 0;
+
+    if (LockId < CFE_ES_LockProfileId_MAX)
+    {
+        SitePtr = &CFE_ES_Global.LockProfile.Locks[LockId].Sites[SiteIdx];
+
+        /* unused entries leave a hole, which is skipped */
+        if (SitePtr->Count != 0)
+        {
+            memset(FileBufferPtr, 0, sizeof(*FileBufferPtr));
+
+            FileBufferPtr->LockId = LockId;
+            if (SitePtr->FunctionName != NULL)
+            {
+                strncpy(FileBufferPtr->FunctionName, SitePtr->FunctionName, sizeof(FileBufferPtr->FunctionName) - 1);
+                FileBufferPtr->LineNumber = SitePtr->LineNumber;
+            }
+            else
+            {
+                strncpy(FileBufferPtr->FunctionName, "(other)", sizeof(FileBufferPtr->FunctionName) - 1);
+            }
+
+            FileBufferPtr->TimerTicksPerSecond = CFE_PSP_GetTimerTicksPerSecond();
+            FileBufferPtr->Count               = SitePtr->Count;
+            FileBufferPtr->MaxWaitTicks        = SitePtr->MaxWaitTicks;
+            FileBufferPtr->MaxHoldTicks        = SitePtr->MaxHoldTicks;
+            FileBufferPtr->TotalWaitTicks      = SitePtr->TotalWaitTicks;
+            FileBufferPtr->TotalHoldTicks      = SitePtr->TotalHoldTicks;
+            memcpy(FileBufferPtr->WaitHistogram, SitePtr->WaitHistogram, sizeof(FileBufferPtr->WaitHistogram));
+            memcpy(FileBufferPtr->HoldHistogram, SitePtr->HoldHistogram, sizeof(FileBufferPtr->HoldHistogram));
+
+            *Buffer  = FileBufferPtr;
+            *BufSize = sizeof(*FileBufferPtr);
+        }
+    }
+
+    /* Check for EOF (last entry)  */
+    return (RecordNum >= ((CFE_ES_LockProfileId_MAX * (CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES + 1)) - 1));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_BackgroundLockProfileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status,
+                                              uint32 RecordNum, size_t BlockSize, size_t Position)
+{
+    CFE_ES_LockProfileDumpState_t *StatePtr;
+
+    StatePtr = (CFE_ES_LockProfileDumpState_t *)Meta;
+
+    /* Note that this runs in the context of ES background task (file writer background job) */
+    switch (Event)
+    {
+        case CFE_FS_FileWriteEvent_COMPLETE:
+            CFE_EVS_SendEvent(CFE_ES_LOCKPROF_EID, CFE_EVS_EventType_DEBUG, "%s written:Size=%lu",
+                              StatePtr->FileWrite.FileName, (unsigned long)Position);
+            break;
+
+        case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
+        case CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_FILEWRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "File write,byte cnt err,file %s,request=%u,actual=%u", StatePtr->FileWrite.FileName,
+                              (int)BlockSize, (int)Status);
+            break;
+
+        case CFE_FS_FileWriteEvent_CREATE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_LOCKPROF_ERR_EID, CFE_EVS_EventType_ERROR, "Error creating file %s, RC = %d",
+                              StatePtr->FileWrite.FileName, (int)Status);
+            break;
+
+        default:
+            /* unhandled event - ignore */
+            break;
+    }
+}
@@ -0,0 +1,128 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Purpose: Lock profiler data structures
+ *
+ * Design Notes:
+ *   The profile of each lock is only modified by the task that holds that
+ *   lock, so the profiler needs no lock of its own.  The profile is read
+ *   without locking when it is written to a file, so an entry that is being
+ *   updated at that moment may be slightly inconsistent.
+ *
+ * References:
+ *
+ */
+
+#ifndef CFE_ES_LOCKPROF_H
+#define CFE_ES_LOCKPROF_H
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "cfe_platform_cfg.h"
+#include "cfe_fs_api_typedefs.h"
+#include "cfe_es_lockprof_typedef.h"
+
+/*
+** Typedefs
+*/
+
+/*
+ * Data kept for each call site of a profiled lock
+ */
+typedef struct
+{
+    const char *FunctionName;                             /**< Calling function, NULL for the combined entry */
+    int32       LineNumber;                               /**< Line of the call, 0 if not known */
+    uint32      Count;                                    /**< Number of acquisitions */
+    uint32      MaxWaitTicks;                             /**< Longest wait for the lock */
+    uint32      MaxHoldTicks;                             /**< Longest time the lock was held */
+    uint64      TotalWaitTicks;                           /**< Sum of all waits */
+    uint64      TotalHoldTicks;                           /**< Sum of all hold times */
+    uint32      WaitHistogram[CFE_ES_LOCKPROF_HIST_BINS]; /**< Distribution of the waits */
+    uint32      HoldHistogram[CFE_ES_LOCKPROF_HIST_BINS]; /**< Distribution of the hold times */
+} CFE_ES_LockProfileSite_t;
+
+/*
+ * Data kept for each profiled lock
+ *
+ * The entry after the last call site combines the acquisitions from all
+ * call sites that did not fit in the table.
+ */
+typedef struct
+{
+    uint32                    NumSites;     /**< Number of call sites in use */
+    uint32                    HoldDepth;    /**< Nesting depth of the current holder */
+    CFE_ES_LockProfileSite_t *HolderSite;   /**< Call site of the outermost acquisition */
+    uint64                    AcquireTicks; /**< Timebase of the outermost acquisition */
+    CFE_ES_LockProfileSite_t  Sites[CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES + 1];
+} CFE_ES_LockProfileRecord_t;
+
+/*
+ * Background lock profile dump state structure
+ */
+typedef struct
+{
+    CFE_FS_FileWriteMetaData_t     FileWrite;   /**< FS state data - must be first */
+    CFE_ES_LockProfile_FileEntry_t EntryBuffer; /**< Temp holding area for record to write */
+} CFE_ES_LockProfileDumpState_t;
+
+/*
+ * Lock profiler global data
+ */
+typedef struct
+{
+    CFE_ES_LockProfileRecord_t    Locks[CFE_ES_LockProfileId_MAX];
+    CFE_ES_LockProfileDumpState_t BackgroundDumpState;
+} CFE_ES_LockProfileGlobal_t;
+
+/*
+** Function prototypes
+*/
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Gets the histogram bin of a duration
+ *
+ * @param Ticks  Duration in timebase ticks
+ * @returns Bin index, the number of significant bits of Ticks limited to the last bin
+ */
+uint32 CFE_ES_LockProfileBin(uint64 Ticks);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Background file write data getter for the lock profile
+ *
+ * Gets the entry of a single call site to write to a file.
+ */
+bool CFE_ES_BackgroundLockProfileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Background file write event handler for the lock profile
+ *
+ * Report events during writing the lock profile to a file
+ */
+void CFE_ES_BackgroundLockProfileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status,
+                                              uint32 RecordNum, size_t BlockSize, size_t Position);
+
+#endif /* CFE_ES_LOCKPROF_H */
@@ -91,10 +91,90 @@
  */
 #define CFE_ES_ERLOG_NO_CONTEXT (0)
 
+/**
+ * \name Layout of the system log state word
+ *
+ * The write index, the end index, the number of appends that are still
+ * copying their message and a sequence number of the system log are kept
+ * in a single 64 bit word in the reset area.  This allows all of them to be
+ * updated together with one compare-and-swap, so that tasks can append to
+ * the system log concurrently without taking a lock.
+ *
+ * The sequence number is incremented by every change of the indices, and
+ * is used to tell which of two states is the newer one.  The lap count is
+ * incremented whenever the write index wraps back to the start of the log,
+ * and by two when the log is cleared, so that a reader can tell whether the
+ * part of the log it is reading has been overwritten.
+ * \{
+ */
+#define CFE_ES_SYSLOG_IDX_BITS      20
+#define CFE_ES_SYSLOG_IDX_MASK      ((1UL << CFE_ES_SYSLOG_IDX_BITS) - 1)
+#define CFE_ES_SYSLOG_PENDING_SHIFT 40
+#define CFE_ES_SYSLOG_PENDING_MAX   0xFF
+#define CFE_ES_SYSLOG_SEQ_SHIFT     48
+#define CFE_ES_SYSLOG_LAP_SHIFT     56
+
+#define CFE_ES_SYSLOG_STATE_WRITEIDX(State) ((size_t)((State)&CFE_ES_SYSLOG_IDX_MASK))
+#define CFE_ES_SYSLOG_STATE_ENDIDX(State)   ((size_t)(((State) >> CFE_ES_SYSLOG_IDX_BITS) & CFE_ES_SYSLOG_IDX_MASK))
+#define CFE_ES_SYSLOG_STATE_PENDING(State)  ((uint8)((State) >> CFE_ES_SYSLOG_PENDING_SHIFT))
+#define CFE_ES_SYSLOG_STATE_SEQ(State)      ((uint8)((State) >> CFE_ES_SYSLOG_SEQ_SHIFT))
+#define CFE_ES_SYSLOG_STATE_LAP(State)      ((uint8)((State) >> CFE_ES_SYSLOG_LAP_SHIFT))
+#define CFE_ES_SYSLOG_STATE(WriteIdx, EndIdx, Pending, Seq, Lap)                                              \
+    ((uint64)(WriteIdx) | ((uint64)(EndIdx) << CFE_ES_SYSLOG_IDX_BITS) |                                      \
+     ((uint64)(Pending) << CFE_ES_SYSLOG_PENDING_SHIFT) | ((uint64)(uint8)(Seq) << CFE_ES_SYSLOG_SEQ_SHIFT) | \
+     ((uint64)(uint8)(Lap) << CFE_ES_SYSLOG_LAP_SHIFT))
+/**\}*/
+
+/**
+ * \name Formats of the system log
+ *
+ * In the text format, every message is formatted when it is written.  In
+ * the binary format, the time, the format string and the arguments are
+ * stored as a record, and the message is only formatted when the log is
+ * read.  The format in use is kept in the reset area, see
+ * CFE_PLATFORM_ES_SYSLOG_BINARY_FORMAT.
+ * \{
+ */
+#define CFE_ES_SYSLOG_FORMAT_TEXT   0
+#define CFE_ES_SYSLOG_FORMAT_BINARY 1
+/**\}*/
+
+/**
+ * \brief Value of the magic number at the start of each binary syslog record
+ */
+#define CFE_ES_SYSLOG_RECORD_MAGIC 0x5E1F
+
+/**
+ * \brief Maximum size of a binary syslog record
+ *
+ * The arguments are stored in 64 bits each, so a record can be larger than
+ * the message it is formatted into.  The message is still truncated to
+ * CFE_ES_MAX_SYSLOG_MSG_SIZE.
+ */
+#define CFE_ES_SYSLOG_MAX_RECORD_SIZE (2 * CFE_ES_MAX_SYSLOG_MSG_SIZE)
+
 /*
 ** Type Definitions
 */
 
+/**
+ * \brief Header of a record in a system log in binary format
+ *
+ * This is followed by the null terminated format string, and then the
+ * arguments of each conversion in the format string, in order.  Integers
+ * and pointers are stored as 64 bit values, floating point values as
+ * doubles, and strings are copied with their terminating null character.
+ *
+ * Records are not aligned in the log, so they must be copied out before
+ * the header is accessed.
+ */
+typedef struct
+{
+    uint16             Magic; /**< Always CFE_ES_SYSLOG_RECORD_MAGIC */
+    uint16             Size;  /**< Size of the record, including this header */
+    CFE_TIME_SysTime_t Time;  /**< Time the message was written */
+} CFE_ES_SysLogRecordHeader_t;
+
 /**
  * \brief Buffer structure for reading data out of the SysLog
  *
@@ -102,7 +182,7 @@
  * directly access the contents.  This structure keeps the state of
  * read operations such that the syslog can be read in segments.
  *
- * @sa CFE_ES_SysLogReadData(), CFE_ES_SysLogReadStart_Unsync()
+ * @sa CFE_ES_SysLogReadData(), CFE_ES_SysLogReadStart()
  */
 typedef struct
 {
@@ -110,6 +190,9 @@ typedef struct
     size_t BlockSize;  /**< Size of content currently in the "Data" member */
     size_t EndIdx;     /**< End of the syslog buffer at the time reading started */
     size_t LastOffset; /**< Current Read Position */
+    size_t StartIdx;   /**< Read position at the time reading started */
+    size_t TotalSize;  /**< Total amount of syslog data at the time reading started */
+    uint64 State;      /**< State of the syslog at the time reading started */
 
     char Data[CFE_ES_SYSLOG_READ_BUFFER_SIZE]; /**< Actual syslog content */
 } CFE_ES_SysLogReadBuffer_t;
@@ -130,9 +213,22 @@ typedef struct
  *
  * This discards the entire system log buffer and resets internal index values
  *
- * \note This function requires external thread synchronization
+ * \note Appends that are in progress at the same time are still completed,
+ * but their messages are not part of the log anymore.
+ */
+void CFE_ES_SysLogClear(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Recover the system log after a reset
+ *
+ * Appends that were in progress when the processor was reset will never
+ * complete, so they are no longer counted.  Their messages may be incomplete.
+ *
+ * This must be called once, after the reset area is set up and before
+ * anything is written to the system log.
  */
-void CFE_ES_SysLogClear_Unsync(void);
+void CFE_ES_SysLogRecover(void);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -142,6 +238,9 @@ void CFE_ES_SysLogClear_Unsync(void);
  * the contents of the syslog to a disk file.  This locates the oldest complete
  * log message currently contained in the buffer.
  *
+ * Only the log up to the last time that no append was in progress is read,
+ * so a message that is still being copied into the log is never read.
+ *
  * The oldest log message may be overwritten when any application calls
  * CFE_ES_WriteToSysLog() if set to OVERWRITE mode.
  *
@@ -151,10 +250,9 @@ void CFE_ES_SysLogClear_Unsync(void);
  *
  * \param Buffer  A local buffer which will be initialized to the start of the log buffer
  *
- * \note This function requires external thread synchronization
  * \sa CFE_ES_SysLogReadData()
  */
-void CFE_ES_SysLogReadStart_Unsync(CFE_ES_SysLogReadBuffer_t *Buffer);
+void CFE_ES_SysLogReadStart(CFE_ES_SysLogReadBuffer_t *Buffer);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -165,10 +263,32 @@ void CFE_ES_SysLogReadStart_Unsync(CFE_ES_SysLogReadBuffer_t *Buffer);
  * logging from within the ES subsystem where the appropriate lock is
  * already held for other reasons.
  *
- * \note This function requires external thread synchronization
+ * \note This function requires external thread synchronization, unless
+ * appends to the system log are lock-free (see CFE_ES_SysLogAppend())
  */
 int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Append a message to a system log in binary format
+ *
+ * Stores the current time, the format string and the arguments as a record,
+ * without formatting the message.  The message is formatted when the log
+ * is read with CFE_ES_SysLogReadData().
+ *
+ * Records are never truncated.  If "LogMode" is set to DISCARD and the
+ * record does not fit in the remaining space, it is discarded.  If the
+ * record does not fit in CFE_ES_SYSLOG_MAX_RECORD_SIZE, the format string is
+ * cut off at the conversion that does not fit, or a string argument is cut off.
+ *
+ * \param SpecStringPtr Printf-style format string
+ * \param ArgPtr        Variable argument list as obtained by va_start() in the caller
+ *
+ * \note This has the same synchronization requirements as CFE_ES_SysLogAppend()
+ * \sa CFE_ES_SysLogAppend()
+ */
+int32 CFE_ES_SysLogAppendBinary(const char *SpecStringPtr, va_list ArgPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Append a complete pre-formatted string to the ES SysLog
@@ -183,34 +303,36 @@ int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...);
  * If "LogMode" is set to OVERWRITE, then the oldest message(s) in the
  * system log will be overwritten with this new message.
  *
+ * The space for the message is reserved with a compare-and-swap of the
+ * state of the log, then the message is copied in, and then the append is
+ * marked as completed.  Multiple tasks may append at the same time.
+ *
  * \param LogString     Message to append
  *
- * \note This function requires external thread synchronization
+ * \note If the target has no lock-free atomic operations (CFE_ES_ATOMIC_LOCK_FREE
+ * is 0), this function requires external thread synchronization
  * \sa CFE_ES_SysLogSetMode()
  */
-int32 CFE_ES_SysLogAppend_Unsync(const char *LogString);
+int32 CFE_ES_SysLogAppend(const char *LogString);
 
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Read data from the system log buffer into the local buffer
  *
  * Prior to calling this function, the buffer structure should be initialized
- * using CFE_ES_SysLogReadStart_Unsync()
+ * using CFE_ES_SysLogReadStart()
  *
  * This copies the data from the syslog memory space into the local buffer, starting
- * from the end of the previously read data.  To read the complete system log,
+ * from the end of the previously read data.  If the system log is in binary format,
+ * the records are formatted into messages while they are copied.  To read the complete system log,
  * this function should be called repeatedly until the "BlockSize" member in the
  * returned buffer is returned as zero, indicating there is no more data in the syslog.
  *
  * There is no specific external synchronization requirement on this function, since
- * copies of the relevant log indices are kept in the buffer structure itself.  However,
- * if system log data is overwritten between calls to this function, it may result in
- * undefined data being returned to the caller.
- *
- * Therefore, in cases where it is critically important to read log message data, the
- * lock should be held for the entire procedure (initialization through complete read).
- * However this may have significant realtime implications, so it is not the required
- * mode of operation.
+ * copies of the relevant log indices are kept in the buffer structure itself.  If
+ * appends overwrite the oldest part of the data being read, which may happen in
+ * OVERWRITE mode or if the log is cleared, that part is dropped after it was copied
+ * and reading continues with the next complete message that was not overwritten.
  *
  * \param Buffer  A local buffer which will be filled with data from the log buffer
  */
@@ -241,7 +363,7 @@ int32 CFE_ES_SysLogSetMode(CFE_ES_LogMode_Enum_t Mode);
 /**
  * \brief Format a message intended for output to the system log
  *
- * This function prepares a complete message for passing into CFE_ES_SysLogAppend_Unsync(),
+ * This function prepares a complete message for passing into CFE_ES_SysLogAppend(),
  * based on the given vsnprintf-style specification string and argument list.
  *
  * The message is prefixed with a time stamp based on the current time, followed by the
@@ -257,7 +379,7 @@ int32 CFE_ES_SysLogSetMode(CFE_ES_LogMode_Enum_t Mode);
  * \param SpecStringPtr Printf-style format string
  * \param ArgPtr        Variable argument list as obtained by va_start() in the caller
  *
- * \sa CFE_ES_SysLogAppend_Unsync()
+ * \sa CFE_ES_SysLogAppend()
  */
 void CFE_ES_SysLog_vsnprintf(char *Buffer, size_t BufferSize, const char *SpecStringPtr, va_list ArgPtr);
 
@@ -97,6 +97,36 @@ int32 CFE_ES_MemPoolDirectCommit(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Offs
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Takes the pool mutex for a batch of magazine blocks, if the pool needs it
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_MemPoolMagazineLock(CFE_ES_MemPoolRecord_t *PoolRecPtr)
+{
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId) && !PoolRecPtr->Pool.LockFree)
+    {
+        CFE_CORE_PERF_ENTRY(CFE_MISSION_ES_POOL_LOCK_PERF_ID);
+        OS_MutSemTake(PoolRecPtr->MutexId);
+        CFE_CORE_PERF_EXIT(CFE_MISSION_ES_POOL_LOCK_PERF_ID);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Gives the pool mutex taken by CFE_ES_MemPoolMagazineLock()
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_MemPoolMagazineUnlock(CFE_ES_MemPoolRecord_t *PoolRecPtr)
+{
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId) && !PoolRecPtr->Pool.LockFree)
+    {
+        OS_MutSemGive(PoolRecPtr->MutexId);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -182,6 +212,30 @@ CFE_Status_t CFE_ES_PoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
                                  const size_t *BlockSizes, bool UseMutex)
+{
+    return CFE_ES_MemPoolCreate(PoolID, MemPtr, Size, NumBlockSizes, BlockSizes, UseMutex, false);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_PoolCreateBuddy(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                    const size_t *BlockSizes, bool UseMutex)
+{
+    return CFE_ES_MemPoolCreate(PoolID, MemPtr, Size, NumBlockSizes, BlockSizes, UseMutex, true);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_MemPoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                           const size_t *BlockSizes, bool UseMutex, bool UseBuddy)
 {
     int32                   OsStatus;
     int32                   Status;
@@ -281,6 +335,33 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
     Status = CFE_ES_GenPoolInitialize(&PoolRecPtr->Pool, 0, Size, Alignment, NumBlockSizes, BlockSizes,
                                       CFE_ES_MemPoolDirectRetrieve, CFE_ES_MemPoolDirectCommit);
 
+    if (Status == CFE_SUCCESS && UseBuddy)
+    {
+        /* buddy pools split and merge blocks on every get and put, so these always need the mutex */
+        Status = CFE_ES_GenPoolEnableBuddy(&PoolRecPtr->Pool);
+    }
+#if (CFE_PLATFORM_ES_POOL_LOCK_FREE == 1)
+    /*
+     * Memory mapped pools can return and recycle blocks without the mutex.
+     * The mutex is then only needed to create new blocks.
+     */
+    else if (Status == CFE_SUCCESS)
+    {
+        CFE_ES_GenPoolEnableLockFree(&PoolRecPtr->Pool);
+    }
+#endif
+
+#if (CFE_PLATFORM_ES_POOL_SIZE_PROFILE == 1)
+    /*
+     * Count the requested sizes, for the CFE_ES_WRITE_POOL_PROFILE_CC command
+     */
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_ES_GenPoolEnableProfile(&PoolRecPtr->Pool,
+                                    &CFE_ES_Global.PoolProfile.MemPools[PoolRecPtr - CFE_ES_Global.MemPoolTable]);
+    }
+#endif
+
     /*
      * If successful, complete the process.
      */
@@ -363,6 +444,11 @@ int32 CFE_ES_PoolDelete(CFE_ES_MemHandle_t PoolID)
     if (CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, PoolID))
     {
         MutexId = PoolRecPtr->MutexId; /* snapshot mutex ID, will be freed later */
+        if (PoolRecPtr->MagazineSet != NULL)
+        {
+            /* any cached blocks go away with the pool */
+            PoolRecPtr->MagazineSet->PoolID = CFE_ES_MEMHANDLE_UNDEFINED;
+        }
         CFE_ES_MemPoolRecordSetFree(PoolRecPtr);
         Status = CFE_SUCCESS;
     }
@@ -395,6 +481,61 @@ int32 CFE_ES_PoolDelete(CFE_ES_MemHandle_t PoolID)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_PoolEnableMagazines(CFE_ES_MemHandle_t PoolID)
+{
+    CFE_ES_MemPoolRecord_t *  PoolRecPtr;
+    CFE_ES_PoolMagazineSet_t *SetPtr;
+    uint32                    i;
+    int32                     Status;
+
+    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(PoolID);
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, PoolID))
+    {
+        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+    else if (PoolRecPtr->MagazineSet != NULL)
+    {
+        /* already enabled, nothing to do */
+        Status = CFE_SUCCESS;
+    }
+    else
+    {
+        Status = CFE_ES_NO_RESOURCE_IDS_AVAILABLE;
+        SetPtr = CFE_ES_Global.PoolMagazineSets;
+        for (i = 0; i < CFE_PLATFORM_ES_POOL_MAX_MAGAZINE_POOLS; ++i)
+        {
+            if (!CFE_RESOURCEID_TEST_DEFINED(SetPtr->PoolID))
+            {
+                memset(SetPtr, 0, sizeof(*SetPtr));
+                SetPtr->PoolID          = PoolID;
+                PoolRecPtr->MagazineSet = SetPtr;
+                Status                  = CFE_SUCCESS;
+                break;
+            }
+
+            ++SetPtr;
+        }
+
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_ES_SysLogWrite_Unsync("%s: No free magazine sets available\n", __func__);
+        }
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -406,6 +547,7 @@ int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle,
     int32                   Status;
     CFE_ES_AppId_t          AppId;
     CFE_ES_MemPoolRecord_t *PoolRecPtr;
+    CFE_ES_PoolTaskCache_t *CachePtr;
     size_t                  DataOffset;
 
     if (BufPtr == NULL)
@@ -413,6 +555,8 @@ int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle,
         return CFE_ES_BAD_ARGUMENT;
     }
 
+    CFE_CORE_PERF_ENTRY(CFE_MISSION_ES_GETPOOLBUF_PERF_ID);
+
     PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(Handle);
 
     /* basic sanity check */
@@ -421,35 +565,62 @@ int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle,
         CFE_ES_GetAppID(&AppId);
         CFE_ES_WriteToSysLog("%s: Err:Bad handle(0x%08lX) AppId=%lu\n", __func__, CFE_RESOURCEID_TO_ULONG(Handle),
                              CFE_RESOURCEID_TO_ULONG(AppId));
+        CFE_CORE_PERF_EXIT(CFE_MISSION_ES_GETPOOLBUF_PERF_ID);
         return CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
 
     /*
-     * Real work begins here.
-     * If pool is mutex-protected, take the mutex now.
+     * If the pool has magazines, the block is taken from the cache of the
+     * calling task.  Otherwise a lock-free pool first tries to recycle a
+     * returned block, which does not need the mutex.
      */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    Status   = CFE_ES_BUFFER_NOT_IN_POOL;
+    CachePtr = CFE_ES_MemPoolGetTaskCache(PoolRecPtr);
+    if (CachePtr != NULL)
     {
-        OS_MutSemTake(PoolRecPtr->MutexId);
+        Status = CFE_ES_MemPoolMagazineGet(PoolRecPtr, CachePtr, &DataOffset, Size);
     }
 
-    /*
-     * Fundamental work is done as a generic routine.
-     *
-     * If successful, this gets an offset, which can then
-     * be translated into a pointer to return to the caller.
-     */
-    Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, Size);
+    if (Status != CFE_SUCCESS && PoolRecPtr->Pool.LockFree)
+    {
+        Status = CFE_ES_GenPoolGetFreeBlock(&PoolRecPtr->Pool, &DataOffset, Size);
+    }
 
-    /*
-     * Real work ends here.
-     * If pool is mutex-protected, release the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    if (Status != CFE_SUCCESS)
     {
-        OS_MutSemGive(PoolRecPtr->MutexId);
+        /*
+         * Real work begins here.
+         * If pool is mutex-protected, take the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            CFE_CORE_PERF_ENTRY(CFE_MISSION_ES_POOL_LOCK_PERF_ID);
+            OS_MutSemTake(PoolRecPtr->MutexId);
+            CFE_CORE_PERF_EXIT(CFE_MISSION_ES_POOL_LOCK_PERF_ID);
+        }
+
+        /*
+         * Fundamental work is done as a generic routine.
+         *
+         * If successful, this gets an offset, which can then
+         * be translated into a pointer to return to the caller.
+         */
+        Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, Size);
+
+        /*
+         * Real work ends here.
+         * If pool is mutex-protected, release the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemGive(PoolRecPtr->MutexId);
+        }
     }
 
+    CFE_ES_GenPoolProfileRequest(&PoolRecPtr->Pool, Size, Status == CFE_SUCCESS);
+
+    CFE_CORE_PERF_EXIT(CFE_MISSION_ES_GETPOOLBUF_PERF_ID);
+
     /* If not successful, return error now */
     if (Status != CFE_SUCCESS)
     {
@@ -531,6 +702,7 @@ CFE_Status_t CFE_ES_GetPoolBufInfo(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_
 int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
 {
     CFE_ES_MemPoolRecord_t *PoolRecPtr;
+    CFE_ES_PoolTaskCache_t *CachePtr;
     size_t                  DataSize;
     size_t                  DataOffset;
     int32                   Status;
@@ -550,32 +722,46 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
         return CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
 
+    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
+
     /*
-     * Real work begins here.
-     * If pool is mutex-protected, take the mutex now.
+     * If the pool has magazines, the block goes to the cache of the calling task
      */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    CachePtr = CFE_ES_MemPoolGetTaskCache(PoolRecPtr);
+    if (CachePtr != NULL)
     {
-        OS_MutSemTake(PoolRecPtr->MutexId);
+        Status = CFE_ES_MemPoolMagazinePut(PoolRecPtr, CachePtr, &DataSize, DataOffset);
     }
+    else
+    {
+        /*
+         * Real work begins here.
+         * If pool is mutex-protected, take the mutex now.
+         * Blocks are returned to a lock-free pool without the mutex.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId) && !PoolRecPtr->Pool.LockFree)
+        {
+            CFE_CORE_PERF_ENTRY(CFE_MISSION_ES_POOL_LOCK_PERF_ID);
+            OS_MutSemTake(PoolRecPtr->MutexId);
+            CFE_CORE_PERF_EXIT(CFE_MISSION_ES_POOL_LOCK_PERF_ID);
+        }
 
-    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
-
-    /*
-     * Fundamental work is done as a generic routine.
-     *
-     * If successful, this gets an offset, which can then
-     * be translated into a pointer to return to the caller.
-     */
-    Status = CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &DataSize, DataOffset);
+        /*
+         * Fundamental work is done as a generic routine.
+         *
+         * If successful, this gets an offset, which can then
+         * be translated into a pointer to return to the caller.
+         */
+        Status = CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &DataSize, DataOffset);
 
-    /*
-     * Real work ends here.
-     * If pool is mutex-protected, release the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
-    {
-        OS_MutSemGive(PoolRecPtr->MutexId);
+        /*
+         * Real work ends here.
+         * If pool is mutex-protected, release the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId) && !PoolRecPtr->Pool.LockFree)
+        {
+            OS_MutSemGive(PoolRecPtr->MutexId);
+        }
     }
 
     /*
@@ -586,6 +772,8 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
      */
     if (Status == CFE_SUCCESS)
     {
+        CFE_ES_GenPoolProfileRelease(&PoolRecPtr->Pool, DataSize);
+
         Status = (int32)DataSize;
     }
     else if (Status == CFE_ES_POOL_BLOCK_INVALID)
@@ -644,6 +832,11 @@ CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHan
      */
     CFE_ES_GenPoolGetUsage(&PoolRecPtr->Pool, &BufPtr->NumFreeBytes, &BufPtr->PoolSize);
 
+    /*
+     * Obtain the space held in free blocks, to show the fragmentation
+     */
+    CFE_ES_GenPoolGetFragmentation(&PoolRecPtr->Pool, &BufPtr->FreeBlockBytes, &BufPtr->LargestFreeBlock);
+
     /*
      * Obtain the allocation and validation error counts
      */
@@ -705,3 +898,309 @@ bool CFE_ES_ValidateHandle(CFE_ES_MemHandle_t Handle)
 
     return true;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Returns all blocks of a task cache to the pool
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_MemPoolFlushTaskCache(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_PoolTaskCache_t *CachePtr)
+{
+    uint32 i;
+
+    for (i = 0; i < CFE_PLATFORM_ES_POOL_MAGAZINES_PER_TASK; ++i)
+    {
+        if (CachePtr->Magazines[i].Count > 0)
+        {
+            CFE_ES_MemPoolMagazineFlush(PoolRecPtr, &CachePtr->Magazines[i], CachePtr->Magazines[i].Count);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_PoolTaskCache_t *CFE_ES_MemPoolGetTaskCache(CFE_ES_MemPoolRecord_t *PoolRecPtr)
+{
+    CFE_ES_PoolTaskCache_t *CachePtr;
+    CFE_ES_TaskId_t         TaskId;
+    CFE_ES_TaskId_t         PrevOwner;
+    osal_id_t               OsalId;
+    osal_index_t            TaskIdx;
+
+    OsalId = OS_TaskGetId();
+    if (PoolRecPtr->MagazineSet == NULL ||
+        OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, OsalId, &TaskIdx) != OS_SUCCESS || TaskIdx >= OS_MAX_TASKS)
+    {
+        return NULL;
+    }
+
+    CachePtr = &PoolRecPtr->MagazineSet->TaskCache[TaskIdx];
+    TaskId   = CFE_ES_TaskId_FromOSAL(OsalId);
+
+    /* no other task changes the owner while the owner is running, so this needs no lock */
+    if (CFE_RESOURCEID_TEST_EQUAL(CachePtr->Owner, TaskId))
+    {
+        return CachePtr;
+    }
+
+    /*
+     * The cache is unused or belongs to a deleted task of the same slot.  The
+     * caller takes it over, unless the blocks of the deleted task are being
+     * returned by CFE_ES_MemPoolFlushTaskCaches() right now.
+     */
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    PrevOwner = CachePtr->Owner;
+    if (!CFE_RESOURCEID_TEST_EQUAL(PrevOwner, CFE_ES_POOL_CACHE_FLUSHING))
+    {
+        CachePtr->Owner = TaskId;
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    if (CFE_RESOURCEID_TEST_EQUAL(PrevOwner, CFE_ES_POOL_CACHE_FLUSHING))
+    {
+        return NULL;
+    }
+
+    /* blocks left by the earlier owner are not the caller's, they go back to the pool */
+    CFE_ES_MemPoolFlushTaskCache(PoolRecPtr, CachePtr);
+
+    return CachePtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_MemPoolMagazineGet(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_PoolTaskCache_t *CachePtr,
+                                size_t *BlockOffsetPtr, size_t ReqSize)
+{
+    CFE_ES_PoolMagazine_t *MagPtr;
+    size_t                 BlockOffset;
+    size_t                 BlockSize;
+    uint16                 BucketId;
+    uint16                 CachedBucketId;
+    uint16                 i;
+    int32                  Status;
+
+    /* a size that fits no bucket gets bucket 0, which is also the bucket of unassigned magazines */
+    BucketId = CFE_ES_GenPoolFindBucket(&PoolRecPtr->Pool, ReqSize);
+    MagPtr   = NULL;
+    for (i = 0; i < CFE_PLATFORM_ES_POOL_MAGAZINES_PER_TASK; ++i)
+    {
+        if (CachePtr->Magazines[i].BucketId == BucketId)
+        {
+            MagPtr = &CachePtr->Magazines[i];
+            break;
+        }
+    }
+
+    if (MagPtr == NULL || BucketId == 0)
+    {
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    if (MagPtr->Count == 0)
+    {
+        /*
+         * Refill the magazine with a batch of free blocks.  Only half of it is
+         * filled, to leave room for the blocks the task returns later.
+         *
+         * If the pool is not lock-free the mutex is held anyway, so the block
+         * for the caller may also be a new one.
+         */
+        CFE_ES_MemPoolMagazineLock(PoolRecPtr);
+
+        if (PoolRecPtr->Pool.LockFree)
+        {
+            Status = CFE_ES_GenPoolRecyclePoolBlock(&PoolRecPtr->Pool, BucketId, ReqSize, BlockOffsetPtr);
+        }
+        else
+        {
+            Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, BlockOffsetPtr, ReqSize);
+        }
+
+        while (Status == CFE_SUCCESS && MagPtr->Count < (CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE / 2) &&
+               CFE_ES_GenPoolRecyclePoolBlock(&PoolRecPtr->Pool, BucketId, ReqSize, &BlockOffset) == CFE_SUCCESS)
+        {
+            if (CFE_ES_GenPoolCacheBlock(&PoolRecPtr->Pool, &BlockSize, &CachedBucketId, BlockOffset) == CFE_SUCCESS)
+            {
+                MagPtr->Offsets[MagPtr->Count] = BlockOffset;
+                ++MagPtr->Count;
+            }
+        }
+
+        CFE_ES_MemPoolMagazineUnlock(PoolRecPtr);
+    }
+    else
+    {
+        /* the newest block is taken first, it is the most likely to still be in the data cache */
+        --MagPtr->Count;
+        BlockOffset = MagPtr->Offsets[MagPtr->Count];
+
+        Status = CFE_ES_GenPoolUncacheBlock(&PoolRecPtr->Pool, BlockOffset, ReqSize);
+        if (Status == CFE_SUCCESS)
+        {
+            *BlockOffsetPtr = BlockOffset;
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_MemPoolMagazinePut(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_PoolTaskCache_t *CachePtr,
+                                size_t *BlockSizePtr, size_t BlockOffset)
+{
+    CFE_ES_PoolMagazine_t *MagPtr;
+    CFE_ES_PoolMagazine_t *EmptyPtr;
+    uint16                 BucketId;
+    uint16                 i;
+    int32                  Status;
+
+    Status = CFE_ES_GenPoolCacheBlock(&PoolRecPtr->Pool, BlockSizePtr, &BucketId, BlockOffset);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    MagPtr   = NULL;
+    EmptyPtr = NULL;
+    for (i = 0; i < CFE_PLATFORM_ES_POOL_MAGAZINES_PER_TASK; ++i)
+    {
+        if (CachePtr->Magazines[i].BucketId == BucketId)
+        {
+            MagPtr = &CachePtr->Magazines[i];
+            break;
+        }
+
+        if (EmptyPtr == NULL && CachePtr->Magazines[i].Count == 0)
+        {
+            EmptyPtr = &CachePtr->Magazines[i];
+        }
+    }
+
+    if (MagPtr == NULL)
+    {
+        if (EmptyPtr == NULL)
+        {
+            /* all magazines hold blocks of other buckets, so one of them is emptied */
+            EmptyPtr            = &CachePtr->Magazines[CachePtr->NextEvict];
+            CachePtr->NextEvict = (CachePtr->NextEvict + 1) % CFE_PLATFORM_ES_POOL_MAGAZINES_PER_TASK;
+
+            CFE_ES_MemPoolMagazineFlush(PoolRecPtr, EmptyPtr, EmptyPtr->Count);
+        }
+
+        MagPtr           = EmptyPtr;
+        MagPtr->BucketId = BucketId;
+    }
+    else if (MagPtr->Count >= CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE)
+    {
+        /* return the older half as one batch, keeping the newer blocks cached */
+        CFE_ES_MemPoolMagazineFlush(PoolRecPtr, MagPtr, CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE / 2);
+    }
+
+    MagPtr->Offsets[MagPtr->Count] = BlockOffset;
+    ++MagPtr->Count;
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_MemPoolMagazineFlush(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_PoolMagazine_t *MagPtr, uint16 NumBlocks)
+{
+    size_t BlockSize;
+    uint16 i;
+
+    CFE_ES_MemPoolMagazineLock(PoolRecPtr);
+
+    for (i = 0; i < NumBlocks; ++i)
+    {
+        /* a block that fails validation was overwritten while cached, and is not returned */
+        if (CFE_ES_GenPoolUncacheBlock(&PoolRecPtr->Pool, MagPtr->Offsets[i], 0) == CFE_SUCCESS)
+        {
+            CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &BlockSize, MagPtr->Offsets[i]);
+        }
+    }
+
+    CFE_ES_MemPoolMagazineUnlock(PoolRecPtr);
+
+    MagPtr->Count -= NumBlocks;
+    memmove(&MagPtr->Offsets[0], &MagPtr->Offsets[NumBlocks], MagPtr->Count * sizeof(MagPtr->Offsets[0]));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_MemPoolFlushTaskCaches(CFE_ES_TaskId_t TaskId)
+{
+    CFE_ES_PoolMagazineSet_t *SetPtr;
+    CFE_ES_MemPoolRecord_t *  PoolRecPtr;
+    CFE_ES_PoolTaskCache_t *  CachePtr;
+    osal_index_t              TaskIdx;
+    uint32                    i;
+
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, CFE_ES_TaskId_ToOSAL(TaskId), &TaskIdx) != OS_SUCCESS ||
+        TaskIdx >= OS_MAX_TASKS)
+    {
+        return;
+    }
+
+    SetPtr = CFE_ES_Global.PoolMagazineSets;
+    for (i = 0; i < CFE_PLATFORM_ES_POOL_MAX_MAGAZINE_POOLS; ++i)
+    {
+        CachePtr = &SetPtr->TaskCache[TaskIdx];
+
+        CFE_ES_LockSharedData(__func__, __LINE__);
+
+        /*
+         * Only a cache still owned by the task is flushed.  If a new task of the
+         * same slot took it over, that task has already returned the blocks.
+         */
+        PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(SetPtr->PoolID);
+        if (CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, SetPtr->PoolID) &&
+            CFE_RESOURCEID_TEST_EQUAL(CachePtr->Owner, TaskId))
+        {
+            CachePtr->Owner = CFE_ES_POOL_CACHE_FLUSHING;
+        }
+        else
+        {
+            PoolRecPtr = NULL;
+        }
+
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        /* the blocks are returned without the ES lock, as that may take the pool mutex */
+        if (PoolRecPtr != NULL)
+        {
+            CFE_ES_MemPoolFlushTaskCache(PoolRecPtr, CachePtr);
+
+            CFE_ES_LockSharedData(__func__, __LINE__);
+            CachePtr->Owner = CFE_ES_TASKID_UNDEFINED;
+            CFE_ES_UnlockSharedData(__func__, __LINE__);
+        }
+
+        ++SetPtr;
+    }
+}
@@ -32,9 +32,48 @@
 ** Include Files
 */
 #include "common_types.h"
+#include "osconfig.h"
 #include "cfe_resourceid.h"
+#include "cfe_es_api_typedefs.h"
 #include "cfe_es_generic_pool.h"
 
+/**
+ * \brief A magazine of cached free blocks of one bucket
+ */
+typedef struct
+{
+    uint16 BucketId;                                    /**< Bucket of the cached blocks, 0 if not assigned */
+    uint16 Count;                                       /**< Number of cached blocks */
+    size_t Offsets[CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE]; /**< Offsets of the cached blocks, newest last */
+} CFE_ES_PoolMagazine_t;
+
+/**
+ * \brief Owner of a task cache while its blocks are returned after the owner was deleted
+ */
+#define CFE_ES_POOL_CACHE_FLUSHING CFE_ES_TASKID_C(CFE_RESOURCEID_RESERVED)
+
+/**
+ * \brief The magazines of one task for one memory pool
+ *
+ * Only the owner task uses its magazines, so they are accessed without a lock.
+ * The owner is only changed while holding the ES global lock.
+ */
+typedef struct
+{
+    CFE_ES_TaskId_t       Owner;     /**< Task the cached blocks belong to, undefined if none */
+    uint16                NextEvict; /**< Magazine to reassign next if all are in use */
+    CFE_ES_PoolMagazine_t Magazines[CFE_PLATFORM_ES_POOL_MAGAZINES_PER_TASK];
+} CFE_ES_PoolTaskCache_t;
+
+/**
+ * \brief The per-task magazine caches of one memory pool
+ */
+typedef struct
+{
+    CFE_ES_MemHandle_t     PoolID;                  /**< Pool using these caches, undefined if free */
+    CFE_ES_PoolTaskCache_t TaskCache[OS_MAX_TASKS]; /**< Caches, indexed by the OSAL task index */
+} CFE_ES_PoolMagazineSet_t;
+
 typedef struct
 {
     /*
@@ -69,6 +108,11 @@ typedef struct
      * Optional Mutex for serializing get/put operations
      */
     osal_id_t MutexId;
+
+    /**
+     * Optional per-task magazine caches, NULL if not enabled
+     */
+    CFE_ES_PoolMagazineSet_t *MagazineSet;
 } CFE_ES_MemPoolRecord_t;
 
 /*---------------------------------------------------------------------------------------*/
@@ -241,4 +285,97 @@ static inline bool CFE_ES_MemPoolRecordIsMatch(const CFE_ES_MemPoolRecord_t *Poo
  */
 bool CFE_ES_CheckMemPoolSlotUsed(CFE_ResourceId_t CheckId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Create a memory pool
+ *
+ * Common implementation of CFE_ES_PoolCreateEx() and CFE_ES_PoolCreateBuddy(),
+ * see those for the arguments.
+ *
+ * @param[in]   UseBuddy      whether blocks are split and merged by the buddy system
+ * @returns #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_MemPoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                           const size_t *BlockSizes, bool UseMutex, bool UseBuddy);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the magazine cache of the calling task for a memory pool
+ *
+ * The caches are indexed by the OSAL task slot, which is reused by new tasks.
+ * If the cache still belongs to an earlier task of the same slot, its blocks
+ * are first returned to the pool and the caller becomes the owner.
+ *
+ * @param[in]   PoolRecPtr   pointer to Pool table entry
+ * @returns pointer to the magazine cache, or NULL if the pool has no magazines,
+ *          the caller is not an OSAL task, or the blocks of the earlier owner
+ *          are still being returned
+ */
+CFE_ES_PoolTaskCache_t *CFE_ES_MemPoolGetTaskCache(CFE_ES_MemPoolRecord_t *PoolRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get a block from the magazine cache of a task
+ *
+ * If the magazine for the bucket is empty, it is first refilled with a batch
+ * of free blocks from the pool.  New blocks are only created for the caller,
+ * and only if the pool is not lock-free.  Otherwise, if the pool has no free
+ * blocks of the bucket, the caller must get the block from the pool instead.
+ *
+ * @param[in]   PoolRecPtr      pointer to Pool table entry
+ * @param[in]   CachePtr        magazine cache of the calling task
+ * @param[out]  BlockOffsetPtr  offset of the block
+ * @param[in]   ReqSize         requested size
+ *
+ * @return Execution status, see @ref CFEReturnCodes
+ * @retval #CFE_SUCCESS                 @copybrief CFE_SUCCESS
+ * @retval #CFE_ES_BUFFER_NOT_IN_POOL   @copybrief CFE_ES_BUFFER_NOT_IN_POOL
+ */
+int32 CFE_ES_MemPoolMagazineGet(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_PoolTaskCache_t *CachePtr,
+                                size_t *BlockOffsetPtr, size_t ReqSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Return a block to the magazine cache of a task
+ *
+ * If the magazine for the bucket is full, a batch of the oldest blocks
+ * is first returned to the pool.
+ *
+ * @param[in]   PoolRecPtr    pointer to Pool table entry
+ * @param[in]   CachePtr      magazine cache of the calling task
+ * @param[out]  BlockSizePtr  size of the block that was returned
+ * @param[in]   BlockOffset   offset of the block
+ *
+ * @return Execution status, see @ref CFEReturnCodes
+ * @retval #CFE_SUCCESS                 @copybrief CFE_SUCCESS
+ * @retval #CFE_ES_BUFFER_NOT_IN_POOL   @copybrief CFE_ES_BUFFER_NOT_IN_POOL
+ * @retval #CFE_ES_POOL_BLOCK_INVALID   @copybrief CFE_ES_POOL_BLOCK_INVALID
+ */
+int32 CFE_ES_MemPoolMagazinePut(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_PoolTaskCache_t *CachePtr,
+                                size_t *BlockSizePtr, size_t BlockOffset);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Return the oldest blocks of a magazine to the pool
+ *
+ * The blocks are returned as one batch, taking the pool mutex only once.
+ *
+ * @param[in]   PoolRecPtr   pointer to Pool table entry
+ * @param[in]   MagPtr       magazine to flush
+ * @param[in]   NumBlocks    number of blocks to return
+ */
+void CFE_ES_MemPoolMagazineFlush(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_PoolMagazine_t *MagPtr, uint16 NumBlocks);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Return all blocks cached by a task to their pools
+ *
+ * Called when a task is deleted, after it was deleted, or by the task itself
+ * just before it exits.  Caches that were already taken over by a new task
+ * of the same OSAL slot are left alone, that task has returned the blocks.
+ *
+ * @param[in]   TaskId   the task that was deleted
+ */
+void CFE_ES_MemPoolFlushTaskCaches(CFE_ES_TaskId_t TaskId);
+
 #endif /* CFE_ES_MEMPOOL_H */
@@ -37,12 +37,17 @@
 
 #include "cfe_msgids.h"
 #include "cfe_perfids.h"
+#include "cfe_core_perf_markers.h"
 
 #include "cfe_es_core_internal.h"
 #include "cfe_es_apps.h"
 #include "cfe_es_cds.h"
 #include "cfe_es_crc.h"
 #include "cfe_es_perf.h"
+#include "cfe_es_lockprof.h"
+#include "cfe_es_poolprof.h"
+#include "cfe_es_timeline.h"
+#include "cfe_es_atomic.h"
 #include "cfe_es_generic_pool.h"
 #include "cfe_es_mempool.h"
 #include "cfe_es_global.h"
@@ -31,6 +31,12 @@
 
 #include <string.h>
 
+/*
+ * Names of the performance markers, for the TRACE_JSON format.
+ * The list is terminated by an entry with a NULL name.
+ */
+static const CFE_ES_PerfMarkerName_t CFE_ES_PERF_MARKER_NAMES[] = {CFE_PLATFORM_ES_PERF_MARKER_NAMES{0, NULL}};
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -81,6 +87,8 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
         Perf->MetaData.DataCount             = 0;
         Perf->MetaData.InvalidMarkerReported = false;
         Perf->MetaData.FilterTriggerMaskSize = CFE_ES_PERF_32BIT_WORDS_IN_MASK;
+        Perf->Generation                     = 0;
+        Perf->BuffersInUse                   = 0;
 
         for (i = 0; i < CFE_ES_PERF_32BIT_WORDS_IN_MASK; i++)
         {
@@ -88,6 +96,13 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
             Perf->MetaData.TriggerMask[i] = CFE_PLATFORM_ES_PERF_TRIGMASK_INIT;
         }
     }
+
+    /* the marker statistics are not preserved on any reset */
+    memset(&CFE_ES_Global.PerfStats, 0, sizeof(CFE_ES_Global.PerfStats));
+    for (i = 0; i < CFE_ES_PERF_32BIT_WORDS_IN_MASK; i++)
+    {
+        CFE_ES_Global.PerfStats.Mask[i] = CFE_PLATFORM_ES_PERF_STATSMASK_INIT;
+    }
 }
 
 /*----------------------------------------------------------------
@@ -133,6 +148,40 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void)
     return Result;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Waits until no task is recording an entry in the performance log
+ * Returns false if a task is still recording after the wait limit
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_PerfLogWaitForWriters(void)
+{
+    uint32 TaskIdx;
+    uint32 Delays;
+
+    TaskIdx = 0;
+    Delays  = 0;
+    while (TaskIdx < OS_MAX_TASKS)
+    {
+        if (CFE_ES_AtomicLoad32(&CFE_ES_Global.PerfTaskMap[TaskIdx].Writing) == 0)
+        {
+            ++TaskIdx;
+        }
+        else if (Delays < CFE_ES_PERF_WRITER_WAIT_LIMIT)
+        {
+            ++Delays;
+            OS_TaskDelay(1);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -141,26 +190,58 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
 {
-    const CFE_ES_StartPerfCmd_Payload_t *CmdPtr        = &data->Payload;
-    CFE_ES_PerfDumpGlobal_t *            PerfDumpState = &CFE_ES_Global.BackgroundPerfDumpState;
+    const CFE_ES_StartPerfCmd_Payload_t *CmdPtr          = &data->Payload;
+    CFE_ES_PerfDumpGlobal_t *            PerfDumpState   = &CFE_ES_Global.BackgroundPerfDumpState;
+    CFE_ES_PerfStreamGlobal_t *          PerfStreamState = &CFE_ES_Global.BackgroundPerfStreamState;
     CFE_ES_PerfData_t *                  Perf;
+    uint32                               NewGeneration;
+    bool                                 WritersDone;
 
     /*
     ** Set the pointer to the data area
     */
-    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+    Perf        = &CFE_ES_Global.ResetDataPtr->Perf;
+    WritersDone = true;
 
     /* Ensure there is no file write in progress before proceeding */
     if (PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
-        PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE)
+        PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE && !PerfStreamState->Active)
     {
         /* Make sure Trigger Mode is valid */
-        if (CmdPtr->TriggerMode <= CFE_ES_PerfTrigger_END)
+        if (CmdPtr->TriggerMode <= CFE_ES_PerfTrigger_STREAM)
+        {
+            /*
+             * This might be changing from one active mode to another, and tasks may
+             * still be recording entries in the buffers of the previous run.  Stop
+             * collecting and start a new generation first, so that no task records
+             * another entry in the old buffers, then wait for the entries already
+             * in progress before the buffers are handed out again.  No buffer is
+             * claimed while the state is idle, so the lock is not held while waiting.
+             */
+            OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+            CFE_ES_AtomicStore32(&Perf->MetaData.State, CFE_ES_PERF_IDLE);
+            NewGeneration = Perf->Generation + 1;
+            if (NewGeneration == 0)
+            {
+                /* zero is never used, so that a cleared task map never matches */
+                NewGeneration = 1;
+            }
+            CFE_ES_AtomicExchange32(&Perf->Generation, NewGeneration);
+            OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+
+            WritersDone = CFE_ES_PerfLogWaitForWriters();
+        }
+
+        if (!WritersDone)
+        {
+            CFE_ES_Global.TaskData.CommandErrorCounter++;
+            CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Cannot start collecting performance data, tasks still writing to the old buffers");
+        }
+        else if (CmdPtr->TriggerMode <= CFE_ES_PerfTrigger_STREAM)
         {
             CFE_ES_Global.TaskData.CommandCounter++;
 
-            /* Taking lock here as this might be changing states from one active mode to another.
-             * In that case, need to make sure that the log is not written to while resetting the counters. */
             OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
             Perf->MetaData.Mode                  = CmdPtr->TriggerMode;
             Perf->MetaData.TriggerCount          = 0;
@@ -168,7 +249,26 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
             Perf->MetaData.DataEnd               = 0;
             Perf->MetaData.DataCount             = 0;
             Perf->MetaData.InvalidMarkerReported = false;
-            Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
+            Perf->BuffersInUse                   = 0;
+            if (CmdPtr->TriggerMode == CFE_ES_PerfTrigger_STREAM)
+            {
+                /* Set up the rolling file writes, the trigger masks are not used while streaming */
+                memset(PerfStreamState, 0, sizeof(*PerfStreamState));
+                PerfStreamState->FileWrite.FileSubType = CFE_FS_SubType_ES_PERFDATA;
+                snprintf(PerfStreamState->FileWrite.Description, sizeof(PerfStreamState->FileWrite.Description),
+                         CFE_ES_PERF_LOG_DESC);
+                PerfStreamState->FileWrite.GetData = CFE_ES_PerfStreamFileDataGetter;
+                PerfStreamState->FileWrite.OnEvent = CFE_ES_PerfStreamFileEventHandler;
+                PerfStreamState->Active            = true;
+
+                /* this must be done last */
+                CFE_ES_AtomicStore32(&Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+            }
+            else
+            {
+                /* this must be done last */
+                CFE_ES_AtomicStore32(&Perf->MetaData.State, CFE_ES_PERF_WAITING_FOR_TRIGGER);
+            }
             OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_EID, CFE_EVS_EventType_DEBUG,
@@ -180,7 +280,7 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
             CFE_ES_Global.TaskData.CommandErrorCounter++;
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_TRIG_ERR_EID, CFE_EVS_EventType_ERROR,
                               "Cannot start collecting performance data, trigger mode (%d) out of range (%d to %d)",
-                              (int)CmdPtr->TriggerMode, (int)CFE_ES_PerfTrigger_START, (int)CFE_ES_PerfTrigger_END);
+                              (int)CmdPtr->TriggerMode, (int)CFE_ES_PerfTrigger_START, (int)CFE_ES_PerfTrigger_STREAM);
         }
     }
     else
@@ -201,8 +301,9 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
 {
-    const CFE_ES_StopPerfCmd_Payload_t *CmdPtr        = &data->Payload;
-    CFE_ES_PerfDumpGlobal_t *           PerfDumpState = &CFE_ES_Global.BackgroundPerfDumpState;
+    const CFE_ES_StopPerfCmd_Payload_t *CmdPtr          = &data->Payload;
+    CFE_ES_PerfDumpGlobal_t *           PerfDumpState   = &CFE_ES_Global.BackgroundPerfDumpState;
+    CFE_ES_PerfStreamGlobal_t *         PerfStreamState = &CFE_ES_Global.BackgroundPerfStreamState;
     CFE_ES_PerfData_t *                 Perf;
     int32                               Status;
 
@@ -211,13 +312,44 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
     */
     Perf = &CFE_ES_Global.ResetDataPtr->Perf;
 
+    if (PerfStreamState->Active)
+    {
+        /*
+         * Streaming writes its own files, so the file name is not used.  The
+         * background job writes any remaining entries once it sees the IDLE state.
+         */
+        if (CFE_ES_AtomicLoad32(&Perf->MetaData.State) != CFE_ES_PERF_IDLE)
+        {
+            /* taking the lock keeps a trigger from undoing the stop when atomics are not lock-free */
+            OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+            CFE_ES_AtomicStore32(&Perf->MetaData.State, CFE_ES_PERF_IDLE);
+            OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+            CFE_ES_BackgroundWakeup();
+
+            CFE_ES_Global.TaskData.CommandCounter++;
+
+            CFE_EVS_SendEvent(CFE_ES_PERF_STOPCMD_EID, CFE_EVS_EventType_DEBUG,
+                              "Perf Stop Cmd Rcvd, ending stream, %d files written", (int)PerfStreamState->FileCount);
+        }
+        else
+        {
+            CFE_ES_Global.TaskData.CommandErrorCounter++;
+            CFE_EVS_SendEvent(CFE_ES_PERF_STOPCMD_ERR2_EID, CFE_EVS_EventType_ERROR,
+                              "Stop performance data cmd ignored,perf data write in progress");
+        }
+    }
     /* Ensure there is no file write in progress before proceeding */
     /* note - also need to check the PendingState here, in case this command
      * was sent twice in succession and the background task has not awakened yet */
-    if (PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
-        PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE)
+    else if (PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
+             PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE)
     {
-        Perf->MetaData.State = CFE_ES_PERF_IDLE;
+        OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+        CFE_ES_AtomicStore32(&Perf->MetaData.State, CFE_ES_PERF_IDLE);
+        OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+
+        /* Preliminary count for reporting, final count is taken once writers have finished */
+        Perf->MetaData.DataCount = CFE_ES_PerfLogCountEntries(NULL, NULL);
 
         /* Copy out the string, using default if unspecified */
         Status = CFE_FS_ParseInputFileNameEx(PerfDumpState->DataFileName, CmdPtr->DataFileName,
@@ -226,8 +358,15 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
                                              CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
                                              CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
 
+        if (Status == CFE_SUCCESS && CmdPtr->DumpFormat > CFE_ES_PerfDumpFormat_TRACE_JSON)
+        {
+            Status = CFE_ES_BAD_ARGUMENT;
+        }
+
         if (Status == CFE_SUCCESS)
         {
+            PerfDumpState->DumpFormat = CmdPtr->DumpFormat;
+
             PerfDumpState->PendingState = CFE_ES_PerfDumpState_INIT;
             CFE_ES_BackgroundWakeup();
 
@@ -241,7 +380,8 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
         else
         {
             CFE_ES_Global.TaskData.CommandErrorCounter++;
-            CFE_EVS_SendEvent(CFE_ES_PERF_LOG_ERR_EID, CFE_EVS_EventType_ERROR, "Error parsing filename, RC = %d",
+            CFE_EVS_SendEvent(CFE_ES_PERF_LOG_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error parsing filename or format %u, RC = %d", (unsigned int)CmdPtr->DumpFormat,
                               (int)Status);
         }
 
@@ -264,12 +404,14 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
  *-----------------------------------------------------------------*/
 bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
 {
-    CFE_ES_PerfDumpGlobal_t *State = (CFE_ES_PerfDumpGlobal_t *)Arg;
-    int32                    OsStatus;
-    int32                    Status;
-    CFE_FS_Header_t          FileHdr;
-    size_t                   BlockSize;
-    CFE_ES_PerfData_t *      Perf;
+    CFE_ES_PerfDumpGlobal_t *     State = (CFE_ES_PerfDumpGlobal_t *)Arg;
+    int32                         OsStatus;
+    int32                         Status;
+    CFE_FS_Header_t               FileHdr;
+    size_t                        BlockSize;
+    CFE_ES_PerfData_t *           Perf;
+    const CFE_ES_PerfDataEntry_t *EntryPtr;
+    uint32                        BufferIdx;
 
     /*
     ** Set the pointer to the data area
@@ -338,22 +480,54 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                     State->WorkCredit = 0;
                     break;
 
-                case CFE_ES_PerfDumpState_LOCK_DATA:
-                    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+                case CFE_ES_PerfDumpState_MERGE_SETUP:
+                    /*
+                     * No new entries are started while the state is idle, but an entry
+                     * may still be in progress after the delay.  Wait for those, then
+                     * take the final count of entries and set up the position within
+                     * each task buffer.  The log is written as a single stream, oldest
+                     * entry first.  If a task does not finish its entry, the log is not
+                     * written, as its buffer may be changing under the merge.
+                     */
+                    if (!CFE_ES_PerfLogWaitForWriters())
+                    {
+                        CFE_EVS_SendEvent(CFE_ES_PERF_LOG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "Error writing file %s, tasks still writing performance data",
+                                          State->DataFileName);
+                        State->PendingState = CFE_ES_PerfDumpState_CLEANUP;
+                        break;
+                    }
+
+                    Perf->MetaData.DataCount = CFE_ES_PerfLogCountEntries(State->MergePos, State->MergeEnd);
+                    Perf->MetaData.DataStart = 0;
+                    Perf->MetaData.DataEnd   = Perf->MetaData.DataCount;
                     break;
 
                 case CFE_ES_PerfDumpState_WRITE_FS_HDR:
-                case CFE_ES_PerfDumpState_WRITE_PERF_METADATA:
                     State->StateCounter = 1;
                     break;
 
+                case CFE_ES_PerfDumpState_WRITE_PERF_METADATA:
+                    if (State->DumpFormat == CFE_ES_PerfDumpFormat_TRACE_JSON)
+                    {
+                        /* one track per task buffer, in place of the binary metadata */
+                        State->StateCounter = CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS;
+                    }
+                    else
+                    {
+                        State->StateCounter = 1;
+                    }
+                    break;
+
                 case CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES:
-                    State->DataPos      = Perf->MetaData.DataStart;
                     State->StateCounter = Perf->MetaData.DataCount;
                     break;
 
-                case CFE_ES_PerfDumpState_UNLOCK_DATA:
-                    OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+                case CFE_ES_PerfDumpState_WRITE_TRAILER:
+                    if (State->DumpFormat == CFE_ES_PerfDumpFormat_TRACE_JSON)
+                    {
+                        State->StateCounter = 1;
+                    }
                     break;
 
                 case CFE_ES_PerfDumpState_CLOSE_FILE:
@@ -404,8 +578,9 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
 
                 case CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES:
                     CFE_EVS_SendEvent(CFE_ES_PERF_DATAWRITTEN_EID, CFE_EVS_EventType_DEBUG,
-                                      "%s written:Size=%lu,EntryCount=%lu", State->DataFileName,
-                                      (unsigned long)State->FileSize, (unsigned long)Perf->MetaData.DataCount);
+                                      "%s written:Size=%lu,EntryCount=%lu,Dropped=%lu", State->DataFileName,
+                                      (unsigned long)State->FileSize, (unsigned long)Perf->MetaData.DataCount,
+                                      (unsigned long)CFE_ES_PerfLogCountDropped());
                     break;
 
                 default:
@@ -422,6 +597,17 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
             switch (State->CurrentState)
             {
                 case CFE_ES_PerfDumpState_WRITE_FS_HDR:
+                    if (State->DumpFormat == CFE_ES_PerfDumpFormat_TRACE_JSON)
+                    {
+                        /* a text file has no cFE header, start the event list instead */
+                        BlockSize = snprintf(State->TextBuffer, sizeof(State->TextBuffer),
+                                             "{\"traceEvents\":[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+                                             "\"args\":{\"name\":\"cFE\"}}");
+                        OsStatus = OS_write(State->FileDesc, State->TextBuffer, BlockSize);
+                        Status   = (long)OsStatus; /* status type conversion (size) */
+                        break;
+                    }
+
                     /* Zero cFE header, then fill in fields */
                     CFE_FS_InitHeader(&FileHdr, CFE_ES_PERF_LOG_DESC, CFE_FS_SubType_ES_PERFDATA);
                     /* predicted total length of final output */
@@ -433,6 +619,20 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                     break;
 
                 case CFE_ES_PerfDumpState_WRITE_PERF_METADATA:
+                    if (State->DumpFormat == CFE_ES_PerfDumpFormat_TRACE_JSON)
+                    {
+                        /* name the track of each task buffer that has entries to write */
+                        BufferIdx = CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS - State->StateCounter;
+                        if (State->MergePos[BufferIdx] != State->MergeEnd[BufferIdx])
+                        {
+                            BlockSize = CFE_ES_PerfTraceFormatTrack(State->TextBuffer, sizeof(State->TextBuffer),
+                                                                    Perf->TaskBuffer[BufferIdx].TaskId);
+                            OsStatus  = OS_write(State->FileDesc, State->TextBuffer, BlockSize);
+                            Status    = (long)OsStatus; /* status type conversion (size) */
+                        }
+                        break;
+                    }
+
                     /* write the performance metadata to the file */
                     BlockSize = sizeof(CFE_ES_PerfMetaData_t);
                     OsStatus  = OS_write(State->FileDesc, &Perf->MetaData, BlockSize);
@@ -440,15 +640,26 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                     break;
 
                 case CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES:
-                    BlockSize = sizeof(CFE_ES_PerfDataEntry_t);
-                    OsStatus  = OS_write(State->FileDesc, &Perf->DataBuffer[State->DataPos], BlockSize);
-                    Status    = (long)OsStatus; /* status type conversion (size) */
-
-                    ++State->DataPos;
-                    if (State->DataPos >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+                    EntryPtr = CFE_ES_PerfLogMergeNext(State->MergePos, State->MergeEnd, &BufferIdx);
+                    if (State->DumpFormat == CFE_ES_PerfDumpFormat_TRACE_JSON)
+                    {
+                        BlockSize = CFE_ES_PerfTraceFormatEntry(State->TextBuffer, sizeof(State->TextBuffer),
+                                                                &Perf->MetaData, EntryPtr,
+                                                                Perf->TaskBuffer[BufferIdx].TaskId);
+                        OsStatus  = OS_write(State->FileDesc, State->TextBuffer, BlockSize);
+                    }
+                    else
                     {
-                        State->DataPos = 0;
+                        BlockSize = sizeof(CFE_ES_PerfDataEntry_t);
+                        OsStatus  = OS_write(State->FileDesc, EntryPtr, BlockSize);
                     }
+                    Status = (long)OsStatus; /* status type conversion (size) */
+                    break;
+
+                case CFE_ES_PerfDumpState_WRITE_TRAILER:
+                    BlockSize = snprintf(State->TextBuffer, sizeof(State->TextBuffer), "\n]}\n");
+                    OsStatus  = OS_write(State->FileDesc, State->TextBuffer, BlockSize);
+                    Status    = (long)OsStatus; /* status type conversion (size) */
                     break;
 
                 default:
@@ -479,6 +690,192 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
     return (State->CurrentState != CFE_ES_PerfDumpState_IDLE);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_RunPerfLogStream(uint32 ElapsedTime, void *Arg)
+{
+    CFE_ES_PerfStreamGlobal_t *State = (CFE_ES_PerfStreamGlobal_t *)Arg;
+    CFE_ES_PerfData_t *        Perf;
+    uint32                     PendingCount;
+    uint32                     i;
+    bool                       IsStopping;
+    bool                       IsDue;
+
+    if (!State->Active)
+    {
+        return false;
+    }
+
+    /* The entries of the previous file are not released until it is finished */
+    if (CFE_FS_BackgroundFileDumpIsPending(&State->FileWrite))
+    {
+        return true;
+    }
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    /* Check the state before counting, so that the final file holds everything logged before the stop */
+    IsStopping = (CFE_ES_AtomicLoad32(&Perf->MetaData.State) == CFE_ES_PERF_IDLE);
+    State->ElapsedTime += ElapsedTime;
+
+    PendingCount = CFE_ES_PerfLogCountEntries(State->MergePos, State->MergeEnd);
+    if (PendingCount == 0)
+    {
+        if (IsStopping)
+        {
+            State->Active = false;
+
+            CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_STOPPED_EID, CFE_EVS_EventType_INFORMATION,
+                              "Perf stream stopped:Files=%lu,EntryCount=%lu,Dropped=%lu",
+                              (unsigned long)State->FileCount, (unsigned long)Perf->MetaData.DataCount,
+                              (unsigned long)(CFE_ES_PerfLogCountDropped() + State->DiscardCount));
+        }
+
+        return State->Active;
+    }
+
+    /*
+     * Write the next file when the period has passed, or sooner if any task buffer
+     * is half full, so there is still room for the writer while the file is written.
+     */
+    IsDue = (IsStopping || State->ElapsedTime >= CFE_PLATFORM_ES_PERF_STREAM_MS_PERIOD);
+    for (i = 0; !IsDue && i < CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS; ++i)
+    {
+        IsDue = ((State->MergeEnd[i] - State->MergePos[i]) >= (CFE_ES_PERF_TASK_BUFFER_SIZE / 2));
+    }
+
+    if (IsDue)
+    {
+        /* Each file is a complete performance log, with its own metadata */
+        State->SegmentCount       = PendingCount;
+        State->MetaData           = Perf->MetaData;
+        State->MetaData.DataStart = 0;
+        State->MetaData.DataEnd   = PendingCount;
+        State->MetaData.DataCount = PendingCount;
+
+        snprintf(State->FileWrite.FileName, sizeof(State->FileWrite.FileName), "%s_%02u.dat",
+                 CFE_PLATFORM_ES_DEFAULT_PERF_STREAM_FILENAME, (unsigned int)State->FileIndex);
+
+        /* If the FS request queue is full, this is retried on the next iteration */
+        if (CFE_FS_BackgroundFileDumpRequest(&State->FileWrite) == CFE_SUCCESS)
+        {
+            State->ElapsedTime = 0;
+        }
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_PerfStreamFileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_ES_PerfStreamGlobal_t *   State;
+    const CFE_ES_PerfDataEntry_t *EntryPtr;
+
+    State = (CFE_ES_PerfStreamGlobal_t *)Meta;
+
+    if (RecordNum == 0)
+    {
+        *Buffer  = &State->MetaData;
+        *BufSize = sizeof(State->MetaData);
+    }
+    else
+    {
+        EntryPtr = CFE_ES_PerfLogMergeNext(State->MergePos, State->MergeEnd, NULL);
+        if (EntryPtr != NULL)
+        {
+            State->EntryBuffer = *EntryPtr;
+
+            *Buffer  = &State->EntryBuffer;
+            *BufSize = sizeof(State->EntryBuffer);
+        }
+        else
+        {
+            *Buffer  = NULL;
+            *BufSize = 0;
+        }
+    }
+
+    /* Check for EOF (last entry) */
+    return (RecordNum >= State->SegmentCount);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfStreamFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
+                                       size_t BlockSize, size_t Position)
+{
+    CFE_ES_PerfStreamGlobal_t *State;
+    CFE_ES_PerfData_t *        Perf;
+    uint32                     i;
+
+    State = (CFE_ES_PerfStreamGlobal_t *)Meta;
+    Perf  = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    /* Note that this runs in the context of ES background task (file writer background job) */
+    switch (Event)
+    {
+        case CFE_FS_FileWriteEvent_COMPLETE:
+            ++State->FileCount;
+            Perf->MetaData.DataCount += State->SegmentCount;
+
+            CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_EID, CFE_EVS_EventType_DEBUG, "%s written:Size=%lu,EntryCount=%lu",
+                              State->FileWrite.FileName, (unsigned long)Position, (unsigned long)State->SegmentCount);
+            break;
+
+        case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
+        case CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR:
+            State->DiscardCount += State->SegmentCount;
+
+            CFE_EVS_SendEvent(CFE_ES_FILEWRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "File write,byte cnt err,file %s,request=%u,actual=%u", State->FileWrite.FileName,
+                              (int)BlockSize, (int)Status);
+            break;
+
+        case CFE_FS_FileWriteEvent_CREATE_ERROR:
+            State->DiscardCount += State->SegmentCount;
+
+            CFE_EVS_SendEvent(CFE_ES_PERF_LOG_ERR_EID, CFE_EVS_EventType_ERROR, "Error creating file %s, RC = %d",
+                              State->FileWrite.FileName, (int)Status);
+            break;
+
+        default:
+            /* unhandled event - ignore */
+            return;
+    }
+
+    /*
+     * The file is finished one way or the other, release its entries back to
+     * the writers and move on to the next file of the rolling set.  A buffer
+     * claimed after the entries were counted still has a read count of 0,
+     * which is also its end here, and a write count may wrap to 0 as well,
+     * so every buffer is released.
+     */
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS; ++i)
+    {
+        CFE_ES_AtomicStore32(&Perf->TaskBuffer[i].ReadCount, State->MergeEnd[i]);
+    }
+
+    State->SegmentCount = 0;
+    State->FileIndex    = (State->FileIndex + 1) % CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -557,133 +954,857 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
 
 /*----------------------------------------------------------------
  *
- * Implemented per public API
+ * Application-scope internal function
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
+int32 CFE_ES_SetPerfStatsMaskCmd(const CFE_ES_SetPerfStatsMaskCmd_t *data)
 {
-    CFE_ES_PerfDataEntry_t EntryData;
-    uint32                 DataEnd;
-    CFE_ES_PerfData_t *    Perf;
+    const CFE_ES_SetPerfStatsMaskCmd_Payload_t *cmd   = &data->Payload;
+    CFE_ES_PerfStatsGlobal_t *                  Stats = &CFE_ES_Global.PerfStats;
 
-    /*
-    ** Set the pointer to the data area
-    */
-    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+    if (cmd->StatsMaskNum < CFE_ES_PERF_32BIT_WORDS_IN_MASK)
+    {
+        /* the statistics collected so far belong to the old selection, start over */
+        OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
 
-    /*
-     * If the global state is idle, exit immediately without locking or doing anything
-     */
-    if (Perf->MetaData.State == CFE_ES_PERF_IDLE)
+        Stats->Mask[cmd->StatsMaskNum] = cmd->StatsMask;
+        CFE_ES_AtomicStore32(&Stats->NumEntries, 0);
+        CFE_ES_AtomicStore32(&Stats->UntrackedCount, 0);
+
+        OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+
+        CFE_EVS_SendEvent(CFE_ES_PERF_STATSMSKCMD_EID, CFE_EVS_EventType_DEBUG,
+                          "Set Performance Statistics Mask Cmd rcvd, num %u, val 0x%08X",
+                          (unsigned int)cmd->StatsMaskNum, (unsigned int)cmd->StatsMask);
+
+        CFE_ES_Global.TaskData.CommandCounter++;
+    }
+    else
     {
-        return;
+        CFE_EVS_SendEvent(CFE_ES_PERF_STATSMSKERR_EID, CFE_EVS_EventType_ERROR,
+                          "Performance Statistics Mask Cmd Error,Index(%u)out of range(%u)",
+                          (unsigned int)cmd->StatsMaskNum, (unsigned int)CFE_ES_PERF_32BIT_WORDS_IN_MASK);
+
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
     }
 
-    /* if marker is out of range... */
-    if (Marker >= CFE_MISSION_ES_PERF_MAX_IDS)
-    {
-        /* if marker has not been reported previously ... */
-        if (Perf->MetaData.InvalidMarkerReported == false)
-        {
-            CFE_ES_WriteToSysLog("%s: Invalid performance marker %d,max is %d\n", __func__, (unsigned int)Marker,
-                                 (CFE_MISSION_ES_PERF_MAX_IDS - 1));
-            Perf->MetaData.InvalidMarkerReported = true;
-        }
+    return CFE_SUCCESS;
+}
 
-        return;
+/*----------------------------------------------------------------
+ *
+ * Local helper to convert a duration in timer ticks to microseconds
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_PerfStatsTicksToUsec(uint32 Ticks, uint32 TicksPerSecond)
+{
+    uint64 Usec;
+
+    if (TicksPerSecond == 0)
+    {
+        return Ticks;
     }
 
-    /*
-     * check if this ID is filtered.
-     * This is also done outside the lock -
-     * normally masks should NOT be changed while perf log is active / non-idle,
-     * so although this is reading a global it should be constant, and this avoids
-     * locking (and potential task switch) if the data is ultimately not going to
-     * be written to the log.
-     */
-    if (!CFE_ES_TEST_LONG_MASK(Perf->MetaData.FilterMask, Marker))
+    Usec = ((uint64)Ticks * 1000000) / TicksPerSecond;
+    if (Usec > 0xFFFFFFFF)
     {
-        return;
+        Usec = 0xFFFFFFFF;
     }
 
-    /*
-     * prepare the entry data (timestamp) before locking,
-     * just in case the locking operation incurs a delay
-     */
-    EntryData.Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
-    CFE_PSP_Get_Timebase(&EntryData.TimerUpper32, &EntryData.TimerLower32);
+    return Usec;
+}
 
-    /*
-     * Acquire the perflog mutex before writing into the shared area.
-     * Note this lock is held for long periods while a background dump
-     * is taking place, but the dump should never be active at the
-     * same time that a capture/record is taking place.
-     */
-    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_SendPerfStatsCmd(const CFE_ES_SendPerfStatsCmd_t *data)
+{
+    CFE_ES_PerfStatsTlm_Payload_t *Payload = &CFE_ES_Global.TaskData.PerfStatsPacket.Payload;
+    CFE_ES_PerfStatsGlobal_t *     Stats   = &CFE_ES_Global.PerfStats;
+    const CFE_ES_PerfStatsEntry_t *StatPtr;
+    CFE_ES_PerfMarkerStats_t *     TlmPtr;
+    uint32                         TicksPerSecond;
+    uint32                         i;
+    uint32                         Bin;
+    uint32                         Target;
+    uint32                         Total;
+    uint32                         P99Ticks;
+
+    TicksPerSecond = CFE_ES_Global.ResetDataPtr->Perf.MetaData.TimerTicksPerSecond;
 
     /*
-     * Confirm that the global is still non-idle after lock
-     * (state could become idle while getting lock)
+     * The owning tasks may update their statistics while this is running,
+     * so a value may be one measurement newer than the others in its entry.
      */
-    if (Perf->MetaData.State != CFE_ES_PERF_IDLE)
+    memset(Payload, 0, sizeof(*Payload));
+    Payload->NumStats       = CFE_ES_AtomicLoad32(&Stats->NumEntries);
+    Payload->UntrackedCount = CFE_ES_AtomicLoad32(&Stats->UntrackedCount);
+
+    for (i = 0; i < Payload->NumStats; ++i)
     {
-        /* copy data to next perflog slot */
-        DataEnd                   = Perf->MetaData.DataEnd;
-        Perf->DataBuffer[DataEnd] = EntryData;
+        StatPtr = &Stats->Entries[i];
+        TlmPtr  = &Payload->Stats[i];
 
-        ++DataEnd;
-        if (DataEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-        {
-            DataEnd = 0;
-        }
-        Perf->MetaData.DataEnd = DataEnd;
+        TlmPtr->Marker = StatPtr->Marker;
+        TlmPtr->TaskId = CFE_ES_TaskId_FromOSAL(StatPtr->TaskId);
+        TlmPtr->Count  = StatPtr->Count;
 
-        /* we have filled up the buffer */
-        if (Perf->MetaData.DataCount < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+        if (StatPtr->Count == 0)
         {
-            Perf->MetaData.DataCount++;
-        }
-        else
-        {
-            /* after the buffer fills up start and end point to the same entry since we
-               are now overwriting old data */
-            Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
+            continue;
         }
 
-        /* waiting for trigger */
-        if (Perf->MetaData.State == CFE_ES_PERF_WAITING_FOR_TRIGGER)
+        /* the 99th percentile falls in the first bin where the running total reaches 99% of the count */
+        Target = StatPtr->Count - (StatPtr->Count / 100);
+        Total  = 0;
+        for (Bin = 0; Bin < (CFE_ES_PERF_STATS_HIST_BINS - 1); ++Bin)
         {
-            if (CFE_ES_TEST_LONG_MASK(Perf->MetaData.TriggerMask, Marker))
+            Total += StatPtr->Histogram[Bin];
+            if (Total >= Target)
             {
-                Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+                break;
             }
         }
 
-        /* triggered */
-        if (Perf->MetaData.State == CFE_ES_PERF_TRIGGERED)
+        P99Ticks = CFE_ES_PerfStatsBinLimit(Bin);
+        if (P99Ticks > StatPtr->MaxTicks)
         {
-            Perf->MetaData.TriggerCount++;
-            if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_START)
-            {
-                if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-                {
-                    Perf->MetaData.State = CFE_ES_PERF_IDLE;
-                }
-            }
-            else if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_CENTER)
-            {
-                if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2)
-                {
-                    Perf->MetaData.State = CFE_ES_PERF_IDLE;
-                }
-            }
-            else if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_END)
-            {
-                Perf->MetaData.State = CFE_ES_PERF_IDLE;
+            P99Ticks = StatPtr->MaxTicks;
+        }
+
+        TlmPtr->MinTime = CFE_ES_PerfStatsTicksToUsec(StatPtr->MinTicks, TicksPerSecond);
+        TlmPtr->AvgTime = CFE_ES_PerfStatsTicksToUsec(StatPtr->SumTicks / StatPtr->Count, TicksPerSecond);
+        TlmPtr->MaxTime = CFE_ES_PerfStatsTicksToUsec(StatPtr->MaxTicks, TicksPerSecond);
+        TlmPtr->P99Time = CFE_ES_PerfStatsTicksToUsec(P99Ticks, TicksPerSecond);
+    }
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.PerfStatsPacket.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.PerfStatsPacket.TelemetryHeader), true);
+
+    CFE_ES_Global.TaskData.CommandCounter++;
+    CFE_EVS_SendEvent(CFE_ES_PERF_STATS_TLM_EID, CFE_EVS_EventType_DEBUG,
+                      "Successfully telemetered performance statistics for %u markers",
+                      (unsigned int)Payload->NumStats);
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_PerfTaskBuffer_t *CFE_ES_PerfLogGetTaskBuffer(CFE_ES_PerfData_t *Perf, CFE_ES_PerfTaskMap_t **MapPtrOut)
+{
+    CFE_ES_PerfTaskMap_t *   MapPtr;
+    CFE_ES_PerfTaskBuffer_t *BufPtr;
+    osal_id_t                OsTaskId;
+    osal_index_t             TaskIdx;
+
+    OsTaskId = OS_TaskGetId();
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, OsTaskId, &TaskIdx) != OS_SUCCESS || TaskIdx >= OS_MAX_TASKS)
+    {
+        return NULL;
+    }
+
+    MapPtr = &CFE_ES_Global.PerfTaskMap[TaskIdx];
+
+    if (MapPtr->Generation != CFE_ES_AtomicLoad32(&Perf->Generation))
+    {
+        /*
+         * First entry from this task in this run, claim a buffer.  This is
+         * the only place the lock is needed on the logging path, after this
+         * the task is the sole writer of the buffer it was given.
+         *
+         * No buffer is claimed while the log is idle, the start command
+         * releases the lock while it waits for the previous run to finish
+         * and only resets the buffer count after that.
+         */
+        OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+
+        if (CFE_ES_AtomicLoad32(&Perf->MetaData.State) == CFE_ES_PERF_IDLE)
+        {
+            OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+            return NULL;
+        }
+
+        if (Perf->BuffersInUse < CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS)
+        {
+            MapPtr->BufferIdx = Perf->BuffersInUse;
+            BufPtr            = &Perf->TaskBuffer[MapPtr->BufferIdx];
+
+            BufPtr->WriteCount    = 0;
+            BufPtr->ReadCount     = 0;
+            BufPtr->TriggerCount  = 0;
+            BufPtr->OverflowCount = 0;
+            BufPtr->TaskId        = OS_ObjectIdToInteger(OsTaskId);
+            BufPtr->Generation    = Perf->Generation;
+
+            ++Perf->BuffersInUse;
+        }
+        else
+        {
+            MapPtr->BufferIdx = CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS;
+        }
+
+        MapPtr->DroppedCount = 0;
+        MapPtr->Generation   = Perf->Generation;
+
+        OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+    }
+
+    if (MapPtr->BufferIdx >= CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS)
+    {
+        ++MapPtr->DroppedCount;
+        return NULL;
+    }
+
+    /*
+     * Mark the task as writing before checking that the run is still the one
+     * the buffer was claimed in.  The start command changes the generation
+     * before it checks the flags, and both sides use a full barrier, so
+     * either this task sees the new generation or the start command sees
+     * the flag and waits for the entry before handing out the buffers again.
+     */
+    CFE_ES_AtomicExchange32(&MapPtr->Writing, 1);
+    if (MapPtr->Generation != CFE_ES_AtomicLoad32(&Perf->Generation) ||
+        CFE_ES_AtomicLoad32(&Perf->MetaData.State) == CFE_ES_PERF_IDLE)
+    {
+        CFE_ES_AtomicStore32(&MapPtr->Writing, 0);
+        return NULL;
+    }
+
+    *MapPtrOut = MapPtr;
+    return &Perf->TaskBuffer[MapPtr->BufferIdx];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_PerfLogCountEntries(uint32 *PosArray, uint32 *EndArray)
+{
+    CFE_ES_PerfData_t *      Perf;
+    CFE_ES_PerfTaskBuffer_t *BufPtr;
+    uint32                   i;
+    uint32                   Start;
+    uint32                   End;
+    uint32                   Total;
+
+    Perf  = &CFE_ES_Global.ResetDataPtr->Perf;
+    Total = 0;
+
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS; ++i)
+    {
+        BufPtr = &Perf->TaskBuffer[i];
+        Start  = 0;
+        End    = 0;
+
+        if (i < Perf->BuffersInUse && BufPtr->Generation == Perf->Generation)
+        {
+            /*
+             * Entries already streamed to a file are not held, and once a buffer
+             * wraps only the newest entries are.  The counters themselves wrap
+             * as well, so they are only compared by their difference.
+             */
+            End   = CFE_ES_AtomicLoad32(&BufPtr->WriteCount);
+            Start = BufPtr->ReadCount;
+            if ((End - Start) > CFE_ES_PERF_TASK_BUFFER_SIZE)
+            {
+                Start = End - CFE_ES_PERF_TASK_BUFFER_SIZE;
+            }
+        }
+
+        if (PosArray != NULL)
+        {
+            PosArray[i] = Start;
+        }
+        if (EndArray != NULL)
+        {
+            EndArray[i] = End;
+        }
+
+        Total += End - Start;
+    }
+
+    return Total;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_PerfLogCountDropped(void)
+{
+    CFE_ES_PerfData_t *Perf;
+    uint32             i;
+    uint32             Total;
+
+    Perf  = &CFE_ES_Global.ResetDataPtr->Perf;
+    Total = 0;
+
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        if (CFE_ES_Global.PerfTaskMap[i].Generation == Perf->Generation)
+        {
+            Total += CFE_ES_Global.PerfTaskMap[i].DroppedCount;
+        }
+    }
+
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS; ++i)
+    {
+        if (i < Perf->BuffersInUse && Perf->TaskBuffer[i].Generation == Perf->Generation)
+        {
+            Total += Perf->TaskBuffer[i].OverflowCount;
+        }
+    }
+
+    return Total;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+const CFE_ES_PerfDataEntry_t *CFE_ES_PerfLogMergeNext(uint32 *PosArray, const uint32 *EndArray, uint32 *BufferIdx)
+{
+    CFE_ES_PerfData_t *           Perf;
+    const CFE_ES_PerfDataEntry_t *EntryPtr;
+    const CFE_ES_PerfDataEntry_t *OldestPtr;
+    uint32                        i;
+    uint32                        OldestIdx;
+
+    Perf      = &CFE_ES_Global.ResetDataPtr->Perf;
+    OldestPtr = NULL;
+    OldestIdx = 0;
+
+    /*
+     * the number of task buffers is small, so a linear scan of the heads is sufficient.
+     * The positions may wrap past the end, so only equality marks an empty buffer.
+     */
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS; ++i)
+    {
+        if (PosArray[i] != EndArray[i])
+        {
+            EntryPtr = &Perf->TaskBuffer[i].Entries[PosArray[i] % CFE_ES_PERF_TASK_BUFFER_SIZE];
+
+            if (OldestPtr == NULL || EntryPtr->TimerUpper32 < OldestPtr->TimerUpper32 ||
+                (EntryPtr->TimerUpper32 == OldestPtr->TimerUpper32 &&
+                 EntryPtr->TimerLower32 < OldestPtr->TimerLower32))
+            {
+                OldestPtr = EntryPtr;
+                OldestIdx = i;
             }
         }
     }
 
+    if (OldestPtr != NULL)
+    {
+        ++PosArray[OldestIdx];
+    }
+
+    if (BufferIdx != NULL)
+    {
+        *BufferIdx = OldestIdx;
+    }
+
+    return OldestPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+const char *CFE_ES_PerfLogMarkerName(uint32 Marker)
+{
+    const CFE_ES_PerfMarkerName_t *NamePtr;
+
+    for (NamePtr = CFE_ES_PERF_MARKER_NAMES; NamePtr->Name != NULL; ++NamePtr)
+    {
+        if (NamePtr->Marker == Marker)
+        {
+            return NamePtr->Name;
+        }
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+size_t CFE_ES_PerfTraceFormatTrack(char *Buf, size_t BufSize, uint32 TaskId)
+{
+    OS_task_prop_t TaskProp;
+    int            Len;
+
+    /* the task may have exited since it logged its entries, in which case the name is not known */
+    if (OS_TaskGetInfo(OS_ObjectIdFromInteger(TaskId), &TaskProp) != OS_SUCCESS)
+    {
+        snprintf(TaskProp.name, sizeof(TaskProp.name), "Task%lu", (unsigned long)TaskId);
+    }
+
+    Len = snprintf(Buf, BufSize,
+                   ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}",
+                   (unsigned long)TaskId, TaskProp.name);
+
+    /* a truncated line is written as far as it goes */
+    if (Len < 0)
+    {
+        Len = 0;
+    }
+    else if (Len >= BufSize)
+    {
+        Len = BufSize - 1;
+    }
+
+    return Len;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint64 CFE_ES_PerfLogTimerTicks(const CFE_ES_PerfMetaData_t *MetaData, uint32 Upper32, uint32 Lower32)
+{
+    /* a rollover of 0 means the lower word uses all 32 bits */
+    if (MetaData->TimerLow32Rollover != 0)
+    {
+        return ((uint64)Upper32 * MetaData->TimerLow32Rollover) + Lower32;
+    }
+
+    return ((uint64)Upper32 << 32) + Lower32;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+size_t CFE_ES_PerfTraceFormatEntry(char *Buf, size_t BufSize, const CFE_ES_PerfMetaData_t *MetaData,
+                                   const CFE_ES_PerfDataEntry_t *Entry, uint32 TaskId)
+{
+    uint64      Ticks;
+    uint64      TicksPerSecond;
+    uint32      Seconds;
+    uint32      Nanoseconds;
+    uint32      Marker;
+    const char *Name;
+    char        NameBuf[24];
+    char        TimeBuf[32];
+    int         Len;
+
+    if (Entry == NULL)
+    {
+        return 0;
+    }
+
+    Ticks          = CFE_ES_PerfLogTimerTicks(MetaData, Entry->TimerUpper32, Entry->TimerLower32);
+    TicksPerSecond = MetaData->TimerTicksPerSecond;
+    if (TicksPerSecond == 0)
+    {
+        TicksPerSecond = 1;
+    }
+
+    /* the trace time unit is microseconds, keep nanosecond resolution as the fraction */
+    Seconds     = Ticks / TicksPerSecond;
+    Nanoseconds = ((Ticks % TicksPerSecond) * 1000000000) / TicksPerSecond;
+
+    /* JSON numbers must not have leading zeros */
+    if (Seconds == 0)
+    {
+        snprintf(TimeBuf, sizeof(TimeBuf), "%lu.%03lu", (unsigned long)(Nanoseconds / 1000),
+                 (unsigned long)(Nanoseconds % 1000));
+    }
+    else
+    {
+        snprintf(TimeBuf, sizeof(TimeBuf), "%lu%06lu.%03lu", (unsigned long)Seconds,
+                 (unsigned long)(Nanoseconds / 1000), (unsigned long)(Nanoseconds % 1000));
+    }
+
+    Marker = Entry->Data & ~(1U << CFE_MISSION_ES_PERF_EXIT_BIT);
+    Name   = CFE_ES_PerfLogMarkerName(Marker);
+    if (Name == NULL)
+    {
+        snprintf(NameBuf, sizeof(NameBuf), "Marker%lu", (unsigned long)Marker);
+        Name = NameBuf;
+    }
+
+    /* entry and exit markers become the begin and end of a duration slice */
+    Len = snprintf(Buf, BufSize, ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":1,\"tid\":%lu,\"ts\":%s}", Name,
+                   (Entry->Data & (1U << CFE_MISSION_ES_PERF_EXIT_BIT)) ? 'E' : 'B', (unsigned long)TaskId, TimeBuf);
+
+    /* a truncated line is written as far as it goes */
+    if (Len < 0)
+    {
+        Len = 0;
+    }
+    else if (Len >= BufSize)
+    {
+        Len = BufSize - 1;
+    }
+
+    return Len;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_PerfStatsBin(uint32 Ticks)
+{
+    uint32 Log2;
+    uint32 Value;
+
+    if (Ticks < 4)
+    {
+        return Ticks;
+    }
+
+    /* find the highest bit set, then use the next two bits to pick one of 4 bins */
+    Log2  = 0;
+    Value = Ticks;
+    if (Value >= 0x10000)
+    {
+        Value >>= 16;
+        Log2 += 16;
+    }
+    if (Value >= 0x100)
+    {
+        Value >>= 8;
+        Log2 += 8;
+    }
+    if (Value >= 0x10)
+    {
+        Value >>= 4;
+        Log2 += 4;
+    }
+    if (Value >= 0x4)
+    {
+        Value >>= 2;
+        Log2 += 2;
+    }
+    if (Value >= 0x2)
+    {
+        Log2 += 1;
+    }
+
+    return ((Log2 - 1) * 4) + ((Ticks >> (Log2 - 2)) & 0x3);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_PerfStatsBinLimit(uint32 Bin)
+{
+    uint32 Shift;
+
+    if (Bin < 4)
+    {
+        return Bin;
+    }
+
+    /* one less than the start of the next bin, the last bin wraps to the 32 bit maximum */
+    Shift = (Bin / 4) - 1;
+    return (((uint32)5 + (Bin % 4)) << Shift) - 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfStatsAdd(uint32 Marker, uint32 EntryExit)
+{
+    CFE_ES_PerfStatsGlobal_t *Stats = &CFE_ES_Global.PerfStats;
+    CFE_ES_PerfStatsEntry_t * StatPtr;
+    CFE_ES_PerfMetaData_t *   MetaData;
+    osal_id_t                 OsTaskId;
+    osal_index_t              TaskIdx;
+    uint32                    Upper32;
+    uint32                    Lower32;
+    uint32                    NumEntries;
+    uint32                    i;
+    uint64                    Ticks;
+
+    /* an exit is timed before the lookup, so the lookup is not part of the measurement */
+    if (EntryExit != 0)
+    {
+        CFE_PSP_Get_Timebase(&Upper32, &Lower32);
+    }
+
+    OsTaskId = OS_TaskGetId();
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, OsTaskId, &TaskIdx) != OS_SUCCESS)
+    {
+        return;
+    }
+
+    StatPtr    = NULL;
+    NumEntries = CFE_ES_AtomicLoad32(&Stats->NumEntries);
+    for (i = 0; i < NumEntries; ++i)
+    {
+        if (Stats->Entries[i].Marker == Marker && Stats->Entries[i].TaskIdx == TaskIdx)
+        {
+            StatPtr = &Stats->Entries[i];
+            break;
+        }
+    }
+
+    if (StatPtr == NULL)
+    {
+        /* an exit without a recorded entry has nothing to measure */
+        if (EntryExit != 0)
+        {
+            return;
+        }
+
+        /* a full table stays full until the mask is changed, so there is nothing to claim */
+        if (CFE_ES_ATOMIC_LOCK_FREE && NumEntries >= CFE_MISSION_ES_PERF_MAX_STATS)
+        {
+            CFE_ES_AtomicIncrement32(&Stats->UntrackedCount);
+            return;
+        }
+
+        OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+
+        if (Stats->NumEntries < CFE_MISSION_ES_PERF_MAX_STATS)
+        {
+            StatPtr = &Stats->Entries[Stats->NumEntries];
+            memset(StatPtr, 0, sizeof(*StatPtr));
+            StatPtr->Marker   = Marker;
+            StatPtr->TaskIdx  = TaskIdx;
+            StatPtr->TaskId   = OsTaskId;
+            StatPtr->MinTicks = 0xFFFFFFFF;
+
+            /* the entry must be complete before lookups outside the lock can find it */
+            CFE_ES_AtomicStore32(&Stats->NumEntries, Stats->NumEntries + 1);
+        }
+        else
+        {
+            CFE_ES_AtomicIncrement32(&Stats->UntrackedCount);
+        }
+
+        OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+
+        if (StatPtr == NULL)
+        {
+            return;
+        }
+    }
+
+    if (EntryExit == 0)
+    {
+        /* an entry is timed last, so the lookup is not part of the measurement */
+        CFE_PSP_Get_Timebase(&StatPtr->EntryUpper32, &StatPtr->EntryLower32);
+        StatPtr->InEntry = true;
+        return;
+    }
+
+    if (!StatPtr->InEntry)
+    {
+        return;
+    }
+
+    StatPtr->InEntry = false;
+
+    MetaData = &CFE_ES_Global.ResetDataPtr->Perf.MetaData;
+    Ticks    = CFE_ES_PerfLogTimerTicks(MetaData, Upper32, Lower32) -
+            CFE_ES_PerfLogTimerTicks(MetaData, StatPtr->EntryUpper32, StatPtr->EntryLower32);
+    if (Ticks > 0xFFFFFFFF)
+    {
+        Ticks = 0xFFFFFFFF;
+    }
+
+    ++StatPtr->Count;
+    StatPtr->SumTicks += Ticks;
+    if (Ticks < StatPtr->MinTicks)
+    {
+        StatPtr->MinTicks = Ticks;
+    }
+    if (Ticks > StatPtr->MaxTicks)
+    {
+        StatPtr->MaxTicks = Ticks;
+    }
+    ++StatPtr->Histogram[CFE_ES_PerfStatsBin(Ticks)];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Changes the performance log state, if it is still OldState
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_PerfLogChangeState(CFE_ES_PerfData_t *Perf, uint32 OldState, uint32 NewState)
+{
+#if CFE_ES_ATOMIC_LOCK_FREE
+    CFE_ES_AtomicCompareExchange32(&Perf->MetaData.State, &OldState, NewState);
+#else
+    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+    if (Perf->MetaData.State == OldState)
+    {
+        Perf->MetaData.State = NewState;
+    }
     OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
+{
+    CFE_ES_PerfDataEntry_t * EntryData;
+    CFE_ES_PerfTaskBuffer_t *BufPtr;
+    CFE_ES_PerfTaskMap_t *   MapPtr;
+    CFE_ES_PerfData_t *      Perf;
+    uint32                   State;
+    uint32                   WriteCount;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    /* the latency statistics are kept for the selected markers whether or not the log is collecting */
+    if (Marker < CFE_MISSION_ES_PERF_MAX_IDS && CFE_ES_TEST_LONG_MASK(CFE_ES_Global.PerfStats.Mask, Marker))
+    {
+        CFE_ES_PerfStatsAdd(Marker, EntryExit);
+    }
+
+    /*
+     * If the global state is idle, exit immediately without locking or doing anything
+     */
+    if (CFE_ES_AtomicLoad32(&Perf->MetaData.State) == CFE_ES_PERF_IDLE)
+    {
+        return;
+    }
+
+    /* if marker is out of range... */
+    if (Marker >= CFE_MISSION_ES_PERF_MAX_IDS)
+    {
+        /* if marker has not been reported previously ... */
+        if (Perf->MetaData.InvalidMarkerReported == false)
+        {
+            CFE_ES_WriteToSysLog("%s: Invalid performance marker %d,max is %d\n", __func__, (unsigned int)Marker,
+                                 (CFE_MISSION_ES_PERF_MAX_IDS - 1));
+            Perf->MetaData.InvalidMarkerReported = true;
+        }
+
+        return;
+    }
+
+    /*
+     * check if this ID is filtered.
+     * Normally masks should NOT be changed while perf log is active / non-idle,
+     * so although this is reading a global it should be constant.
+     */
+    if (!CFE_ES_TEST_LONG_MASK(Perf->MetaData.FilterMask, Marker))
+    {
+        return;
+    }
+
+    /*
+     * Each task writes only to its own buffer, so no lock is needed to
+     * record the entry.  Only the first entry of a run claims the buffer.
+     * A buffer is only returned while the log is still collecting in the
+     * run it was claimed in.
+     */
+    BufPtr = CFE_ES_PerfLogGetTaskBuffer(Perf, &MapPtr);
+    if (BufPtr == NULL)
+    {
+        return;
+    }
+
+    /*
+     * when streaming, entries that have not been written out yet are never overwritten.
+     * Only this task changes the write count, the read count is published by the reader.
+     */
+    WriteCount = BufPtr->WriteCount;
+    if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_STREAM &&
+        (WriteCount - CFE_ES_AtomicLoad32(&BufPtr->ReadCount)) >= CFE_ES_PERF_TASK_BUFFER_SIZE)
+    {
+        ++BufPtr->OverflowCount;
+        CFE_ES_AtomicStore32(&MapPtr->Writing, 0);
+        return;
+    }
+
+    /* write the entry into the next slot, the newest entries are kept once the buffer wraps */
+    EntryData       = &BufPtr->Entries[WriteCount % CFE_ES_PERF_TASK_BUFFER_SIZE];
+    EntryData->Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
+    CFE_PSP_Get_Timebase(&EntryData->TimerUpper32, &EntryData->TimerLower32);
+
+    /* publish the entry to the reader only once it is complete */
+    CFE_ES_AtomicStore32(&BufPtr->WriteCount, WriteCount + 1);
+
+    /*
+     * Trigger handling.  Any task that hits a trigger or fills its share of
+     * the buffer may change the state, so each change is made only if the
+     * state is still the one this task saw.  This keeps a task that saw
+     * WAITING from undoing a stop or a later trigger made by another task.
+     * Each task counts its own entries after the trigger, and collection stops
+     * once any task has used up its share of the buffer for the selected mode.
+     */
+    State = CFE_ES_AtomicLoad32(&Perf->MetaData.State);
+    if (State == CFE_ES_PERF_WAITING_FOR_TRIGGER)
+    {
+        if (CFE_ES_TEST_LONG_MASK(Perf->MetaData.TriggerMask, Marker))
+        {
+            CFE_ES_PerfLogChangeState(Perf, State, CFE_ES_PERF_TRIGGERED);
+            State = CFE_ES_AtomicLoad32(&Perf->MetaData.State);
+        }
+    }
+
+    /* triggered */
+    if (State == CFE_ES_PERF_TRIGGERED)
+    {
+        BufPtr->TriggerCount++;
+        if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_START)
+        {
+            if (BufPtr->TriggerCount >= CFE_ES_PERF_TASK_BUFFER_SIZE)
+            {
+                CFE_ES_PerfLogChangeState(Perf, State, CFE_ES_PERF_IDLE);
+            }
+        }
+        else if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_CENTER)
+        {
+            if (BufPtr->TriggerCount >= CFE_ES_PERF_TASK_BUFFER_SIZE / 2)
+            {
+                CFE_ES_PerfLogChangeState(Perf, State, CFE_ES_PERF_IDLE);
+            }
+        }
+        else if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_END)
+        {
+            CFE_ES_PerfLogChangeState(Perf, State, CFE_ES_PERF_IDLE);
+        }
+    }
+
+    CFE_ES_AtomicStore32(&MapPtr->Writing, 0);
 }
@@ -36,11 +36,34 @@
 #include "common_types.h"
 #include "osconfig.h"
 #include "cfe_es_api_typedefs.h"
+#include "cfe_es_msg.h"
+#include "cfe_fs_api_typedefs.h"
+#include "cfe_es_perfdata_typedef.h"
 
 /*
 **  Defines
 */
 
+/**
+ * @brief Size of the text buffer for one line of a TRACE_JSON performance log
+ */
+#define CFE_ES_PERF_TRACE_LINE_SIZE 192
+
+/**
+ * @brief Number of histogram bins kept for each performance marker statistic
+ *
+ * Durations below 4 ticks have a bin each, above that each power of two
+ * is split into 4 bins, which covers the full 32 bit range in 124 bins.
+ */
+#define CFE_ES_PERF_STATS_HIST_BINS 124
+
+/**
+ * @brief Number of 1 ms delays the start command waits for tasks still recording an entry
+ *
+ * Recording an entry takes far less than a millisecond, so only a task that
+ * was preempted in the middle of it can hold up the start command.
+ */
+#define CFE_ES_PERF_WRITER_WAIT_LIMIT 100
 
 /** @defgroup CFEESPerf Performance Analyzer Data Structures
  * @{
@@ -71,12 +94,12 @@ typedef enum
     CFE_ES_PerfDumpState_INIT,                /* Placeholder for entry/init, no action */
     CFE_ES_PerfDumpState_OPEN_FILE,           /* Opening of the output file */
     CFE_ES_PerfDumpState_DELAY,               /* Wait-state to ensure in-progress writes are finished */
-    CFE_ES_PerfDumpState_LOCK_DATA,           /* Locking of the global data structure */
+    CFE_ES_PerfDumpState_MERGE_SETUP,         /* Count the entries in each task buffer to be merged */
     CFE_ES_PerfDumpState_WRITE_FS_HDR,        /* Write the CFE FS file header */
     CFE_ES_PerfDumpState_WRITE_PERF_METADATA, /* Write the Perf global metadata */
     CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES,  /* Write the Perf Log entries (throttled) */
+    CFE_ES_PerfDumpState_WRITE_TRAILER,       /* Write the end of the file, for text formats */
     CFE_ES_PerfDumpState_CLEANUP,             /* Placeholder for cleanup, no action */
-    CFE_ES_PerfDumpState_UNLOCK_DATA,         /* Unlocking of the global data structure */
     CFE_ES_PerfDumpState_CLOSE_FILE,          /* Closing of the output file */
     CFE_ES_PerfDumpState_MAX                  /* Placeholder for last state, no action, always last */
 } CFE_ES_PerfDumpState_t;
@@ -106,10 +129,119 @@ typedef struct
     osal_id_t FileDesc;                      /* file descriptor for writing */
     uint32    WorkCredit;                    /* accumulator based on the passage of time */
     uint32    StateCounter;                  /* number of blocks/items left in current state */
-    uint32    DataPos;                       /* last position within the Perf Log */
     size_t    FileSize;                      /* Total file size, for progress reporting in telemetry */
+
+    CFE_ES_PerfDumpFormat_Enum_t DumpFormat;                               /* file format from dump command */
+    char                         TextBuffer[CFE_ES_PERF_TRACE_LINE_SIZE]; /* line being written, for text formats */
+
+    uint32 MergePos[CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS]; /* next entry to write from each task buffer */
+    uint32 MergeEnd[CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS]; /* end of the entries in each task buffer */
 } CFE_ES_PerfDumpGlobal_t;
 
+/**
+ * @brief Performance log stream state structure
+ *
+ * This structure is stored in global memory and keeps the state of a
+ * STREAM mode collection, from the start command until the final file
+ * is written after the stop command.
+ *
+ * While a collection is streaming, the ES background task periodically takes
+ * a snapshot of the unread entries in each task buffer and submits a request
+ * to the FS background file writer to write them to the next file of the
+ * rolling set.  The entries are released back to the writers once the file
+ * is finished.
+ */
+typedef struct
+{
+    CFE_FS_FileWriteMetaData_t FileWrite; /**< FS state data - must be first */
+
+    bool   Active;       /**< Whether a STREAM mode collection is in progress */
+    uint32 ElapsedTime;  /**< Time since the last file was requested, in milliseconds */
+    uint32 FileIndex;    /**< Index of the next file within the rolling set */
+    uint32 FileCount;    /**< Number of files written in this collection */
+    uint32 SegmentCount; /**< Number of entries in the file being written */
+    uint32 DiscardCount; /**< Entries discarded because a file could not be written */
+
+    CFE_ES_PerfMetaData_t  MetaData;    /**< Metadata record of the file being written */
+    CFE_ES_PerfDataEntry_t EntryBuffer; /**< Temp holding area for record to write */
+
+    uint32 MergePos[CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS]; /**< next entry to write from each task buffer */
+    uint32 MergeEnd[CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS]; /**< end of the entries in each task buffer */
+} CFE_ES_PerfStreamGlobal_t;
+
+/**
+ * @brief Performance marker name table entry
+ *
+ * Used to name the markers when writing the performance log in
+ * the TRACE_JSON format, see #CFE_PLATFORM_ES_PERF_MARKER_NAMES
+ */
+typedef struct
+{
+    uint32      Marker; /* marker ID */
+    const char *Name;   /* name to show in the trace */
+} CFE_ES_PerfMarkerName_t;
+
+/**
+ * @brief Performance log task buffer assignment
+ *
+ * One entry per OSAL task, indexed by the OSAL task array index.  Each
+ * entry is only written by the task it belongs to, which allows a task
+ * to find its own buffer without locking.  The assignment is only valid
+ * while the Generation matches the current collection run.
+ *
+ * The Writing flag is set while the task records an entry, so that the
+ * start command can wait for the entry before giving the buffer to
+ * another task.
+ */
+typedef struct
+{
+    uint32 Generation;   /* collection run the assignment belongs to */
+    uint32 BufferIdx;    /* assigned task buffer, CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS if none was free */
+    uint32 DroppedCount; /* entries not recorded because no task buffer was free */
+    uint32 Writing;      /* nonzero while the task is recording an entry */
+} CFE_ES_PerfTaskMap_t;
+
+/**
+ * @brief Entry to exit latency statistics of one marker in one task
+ *
+ * Each entry is only updated by the task it belongs to, so no lock is
+ * needed to update it.  Durations are kept in timer ticks and converted
+ * when the statistics are telemetered.
+ */
+typedef struct
+{
+    uint32    Marker;       /* marker ID */
+    uint32    TaskIdx;      /* OSAL task array index of the task */
+    osal_id_t TaskId;       /* OSAL task ID of the task */
+    bool      InEntry;      /* set between an entry marker and its exit marker */
+    uint32    EntryUpper32; /* time of the last entry marker, upper word */
+    uint32    EntryLower32; /* time of the last entry marker, lower word */
+    uint32    Count;        /* number of entry/exit pairs measured */
+    uint32    MinTicks;     /* shortest duration */
+    uint32    MaxTicks;     /* longest duration */
+    uint64    SumTicks;     /* total duration, for the mean */
+    uint32    Histogram[CFE_ES_PERF_STATS_HIST_BINS]; /* number of durations in each bin */
+} CFE_ES_PerfStatsEntry_t;
+
+/**
+ * @brief Performance marker latency statistics
+ *
+ * Entries are claimed under the PerfDataMutex the first time a task logs a
+ * selected marker, and are only added to, so a task can find its entry without
+ * locking.  Once all entries are in use, the markers that are not measured are
+ * only counted, without the lock where the counter can be updated atomically.
+ * Changing the mask clears all entries; an update made by a task at the same
+ * time may be lost.
+ */
+typedef struct
+{
+    uint32 Mask[CFE_ES_PERF_32BIT_WORDS_IN_MASK]; /* markers to keep statistics for */
+
+    uint32                  NumEntries;     /* entries claimed so far, published with a release store */
+    uint32                  UntrackedCount; /* markers not measured because all entries were in use, atomic */
+    CFE_ES_PerfStatsEntry_t Entries[CFE_MISSION_ES_PERF_MAX_STATS];
+} CFE_ES_PerfStatsGlobal_t;
+
 /**
  * @brief Helper function to obtain the progress/remaining items from
  * the background task that is writing the performance log data
@@ -137,6 +269,182 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void);
  */
 bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Stream performance data to a rolling set of files
+ *
+ * Implementation of the background job for the STREAM mode.  Each time
+ * the collected entries need to be written out, this requests the FS
+ * background file writer to write them to the next file of the set.
+ * After the stop command, the remaining entries are written and the
+ * job becomes idle.
+ */
+bool CFE_ES_RunPerfLogStream(uint32 ElapsedTime, void *Arg);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Data getter for the performance log stream files
+ *
+ * Record 0 is the metadata, followed by the entries of the
+ * snapshot in time order.
+ *
+ * @sa CFE_FS_FileWriteGetData_t
+ */
+bool CFE_ES_PerfStreamFileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Event handler for the performance log stream files
+ *
+ * Releases the entries of the snapshot back to the task buffers
+ * whether or not the file was written, and advances to the next
+ * file of the rolling set.
+ *
+ * @sa CFE_FS_FileWriteOnEvent_t
+ */
+void CFE_ES_PerfStreamFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
+                                       size_t BlockSize, size_t Position);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the performance log buffer of the calling task
+ *
+ * Looks up the buffer assigned to the calling task in the current collection
+ * run, claiming a free buffer on the first call of a run.  Only the claim takes
+ * the PerfDataMutex; every later call for the same run is lock-free.
+ *
+ * When a buffer is returned the Writing flag of the task is set, and the caller
+ * must clear it once the entry is recorded.
+ *
+ * @param[in]  Perf    Pointer to the performance log data
+ * @param[out] MapPtr  Set to the buffer assignment of the calling task, when a buffer is returned
+ * @returns Pointer to the task buffer, or NULL if no buffer is available or collection stopped
+ */
+CFE_ES_PerfTaskBuffer_t *CFE_ES_PerfLogGetTaskBuffer(CFE_ES_PerfData_t *Perf, CFE_ES_PerfTaskMap_t **MapPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Count the entries held in the performance log task buffers
+ *
+ * Only buffers claimed in the current collection run are counted, and in
+ * the STREAM mode only the entries that have not been written out yet.
+ * Optionally also reports the range of entries held in each buffer, for merging.
+ *
+ * @param[out] PosArray  First entry held in each task buffer, may be NULL
+ * @param[out] EndArray  End of the entries held in each task buffer, may be NULL
+ * @returns Total number of entries held
+ */
+uint32 CFE_ES_PerfLogCountEntries(uint32 *PosArray, uint32 *EndArray);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Count the performance log entries dropped in the current run
+ *
+ * Entries are dropped when a task logs a marker after all task
+ * buffers have been claimed by other tasks, or in the STREAM mode
+ * when a task buffer is full of entries not yet written out.
+ *
+ * @returns Number of entries dropped
+ */
+uint32 CFE_ES_PerfLogCountDropped(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the next performance log entry in time order
+ *
+ * Picks the oldest remaining entry across all task buffers being
+ * merged and advances past it.
+ *
+ * @param[inout] PosArray  Next entry to merge from each task buffer
+ * @param[in]    EndArray  End of the entries to merge from each task buffer
+ * @param[out]   BufferIdx Task buffer the entry came from, may be NULL
+ * @returns Pointer to the entry, or NULL if no entries remain
+ */
+const CFE_ES_PerfDataEntry_t *CFE_ES_PerfLogMergeNext(uint32 *PosArray, const uint32 *EndArray, uint32 *BufferIdx);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Look up the name of a performance marker
+ *
+ * @param[in] Marker  Marker ID, without the exit bit
+ * @returns Name from #CFE_PLATFORM_ES_PERF_MARKER_NAMES, or NULL if not listed
+ */
+const char *CFE_ES_PerfLogMarkerName(uint32 Marker);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Format the track of a task buffer as a Trace Event JSON line
+ *
+ * The track is named after the task that claimed the buffer.  Every
+ * line after the start of the file begins with the separating comma.
+ *
+ * @param[out] Buf     Buffer to hold the line
+ * @param[in]  BufSize Size of the buffer
+ * @param[in]  TaskId  OSAL task ID of the task, as an integer
+ * @returns Length of the line
+ */
+size_t CFE_ES_PerfTraceFormatTrack(char *Buf, size_t BufSize, uint32 TaskId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Format a performance log entry as a Trace Event JSON line
+ *
+ * Entry markers begin a duration slice on the track of the task, and
+ * exit markers end it.  The time stamp is converted to microseconds
+ * using the timer rate in the metadata.
+ *
+ * @param[out] Buf       Buffer to hold the line
+ * @param[in]  BufSize   Size of the buffer
+ * @param[in]  MetaData  Performance log metadata
+ * @param[in]  Entry     Entry to format
+ * @param[in]  TaskId    OSAL task ID of the task that logged the entry, as an integer
+ * @returns Length of the line
+ */
+size_t CFE_ES_PerfTraceFormatEntry(char *Buf, size_t BufSize, const CFE_ES_PerfMetaData_t *MetaData,
+                                   const CFE_ES_PerfDataEntry_t *Entry, uint32 TaskId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the full timer count of a performance log time stamp
+ *
+ * @param[in] MetaData  Metadata holding the timer rollover value
+ * @param[in] Upper32   Upper word of the time stamp
+ * @param[in] Lower32   Lower word of the time stamp
+ * @returns Number of timer ticks
+ */
+uint64 CFE_ES_PerfLogTimerTicks(const CFE_ES_PerfMetaData_t *MetaData, uint32 Upper32, uint32 Lower32);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Update the latency statistics of a performance marker
+ *
+ * Called from CFE_ES_PerfLogAdd for markers selected by the statistics
+ * mask.  An entry marker records the time, and the matching exit marker
+ * of the same task adds the duration to the statistics.
+ *
+ * @param[in] Marker     Marker ID
+ * @param[in] EntryExit  0 for an entry marker, 1 for an exit marker
+ */
+void CFE_ES_PerfStatsAdd(uint32 Marker, uint32 EntryExit);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the histogram bin of a duration
+ *
+ * @param[in] Ticks  Duration in timer ticks
+ * @returns Bin index, less than #CFE_ES_PERF_STATS_HIST_BINS
+ */
+uint32 CFE_ES_PerfStatsBin(uint32 Ticks);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the longest duration that falls in a histogram bin
+ *
+ * @param[in] Bin  Bin index
+ * @returns Upper limit of the bin in timer ticks
+ */
+uint32 CFE_ES_PerfStatsBinLimit(uint32 Bin);
+
 /** @} */
 
 #endif /* CFE_ES_PERF_H */
@@ -0,0 +1,220 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+**  File:
+**    cfe_es_poolprof.c
+**
+**  Purpose:
+**    This file implements writing the size profiles of the ES memory pools
+**    and the CDS pool to a file, for sizing the block size lists of the pools.
+**
+**  References:
+**     Flight Software Branch C Coding Standard Version 1.0a
+**     cFE Flight Software Application Developers Guide
+**
+**  Notes:
+**
+*/
+
+/*
+** Required header files.
+*/
+#include "cfe_es_module_all.h"
+
+#include <string.h>
+#include <stdio.h>
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_WritePoolProfileCmd(const CFE_ES_WritePoolProfileCmd_t *data)
+{
+    const CFE_ES_FileNameCmd_Payload_t *CmdPtr = &data->Payload;
+    CFE_ES_PoolProfileDumpState_t *     StatePtr;
+    int32                               Status;
+
+    StatePtr = &CFE_ES_Global.PoolProfile.BackgroundDumpState;
+
+    /* check if pending before overwriting fields in the structure */
+    if (CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite))
+    {
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+    else
+    {
+        /* Reset the entire state object (just for good measure, ensure no stale data) */
+        memset(StatePtr, 0, sizeof(*StatePtr));
+
+        StatePtr->FileWrite.FileSubType = CFE_FS_SubType_ES_POOLPROF;
+        snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), CFE_ES_POOLPROF_LOG_DESC);
+
+        StatePtr->FileWrite.GetData = CFE_ES_BackgroundPoolProfileDataGetter;
+        StatePtr->FileWrite.OnEvent = CFE_ES_BackgroundPoolProfileEventHandler;
+
+        /*
+        ** Copy the filename into local buffer with default name/path/extension if not specified
+        */
+        Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName, CmdPtr->FileName,
+                                             sizeof(StatePtr->FileWrite.FileName), sizeof(CmdPtr->FileName),
+                                             CFE_PLATFORM_ES_DEFAULT_POOL_PROFILE_FILE,
+                                             CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                             CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_FS_BackgroundFileDumpRequest(&StatePtr->FileWrite);
+        }
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        if (Status == CFE_STATUS_REQUEST_ALREADY_PENDING)
+        {
+            CFE_EVS_SendEvent(CFE_ES_POOLPROF_PENDING_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Pool profile write already in progress");
+        }
+        else
+        {
+            CFE_EVS_SendEvent(CFE_ES_POOLPROF_ERR_EID, CFE_EVS_EventType_ERROR, "Error creating file, RC = %d",
+                              (int)Status);
+        }
+
+        /* background dump did not start, consider this an error */
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+    }
+    else
+    {
+        CFE_ES_Global.TaskData.CommandCounter++;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_BackgroundPoolProfileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_ES_PoolProfileDumpState_t *   StatePtr;
+    CFE_ES_PoolProfile_FileEntry_t *  FileBufferPtr;
+    CFE_ES_MemPoolRecord_t *          MemPoolRecPtr;
+    CFE_ES_GenPoolRecord_t *          GenPoolRecPtr;
+    const CFE_ES_GenPoolProfileBin_t *BinPtr;
+    uint32                            PoolIdx;
+    uint32                            Bin;
+    uint32                            PoolId;
+
+    StatePtr      = (CFE_ES_PoolProfileDumpState_t *)Meta;
+    FileBufferPtr = &StatePtr->EntryBuffer;
+
+    /* each memory pool slot has its bins, followed by the bins of the CDS pool */
+    PoolIdx = RecordNum / CFE_ES_POOLPROF_HIST_BINS;
+    Bin     = RecordNum % CFE_ES_POOLPROF_HIST_BINS;
+
+    *Buffer  = NULL;
+    *BufSize = 0;
+
+    GenPoolRecPtr = NULL;
+    PoolId        = 0;
+    if (PoolIdx < CFE_PLATFORM_ES_MAX_MEMORY_POOLS)
+    {
+        MemPoolRecPtr = &CFE_ES_Global.MemPoolTable[PoolIdx];
+        if (CFE_ES_MemPoolRecordIsUsed(MemPoolRecPtr))
+        {
+            GenPoolRecPtr = &MemPoolRecPtr->Pool;
+            PoolId        = CFE_RESOURCEID_TO_ULONG(CFE_ES_MemPoolRecordGetID(MemPoolRecPtr));
+        }
+    }
+    else if (PoolIdx == CFE_PLATFORM_ES_MAX_MEMORY_POOLS)
+    {
+        GenPoolRecPtr = &CFE_ES_Global.CDSVars.Pool;
+    }
+
+    /* pools without a profile and bins without requests leave a hole, which is skipped */
+    if (GenPoolRecPtr != NULL && GenPoolRecPtr->Profile != NULL)
+    {
+        BinPtr = &GenPoolRecPtr->Profile->Bins[Bin];
+        if (BinPtr->RequestCount != 0 || BinPtr->FailCount != 0)
+        {
+            memset(FileBufferPtr, 0, sizeof(*FileBufferPtr));
+
+            FileBufferPtr->PoolId       = PoolId;
+            FileBufferPtr->PoolSize     = GenPoolRecPtr->PoolTotalSize;
+            FileBufferPtr->AlignSize    = GenPoolRecPtr->AlignMask + 1;
+            FileBufferPtr->BinIndex     = Bin;
+            FileBufferPtr->BinMinSize   = CFE_ES_GenPoolProfileBinMinSize(Bin);
+            FileBufferPtr->MaxSize      = BinPtr->MaxSize;
+            FileBufferPtr->RequestCount = BinPtr->RequestCount;
+            FileBufferPtr->FailCount    = BinPtr->FailCount;
+            FileBufferPtr->InUse        = BinPtr->InUse;
+            FileBufferPtr->PeakInUse    = BinPtr->PeakInUse;
+
+            *Buffer  = FileBufferPtr;
+            *BufSize = sizeof(*FileBufferPtr);
+        }
+    }
+
+    /* Check for EOF (last entry)  */
+    return (RecordNum >= (((CFE_PLATFORM_ES_MAX_MEMORY_POOLS + 1) * CFE_ES_POOLPROF_HIST_BINS) - 1));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_BackgroundPoolProfileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status,
+                                              uint32 RecordNum, size_t BlockSize, size_t Position)
+{
+    CFE_ES_PoolProfileDumpState_t *StatePtr;
+
+    StatePtr = (CFE_ES_PoolProfileDumpState_t *)Meta;
+
+    /* Note that this runs in the context of ES background task (file writer background job) */
+    switch (Event)
+    {
+        case CFE_FS_FileWriteEvent_COMPLETE:
+            CFE_EVS_SendEvent(CFE_ES_POOLPROF_EID, CFE_EVS_EventType_DEBUG, "%s written:Size=%lu",
+                              StatePtr->FileWrite.FileName, (unsigned long)Position);
+            break;
+
+        case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
+        case CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_FILEWRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "File write,byte cnt err,file %s,request=%u,actual=%u", StatePtr->FileWrite.FileName,
+                              (int)BlockSize, (int)Status);
+            break;
+
+        case CFE_FS_FileWriteEvent_CREATE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_POOLPROF_ERR_EID, CFE_EVS_EventType_ERROR, "Error creating file %s, RC = %d",
+                              StatePtr->FileWrite.FileName, (int)Status);
+            break;
+
+        default:
+            /* unhandled event - ignore */
+            break;
+    }
+}
@@ -0,0 +1,95 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Purpose: Pool size profiler data structures
+ *
+ * Design Notes:
+ *   The counters themselves are part of the generic pool, see
+ *   CFE_ES_GenPoolEnableProfile().  This keeps the storage for the
+ *   profiles of the ES pools, and writes them to a file.  The profiles
+ *   are read without locking, so an entry that is being updated at that
+ *   moment may be slightly inconsistent.
+ *
+ * References:
+ *
+ */
+
+#ifndef CFE_ES_POOLPROF_H
+#define CFE_ES_POOLPROF_H
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "cfe_platform_cfg.h"
+#include "cfe_fs_api_typedefs.h"
+#include "cfe_es_generic_pool.h"
+#include "cfe_es_poolprof_typedef.h"
+
+/*
+** Typedefs
+*/
+
+/*
+ * Background pool profile dump state structure
+ */
+typedef struct
+{
+    CFE_FS_FileWriteMetaData_t     FileWrite;   /**< FS state data - must be first */
+    CFE_ES_PoolProfile_FileEntry_t EntryBuffer; /**< Temp holding area for record to write */
+} CFE_ES_PoolProfileDumpState_t;
+
+/*
+ * Pool profiler global data
+ */
+typedef struct
+{
+#if (CFE_PLATFORM_ES_POOL_SIZE_PROFILE == 1)
+    /* the profiles are only allocated when they are used */
+    CFE_ES_GenPoolProfile_t MemPools[CFE_PLATFORM_ES_MAX_MEMORY_POOLS]; /**< Profile of each memory pool slot */
+    CFE_ES_GenPoolProfile_t CDSPool;                                    /**< Profile of the CDS pool */
+#endif
+
+    CFE_ES_PoolProfileDumpState_t BackgroundDumpState;
+} CFE_ES_PoolProfileGlobal_t;
+
+/*
+** Function prototypes
+*/
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Background file write data getter for the pool profile
+ *
+ * Gets the entry of a single size bin of a pool to write to a file.
+ */
+bool CFE_ES_BackgroundPoolProfileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Background file write event handler for the pool profile
+ *
+ * Report events during writing the pool profile to a file
+ */
+void CFE_ES_BackgroundPoolProfileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status,
+                                              uint32 RecordNum, size_t BlockSize, size_t Position);
+
+#endif /* CFE_ES_POOLPROF_H */
@@ -80,6 +80,11 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
      */
     memset(&CFE_ES_Global, 0, sizeof(CFE_ES_Global));
 
+    /*
+    ** Take the reference time of the startup timeline
+    */
+    CFE_ES_TimelineStart();
+
     /*
     ** Indicate that the CFE is the earliest initialization state
     */
@@ -151,6 +156,18 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
         return;
     }
 
+    /*
+    ** Create the semaphore that tasks waiting for the system state block on.
+    ** This is not fatal, without it CFE_ES_WaitForSystemState() polls the state.
+    */
+    OsStatus = OS_CountSemCreate(&CFE_ES_Global.SystemStateSemId, "ES_STATE_SEM", 0, 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_SysLogWrite_Unsync("%s: Error: ES System State semaphore could not be created. RC=%ld\n", __func__,
+                                  (long)OsStatus);
+        CFE_ES_Global.SystemStateSemId = OS_OBJECT_ID_UNDEFINED;
+    }
+
     /*
     ** Announce the startup
     */
@@ -159,6 +176,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     /*
     ** Create and Mount the filesystems needed
     */
+    CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_FILESYSTEMS);
     CFE_ES_InitializeFileSystems(StartType);
 
     /*
@@ -178,7 +196,8 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     ** Indicate that the CFE core is now starting up / going multi-threaded
     */
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering CORE_STARTUP state\n", __func__);
-    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_STARTUP;
+    CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_CORE_STARTUP);
+    CFE_ES_SetSystemState(CFE_ES_SystemState_CORE_STARTUP);
 
     /*
     ** Create the tasks, OS objects, and initialize hardware
@@ -189,7 +208,8 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     ** Indicate that the CFE core is ready
     */
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering CORE_READY state\n", __func__);
-    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
+    CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_CORE_READY);
+    CFE_ES_SetSystemState(CFE_ES_SystemState_CORE_READY);
 
     /*
     ** Start the cFE Applications from the disk using the file
@@ -197,6 +217,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     ** ( defined in the cfe_platform_cfg.h file )
     */
     CFE_ES_StartApplications(StartType, StartFilePath);
+    CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_APPS_LOADED);
 
     /*
      * Wait for applications to be in at least "LATE_INIT"
@@ -211,7 +232,8 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     }
 
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering APPS_INIT state\n", __func__);
-    CFE_ES_Global.SystemState = CFE_ES_SystemState_APPS_INIT;
+    CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_APPS_INIT);
+    CFE_ES_SetSystemState(CFE_ES_SystemState_APPS_INIT);
 
     /*
      * Wait for applications to be "RUNNING" before moving to operational system state.
@@ -229,7 +251,33 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     ** Startup is fully complete
     */
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering OPERATIONAL state\n", __func__);
-    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+    CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_OPERATIONAL);
+    CFE_ES_SetSystemState(CFE_ES_SystemState_OPERATIONAL);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_SetSystemState(uint32 SystemState)
+{
+    /*
+     * Waiters check the state and register under the same lock,
+     * so every task that saw the old state is given the semaphore
+     */
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    CFE_ES_Global.SystemState = SystemState;
+
+    while (CFE_ES_Global.SystemStateWaiters > 0)
+    {
+        OS_CountSemGive(CFE_ES_Global.SystemStateSemId);
+        --CFE_ES_Global.SystemStateWaiters;
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
 }
 
 /*----------------------------------------------------------------
@@ -300,9 +348,39 @@ void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 Bo
          */
         return;
     }
+    else if ((ResetDataAddr % sizeof(uint64)) != 0)
+    {
+        /*
+        ** The system log state at the start of the Reset Area is updated
+        ** with 64 bit atomic operations, which need it to be aligned
+        */
+        OS_printf("ES Startup: Error: ES Reset area at 0x%lx is not aligned to %d bytes.\n",
+                  (unsigned long)ResetDataAddr, (int)sizeof(uint64));
+        /*
+        ** Delay to allow the message to be read
+        */
+        OS_TaskDelay(CFE_ES_PANIC_DELAY);
+
+        /*
+        ** cFE Cannot continue to start up.
+        */
+        CFE_PSP_Panic(CFE_PSP_PANIC_MEMORY_ALLOC);
+
+        /*
+         * Normally unreachable, except in UT where
+         * CFE_PSP_Panic is a stub that may return
+         */
+        return;
+    }
 
     CFE_ES_Global.ResetDataPtr = (CFE_ES_ResetData_t *)ResetDataAddr;
 
+    /*
+    ** Drop any syslog appends that were in progress when the reset occurred,
+    ** before anything else is written to the log.
+    */
+    CFE_ES_SysLogRecover();
+
     /*
     ** Record the BootSource (bank) so it will be valid in the ER log entries.
     */
@@ -760,6 +838,8 @@ void CFE_ES_CreateObjects(void)
                 */
                 if (AppRecPtr != NULL)
                 {
+                    CFE_ES_TimelineAddModule(PendingAppId, AppRecPtr->AppName, CFE_ES_TimelineRecordType_CORE_APP);
+
                     /*
                     ** Start the core app main task
                     ** (core apps are already in memory - no loading needed)
@@ -767,6 +847,10 @@ void CFE_ES_CreateObjects(void)
                     ReturnCode = CFE_ES_StartAppTask(
                         &AppRecPtr->MainTaskId, AppRecPtr->AppName, CFE_ES_ObjectTable[i].FuncPtrUnion.MainTaskPtr,
                         &AppRecPtr->StartParams.MainTaskInfo, CFE_ES_APPID_C(PendingAppId));
+                    if (ReturnCode == CFE_SUCCESS)
+                    {
+                        CFE_ES_TimelineMarkModule(PendingAppId, CFE_ES_TimelineMilestone_STARTED);
+                    }
 
                     /*
                      * Finalize data in the app table entry, which must be done under lock.
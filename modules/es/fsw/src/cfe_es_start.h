@@ -117,4 +117,15 @@ void CFE_ES_InitializeFileSystems(uint32 StartType);
  */
 void CFE_ES_SetupPerfVariables(uint32 ResetType);
 
+/*
+ * Name: CFE_ES_SetSystemState
+ *
+ * Purpose: This function advances the system state, and wakes all of the
+ *          tasks blocked in CFE_ES_WaitForSystemState().
+ *
+ * Assumptions and Notes: This gets called from CFE_ES_Main() at startup,
+ * once the ES shared data mutex has been created.
+ */
+void CFE_ES_SetSystemState(uint32 SystemState);
+
 #endif /* CFE_ES_START_H */
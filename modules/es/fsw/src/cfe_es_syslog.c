@@ -41,9 +41,13 @@
 **     to call B_Unsync() while A_Unsync() is executing or vice-versa.  The external
 **     lock must wait until A_Unsync() finishes before calling B_Unsync().
 **
-**     The expectation is that the required level of synchronization can be achieved
-**     using the existing ES shared data lock.  However, if it becomes necessary, this
-**     could be replaced with a finer grained syslog-specific lock.
+**     The exceptions are CFE_ES_SysLogAppend(), CFE_ES_SysLogClear() and
+**     CFE_ES_SysLogReadStart(), which update the state of the log atomically.
+**     Appends reserve their space in the log, copy the message in, and then mark
+**     the append as completed.  Readers only see the log as it was when the last
+**     append in progress was completed, so a partially copied message is never read.
+**     If the platform cannot update the state atomically (see cfe_es_atomic.h),
+**     the ES shared data lock is used for these as well.
 */
 
 /*
@@ -54,229 +58,1345 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <ctype.h>
 
+/*
+ * The state words of the log are updated with 64 bit atomic operations, which
+ * need them to be naturally aligned.  The reset area itself is checked at startup.
+ */
+CompileTimeAssert((offsetof(CFE_ES_ResetData_t, SystemLogState) % sizeof(uint64)) == 0, SystemLogStateAlign);
+CompileTimeAssert((offsetof(CFE_ES_ResetData_t, SystemLogCommitted) % sizeof(uint64)) == 0, SystemLogCommittedAlign);
+
+/*
+ * Maximum length of one conversion specification in a binary syslog record
+ */
+#define CFE_ES_SYSLOG_MAX_SPEC_LEN 32
+
+/*
+ * Classes of the argument of a conversion specification
+ */
+typedef enum
+{
+    CFE_ES_SysLogArg_NONE, /* "%%", without an argument */
+    CFE_ES_SysLogArg_SIGNED,
+    CFE_ES_SysLogArg_UNSIGNED,
+    CFE_ES_SysLogArg_FLOAT,
+    CFE_ES_SysLogArg_CHAR,
+    CFE_ES_SysLogArg_STRING,
+    CFE_ES_SysLogArg_POINTER,
+    CFE_ES_SysLogArg_COUNT /* "%n", which is dropped */
+} CFE_ES_SysLogArg_t;
+
+/*
+ * Value of one argument of a binary syslog record
+ */
+typedef union
+{
+    int64       Signed;
+    uint64      Unsigned;
+    double      Float;
+    const char *String;
+} CFE_ES_SysLogArgValue_t;
+
 /*******************************************************************
  *
- * Non-synchronized helper functions
+ * Non-synchronized helper functions
+ *
+ * An external mutex be held while calling any function marked "Unsync"
+ * These helper functions are local to the ES subsystem and must _NOT_
+ * be exposed to the public API.
+ *
+ * For external access, a public wrapper API must first acquire the
+ * necessary mutex before calling any function marked as "Unsync"
+ *
+ *******************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Makes a state of the log with no appends in progress visible to readers
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_SysLogPublish(uint64 State)
+{
+    uint64 Committed;
+
+    /*
+     * Tasks that complete their append at the same time may publish out of
+     * order, so an older state must never replace a newer one.
+     */
+    Committed = CFE_ES_AtomicLoad64(&CFE_ES_Global.ResetDataPtr->SystemLogCommitted);
+    while ((int8)(CFE_ES_SYSLOG_STATE_SEQ(State) - CFE_ES_SYSLOG_STATE_SEQ(Committed)) > 0)
+    {
+        if (CFE_ES_AtomicCompareExchange64(&CFE_ES_Global.ResetDataPtr->SystemLogCommitted, &Committed, State))
+        {
+            break;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_SysLogClear(void)
+{
+    uint64 OldState;
+    uint64 NewState;
+
+    /*
+     * Note - no need to actually memset the SystemLog buffer -
+     * by simply zeroing out the indices will cover it.  The lap count is
+     * advanced by two, so that a dump in progress drops everything it reads.
+     */
+    OldState = CFE_ES_AtomicLoad64(&CFE_ES_Global.ResetDataPtr->SystemLogState);
+    do
+    {
+        NewState = CFE_ES_SYSLOG_STATE(0, 0, CFE_ES_SYSLOG_STATE_PENDING(OldState),
+                                       CFE_ES_SYSLOG_STATE_SEQ(OldState) + 1, CFE_ES_SYSLOG_STATE_LAP(OldState) + 2);
+    } while (!CFE_ES_AtomicCompareExchange64(&CFE_ES_Global.ResetDataPtr->SystemLogState, &OldState, NewState));
+
+    /* otherwise the last append in progress publishes the cleared log */
+    if (CFE_ES_SYSLOG_STATE_PENDING(NewState) == 0)
+    {
+        CFE_ES_SysLogPublish(NewState);
+    }
+
+    CFE_ES_AtomicStore32(&CFE_ES_Global.ResetDataPtr->SystemLogEntryNum, 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_SysLogRecover(void)
+{
+    uint64 State;
+    uint32 Format;
+
+    State = CFE_ES_SYSLOG_STATE(CFE_ES_SYSLOG_STATE_WRITEIDX(CFE_ES_Global.ResetDataPtr->SystemLogState),
+                                CFE_ES_SYSLOG_STATE_ENDIDX(CFE_ES_Global.ResetDataPtr->SystemLogState), 0,
+                                CFE_ES_SYSLOG_STATE_SEQ(CFE_ES_Global.ResetDataPtr->SystemLogState) + 1,
+                                CFE_ES_SYSLOG_STATE_LAP(CFE_ES_Global.ResetDataPtr->SystemLogState));
+
+    if (CFE_PLATFORM_ES_SYSLOG_BINARY_FORMAT)
+    {
+        Format = CFE_ES_SYSLOG_FORMAT_BINARY;
+    }
+    else
+    {
+        Format = CFE_ES_SYSLOG_FORMAT_TEXT;
+    }
+
+    /* a log that was written in the other format cannot be read, so it is cleared */
+    if (CFE_ES_Global.ResetDataPtr->SystemLogFormat != Format)
+    {
+        State = CFE_ES_SYSLOG_STATE(0, 0, 0, CFE_ES_SYSLOG_STATE_SEQ(State), CFE_ES_SYSLOG_STATE_LAP(State));
+
+        CFE_ES_Global.ResetDataPtr->SystemLogFormat   = Format;
+        CFE_ES_Global.ResetDataPtr->SystemLogEntryNum = 0;
+    }
+
+    /* nothing else runs yet, so plain writes are fine here */
+    CFE_ES_Global.ResetDataPtr->SystemLogState     = State;
+    CFE_ES_Global.ResetDataPtr->SystemLogCommitted = State;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Gets the size of the binary record at the given offset, or 0 if there is no valid record
+ *
+ *-----------------------------------------------------------------*/
+static size_t CFE_ES_SysLogRecordSize(size_t Offset, size_t EndIdx)
+{
+    CFE_ES_SysLogRecordHeader_t Header;
+
+    if ((Offset + sizeof(Header)) > EndIdx)
+    {
+        return 0;
+    }
+
+    memcpy(&Header, &CFE_ES_Global.ResetDataPtr->SystemLog[Offset], sizeof(Header));
+    if (Header.Magic != CFE_ES_SYSLOG_RECORD_MAGIC || Header.Size <= sizeof(Header) ||
+        Header.Size > CFE_ES_SYSLOG_MAX_RECORD_SIZE || (Offset + Header.Size) > EndIdx)
+    {
+        return 0;
+    }
+
+    return Header.Size;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Finds the first binary record at or after the given offset that is followed
+ * by an unbroken chain of records up to EndIdx, or EndIdx if there is none
+ *
+ *-----------------------------------------------------------------*/
+static size_t CFE_ES_SysLogFindRecords(size_t Offset, size_t EndIdx)
+{
+    size_t ChainIdx;
+    size_t RecordSize;
+
+    while (Offset < EndIdx)
+    {
+        ChainIdx = Offset;
+        do
+        {
+            RecordSize = CFE_ES_SysLogRecordSize(ChainIdx, EndIdx);
+            ChainIdx += RecordSize;
+        } while (RecordSize != 0 && ChainIdx < EndIdx);
+
+        if (ChainIdx == EndIdx)
+        {
+            break;
+        }
+
+        ++Offset;
+    }
+
+    return Offset;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_SysLogReadStart(CFE_ES_SysLogReadBuffer_t *Buffer)
+{
+    uint64 Committed;
+    size_t ReadIdx;
+    size_t EndIdx;
+    size_t TotalSize;
+
+    /* Only read what was written by appends that are completed */
+    Committed = CFE_ES_AtomicLoad64(&CFE_ES_Global.ResetDataPtr->SystemLogCommitted);
+    ReadIdx   = CFE_ES_SYSLOG_STATE_WRITEIDX(Committed);
+    EndIdx    = CFE_ES_SYSLOG_STATE_ENDIDX(Committed);
+    TotalSize = EndIdx;
+
+    if (CFE_ES_Global.ResetDataPtr->SystemLogFormat == CFE_ES_SYSLOG_FORMAT_BINARY)
+    {
+        /*
+         * Records are not terminated by a newline.  The oldest complete record
+         * is the first one that is followed by an unbroken chain of records up
+         * to the end of the buffer.
+         */
+        ReadIdx = CFE_ES_SysLogFindRecords(ReadIdx, EndIdx);
+        TotalSize -= ReadIdx - CFE_ES_SYSLOG_STATE_WRITEIDX(Committed);
+    }
+    else
+    {
+        /*
+         * Ensure that we start reading at the start of a message
+         * Likely pointing to an old fragment right now -- find the end of it
+         */
+        while (TotalSize > 0 && ReadIdx < EndIdx)
+        {
+            ++ReadIdx;
+            --TotalSize;
+            if (CFE_ES_Global.ResetDataPtr->SystemLog[ReadIdx - 1] == '\n')
+            {
+                break;
+            }
+        }
+    }
+
+    Buffer->SizeLeft   = TotalSize;
+    Buffer->LastOffset = ReadIdx;
+    Buffer->EndIdx     = EndIdx;
+    Buffer->BlockSize  = 0;
+    Buffer->StartIdx   = ReadIdx;
+    Buffer->TotalSize  = TotalSize;
+    Buffer->State      = Committed;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Gets how much of the data being read, counting from the start of reading,
+ * may have been overwritten by appends since reading started
+ *
+ *-----------------------------------------------------------------*/
+static size_t CFE_ES_SysLogReadLost(const CFE_ES_SysLogReadBuffer_t *Buffer)
+{
+    uint64 State;
+    uint8  Laps;
+    size_t WriteIdx;
+    size_t Lost;
+
+    /*
+     * Appends write forward from the write index at the time reading started,
+     * which is just before the oldest data being read.  The reserved state is
+     * used, since an append that is not completed yet may already be copying.
+     */
+    State    = CFE_ES_AtomicLoad64(&CFE_ES_Global.ResetDataPtr->SystemLogState);
+    Laps     = CFE_ES_SYSLOG_STATE_LAP(State) - CFE_ES_SYSLOG_STATE_LAP(Buffer->State);
+    WriteIdx = CFE_ES_SYSLOG_STATE_WRITEIDX(State);
+
+    if (Laps == 0)
+    {
+        /* the appends did not wrap, only the data up to the write index is gone */
+        if (WriteIdx > Buffer->EndIdx)
+        {
+            WriteIdx = Buffer->EndIdx;
+        }
+        if (WriteIdx > Buffer->StartIdx)
+        {
+            Lost = WriteIdx - Buffer->StartIdx;
+        }
+        else
+        {
+            Lost = 0;
+        }
+    }
+    else if (Laps == 1)
+    {
+        /* the appends wrapped once, the data up to the end index and after the start of the log is gone */
+        if (WriteIdx > CFE_ES_SYSLOG_STATE_WRITEIDX(Buffer->State))
+        {
+            WriteIdx = CFE_ES_SYSLOG_STATE_WRITEIDX(Buffer->State);
+        }
+        Lost = (Buffer->EndIdx - Buffer->StartIdx) + WriteIdx;
+    }
+    else
+    {
+        /* the log was cleared or wrapped again, all of it is gone */
+        Lost = Buffer->TotalSize;
+    }
+
+    return Lost;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Continues reading at the first complete message at or after the given
+ * position, counting from the start of reading
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_SysLogReadSkip(CFE_ES_SysLogReadBuffer_t *Buffer, size_t Position)
+{
+    size_t FirstSize;
+    size_t SegmentEnd;
+    size_t Offset;
+    size_t NextIdx;
+    bool   IsBinary;
+
+    IsBinary = (CFE_ES_Global.ResetDataPtr->SystemLogFormat == CFE_ES_SYSLOG_FORMAT_BINARY);
+
+    /* the data is read from the start of reading up to the end index, then from the start of the log */
+    FirstSize = Buffer->EndIdx - Buffer->StartIdx;
+    if (Position < FirstSize)
+    {
+        Offset     = Buffer->StartIdx + Position;
+        SegmentEnd = Buffer->EndIdx;
+    }
+    else
+    {
+        Offset     = Position - FirstSize;
+        SegmentEnd = CFE_ES_SYSLOG_STATE_WRITEIDX(Buffer->State);
+    }
+
+    if (IsBinary)
+    {
+        NextIdx = CFE_ES_SysLogFindRecords(Offset, SegmentEnd);
+    }
+    else
+    {
+        /*
+         * Only the start of the log is known to be the start of a message,
+         * otherwise the message at the position ends at the next newline
+         */
+        NextIdx = Offset;
+        while (NextIdx > 0 && NextIdx < SegmentEnd)
+        {
+            ++NextIdx;
+            if (CFE_ES_Global.ResetDataPtr->SystemLog[NextIdx - 1] == '\n')
+            {
+                break;
+            }
+        }
+    }
+
+    Position += NextIdx - Offset;
+
+    Buffer->LastOffset = NextIdx;
+    if (Position < Buffer->TotalSize)
+    {
+        Buffer->SizeLeft = Buffer->TotalSize - Position;
+    }
+    else
+    {
+        Buffer->SizeLeft = 0;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Drops the part of the text that was read into the buffer that may have been
+ * overwritten while it was copied, see CFE_ES_SysLogReadLost()
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_SysLogDropLost(CFE_ES_SysLogReadBuffer_t *Buffer, size_t Lost)
+{
+    size_t DataPos;
+    size_t Idx;
+
+    /* position of the start of the buffer, counting from the start of reading */
+    DataPos = Buffer->TotalSize - Buffer->SizeLeft - Buffer->BlockSize;
+    if (Lost <= DataPos)
+    {
+        return;
+    }
+
+    /* the message that was partly overwritten ends at the first newline after the overwritten part */
+    Idx = Lost - DataPos;
+    while (Idx < Buffer->BlockSize && Buffer->Data[Idx] != '\n')
+    {
+        ++Idx;
+    }
+
+    if (Idx < Buffer->BlockSize)
+    {
+        ++Idx;
+        memmove(Buffer->Data, &Buffer->Data[Idx], Buffer->BlockSize - Idx);
+        Buffer->BlockSize -= Idx;
+    }
+    else
+    {
+        Buffer->BlockSize = 0;
+        CFE_ES_SysLogReadSkip(Buffer, DataPos + Idx);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Reserves the space for a message in the log, see CFE_ES_SysLogAppend()
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_SysLogReserve(size_t MessageLen, bool AllowTruncate, size_t *WriteIdxPtr, size_t *CopyLenPtr)
+{
+    int32  ReturnCode;
+    size_t CopyLen;
+    size_t WriteIdx;
+    size_t EndIdx;
+    uint32 Pending;
+    uint8  Lap;
+    uint64 OldState;
+    uint64 NewState;
+
+    /*
+     * Reserve the space for the message by replacing the state of the log,
+     * retrying if another task changed it in the meantime.
+     *
+     * WriteIdx -> indicates 1 byte past the end of the newest message
+     *      (this is the place where new messages will be added)
+     *
+     * EndIdx -> indicates the entire size of the buffer
+     *
+     * The state is read once and then kept in local stack variables, since
+     * CFE_ES_Global.ResetDataPtr may point directly into a slower NVRAM space.
+     */
+    OldState = CFE_ES_AtomicLoad64(&CFE_ES_Global.ResetDataPtr->SystemLogState);
+    do
+    {
+        WriteIdx   = CFE_ES_SYSLOG_STATE_WRITEIDX(OldState);
+        EndIdx     = CFE_ES_SYSLOG_STATE_ENDIDX(OldState);
+        Pending    = CFE_ES_SYSLOG_STATE_PENDING(OldState);
+        Lap        = CFE_ES_SYSLOG_STATE_LAP(OldState);
+        CopyLen    = MessageLen;
+        ReturnCode = CFE_SUCCESS;
+
+        /*
+         * Check if the log message plus will fit between
+         * the HeadIdx and the end of the buffer.
+         *
+         * If so, then the process can proceed as normal.
+         *
+         * If not, then the action depends on the setting of "SystemLogMode" which will be
+         * to either discard (default) or overwrite
+         */
+        if (Pending >= CFE_ES_SYSLOG_PENDING_MAX)
+        {
+            /* too many appends in progress to count another one, should never happen */
+            CopyLen = 0;
+        }
+        else if ((WriteIdx + CopyLen) > CFE_PLATFORM_ES_SYSTEM_LOG_SIZE)
+        {
+            if (CFE_ES_Global.ResetDataPtr->SystemLogMode == CFE_ES_LogMode_OVERWRITE)
+            {
+                /* In "overwrite" mode, start back at the beginning of the buffer */
+                EndIdx   = WriteIdx;
+                WriteIdx = 0;
+                ++Lap;
+            }
+            else if (AllowTruncate && WriteIdx < (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - CFE_TIME_PRINTED_STRING_SIZE))
+            {
+                /* In "discard" mode, save as much as possible and discard the remainder of the message
+                 * However this should only be done if there is enough room for at least a full timestamp,
+                 * otherwise the fragment will not be useful at all. */
+                CopyLen    = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - WriteIdx;
+                ReturnCode = CFE_ES_ERR_SYS_LOG_TRUNCATED;
+            }
+            else
+            {
+                /* entire message must be discarded */
+                CopyLen = 0;
+            }
+        }
+
+        if (CopyLen == 0)
+        {
+            return CFE_ES_ERR_SYS_LOG_FULL;
+        }
+
+        /*
+         * Keep track of the buffer endpoint for future reference
+         */
+        if ((WriteIdx + CopyLen) > EndIdx)
+        {
+            EndIdx = WriteIdx + CopyLen;
+        }
+
+        NewState = CFE_ES_SYSLOG_STATE(WriteIdx + CopyLen, EndIdx, Pending + 1, CFE_ES_SYSLOG_STATE_SEQ(OldState) + 1,
+                                       Lap);
+    } while (!CFE_ES_AtomicCompareExchange64(&CFE_ES_Global.ResetDataPtr->SystemLogState, &OldState, NewState));
+
+    *WriteIdxPtr = WriteIdx;
+    *CopyLenPtr  = CopyLen;
+
+    return ReturnCode;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Marks an append as completed, after its message was copied into the reserved space
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_SysLogCommit(void)
+{
+    uint64 OldState;
+    uint64 NewState;
+
+    /*
+     * The last append to complete makes the log visible to readers,
+     * including the messages of all appends that completed before it.
+     */
+    OldState = CFE_ES_AtomicLoad64(&CFE_ES_Global.ResetDataPtr->SystemLogState);
+    do
+    {
+        NewState = OldState - ((uint64)1 << CFE_ES_SYSLOG_PENDING_SHIFT);
+    } while (!CFE_ES_AtomicCompareExchange64(&CFE_ES_Global.ResetDataPtr->SystemLogState, &OldState, NewState));
+
+    CFE_ES_AtomicIncrement32(&CFE_ES_Global.ResetDataPtr->SystemLogEntryNum);
+
+    if (CFE_ES_SYSLOG_STATE_PENDING(NewState) == 0)
+    {
+        CFE_ES_SysLogPublish(NewState);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_SysLogAppend(const char *LogString)
+{
+    int32  ReturnCode;
+    int32  Status;
+    size_t MessageLen;
+    size_t CopyLen;
+    size_t WriteIdx;
+
+    /*
+     * Sanity check - Make sure the message length is actually reasonable
+     * Do not allow any single message to consume more than half of the total log
+     * (even this may be overly generous)
+     */
+    MessageLen = strlen(LogString);
+    if (MessageLen > (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2))
+    {
+        MessageLen = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2;
+        ReturnCode = CFE_ES_ERR_SYS_LOG_TRUNCATED;
+    }
+    else
+    {
+        ReturnCode = CFE_SUCCESS;
+    }
+
+    /*
+     * Final sanity check -- do not bother logging empty messages
+     */
+    if (MessageLen == 0)
+    {
+        return ReturnCode;
+    }
+
+    Status = CFE_ES_SysLogReserve(MessageLen, true, &WriteIdx, &CopyLen);
+    if (Status != CFE_SUCCESS)
+    {
+        ReturnCode = Status;
+    }
+
+    if (Status != CFE_ES_ERR_SYS_LOG_FULL)
+    {
+        /*
+         * Copy the message in, EXCEPT for the last char which is probably a newline
+         */
+        memcpy(&CFE_ES_Global.ResetDataPtr->SystemLog[WriteIdx], LogString, CopyLen - 1);
+
+        /*
+         * Ensure that the last-written character is a newline.
+         * This would have been enforced already except in cases where
+         * the message got truncated.
+         */
+        CFE_ES_Global.ResetDataPtr->SystemLog[WriteIdx + CopyLen - 1] = '\n';
+
+        CFE_ES_SysLogCommit();
+    }
+
+    return ReturnCode;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Parses one conversion specification of a format string, starting at the '%'
+ * Returns its length, or 0 if the conversion is not supported
+ *
+ *-----------------------------------------------------------------*/
+static size_t CFE_ES_SysLogParseSpec(const char *SpecPtr, CFE_ES_SysLogArg_t *ArgClass, char *LenMod)
+{
+    size_t Len;
+
+    /* skip the '%', the flags, the field width and the precision */
+    Len = 1;
+    Len += strspn(&SpecPtr[Len], "-+ #0");
+    Len += strspn(&SpecPtr[Len], "*0123456789");
+    if (SpecPtr[Len] == '.')
+    {
+        ++Len;
+        Len += strspn(&SpecPtr[Len], "*0123456789");
+    }
+
+    /* length modifier, "hh" and "ll" are kept as 'H' and 'q' */
+    *LenMod = 0;
+    if (SpecPtr[Len] != 0 && strchr("hljztL", SpecPtr[Len]) != NULL)
+    {
+        *LenMod = SpecPtr[Len];
+        ++Len;
+        if (*LenMod == 'h' && SpecPtr[Len] == 'h')
+        {
+            *LenMod = 'H';
+            ++Len;
+        }
+        else if (*LenMod == 'l' && SpecPtr[Len] == 'l')
+        {
+            *LenMod = 'q';
+            ++Len;
+        }
+    }
+
+    switch (SpecPtr[Len])
+    {
+        case 'd':
+        case 'i':
+            *ArgClass = CFE_ES_SysLogArg_SIGNED;
+            break;
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+            *ArgClass = CFE_ES_SysLogArg_UNSIGNED;
+            break;
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            *ArgClass = CFE_ES_SysLogArg_FLOAT;
+            break;
+        case 'c':
+            *ArgClass = CFE_ES_SysLogArg_CHAR;
+            break;
+        case 's':
+            *ArgClass = CFE_ES_SysLogArg_STRING;
+            break;
+        case 'p':
+            *ArgClass = CFE_ES_SysLogArg_POINTER;
+            break;
+        case 'n':
+            *ArgClass = CFE_ES_SysLogArg_COUNT;
+            break;
+        case '%':
+            *ArgClass = CFE_ES_SysLogArg_NONE;
+            break;
+        default:
+            return 0;
+    }
+
+    /* wide characters and mismatched length modifiers are not supported */
+    if (*LenMod != 0 && *ArgClass != CFE_ES_SysLogArg_COUNT)
+    {
+        if (*ArgClass == CFE_ES_SysLogArg_FLOAT)
+        {
+            if (*LenMod != 'l' && *LenMod != 'L')
+            {
+                return 0;
+            }
+        }
+        else if ((*ArgClass != CFE_ES_SysLogArg_SIGNED && *ArgClass != CFE_ES_SysLogArg_UNSIGNED) || *LenMod == 'L')
+        {
+            return 0;
+        }
+    }
+
+    return Len + 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Gets the value of one argument from the argument list, see CFE_ES_SysLogAppendBinary()
+ * Returns the number of bytes of the value to store
+ *
+ *-----------------------------------------------------------------*/
+static size_t CFE_ES_SysLogGetArg(CFE_ES_SysLogArg_t ArgClass, char LenMod, va_list *ArgPtr,
+                                  CFE_ES_SysLogArgValue_t *Value)
+{
+    switch (ArgClass)
+    {
+        case CFE_ES_SysLogArg_SIGNED:
+            switch (LenMod)
+            {
+                case 'l':
+                    Value->Signed = va_arg(*ArgPtr, long);
+                    break;
+                case 'q':
+                    Value->Signed = va_arg(*ArgPtr, long long);
+                    break;
+                case 'j':
+                    Value->Signed = va_arg(*ArgPtr, intmax_t);
+                    break;
+                case 'z':
+                    Value->Signed = va_arg(*ArgPtr, size_t);
+                    break;
+                case 't':
+                    Value->Signed = va_arg(*ArgPtr, ptrdiff_t);
+                    break;
+                default:
+                    Value->Signed = va_arg(*ArgPtr, int);
+                    break;
+            }
+            return sizeof(Value->Signed);
+
+        case CFE_ES_SysLogArg_UNSIGNED:
+            switch (LenMod)
+            {
+                case 'l':
+                    Value->Unsigned = va_arg(*ArgPtr, unsigned long);
+                    break;
+                case 'q':
+                    Value->Unsigned = va_arg(*ArgPtr, unsigned long long);
+                    break;
+                case 'j':
+                    Value->Unsigned = va_arg(*ArgPtr, uintmax_t);
+                    break;
+                case 'z':
+                    Value->Unsigned = va_arg(*ArgPtr, size_t);
+                    break;
+                case 't':
+                    Value->Unsigned = va_arg(*ArgPtr, ptrdiff_t);
+                    break;
+                default:
+                    Value->Unsigned = va_arg(*ArgPtr, unsigned int);
+                    break;
+            }
+            return sizeof(Value->Unsigned);
+
+        case CFE_ES_SysLogArg_FLOAT:
+            if (LenMod == 'L')
+            {
+                Value->Float = (double)va_arg(*ArgPtr, long double);
+            }
+            else
+            {
+                Value->Float = va_arg(*ArgPtr, double);
+            }
+            return sizeof(Value->Float);
+
+        case CFE_ES_SysLogArg_CHAR:
+            Value->Signed = va_arg(*ArgPtr, int);
+            return sizeof(Value->Signed);
+
+        case CFE_ES_SysLogArg_POINTER:
+            Value->Unsigned = (cpuaddr)va_arg(*ArgPtr, void *);
+            return sizeof(Value->Unsigned);
+
+        case CFE_ES_SysLogArg_STRING:
+            Value->String = va_arg(*ArgPtr, const char *);
+            if (Value->String == NULL)
+            {
+                Value->String = "(null)";
+            }
+            return strlen(Value->String) + 1;
+
+        case CFE_ES_SysLogArg_COUNT:
+            /* nothing is ever written through this pointer */
+            (void)va_arg(*ArgPtr, void *);
+            return 0;
+
+        default:
+            return 0;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_SysLogAppendBinary(const char *SpecStringPtr, va_list ArgPtr)
+{
+    CFE_ES_SysLogRecordHeader_t Header;
+    CFE_ES_SysLogArgValue_t     Value;
+    CFE_ES_SysLogArg_t          ArgClass;
+    char                        LenMod;
+    char                        Spec[CFE_ES_SYSLOG_MAX_SPEC_LEN];
+    uint8                       Record[CFE_ES_SYSLOG_MAX_RECORD_SIZE];
+    uint8                       ArgData[CFE_ES_SYSLOG_MAX_RECORD_SIZE];
+    char *                      FormatPtr;
+    va_list                     Args;
+    int32                       ReturnCode;
+    int32                       Status;
+    int                         Star;
+    size_t                      SpecLen;
+    size_t                      SpecOut;
+    size_t                      FormatLen;
+    size_t                      ArgLen;
+    size_t                      ValueLen;
+    size_t                      Avail;
+    size_t                      WriteIdx;
+    size_t                      CopyLen;
+    size_t                      i;
+
+    /*
+     * The format string is copied into the record, with the field widths and
+     * precisions given by '*' replaced by their values, and the arguments are
+     * collected separately.  The format string of the caller may be gone by the
+     * time the log is read, e.g. if the app was reloaded or the processor was reset.
+     */
+    va_copy(Args, ArgPtr);
+    ReturnCode = CFE_SUCCESS;
+    FormatPtr  = (char *)&Record[sizeof(Header)];
+    FormatLen  = 0;
+    ArgLen     = 0;
+
+    /*
+     * the space left for the format string, its null char and the arguments,
+     * no single record may take up more than half of the total log
+     */
+    Avail = sizeof(Record);
+    if (Avail > (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2))
+    {
+        Avail = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2;
+    }
+    Avail -= sizeof(Header) + 1;
+
+    while (*SpecStringPtr != 0)
+    {
+        if (*SpecStringPtr != '%')
+        {
+            if ((FormatLen + ArgLen) >= Avail)
+            {
+                ReturnCode = CFE_ES_ERR_SYS_LOG_TRUNCATED;
+                break;
+            }
+
+            FormatPtr[FormatLen] = *SpecStringPtr;
+            ++FormatLen;
+            ++SpecStringPtr;
+            continue;
+        }
+
+        /*
+         * the arguments after a conversion that is not supported cannot be
+         * located, so the format string is cut off there
+         */
+        SpecLen = CFE_ES_SysLogParseSpec(SpecStringPtr, &ArgClass, &LenMod);
+        if (SpecLen == 0)
+        {
+            ReturnCode = CFE_ES_ERR_SYS_LOG_TRUNCATED;
+            break;
+        }
+
+        SpecOut = 0;
+        for (i = 0; i < SpecLen && SpecOut < sizeof(Spec); ++i)
+        {
+            if (SpecStringPtr[i] != '*')
+            {
+                Spec[SpecOut] = SpecStringPtr[i];
+                ++SpecOut;
+            }
+            else
+            {
+                Star = va_arg(Args, int);
+                if (Star < 0 && SpecOut > 0 && Spec[SpecOut - 1] == '.')
+                {
+                    /* a negative precision is taken as if the precision were omitted */
+                    --SpecOut;
+                }
+                else
+                {
+                    SpecOut += snprintf(&Spec[SpecOut], sizeof(Spec) - SpecOut, "%d", Star);
+                }
+            }
+        }
+
+        if (SpecOut >= sizeof(Spec))
+        {
+            ReturnCode = CFE_ES_ERR_SYS_LOG_TRUNCATED;
+            break;
+        }
+
+        ValueLen = CFE_ES_SysLogGetArg(ArgClass, LenMod, &Args, &Value);
+        if (ArgClass == CFE_ES_SysLogArg_COUNT)
+        {
+            /* the count is not stored, so neither is the conversion */
+            SpecOut = 0;
+        }
+
+        if ((FormatLen + SpecOut + ArgLen + ValueLen) > Avail)
+        {
+            /* a string is cut off to fit, like vsnprintf() would do, anything else is dropped */
+            ReturnCode = CFE_ES_ERR_SYS_LOG_TRUNCATED;
+            if (ArgClass != CFE_ES_SysLogArg_STRING || (FormatLen + SpecOut + ArgLen + 1) >= Avail)
+            {
+                break;
+            }
+            ValueLen = Avail - (FormatLen + SpecOut + ArgLen);
+        }
+
+        memcpy(&FormatPtr[FormatLen], Spec, SpecOut);
+        FormatLen += SpecOut;
+
+        if (ArgClass == CFE_ES_SysLogArg_STRING)
+        {
+            memcpy(&ArgData[ArgLen], Value.String, ValueLen - 1);
+            ArgData[ArgLen + ValueLen - 1] = 0;
+        }
+        else
+        {
+            memcpy(&ArgData[ArgLen], &Value, ValueLen);
+        }
+        ArgLen += ValueLen;
+
+        if (ReturnCode != CFE_SUCCESS)
+        {
+            break;
+        }
+
+        SpecStringPtr += SpecLen;
+    }
+
+    va_end(Args);
+
+    /*
+     * Do not bother logging empty messages
+     */
+    if (FormatLen == 0)
+    {
+        return ReturnCode;
+    }
+
+    FormatPtr[FormatLen] = 0;
+    memcpy(&FormatPtr[FormatLen + 1], ArgData, ArgLen);
+
+    memset(&Header, 0, sizeof(Header));
+    Header.Magic = CFE_ES_SYSLOG_RECORD_MAGIC;
+    Header.Size  = sizeof(Header) + FormatLen + 1 + ArgLen;
+    Header.Time  = CFE_TIME_GetTime();
+    memcpy(Record, &Header, sizeof(Header));
+
+    /* a partial record cannot be read, so it is never truncated to fit */
+    Status = CFE_ES_SysLogReserve(Header.Size, false, &WriteIdx, &CopyLen);
+    if (Status == CFE_SUCCESS)
+    {
+        memcpy(&CFE_ES_Global.ResetDataPtr->SystemLog[WriteIdx], Record, CopyLen);
+        CFE_ES_SysLogCommit();
+    }
+    else
+    {
+        ReturnCode = Status;
+    }
+
+    return ReturnCode;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
  *
- * An external mutex be held while calling any function marked "Unsync"
- * These helper functions are local to the ES subsystem and must _NOT_
- * be exposed to the public API.
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...)
+{
+    char    TmpString[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    int32   ReturnCode;
+    va_list ArgPtr;
+
+    va_start(ArgPtr, SpecStringPtr);
+    if (CFE_ES_Global.ResetDataPtr->SystemLogFormat == CFE_ES_SYSLOG_FORMAT_BINARY)
+    {
+        /* the message is formatted when the log is read, it is not output to the console */
+        ReturnCode = CFE_ES_SysLogAppendBinary(SpecStringPtr, ArgPtr);
+    }
+    else
+    {
+        CFE_ES_SysLog_vsnprintf(TmpString, sizeof(TmpString), SpecStringPtr, ArgPtr);
+
+        /* Output the entry to the console */
+        OS_printf("%s", TmpString);
+
+        /*
+         * Append to the syslog buffer
+         */
+        ReturnCode = CFE_ES_SysLogAppend(TmpString);
+    }
+    va_end(ArgPtr);
+
+    return ReturnCode;
+}
+
+/*******************************************************************
  *
- * For external access, a public wrapper API must first acquire the
- * necessary mutex before calling any function marked as "Unsync"
+ * Additional helper functions
+ *
+ * These functions either perform all necessary synchronization internally,
+ * or they have no specific synchronization requirements
  *
  *******************************************************************/
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in header file for argument/return detail
+ * Local helper function, not invoked outside this unit
+ * Finalizes a formatted message, returns its final length
  *
  *-----------------------------------------------------------------*/
-void CFE_ES_SysLogClear_Unsync(void)
+static size_t CFE_ES_SysLogFinishMessage(char *Buffer, size_t StringLen, size_t MaxLen)
 {
+    if (StringLen > MaxLen)
+    {
+        /* the message got truncated */
+        StringLen = MaxLen;
+    }
+
     /*
-     * Note - no need to actually memset the SystemLog buffer -
-     * by simply zeroing out the indices will cover it.
+     * Finalize the output string.
+     *
+     * To be consistent when writing to the console, it is important that
+     * every printed string end in a newline - particularly if the console is buffered.
+     *
+     * The caller may or may not have included a newline in the original format
+     * string.  Most callers do, but some do not.
+     *
+     * Strip off all trailing whitespace, and add back a single newline
      */
+    while (StringLen > 0 && isspace((unsigned char)Buffer[StringLen - 1]))
+    {
+        --StringLen;
+    }
+    Buffer[StringLen] = '\n';
+    ++StringLen;
 
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = 0;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = 0;
-    CFE_ES_Global.ResetDataPtr->SystemLogEntryNum = 0;
+    return StringLen;
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in header file for argument/return detail
+ * Local helper function, not invoked outside this unit
+ * Formats one argument of a binary syslog record, like snprintf()
  *
  *-----------------------------------------------------------------*/
-void CFE_ES_SysLogReadStart_Unsync(CFE_ES_SysLogReadBuffer_t *Buffer)
+static int CFE_ES_SysLogPrintArg(char *Buffer, size_t BufferSize, const char *Spec, CFE_ES_SysLogArg_t ArgClass,
+                                 char LenMod, const CFE_ES_SysLogArgValue_t *Value)
 {
-    size_t ReadIdx;
-    size_t EndIdx;
-    size_t TotalSize;
-
-    ReadIdx   = CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx;
-    EndIdx    = CFE_ES_Global.ResetDataPtr->SystemLogEndIdx;
-    TotalSize = EndIdx;
+    int PrintLen;
 
-    /*
-     * Ensure that we start reading at the start of a message
-     * Likely pointing to an old fragment right now -- find the end of it
-     */
-    while (TotalSize > 0 && ReadIdx < EndIdx)
+    switch (ArgClass)
     {
-        ++ReadIdx;
-        --TotalSize;
-        if (CFE_ES_Global.ResetDataPtr->SystemLog[ReadIdx - 1] == '\n')
-        {
+        case CFE_ES_SysLogArg_SIGNED:
+            switch (LenMod)
+            {
+                case 'l':
+                    PrintLen = snprintf(Buffer, BufferSize, Spec, (long)Value->Signed);
+                    break;
+                case 'q':
+                    PrintLen = snprintf(Buffer, BufferSize, Spec, (long long)Value->Signed);
+                    break;
+                case 'j':
+                    PrintLen = snprintf(Buffer, BufferSize, Spec, (intmax_t)Value->Signed);
+                    break;
+                case 'z':
+                    PrintLen = snprintf(Buffer, BufferSize, Spec, (size_t)Value->Signed);
+                    break;
+                case 't':
+                    PrintLen = snprintf(Buffer, BufferSize, Spec, (ptrdiff_t)Value->Signed);
+                    break;
+                default:
+                    PrintLen = snprintf(Buffer, BufferSize, Spec, (int)Value->Signed);
+                    break;
+            }
+            break;
+
+        case CFE_ES_SysLogArg_UNSIGNED:
+            switch (LenMod)
+            {
+                case 'l':
+                    PrintLen = snprintf(Buffer, BufferSize, Spec, (unsigned long)Value->Unsigned);
+                    break;
+                case 'q':
+                    PrintLen = snprintf(Buffer, BufferSize, Spec, (unsigned long long)Value->Unsigned);
+                    break;
+                case 'j':
+                    PrintLen = snprintf(Buffer, BufferSize, Spec, (uintmax_t)Value->Unsigned);
+                    break;
+                case 'z':
+                    PrintLen = snprintf(Buffer, BufferSize, Spec, (size_t)Value->Unsigned);
+                    break;
+                case 't':
+                    PrintLen = snprintf(Buffer, BufferSize, Spec, (ptrdiff_t)Value->Unsigned);
+                    break;
+                default:
+                    PrintLen = snprintf(Buffer, BufferSize, Spec, (unsigned int)Value->Unsigned);
+                    break;
+            }
+            break;
+
+        case CFE_ES_SysLogArg_FLOAT:
+            if (LenMod == 'L')
+            {
+                PrintLen = snprintf(Buffer, BufferSize, Spec, (long double)Value->Float);
+            }
+            else
+            {
+                PrintLen = snprintf(Buffer, BufferSize, Spec, Value->Float);
+            }
+            break;
+
+        case CFE_ES_SysLogArg_CHAR:
+            PrintLen = snprintf(Buffer, BufferSize, Spec, (int)Value->Signed);
+            break;
+
+        case CFE_ES_SysLogArg_STRING:
+            PrintLen = snprintf(Buffer, BufferSize, Spec, Value->String);
+            break;
+
+        case CFE_ES_SysLogArg_POINTER:
+            PrintLen = snprintf(Buffer, BufferSize, Spec, (void *)(cpuaddr)Value->Unsigned);
+            break;
+
+        default:
+            /* "%%" */
+            PrintLen = snprintf(Buffer, BufferSize, "%%");
             break;
-        }
     }
 
-    Buffer->SizeLeft   = TotalSize;
-    Buffer->LastOffset = ReadIdx;
-    Buffer->EndIdx     = EndIdx;
-    Buffer->BlockSize  = 0;
+    return PrintLen;
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in header file for argument/return detail
+ * Local helper function, not invoked outside this unit
+ * Formats the message of a binary syslog record, see CFE_ES_SysLogAppendBinary()
+ * Returns the length of the message, which is truncated to fit the buffer
  *
  *-----------------------------------------------------------------*/
-int32 CFE_ES_SysLogAppend_Unsync(const char *LogString)
+static size_t CFE_ES_SysLogPrintRecord(char *Buffer, size_t BufferSize, const uint8 *Record, size_t RecordSize)
 {
-    int32  ReturnCode;
-    size_t MessageLen;
-    size_t WriteIdx;
-    size_t EndIdx;
+    CFE_ES_SysLogArgValue_t Value;
+    CFE_ES_SysLogArg_t      ArgClass;
+    char                    LenMod;
+    char                    Spec[CFE_ES_SYSLOG_MAX_SPEC_LEN];
+    const char *            FormatPtr;
+    const uint8 *           EndPtr;
+    size_t                  Offset;
+    size_t                  SpecLen;
+    size_t                  ValueLen;
+    size_t                  StringLen;
+    int                     PrintLen;
 
-    /*
-     * Sanity check - Make sure the message length is actually reasonable
-     * Do not allow any single message to consume more than half of the total log
-     * (even this may be overly generous)
-     */
-    MessageLen = strlen(LogString);
-    if (MessageLen > (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2))
-    {
-        MessageLen = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2;
-        ReturnCode = CFE_ES_ERR_SYS_LOG_TRUNCATED;
-    }
-    else
+    /* the format string must be terminated within the record */
+    FormatPtr = (const char *)&Record[sizeof(CFE_ES_SysLogRecordHeader_t)];
+    EndPtr    = memchr(FormatPtr, 0, RecordSize - sizeof(CFE_ES_SysLogRecordHeader_t));
+    if (EndPtr == NULL)
     {
-        ReturnCode = CFE_SUCCESS;
+        return 0;
     }
 
-    /*
-     * Final sanity check -- do not bother logging empty messages
-     */
-    if (MessageLen == 0)
+    Offset    = (EndPtr - Record) + 1;
+    StringLen = 0;
+    while (*FormatPtr != 0 && (StringLen + 1) < BufferSize)
     {
-        return ReturnCode;
-    }
+        if (*FormatPtr != '%')
+        {
+            Buffer[StringLen] = *FormatPtr;
+            ++StringLen;
+            ++FormatPtr;
+            continue;
+        }
 
-    /*
-     * Real work begins --
-     * Take a local snapshot of the head & tail index values
-     *
-     * WriteIdx -> indicates 1 byte past the end of the newest message
-     *      (this is the place where new messages will be added)
-     *
-     * EndIdx -> indicates the entire size of the buffer
-     *
-     * Keeping them in local stack variables allows more efficient modification,
-     * since CFE_ES_Global.ResetDataPtr may point directly into a slower NVRAM space.
-     */
-    WriteIdx = CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx;
-    EndIdx   = CFE_ES_Global.ResetDataPtr->SystemLogEndIdx;
+        SpecLen = CFE_ES_SysLogParseSpec(FormatPtr, &ArgClass, &LenMod);
+        if (SpecLen == 0 || SpecLen >= sizeof(Spec))
+        {
+            break;
+        }
 
-    /*
-     * Check if the log message plus will fit between
-     * the HeadIdx and the end of the buffer.
-     *
-     * If so, then the process can proceed as normal.
-     *
-     * If not, then the action depends on the setting of "SystemLogMode" which will be
-     * to either discard (default) or overwrite
-     */
-    if ((WriteIdx + MessageLen) > CFE_PLATFORM_ES_SYSTEM_LOG_SIZE)
-    {
-        if (CFE_ES_Global.ResetDataPtr->SystemLogMode == CFE_ES_LogMode_OVERWRITE)
+        memcpy(Spec, FormatPtr, SpecLen);
+        Spec[SpecLen] = 0;
+        FormatPtr += SpecLen;
+
+        /* get the value of the argument, as stored by CFE_ES_SysLogAppendBinary() */
+        if (ArgClass == CFE_ES_SysLogArg_STRING)
+        {
+            Value.String = (const char *)&Record[Offset];
+            EndPtr       = memchr(Value.String, 0, RecordSize - Offset);
+            if (EndPtr == NULL)
+            {
+                break;
+            }
+            ValueLen = (EndPtr - &Record[Offset]) + 1;
+        }
+        else if (ArgClass == CFE_ES_SysLogArg_FLOAT)
         {
-            /* In "overwrite" mode, start back at the beginning of the buffer */
-            EndIdx   = WriteIdx;
-            WriteIdx = 0;
+            ValueLen = sizeof(Value.Float);
         }
-        else if (WriteIdx < (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - CFE_TIME_PRINTED_STRING_SIZE))
+        else if (ArgClass == CFE_ES_SysLogArg_NONE)
         {
-            /* In "discard" mode, save as much as possible and discard the remainder of the message
-             * However this should only be done if there is enough room for at least a full timestamp,
-             * otherwise the fragment will not be useful at all. */
-            MessageLen = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - WriteIdx;
-            ReturnCode = CFE_ES_ERR_SYS_LOG_TRUNCATED;
+            ValueLen = 0;
         }
         else
         {
-            /* entire message must be discarded */
-            MessageLen = 0;
+            ValueLen = sizeof(Value.Unsigned);
         }
-    }
 
-    if (MessageLen == 0)
-    {
-        ReturnCode = CFE_ES_ERR_SYS_LOG_FULL;
-    }
-    else
-    {
-        /*
-         * Copy the message in, EXCEPT for the last char which is probably a newline
-         */
-        memcpy(&CFE_ES_Global.ResetDataPtr->SystemLog[WriteIdx], LogString, MessageLen - 1);
-        WriteIdx += MessageLen;
+        if ((Offset + ValueLen) > RecordSize)
+        {
+            break;
+        }
 
-        /*
-         * Ensure that the last-written character is a newline.
-         * This would have been enforced already except in cases where
-         * the message got truncated.
-         */
-        CFE_ES_Global.ResetDataPtr->SystemLog[WriteIdx - 1] = '\n';
+        if (ArgClass != CFE_ES_SysLogArg_STRING)
+        {
+            memcpy(&Value, &Record[Offset], ValueLen);
+        }
+        Offset += ValueLen;
 
-        /*
-         * Keep track of the buffer endpoint for future reference
-         */
-        if (WriteIdx > EndIdx)
+        /* note that snprintf() may return a size larger than the buffer, if it truncates. */
+        PrintLen = CFE_ES_SysLogPrintArg(&Buffer[StringLen], BufferSize - StringLen, Spec, ArgClass, LenMod, &Value);
+        if (PrintLen > 0)
         {
-            EndIdx = WriteIdx;
+            StringLen += PrintLen;
         }
+    }
 
-        /*
-         * Export updated index values to the reset area for next time.
-         */
-        CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = WriteIdx;
-        CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = EndIdx;
-        ++CFE_ES_Global.ResetDataPtr->SystemLogEntryNum;
+    if (StringLen >= BufferSize)
+    {
+        StringLen = BufferSize - 1;
     }
 
-    return ReturnCode;
+    return StringLen;
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in header file for argument/return detail
+ * Local helper function, not invoked outside this unit
+ * Reads the records of a binary syslog, formatting them into messages
  *
  *-----------------------------------------------------------------*/
-int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...)
+static void CFE_ES_SysLogReadRecords(CFE_ES_SysLogReadBuffer_t *Buffer)
 {
-    char    TmpString[CFE_ES_MAX_SYSLOG_MSG_SIZE];
-    va_list ArgPtr;
-
-    va_start(ArgPtr, SpecStringPtr);
-    CFE_ES_SysLog_vsnprintf(TmpString, sizeof(TmpString), SpecStringPtr, ArgPtr);
-    va_end(ArgPtr);
-
-    /* Output the entry to the console */
-    OS_printf("%s", TmpString);
+    CFE_ES_SysLogRecordHeader_t Header;
+    uint8                       Record[CFE_ES_SYSLOG_MAX_RECORD_SIZE];
+    char *                      MessagePtr;
+    size_t                      RecordSize;
+    size_t                      StringLen;
+    size_t                      ReadPos;
+    size_t                      Lost;
 
     /*
-     * Append to the syslog buffer
+     * Every record is formatted into a message of at most CFE_ES_MAX_SYSLOG_MSG_SIZE,
+     * like the text written by CFE_ES_SysLog_vsnprintf()
      */
-    return CFE_ES_SysLogAppend_Unsync(TmpString);
-}
+    while (Buffer->SizeLeft > 0 && (sizeof(Buffer->Data) - Buffer->BlockSize) >= CFE_ES_MAX_SYSLOG_MSG_SIZE)
+    {
+        if (Buffer->LastOffset >= Buffer->EndIdx)
+        {
+            Buffer->LastOffset = 0;
+        }
 
-/*******************************************************************
- *
- * Additional helper functions
- *
- * These functions either perform all necessary synchronization internally,
- * or they have no specific synchronization requirements
- *
- *******************************************************************/
+        ReadPos    = Buffer->TotalSize - Buffer->SizeLeft;
+        RecordSize = CFE_ES_SysLogRecordSize(Buffer->LastOffset, Buffer->EndIdx);
+        if (RecordSize != 0 && RecordSize <= Buffer->SizeLeft)
+        {
+            memcpy(Record, &CFE_ES_Global.ResetDataPtr->SystemLog[Buffer->LastOffset], RecordSize);
+        }
+
+        /* if the record may have been overwritten while it was copied, continue after the overwritten part */
+        Lost = CFE_ES_SysLogReadLost(Buffer);
+        if (Lost > ReadPos)
+        {
+            CFE_ES_SysLogReadSkip(Buffer, Lost);
+            continue;
+        }
+
+        if (RecordSize == 0 || RecordSize > Buffer->SizeLeft)
+        {
+            /* the log was overwritten since reading started, the rest cannot be found */
+            Buffer->SizeLeft = 0;
+            break;
+        }
+
+        memcpy(&Header, Record, sizeof(Header));
+
+        MessagePtr = &Buffer->Data[Buffer->BlockSize];
+        CFE_TIME_Print(MessagePtr, Header.Time);
+
+        /* using strlen() anyway in case the specific format of CFE_TIME_Print() changes someday */
+        StringLen = strlen(MessagePtr);
+        if (StringLen < (CFE_ES_MAX_SYSLOG_MSG_SIZE - 2))
+        {
+            /* overwrite null with a space to separate the timestamp from the content */
+            MessagePtr[StringLen] = ' ';
+            ++StringLen;
+
+            StringLen += CFE_ES_SysLogPrintRecord(&MessagePtr[StringLen], CFE_ES_MAX_SYSLOG_MSG_SIZE - StringLen,
+                                                  Record, RecordSize);
+        }
+
+        Buffer->BlockSize += CFE_ES_SysLogFinishMessage(MessagePtr, StringLen, CFE_ES_MAX_SYSLOG_MSG_SIZE - 2);
+        Buffer->LastOffset += RecordSize;
+        Buffer->SizeLeft -= RecordSize;
+    }
+}
 
 /*----------------------------------------------------------------
  *
@@ -289,6 +1409,12 @@ void CFE_ES_SysLogReadData(CFE_ES_SysLogReadBuffer_t *Buffer)
     size_t BlockSize;
 
     Buffer->BlockSize = 0;
+    if (CFE_ES_Global.ResetDataPtr->SystemLogFormat == CFE_ES_SYSLOG_FORMAT_BINARY)
+    {
+        CFE_ES_SysLogReadRecords(Buffer);
+        return;
+    }
+
     while (Buffer->SizeLeft > 0 && Buffer->BlockSize < sizeof(Buffer->Data))
     {
         /*
@@ -323,6 +1449,9 @@ void CFE_ES_SysLogReadData(CFE_ES_SysLogReadBuffer_t *Buffer)
         Buffer->BlockSize += BlockSize;
         Buffer->LastOffset += BlockSize;
         Buffer->SizeLeft -= BlockSize;
+
+        /* appends may have overwritten the oldest part while it was copied */
+        CFE_ES_SysLogDropLost(Buffer, CFE_ES_SysLogReadLost(Buffer));
     }
 }
 
@@ -394,29 +1523,7 @@ void CFE_ES_SysLog_vsnprintf(char *Buffer, size_t BufferSize, const char *SpecSt
             }
         }
 
-        if (StringLen > MaxLen)
-        {
-            /* the message got truncated */
-            StringLen = MaxLen;
-        }
-
-        /*
-         * Finalize the output string.
-         *
-         * To be consistent when writing to the console, it is important that
-         * every printed string end in a newline - particularly if the console is buffered.
-         *
-         * The caller may or may not have included a newline in the original format
-         * string.  Most callers do, but some do not.
-         *
-         * Strip off all trailing whitespace, and add back a single newline
-         */
-        while (StringLen > 0 && isspace((unsigned char)Buffer[StringLen - 1]))
-        {
-            --StringLen;
-        }
-        Buffer[StringLen] = '\n';
-        ++StringLen;
+        StringLen = CFE_ES_SysLogFinishMessage(Buffer, StringLen, MaxLen);
     }
 
     if (BufferSize > 0)
@@ -469,7 +1576,7 @@ int32 CFE_ES_SysLogDump(const char *Filename)
          * into the syslog buffer while getting the first block of log data.
          */
         CFE_ES_LockSharedData(__func__, __LINE__);
-        CFE_ES_SysLogReadStart_Unsync(&Buffer.LogData);
+        CFE_ES_SysLogReadStart(&Buffer.LogData);
         CFE_ES_SysLogReadData(&Buffer.LogData);
         CFE_ES_UnlockSharedData(__func__, __LINE__);
 
@@ -507,9 +1614,10 @@ int32 CFE_ES_SysLogDump(const char *Filename)
              * should be writing to a different part of the syslog buffer anyway, and
              * probably will not overwrite the data about to be read here.
              *
-             * There is still a possibility of a "flood" of syslogs coming in which would
-             * potentially overwrite unread data and cause message loss/corruption.  However
-             * taking a lock here will not alleviate that situation - this means that the
+             * A "flood" of syslogs coming in may still overwrite unread data.  The read
+             * checks the state of the log after every copy and drops what was overwritten,
+             * so those messages are lost but no corrupted data is written to the file.
+             * Taking a lock here will not alleviate that situation - this means that the
              * buffer simply isn't big enough.
              */
             CFE_ES_SysLogReadData(&Buffer.LogData);
@@ -325,6 +325,12 @@ int32 CFE_ES_TaskInit(void)
     CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.MemStatsPacket.TelemetryHeader),
                  CFE_SB_ValueToMsgId(CFE_ES_MEMSTATS_TLM_MID), sizeof(CFE_ES_Global.TaskData.MemStatsPacket));
 
+    /*
+    ** Initialize performance marker statistics telemetry packet
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.PerfStatsPacket.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(CFE_ES_PERFSTATS_TLM_MID), sizeof(CFE_ES_Global.TaskData.PerfStatsPacket));
+
     /*
     ** Create Software Bus message pipe
     */
@@ -448,17 +454,24 @@ int32 CFE_ES_SendHkCmd(const CFE_ES_SendHkCmd_t *data)
     OS_heap_prop_t HeapProp;
     int32          OsStatus;
     uint32         PerfIdx;
+    uint64         SysLogState;
 
     memset(&HeapProp, 0, sizeof(HeapProp));
 
+    /*
+    ** Report the startup timeline once, after the system became operational
+    */
+    CFE_ES_TimelineReport();
+
     /*
     ** Get command execution counters, system log entry count & bytes used.
     */
     CFE_ES_Global.TaskData.HkPacket.Payload.CommandCounter      = CFE_ES_Global.TaskData.CommandCounter;
     CFE_ES_Global.TaskData.HkPacket.Payload.CommandErrorCounter = CFE_ES_Global.TaskData.CommandErrorCounter;
 
+    SysLogState = CFE_ES_AtomicLoad64(&CFE_ES_Global.ResetDataPtr->SystemLogCommitted);
     CFE_ES_Global.TaskData.HkPacket.Payload.SysLogBytesUsed =
-        CFE_ES_MEMOFFSET_C(CFE_ES_Global.ResetDataPtr->SystemLogEndIdx);
+        CFE_ES_MEMOFFSET_C(CFE_ES_SYSLOG_STATE_ENDIDX(SysLogState));
     CFE_ES_Global.TaskData.HkPacket.Payload.SysLogSize    = CFE_ES_MEMOFFSET_C(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE);
     CFE_ES_Global.TaskData.HkPacket.Payload.SysLogEntries = CFE_ES_Global.ResetDataPtr->SystemLogEntryNum;
     CFE_ES_Global.TaskData.HkPacket.Payload.SysLogMode    = CFE_ES_Global.ResetDataPtr->SystemLogMode;
@@ -485,6 +498,9 @@ int32 CFE_ES_SendHkCmd(const CFE_ES_SendHkCmd_t *data)
     CFE_ES_Global.TaskData.HkPacket.Payload.PerfDataEnd      = CFE_ES_Global.ResetDataPtr->Perf.MetaData.DataEnd;
     CFE_ES_Global.TaskData.HkPacket.Payload.PerfDataCount    = CFE_ES_Global.ResetDataPtr->Perf.MetaData.DataCount;
     CFE_ES_Global.TaskData.HkPacket.Payload.PerfDataToWrite  = CFE_ES_GetPerfLogDumpRemaining();
+    CFE_ES_Global.TaskData.HkPacket.Payload.PerfDroppedCount =
+        CFE_ES_PerfLogCountDropped() + CFE_ES_Global.BackgroundPerfStreamState.DiscardCount;
+    CFE_ES_Global.TaskData.HkPacket.Payload.PerfStreamFileCount = CFE_ES_Global.BackgroundPerfStreamState.FileCount;
 
     /*
      * Fill out the perf trigger/filter mask objects
@@ -1269,7 +1285,7 @@ int32 CFE_ES_ClearSysLogCmd(const CFE_ES_ClearSysLogCmd_t *data)
     */
 
     CFE_ES_LockSharedData(__func__, __LINE__);
-    CFE_ES_SysLogClear_Unsync();
+    CFE_ES_SysLogClear();
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
     /*
@@ -54,11 +54,14 @@
 /*
 ** ES File descriptions
 */
-#define CFE_ES_SYS_LOG_DESC  "ES system log data file"
-#define CFE_ES_TASK_LOG_DESC "ES Task Info file"
-#define CFE_ES_APP_LOG_DESC  "ES Application Info file"
-#define CFE_ES_ER_LOG_DESC   "ES ERlog data file"
-#define CFE_ES_PERF_LOG_DESC "ES Performance data file"
+#define CFE_ES_SYS_LOG_DESC      "ES system log data file"
+#define CFE_ES_TASK_LOG_DESC     "ES Task Info file"
+#define CFE_ES_APP_LOG_DESC      "ES Application Info file"
+#define CFE_ES_ER_LOG_DESC       "ES ERlog data file"
+#define CFE_ES_PERF_LOG_DESC     "ES Performance data file"
+#define CFE_ES_LOCKPROF_LOG_DESC "ES Lock profile data file"
+#define CFE_ES_POOLPROF_LOG_DESC "ES Pool profile data file"
+#define CFE_ES_TIMELINE_LOG_DESC "ES Startup timeline data file"
 
 /*
  * Limit for the total number of entries that may be
@@ -213,6 +216,24 @@ int32 CFE_ES_ClearERLogCmd(const CFE_ES_ClearERLogCmd_t *data);
  */
 int32 CFE_ES_WriteERLogCmd(const CFE_ES_WriteERLogCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Write the lock profile to a file
+ */
+int32 CFE_ES_WriteLockProfileCmd(const CFE_ES_WriteLockProfileCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Write the pool size profile to a file
+ */
+int32 CFE_ES_WritePoolProfileCmd(const CFE_ES_WritePoolProfileCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Write the startup timeline to a file
+ */
+int32 CFE_ES_WriteStartupTimelineCmd(const CFE_ES_WriteStartupTimelineCmd_t *data);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief  Processor Reset Count
@@ -255,6 +276,18 @@ int32 CFE_ES_SetPerfFilterMaskCmd(const CFE_ES_SetPerfFilterMaskCmd_t *data);
  */
 int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Command handler to set perf ID statistics mask
+ */
+int32 CFE_ES_SetPerfStatsMaskCmd(const CFE_ES_SetPerfStatsMaskCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Telemeter Performance Marker Statistics
+ */
+int32 CFE_ES_SendPerfStatsCmd(const CFE_ES_SendPerfStatsCmd_t *data);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief  Telemeter Memory Pool Statistics
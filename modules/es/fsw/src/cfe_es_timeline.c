@@ -0,0 +1,500 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+
+/*
+**  File:
+**    cfe_es_timeline.c
+**
+**  Purpose:
+**    This file implements the cFE Executive Services startup timeline, which
+**    records the time of each boot phase and of the startup milestones of each
+**    app and library, and reports it once the system is OPERATIONAL.
+**
+**  References:
+**     Flight Software Branch C Coding Standard Version 1.0a
+**     cFE Flight Software Application Developers Guide
+**
+**  Notes:
+**
+*/
+
+/*
+** Required header files.
+*/
+#include "cfe_es_module_all.h"
+
+#include <string.h>
+#include <stdio.h>
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Reads the timebase as a single tick count
+ *
+ *-----------------------------------------------------------------*/
+static uint64 CFE_ES_TimelineTicks(void)
+{
+    uint32 Upper32;
+    uint32 Lower32;
+    uint32 Rollover;
+
+    CFE_PSP_Get_Timebase(&Upper32, &Lower32);
+
+    /* a rollover of 0 means the lower word uses all 32 bits */
+    Rollover = CFE_PSP_GetTimerLow32Rollover();
+    if (Rollover != 0)
+    {
+        return ((uint64)Upper32 * Rollover) + Lower32;
+    }
+
+    return ((uint64)Upper32 << 32) + Lower32;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Gets the time to record, as ticks since the start plus 1
+ *
+ *-----------------------------------------------------------------*/
+static uint64 CFE_ES_TimelineNow(void)
+{
+    uint64 NowTicks;
+
+    NowTicks = CFE_ES_TimelineTicks();
+    if (NowTicks < CFE_ES_Global.Timeline.StartTicks)
+    {
+        NowTicks = CFE_ES_Global.Timeline.StartTicks;
+    }
+
+    return NowTicks - CFE_ES_Global.Timeline.StartTicks + 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Gets the timeline entry of the table slot of an app or library
+ *
+ *-----------------------------------------------------------------*/
+static CFE_ES_TimelineModule_t *CFE_ES_TimelineGetModule(CFE_ResourceId_t ResourceId)
+{
+    uint32 Idx;
+
+    switch (CFE_ResourceId_GetBase(ResourceId))
+    {
+        case CFE_ES_APPID_BASE:
+            if (CFE_ES_AppID_ToIndex(CFE_ES_APPID_C(ResourceId), &Idx) == CFE_SUCCESS &&
+                Idx < CFE_PLATFORM_ES_MAX_APPLICATIONS)
+            {
+                return &CFE_ES_Global.Timeline.Modules[Idx];
+            }
+            break;
+        case CFE_ES_LIBID_BASE:
+            if (CFE_ES_LibID_ToIndex(CFE_ES_LIBID_C(ResourceId), &Idx) == CFE_SUCCESS &&
+                Idx < CFE_PLATFORM_ES_MAX_LIBRARIES)
+            {
+                return &CFE_ES_Global.Timeline.Modules[CFE_PLATFORM_ES_MAX_APPLICATIONS + Idx];
+            }
+            break;
+        default:
+            break;
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Gets the time between two recorded times in milliseconds, 0 if either was not reached
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_TimelineSpanMsec(uint64 FromTicks, uint64 ToTicks)
+{
+    if (FromTicks == 0 || ToTicks < FromTicks)
+    {
+        return 0;
+    }
+
+    return CFE_ES_TimelineToUsec(ToTicks - FromTicks + 1) / 1000;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Starts writing the startup timeline in the background
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_TimelineDumpRequest(const char *InputName, size_t InputBufSize)
+{
+    CFE_ES_TimelineDumpState_t *StatePtr;
+    int32                       Status;
+
+    StatePtr = &CFE_ES_Global.Timeline.BackgroundDumpState;
+
+    /* check if pending before overwriting fields in the structure */
+    if (CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite))
+    {
+        return CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+
+    /* Reset the entire state object (just for good measure, ensure no stale data) */
+    memset(StatePtr, 0, sizeof(*StatePtr));
+
+    StatePtr->FileWrite.FileSubType = CFE_FS_SubType_ES_TIMELINE;
+    snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), CFE_ES_TIMELINE_LOG_DESC);
+
+    StatePtr->FileWrite.GetData = CFE_ES_BackgroundTimelineDataGetter;
+    StatePtr->FileWrite.OnEvent = CFE_ES_BackgroundTimelineEventHandler;
+
+    /*
+    ** Copy the filename into local buffer with default name/path/extension if not specified
+    */
+    Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName, InputName, sizeof(StatePtr->FileWrite.FileName),
+                                         InputBufSize, CFE_PLATFORM_ES_DEFAULT_STARTUP_TIMELINE_FILE,
+                                         CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                         CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_FS_BackgroundFileDumpRequest(&StatePtr->FileWrite);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_TimelineStart(void)
+{
+    CFE_ES_Global.Timeline.StartTicks = CFE_ES_TimelineTicks();
+
+    CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_EARLY_INIT);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_t Phase)
+{
+    /* the phases are only entered by the ES main task */
+    if (Phase < CFE_ES_TimelinePhase_MAX && CFE_ES_Global.Timeline.PhaseTicks[Phase] == 0)
+    {
+        CFE_ES_Global.Timeline.PhaseTicks[Phase] = CFE_ES_TimelineNow();
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_TimelineAddModule(CFE_ResourceId_t ResourceId, const char *Name, CFE_ES_TimelineRecordType_t RecordType)
+{
+    CFE_ES_TimelineModule_t *ModulePtr;
+
+    if (CFE_ES_Global.SystemState >= CFE_ES_SystemState_OPERATIONAL)
+    {
+        return;
+    }
+
+    ModulePtr = CFE_ES_TimelineGetModule(ResourceId);
+    if (ModulePtr != NULL)
+    {
+        memset(ModulePtr, 0, sizeof(*ModulePtr));
+
+        ModulePtr->ResourceId = ResourceId;
+        ModulePtr->RecordType = RecordType;
+        strncpy(ModulePtr->Name, Name, sizeof(ModulePtr->Name) - 1);
+
+        ModulePtr->Ticks[CFE_ES_TimelineMilestone_CREATE] = CFE_ES_TimelineNow();
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_TimelineMarkModule(CFE_ResourceId_t ResourceId, CFE_ES_TimelineMilestone_t Milestone)
+{
+    CFE_ES_TimelineModule_t *ModulePtr;
+
+    if (CFE_ES_Global.SystemState >= CFE_ES_SystemState_OPERATIONAL || Milestone >= CFE_ES_TimelineMilestone_MAX)
+    {
+        return;
+    }
+
+    ModulePtr = CFE_ES_TimelineGetModule(ResourceId);
+    if (ModulePtr != NULL && ModulePtr->RecordType != CFE_ES_TimelineRecordType_UNUSED &&
+        CFE_ResourceId_Equal(ModulePtr->ResourceId, ResourceId) && ModulePtr->Ticks[Milestone] == 0)
+    {
+        ModulePtr->Ticks[Milestone] = CFE_ES_TimelineNow();
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_TimelineToUsec(uint64 Ticks)
+{
+    uint32 TicksPerSecond;
+    uint64 Usec;
+
+    if (Ticks == 0)
+    {
+        return CFE_ES_TIMELINE_NOT_REACHED;
+    }
+
+    /* remove the offset that marks the time as reached */
+    --Ticks;
+
+    /* without a known timer rate, report the raw ticks */
+    TicksPerSecond = CFE_PSP_GetTimerTicksPerSecond();
+    if (TicksPerSecond == 0)
+    {
+        Usec = Ticks;
+    }
+    else
+    {
+        Usec = ((Ticks / TicksPerSecond) * 1000000) + (((Ticks % TicksPerSecond) * 1000000) / TicksPerSecond);
+    }
+
+    if (Usec >= CFE_ES_TIMELINE_NOT_REACHED)
+    {
+        Usec = CFE_ES_TIMELINE_NOT_REACHED - 1;
+    }
+
+    return (uint32)Usec;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_TimelineReport(void)
+{
+    const CFE_ES_TimelineGlobal_t *TimelinePtr;
+    const CFE_ES_TimelineModule_t *ModulePtr;
+    const char *                   SlowestName;
+    uint32                         SlowestMsec;
+    uint32                         Msec;
+    uint32                         i;
+    int32                          Status;
+
+    TimelinePtr = &CFE_ES_Global.Timeline;
+
+    if (TimelinePtr->ReportSent || CFE_ES_Global.SystemState < CFE_ES_SystemState_OPERATIONAL)
+    {
+        return;
+    }
+
+    /* the external app that took the longest from its creation to running */
+    SlowestName = "none";
+    SlowestMsec = 0;
+    for (i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; ++i)
+    {
+        ModulePtr = &TimelinePtr->Modules[i];
+        /* apps that have not reached RUNNING have no span to compare */
+        if (ModulePtr->RecordType == CFE_ES_TimelineRecordType_APP &&
+            ModulePtr->Ticks[CFE_ES_TimelineMilestone_RUNNING] != 0)
+        {
+            Msec = CFE_ES_TimelineSpanMsec(ModulePtr->Ticks[CFE_ES_TimelineMilestone_CREATE],
+                                           ModulePtr->Ticks[CFE_ES_TimelineMilestone_RUNNING]);
+            if (Msec > SlowestMsec)
+            {
+                SlowestName = ModulePtr->Name;
+                SlowestMsec = Msec;
+            }
+        }
+    }
+
+    CFE_EVS_SendEvent(
+        CFE_ES_TIMELINE_INF_EID, CFE_EVS_EventType_INFORMATION,
+        "Startup %lu ms: core %lu, script %lu, sync %lu, slowest %s %lu ms",
+        (unsigned long)CFE_ES_TimelineSpanMsec(TimelinePtr->PhaseTicks[CFE_ES_TimelinePhase_EARLY_INIT],
+                                               TimelinePtr->PhaseTicks[CFE_ES_TimelinePhase_OPERATIONAL]),
+        (unsigned long)CFE_ES_TimelineSpanMsec(TimelinePtr->PhaseTicks[CFE_ES_TimelinePhase_EARLY_INIT],
+                                               TimelinePtr->PhaseTicks[CFE_ES_TimelinePhase_CORE_READY]),
+        (unsigned long)CFE_ES_TimelineSpanMsec(TimelinePtr->PhaseTicks[CFE_ES_TimelinePhase_CORE_READY],
+                                               TimelinePtr->PhaseTicks[CFE_ES_TimelinePhase_APPS_LOADED]),
+        (unsigned long)CFE_ES_TimelineSpanMsec(TimelinePtr->PhaseTicks[CFE_ES_TimelinePhase_APPS_LOADED],
+                                               TimelinePtr->PhaseTicks[CFE_ES_TimelinePhase_OPERATIONAL]),
+        SlowestName, (unsigned long)SlowestMsec);
+
+    /* a write already requested by command also has the complete timeline, so is not repeated */
+    Status = CFE_ES_TimelineDumpRequest(NULL, 0);
+    if (Status != CFE_SUCCESS && Status != CFE_STATUS_REQUEST_ALREADY_PENDING)
+    {
+        CFE_EVS_SendEvent(CFE_ES_TIMELINE_ERR_EID, CFE_EVS_EventType_ERROR, "Error creating file, RC = %d",
+                          (int)Status);
+    }
+
+    CFE_ES_Global.Timeline.ReportSent = true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_WriteStartupTimelineCmd(const CFE_ES_WriteStartupTimelineCmd_t *data)
+{
+    const CFE_ES_FileNameCmd_Payload_t *CmdPtr = &data->Payload;
+    int32                               Status;
+
+    Status = CFE_ES_TimelineDumpRequest(CmdPtr->FileName, sizeof(CmdPtr->FileName));
+
+    if (Status != CFE_SUCCESS)
+    {
+        if (Status == CFE_STATUS_REQUEST_ALREADY_PENDING)
+        {
+            CFE_EVS_SendEvent(CFE_ES_TIMELINE_PENDING_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Startup timeline write already in progress");
+        }
+        else
+        {
+            CFE_EVS_SendEvent(CFE_ES_TIMELINE_ERR_EID, CFE_EVS_EventType_ERROR, "Error creating file, RC = %d",
+                              (int)Status);
+        }
+
+        /* background dump did not start, consider this an error */
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+    }
+    else
+    {
+        CFE_ES_Global.TaskData.CommandCounter++;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_BackgroundTimelineDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_ES_TimelineDumpState_t *   StatePtr;
+    CFE_ES_Timeline_FileEntry_t *  FileBufferPtr;
+    const CFE_ES_TimelineModule_t *ModulePtr;
+    uint32                         i;
+
+    StatePtr      = (CFE_ES_TimelineDumpState_t *)Meta;
+    FileBufferPtr = &StatePtr->EntryBuffer;
+
+    *Buffer  = NULL;
+    *BufSize = 0;
+
+    memset(FileBufferPtr, 0, sizeof(*FileBufferPtr));
+    for (i = 0; i < CFE_ES_TIMELINE_MAX_TIMES; ++i)
+    {
+        FileBufferPtr->TimeUsec[i] = CFE_ES_TIMELINE_NOT_REACHED;
+    }
+
+    /* the boot phases come first, followed by each app and library table slot */
+    if (RecordNum == 0)
+    {
+        strncpy(FileBufferPtr->Name, "CFE_ES_Main", sizeof(FileBufferPtr->Name) - 1);
+        FileBufferPtr->RecordType = CFE_ES_TimelineRecordType_PHASES;
+        for (i = 0; i < CFE_ES_TimelinePhase_MAX; ++i)
+        {
+            FileBufferPtr->TimeUsec[i] = CFE_ES_TimelineToUsec(CFE_ES_Global.Timeline.PhaseTicks[i]);
+        }
+
+        *Buffer  = FileBufferPtr;
+        *BufSize = sizeof(*FileBufferPtr);
+    }
+    else if (RecordNum <= CFE_ES_TIMELINE_MAX_MODULES)
+    {
+        /* slots without a module created during startup leave a hole, which is skipped */
+        ModulePtr = &CFE_ES_Global.Timeline.Modules[RecordNum - 1];
+        if (ModulePtr->RecordType != CFE_ES_TimelineRecordType_UNUSED)
+        {
+            strncpy(FileBufferPtr->Name, ModulePtr->Name, sizeof(FileBufferPtr->Name) - 1);
+            FileBufferPtr->RecordType = ModulePtr->RecordType;
+            FileBufferPtr->ResourceId = CFE_ResourceId_ToInteger(ModulePtr->ResourceId);
+            for (i = 0; i < CFE_ES_TimelineMilestone_MAX; ++i)
+            {
+                FileBufferPtr->TimeUsec[i] = CFE_ES_TimelineToUsec(ModulePtr->Ticks[i]);
+            }
+
+            *Buffer  = FileBufferPtr;
+            *BufSize = sizeof(*FileBufferPtr);
+        }
+    }
+
+    /* Check for EOF (last entry)  */
+    return (RecordNum >= CFE_ES_TIMELINE_MAX_MODULES);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_BackgroundTimelineEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
+                                           size_t BlockSize, size_t Position)
+{
+    CFE_ES_TimelineDumpState_t *StatePtr;
+
+    StatePtr = (CFE_ES_TimelineDumpState_t *)Meta;
+
+    /* Note that this runs in the context of ES background task (file writer background job) */
+    switch (Event)
+    {
+        case CFE_FS_FileWriteEvent_COMPLETE:
+            CFE_EVS_SendEvent(CFE_ES_TIMELINE_EID, CFE_EVS_EventType_DEBUG, "%s written:Size=%lu",
+                              StatePtr->FileWrite.FileName, (unsigned long)Position);
+            break;
+
+        case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
+        case CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_FILEWRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "File write,byte cnt err,file %s,request=%u,actual=%u", StatePtr->FileWrite.FileName,
+                              (int)BlockSize, (int)Status);
+            break;
+
+        case CFE_FS_FileWriteEvent_CREATE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_TIMELINE_ERR_EID, CFE_EVS_EventType_ERROR, "Error creating file %s, RC = %d",
+                              StatePtr->FileWrite.FileName, (int)Status);
+            break;
+
+        default:
+            /* unhandled event - ignore */
+            break;
+    }
+}
@@ -0,0 +1,168 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Purpose: Startup timeline data structures
+ *
+ * Design Notes:
+ *   ES records the timebase when each boot phase is entered, and when
+ *   each app and library created during startup reaches a milestone.
+ *   The storage has a fixed size, one entry per app and library table
+ *   slot.  Each time is written by a single task, so no lock is taken;
+ *   recording stops once the system is OPERATIONAL.
+ *
+ * References:
+ *
+ */
+
+#ifndef CFE_ES_TIMELINE_H
+#define CFE_ES_TIMELINE_H
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "cfe_platform_cfg.h"
+#include "cfe_resourceid_api_typedefs.h"
+#include "cfe_fs_api_typedefs.h"
+#include "cfe_es_timeline_typedef.h"
+
+/*
+** Macro Definitions
+*/
+
+/*
+ * One timeline entry for each app table slot, followed by one for each library table slot
+ */
+#define CFE_ES_TIMELINE_MAX_MODULES (CFE_PLATFORM_ES_MAX_APPLICATIONS + CFE_PLATFORM_ES_MAX_LIBRARIES)
+
+/*
+** Typedefs
+*/
+
+/*
+ * Startup timeline of a single app or library
+ */
+typedef struct
+{
+    CFE_ResourceId_t ResourceId;                          /**< ID of the app or library, undefined if not used */
+    uint32           RecordType;                          /**< CFE_ES_TimelineRecordType_t of the module */
+    char             Name[OS_MAX_API_NAME];               /**< Name of the app or library */
+    uint64           Ticks[CFE_ES_TimelineMilestone_MAX]; /**< Ticks since the start plus 1, 0 if not reached */
+} CFE_ES_TimelineModule_t;
+
+/*
+ * Background startup timeline dump state structure
+ */
+typedef struct
+{
+    CFE_FS_FileWriteMetaData_t  FileWrite;   /**< FS state data - must be first */
+    CFE_ES_Timeline_FileEntry_t EntryBuffer; /**< Temp holding area for record to write */
+} CFE_ES_TimelineDumpState_t;
+
+/*
+ * Startup timeline global data
+ */
+typedef struct
+{
+    uint64                  StartTicks;                           /**< Timebase when CFE_ES_Main() was entered */
+    uint64                  PhaseTicks[CFE_ES_TimelinePhase_MAX]; /**< Ticks since the start plus 1, 0 if not reached */
+    CFE_ES_TimelineModule_t Modules[CFE_ES_TIMELINE_MAX_MODULES]; /**< Indexed by app, then library table slot */
+    bool                    ReportSent;                           /**< The summary event was sent */
+
+    CFE_ES_TimelineDumpState_t BackgroundDumpState;
+} CFE_ES_TimelineGlobal_t;
+
+/*
+** Function prototypes
+*/
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Starts the startup timeline
+ *
+ * Takes the reference time of all other times.  Called when CFE_ES_Main() is
+ * entered, after the ES global data is cleared.
+ */
+void CFE_ES_TimelineStart(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Records the time a boot phase is entered
+ */
+void CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_t Phase);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Adds an app or library to the startup timeline
+ *
+ * Clears the timeline entry of the table slot of the resource, and records
+ * the CREATE milestone.  Nothing is recorded once the system is OPERATIONAL.
+ *
+ * \param[in] ResourceId The app or library ID, may still be pending
+ * \param[in] Name       The name of the app or library
+ * \param[in] RecordType The CFE_ES_TimelineRecordType_t of the module
+ */
+void CFE_ES_TimelineAddModule(CFE_ResourceId_t ResourceId, const char *Name, CFE_ES_TimelineRecordType_t RecordType);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Records a milestone of an app or library
+ *
+ * Nothing is recorded if the resource was not added during startup, or
+ * once the system is OPERATIONAL.
+ */
+void CFE_ES_TimelineMarkModule(CFE_ResourceId_t ResourceId, CFE_ES_TimelineMilestone_t Milestone);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Converts a recorded time to microseconds for reporting
+ *
+ * \returns The time in microseconds, or CFE_ES_TIMELINE_NOT_REACHED for 0
+ */
+uint32 CFE_ES_TimelineToUsec(uint64 Ticks);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Reports the startup timeline once the system is OPERATIONAL
+ *
+ * Sends the summary event and writes the timeline to the default file.
+ * This is only done once, and is called from the ES housekeeping request.
+ */
+void CFE_ES_TimelineReport(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Background file write data getter for the startup timeline
+ *
+ * Gets the entry of the boot phases or of a single app or library to write to a file.
+ */
+bool CFE_ES_BackgroundTimelineDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Background file write event handler for the startup timeline
+ *
+ * Report events during writing the startup timeline to a file
+ */
+void CFE_ES_BackgroundTimelineEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
+                                           size_t BlockSize, size_t Position);
+
+#endif /* CFE_ES_TIMELINE_H */
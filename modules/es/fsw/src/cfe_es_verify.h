@@ -52,6 +52,9 @@
 #if CFE_PLATFORM_ES_SYSTEM_LOG_SIZE < 512
 #error CFE_PLATFORM_ES_SYSTEM_LOG_SIZE cannot be less than 512 Bytes!
 #endif
+#if CFE_PLATFORM_ES_SYSTEM_LOG_SIZE > 1048575
+#error CFE_PLATFORM_ES_SYSTEM_LOG_SIZE cannot be greater than 1048575 Bytes!
+#endif
 
 #if CFE_PLATFORM_ES_DEFAULT_STACK_SIZE < 2048
 #error CFE_PLATFORM_ES_DEFAULT_STACK_SIZE cannot be less than 2048 Bytes!
@@ -135,6 +138,21 @@
 #error CFE_PLATFORM_ES_DEFAULT_PR_SYSLOG_MODE cannot be greater than 1!
 #endif
 
+/*
+** Format of the System Log
+*/
+#if CFE_PLATFORM_ES_SYSLOG_BINARY_FORMAT < 0
+#error CFE_PLATFORM_ES_SYSLOG_BINARY_FORMAT cannot be less than 0!
+#elif CFE_PLATFORM_ES_SYSLOG_BINARY_FORMAT > 1
+#error CFE_PLATFORM_ES_SYSLOG_BINARY_FORMAT cannot be greater than 1!
+#endif
+
+#if CFE_PLATFORM_ES_STARTUP_WORKERS < 0
+#error CFE_PLATFORM_ES_STARTUP_WORKERS cannot be less than 0!
+#elif CFE_PLATFORM_ES_STARTUP_WORKERS > 16
+#error CFE_PLATFORM_ES_STARTUP_WORKERS cannot be greater than 16!
+#endif
+
 /*
 ** Maximum number of performance IDs
 */
@@ -149,6 +167,47 @@
 #error CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE cannot be less than 1025 entries!
 #endif
 
+#if CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS < 1
+#error CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS cannot be less than 1!
+#endif
+
+#if (CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS) < 64
+#error Each performance data task buffer must hold at least 64 entries!
+#elif (CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS) > 16777216
+#error Each performance data task buffer cannot hold more than 16777216 entries!
+#endif
+
+#if CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES < 1
+#error CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES cannot be less than 1!
+#elif CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES > 100
+#error CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES cannot be greater than 100!
+#endif
+
+#if CFE_MISSION_ES_PERF_MAX_STATS < 1
+#error CFE_MISSION_ES_PERF_MAX_STATS cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_ES_PERF_STREAM_MS_PERIOD < CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY
+#error CFE_PLATFORM_ES_PERF_STREAM_MS_PERIOD cannot be less than CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY!
+#endif
+
+/*
+** Lock profiler
+*/
+#if CFE_PLATFORM_ES_LOCK_PROFILE != 0 && CFE_PLATFORM_ES_LOCK_PROFILE != 1
+#error CFE_PLATFORM_ES_LOCK_PROFILE must be 0 or 1!
+#endif
+#if CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES < 1
+#error CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES cannot be less than 1!
+#endif
+
+/*
+** Pool size profiler
+*/
+#if CFE_PLATFORM_ES_POOL_SIZE_PROFILE != 0 && CFE_PLATFORM_ES_POOL_SIZE_PROFILE != 1
+#error CFE_PLATFORM_ES_POOL_SIZE_PROFILE must be 0 or 1!
+#endif
+
 /*
 ** Maximum number of Registered CDS blocks
 */
@@ -172,6 +231,28 @@
 #error CFE_PLATFORM_ES_MEMPOOL_ALIGN_SIZE_MIN must be a power of 2!
 #endif
 
+#if CFE_PLATFORM_ES_POOL_LOCK_FREE != 0 && CFE_PLATFORM_ES_POOL_LOCK_FREE != 1
+#error CFE_PLATFORM_ES_POOL_LOCK_FREE must be 0 or 1!
+#endif
+
+#if CFE_PLATFORM_ES_POOL_MAX_MAGAZINE_POOLS < 1
+#error CFE_PLATFORM_ES_POOL_MAX_MAGAZINE_POOLS must be at least 1!
+#elif CFE_PLATFORM_ES_POOL_MAX_MAGAZINE_POOLS > CFE_PLATFORM_ES_MAX_MEMORY_POOLS
+#error CFE_PLATFORM_ES_POOL_MAX_MAGAZINE_POOLS cannot be greater than CFE_PLATFORM_ES_MAX_MEMORY_POOLS!
+#endif
+
+#if CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE < 2
+#error CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE must be at least 2!
+#elif (CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE % 2) != 0
+#error CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE must be an even number!
+#endif
+
+#if CFE_PLATFORM_ES_POOL_MAGAZINES_PER_TASK < 1
+#error CFE_PLATFORM_ES_POOL_MAGAZINES_PER_TASK must be at least 1!
+#elif CFE_PLATFORM_ES_POOL_MAGAZINES_PER_TASK > CFE_PLATFORM_ES_POOL_MAX_BUCKETS
+#error CFE_PLATFORM_ES_POOL_MAGAZINES_PER_TASK cannot be greater than CFE_PLATFORM_ES_POOL_MAX_BUCKETS!
+#endif
+
 /*
 **  Intermediate ES Memory Pool Block Sizes
 */
@@ -318,6 +399,19 @@
 #error CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_16 must be less than CFE_PLATFORM_ES_CDS_MAX_BLOCK_SIZE
 #endif
 
+/*
+** CDS write-behind
+*/
+#if (CFE_PLATFORM_ES_CDS_WRITE_BEHIND_SIZE % 4) != 0
+#error CFE_PLATFORM_ES_CDS_WRITE_BEHIND_SIZE must be a multiple of 4!
+#endif
+
+#if CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE < 10
+#error CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE cannot be less than 10 milliseconds!
+#elif CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE > 60000
+#error CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE cannot be greater than 60000 milliseconds!
+#endif
+
 /*
 ** Validate task stack size...
 */
@@ -337,6 +431,10 @@
 #if ((CFE_MISSION_ES_CDS_MAX_NAME_LENGTH % 4) != 0)
 #error CFE_MISSION_ES_CDS_MAX_NAME_LENGTH must be a multiple of 4
 #endif
+
+#if CFE_MISSION_ES_CRC_MAX_CHUNKS < 1
+#error CFE_MISSION_ES_CRC_MAX_CHUNKS cannot be less than 1!
+#endif
 #if ((CFE_MISSION_ES_CDS_MAX_FULL_NAME_LEN % 4) != 0)
 #error CFE_MISSION_ES_CDS_MAX_FULL_NAME_LEN must be a multiple of 4
 #endif
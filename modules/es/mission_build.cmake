@@ -35,3 +35,6 @@ foreach(ES_CFGFILE ${ES_MISSION_CONFIG_FILE_LIST})
     ${DEFAULT_SOURCE}
   )
 endforeach()
+
+# Add the subdirectory for the host tool that recommends pool block sizes from a pool profile file
+add_subdirectory(${CMAKE_CURRENT_LIST_DIR}/tool cfe_es_poolsize_tool)
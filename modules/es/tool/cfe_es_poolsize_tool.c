@@ -0,0 +1,547 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Pool sizing tool
+ *
+ * Reads the pool profile files written by the ES pool size profiler, and
+ * recommends a list of block sizes for each pool that needs the least memory
+ * to hold the highest number of blocks of each size that were in use at once.
+ *
+ * The requests of the bins of a pool are given to a number of buckets, each
+ * holding a range of consecutive bins.  A bucket has the block size of the
+ * largest request of its bins, so the blocks needed for a bucket are the sum
+ * of the peak use of its bins.  This is an upper bound, as the bins of a
+ * bucket may not have been at their peak at the same time.  The best ranges
+ * are found by dynamic programming over the bins.
+ *
+ * The largest requests may also be left without a block, up to the fraction
+ * of all requests given on the command line, so a few rare large requests do
+ * not need a bucket of their own.
+ */
+
+#include "cfe_fs_extern_typedefs.h"
+#include "cfe_es_poolprof_typedef.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <unistd.h>
+
+/*
+ * Default number of block sizes, the same as CFE_PLATFORM_ES_POOL_MAX_BUCKETS
+ * in the sample configuration.
+ */
+#define CFE_ES_POOLSIZE_DEFAULT_BUCKETS 17
+
+/*
+ * Upper limit of the number of block sizes that can be recommended
+ */
+#define CFE_ES_POOLSIZE_MAX_BUCKETS 64
+
+/*
+ * Default size of the block descriptor on the target, which is
+ * CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE on a 64 bit target.
+ */
+#define CFE_ES_POOLSIZE_DEFAULT_DESC_SIZE 24
+
+/*
+ * Maximum number of distinct pools read from the files
+ */
+#define CFE_ES_POOLSIZE_MAX_POOLS 64
+
+/*
+ * The alignment of a pool is never 0 and always below this, so with the
+ * wrong byte order it is either 0 or at least this large.
+ */
+#define CFE_ES_POOLSIZE_ALIGN_LIMIT 0x10000
+
+/*
+ * Bins of one pool, merged over all files
+ */
+typedef struct
+{
+    uint32_t PoolId;
+    uint32_t PoolSize;
+    uint32_t AlignSize;
+    uint32_t MaxSize[CFE_ES_POOLPROF_HIST_BINS];
+    uint32_t PeakInUse[CFE_ES_POOLPROF_HIST_BINS];
+    uint64_t RequestCount[CFE_ES_POOLPROF_HIST_BINS];
+    uint64_t FailCount[CFE_ES_POOLPROF_HIST_BINS];
+} CFE_ES_PoolSizeTool_Pool_t;
+
+/*
+ * Command line options
+ */
+typedef struct
+{
+    uint32_t MaxBuckets;
+    uint32_t AlignSize;
+    uint32_t DescSize;
+    double   FailFraction;
+    bool     SelectPool;
+    uint32_t PoolId;
+} CFE_ES_PoolSizeTool_Options_t;
+
+static CFE_ES_PoolSizeTool_Pool_t CFE_ES_PoolSizeTool_Pools[CFE_ES_POOLSIZE_MAX_POOLS];
+static uint32_t                   CFE_ES_PoolSizeTool_NumPools;
+
+/*----------------------------------------------------------------
+ *
+ * Prints command line usage information
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PoolSizeTool_PrintUsage(const char *cmd)
+{
+    fprintf(stderr, "Usage: %s [-k max_sizes] [-f fail_fraction] [-a align] [-d desc_size] [-p pool_id] file...\n\n",
+            cmd);
+    fprintf(stderr, "Recommends the block sizes of each pool in the given pool profile files\n");
+    fprintf(stderr, " -k: maximum number of block sizes (default %d)\n", CFE_ES_POOLSIZE_DEFAULT_BUCKETS);
+    fprintf(stderr, " -f: fraction of the largest requests that may fail (default 0)\n");
+    fprintf(stderr, " -a: alignment of the blocks (default from the profile)\n");
+    fprintf(stderr, " -d: size of the block descriptor on the target (default %d)\n",
+            CFE_ES_POOLSIZE_DEFAULT_DESC_SIZE);
+    fprintf(stderr, " -p: only the pool with this handle, 0 for the CDS pool\n\n");
+}
+
+/*----------------------------------------------------------------
+ *
+ * Swaps the byte order of a 32 bit value
+ *
+ *-----------------------------------------------------------------*/
+uint32_t CFE_ES_PoolSizeTool_Swap32(uint32_t Value)
+{
+    return ((Value & 0xFF) << 24) | ((Value & 0xFF00) << 8) | ((Value >> 8) & 0xFF00) | (Value >> 24);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Decodes a big endian 32 bit value of the file header
+ *
+ *-----------------------------------------------------------------*/
+uint32_t CFE_ES_PoolSizeTool_GetBigEndian32(const uint8_t *Ptr)
+{
+    return ((uint32_t)Ptr[0] << 24) | ((uint32_t)Ptr[1] << 16) | ((uint32_t)Ptr[2] << 8) | Ptr[3];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Finds or adds the pool with the given handle
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_PoolSizeTool_Pool_t *CFE_ES_PoolSizeTool_GetPool(uint32_t PoolId)
+{
+    CFE_ES_PoolSizeTool_Pool_t *PoolPtr;
+    uint32_t                    i;
+
+    for (i = 0; i < CFE_ES_PoolSizeTool_NumPools; ++i)
+    {
+        if (CFE_ES_PoolSizeTool_Pools[i].PoolId == PoolId)
+        {
+            return &CFE_ES_PoolSizeTool_Pools[i];
+        }
+    }
+
+    if (CFE_ES_PoolSizeTool_NumPools >= CFE_ES_POOLSIZE_MAX_POOLS)
+    {
+        return NULL;
+    }
+
+    PoolPtr = &CFE_ES_PoolSizeTool_Pools[CFE_ES_PoolSizeTool_NumPools];
+    ++CFE_ES_PoolSizeTool_NumPools;
+
+    memset(PoolPtr, 0, sizeof(*PoolPtr));
+    PoolPtr->PoolId = PoolId;
+
+    return PoolPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Reads the entries of one pool profile file
+ *
+ * The entries are in the byte order of the target, which is found from
+ * the alignment of the first entry.  The bin index can not be used for
+ * this, as bin 0 reads the same in either byte order.  The profiles of
+ * the same pool in several files are merged, keeping the largest sizes
+ * and peaks.
+ *
+ *-----------------------------------------------------------------*/
+int CFE_ES_PoolSizeTool_ReadFile(const char *FileName)
+{
+    FILE *                         fp;
+    uint8_t                        Header[12];
+    uint32_t                       HeaderLength;
+    CFE_ES_PoolProfile_FileEntry_t Entry;
+    CFE_ES_PoolSizeTool_Pool_t *   PoolPtr;
+    uint32_t *                     WordPtr;
+    uint32_t                       i;
+    int                            Swap;
+    int                            Status;
+
+    fp = fopen(FileName, "rb");
+    if (fp == NULL)
+    {
+        perror(FileName);
+        return -1;
+    }
+
+    Status = 0;
+    if (fread(Header, sizeof(Header), 1, fp) != 1 ||
+        CFE_ES_PoolSizeTool_GetBigEndian32(&Header[0]) != CFE_FS_FILE_CONTENT_ID ||
+        CFE_ES_PoolSizeTool_GetBigEndian32(&Header[4]) != CFE_FS_SubType_ES_POOLPROF)
+    {
+        fprintf(stderr, "%s: not a pool profile file\n", FileName);
+        Status = -1;
+    }
+    else
+    {
+        /* the length of the header is given in the header itself */
+        HeaderLength = CFE_ES_PoolSizeTool_GetBigEndian32(&Header[8]);
+        if (HeaderLength < sizeof(Header) || fseek(fp, (long)HeaderLength, SEEK_SET) != 0)
+        {
+            fprintf(stderr, "%s: bad header length %lu\n", FileName, (unsigned long)HeaderLength);
+            Status = -1;
+        }
+    }
+
+    Swap = -1;
+    while (Status == 0 && fread(&Entry, sizeof(Entry), 1, fp) == 1)
+    {
+        if (Swap < 0)
+        {
+            if (Entry.AlignSize != 0 && Entry.AlignSize < CFE_ES_POOLSIZE_ALIGN_LIMIT)
+            {
+                Swap = 0;
+            }
+            else if (Entry.AlignSize != 0 && CFE_ES_PoolSizeTool_Swap32(Entry.AlignSize) < CFE_ES_POOLSIZE_ALIGN_LIMIT)
+            {
+                Swap = 1;
+            }
+            else
+            {
+                fprintf(stderr, "%s: bad alignment 0x%08lx, byte order unknown\n", FileName,
+                        (unsigned long)Entry.AlignSize);
+                Status = -1;
+                break;
+            }
+        }
+
+        if (Swap)
+        {
+            WordPtr = (uint32_t *)&Entry;
+            for (i = 0; i < (sizeof(Entry) / sizeof(uint32_t)); ++i)
+            {
+                WordPtr[i] = CFE_ES_PoolSizeTool_Swap32(WordPtr[i]);
+            }
+        }
+
+        if (Entry.BinIndex >= CFE_ES_POOLPROF_HIST_BINS)
+        {
+            fprintf(stderr, "%s: bad bin index %lu\n", FileName, (unsigned long)Entry.BinIndex);
+            Status = -1;
+            break;
+        }
+
+        PoolPtr = CFE_ES_PoolSizeTool_GetPool(Entry.PoolId);
+        if (PoolPtr == NULL)
+        {
+            fprintf(stderr, "%s: too many pools\n", FileName);
+            Status = -1;
+            break;
+        }
+
+        if (Entry.PoolSize > PoolPtr->PoolSize)
+        {
+            PoolPtr->PoolSize = Entry.PoolSize;
+        }
+        if (Entry.AlignSize > PoolPtr->AlignSize)
+        {
+            PoolPtr->AlignSize = Entry.AlignSize;
+        }
+
+        i = Entry.BinIndex;
+        if (Entry.MaxSize > PoolPtr->MaxSize[i])
+        {
+            PoolPtr->MaxSize[i] = Entry.MaxSize;
+        }
+        if (Entry.PeakInUse > PoolPtr->PeakInUse[i])
+        {
+            PoolPtr->PeakInUse[i] = Entry.PeakInUse;
+        }
+        PoolPtr->RequestCount[i] += Entry.RequestCount;
+        PoolPtr->FailCount[i] += Entry.FailCount;
+    }
+
+    fclose(fp);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Rounds a size up to the alignment
+ *
+ *-----------------------------------------------------------------*/
+uint64_t CFE_ES_PoolSizeTool_Align(uint64_t Size, uint32_t AlignSize)
+{
+    if (AlignSize > 1)
+    {
+        Size += AlignSize - 1;
+        Size -= Size % AlignSize;
+    }
+
+    return Size;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Recommends and prints the block sizes of one pool
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PoolSizeTool_SizePool(const CFE_ES_PoolSizeTool_Pool_t *PoolPtr,
+                                  const CFE_ES_PoolSizeTool_Options_t *OptPtr)
+{
+    /* bins with requests, in order of size, and the cost table of the dynamic programming */
+    uint32_t BinSize[CFE_ES_POOLPROF_HIST_BINS];
+    uint64_t BinPeak[CFE_ES_POOLPROF_HIST_BINS];
+    uint64_t Cost[CFE_ES_POOLSIZE_MAX_BUCKETS + 1][CFE_ES_POOLPROF_HIST_BINS + 1];
+    uint32_t Split[CFE_ES_POOLSIZE_MAX_BUCKETS + 1][CFE_ES_POOLPROF_HIST_BINS + 1];
+    uint64_t BucketSize[CFE_ES_POOLSIZE_MAX_BUCKETS];
+    uint64_t BucketPeak[CFE_ES_POOLSIZE_MAX_BUCKETS];
+    uint64_t TotalCount;
+    uint64_t FailAllowed;
+    uint64_t Dropped;
+    uint64_t Peak;
+    uint64_t Total;
+    uint64_t Used;
+    uint32_t AlignSize;
+    uint32_t HeaderSize;
+    uint32_t NumBins;
+    uint32_t NumBuckets;
+    uint32_t Last;
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+
+    AlignSize = OptPtr->AlignSize;
+    if (AlignSize == 0)
+    {
+        AlignSize = PoolPtr->AlignSize;
+    }
+    HeaderSize = (uint32_t)CFE_ES_PoolSizeTool_Align(OptPtr->DescSize, AlignSize);
+
+    TotalCount = 0;
+    for (i = 0; i < CFE_ES_POOLPROF_HIST_BINS; ++i)
+    {
+        TotalCount += PoolPtr->RequestCount[i] + PoolPtr->FailCount[i];
+    }
+
+    /* leave the largest requests without a block, as long as they are within the allowed fraction */
+    FailAllowed = (uint64_t)(OptPtr->FailFraction * (double)TotalCount);
+    Dropped     = 0;
+    Last        = CFE_ES_POOLPROF_HIST_BINS;
+    while (Last > 0 && (Dropped + PoolPtr->RequestCount[Last - 1] + PoolPtr->FailCount[Last - 1]) <= FailAllowed)
+    {
+        --Last;
+        Dropped += PoolPtr->RequestCount[Last] + PoolPtr->FailCount[Last];
+    }
+
+    NumBins = 0;
+    Used    = 0;
+    for (i = 0; i < Last; ++i)
+    {
+        if (PoolPtr->RequestCount[i] != 0 || PoolPtr->FailCount[i] != 0)
+        {
+            BinSize[NumBins] = PoolPtr->MaxSize[i];
+            BinPeak[NumBins] = PoolPtr->PeakInUse[i];
+            if (BinPeak[NumBins] == 0)
+            {
+                /* only failed requests, which still need a block */
+                BinPeak[NumBins] = 1;
+            }
+            Used += BinPeak[NumBins] * (BinSize[NumBins] + HeaderSize);
+            ++NumBins;
+        }
+    }
+
+    printf("Pool 0x%08lx: size %lu, alignment %lu, %llu requests\n", (unsigned long)PoolPtr->PoolId,
+           (unsigned long)PoolPtr->PoolSize, (unsigned long)AlignSize, (unsigned long long)TotalCount);
+
+    if (NumBins == 0)
+    {
+        printf("  No requests need a block\n\n");
+        return;
+    }
+
+    /*
+     * Cost[k][j] is the least memory to hold the first j bins in k buckets,
+     * and Split[k][j] the first bin of the last of these buckets.
+     */
+    for (k = 0; k <= OptPtr->MaxBuckets; ++k)
+    {
+        for (j = 0; j <= NumBins; ++j)
+        {
+            Cost[k][j]  = UINT64_MAX;
+            Split[k][j] = 0;
+        }
+    }
+    Cost[0][0] = 0;
+
+    for (k = 1; k <= OptPtr->MaxBuckets; ++k)
+    {
+        for (j = 1; j <= NumBins; ++j)
+        {
+            Peak = 0;
+            for (i = j; i > 0; --i)
+            {
+                Peak += BinPeak[i - 1];
+                if (Cost[k - 1][i - 1] != UINT64_MAX)
+                {
+                    Total = Cost[k - 1][i - 1] +
+                            (Peak * (CFE_ES_PoolSizeTool_Align(BinSize[j - 1], AlignSize) + HeaderSize));
+                    if (Total < Cost[k][j])
+                    {
+                        Cost[k][j]  = Total;
+                        Split[k][j] = i - 1;
+                    }
+                }
+            }
+        }
+    }
+
+    /* more buckets never cost more, but use no more of them than needed */
+    NumBuckets = 1;
+    for (k = 2; k <= OptPtr->MaxBuckets && k <= NumBins; ++k)
+    {
+        if (Cost[k][NumBins] < Cost[NumBuckets][NumBins])
+        {
+            NumBuckets = k;
+        }
+    }
+
+    j = NumBins;
+    for (k = NumBuckets; k > 0; --k)
+    {
+        i                 = Split[k][j];
+        BucketSize[k - 1] = CFE_ES_PoolSizeTool_Align(BinSize[j - 1], AlignSize);
+        BucketPeak[k - 1] = 0;
+        while (j > i)
+        {
+            --j;
+            BucketPeak[k - 1] += BinPeak[j];
+        }
+    }
+
+    printf("  Block sizes for CFE_ES_PoolCreateEx:\n");
+    printf("  static const size_t BlockSizes[%lu] = {", (unsigned long)NumBuckets);
+    for (k = 0; k < NumBuckets; ++k)
+    {
+        printf("%s%llu", (k == 0) ? " " : ", ", (unsigned long long)BucketSize[k]);
+    }
+    printf(" };\n");
+
+    for (k = 0; k < NumBuckets; ++k)
+    {
+        printf("    %10llu bytes: up to %llu blocks\n", (unsigned long long)BucketSize[k],
+               (unsigned long long)BucketPeak[k]);
+    }
+
+    printf("  Estimated pool size: %llu bytes, plus the pool overhead\n",
+           (unsigned long long)Cost[NumBuckets][NumBins]);
+    printf("  Bytes lost to rounding up the sizes: %llu\n", (unsigned long long)(Cost[NumBuckets][NumBins] - Used));
+    if (Dropped != 0)
+    {
+        printf("  Requests larger than %llu bytes that would fail: %llu of %llu\n",
+               (unsigned long long)BucketSize[NumBuckets - 1], (unsigned long long)Dropped,
+               (unsigned long long)TotalCount);
+    }
+    printf("\n");
+}
+
+/*----------------------------------------------------------------
+ *
+ * Main routine
+ *
+ *-----------------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+    CFE_ES_PoolSizeTool_Options_t Options;
+    uint32_t                      i;
+    int                           opt;
+
+    memset(&Options, 0, sizeof(Options));
+    Options.MaxBuckets = CFE_ES_POOLSIZE_DEFAULT_BUCKETS;
+    Options.DescSize   = CFE_ES_POOLSIZE_DEFAULT_DESC_SIZE;
+
+    while ((opt = getopt(argc, argv, "k:f:a:d:p:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'k':
+                Options.MaxBuckets = strtoul(optarg, NULL, 0);
+                break;
+            case 'f':
+                Options.FailFraction = strtod(optarg, NULL);
+                break;
+            case 'a':
+                Options.AlignSize = strtoul(optarg, NULL, 0);
+                break;
+            case 'd':
+                Options.DescSize = strtoul(optarg, NULL, 0);
+                break;
+            case 'p':
+                Options.SelectPool = true;
+                Options.PoolId     = strtoul(optarg, NULL, 0);
+                break;
+            default:
+                CFE_ES_PoolSizeTool_PrintUsage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (optind >= argc || Options.MaxBuckets == 0 || Options.MaxBuckets > CFE_ES_POOLSIZE_MAX_BUCKETS ||
+        Options.FailFraction < 0.0 || Options.FailFraction >= 1.0 || (Options.AlignSize & (Options.AlignSize - 1)) != 0)
+    {
+        CFE_ES_PoolSizeTool_PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    while (optind < argc)
+    {
+        if (CFE_ES_PoolSizeTool_ReadFile(argv[optind]) != 0)
+        {
+            return EXIT_FAILURE;
+        }
+        ++optind;
+    }
+
+    for (i = 0; i < CFE_ES_PoolSizeTool_NumPools; ++i)
+    {
+        if (!Options.SelectPool || Options.PoolId == CFE_ES_PoolSizeTool_Pools[i].PoolId)
+        {
+            CFE_ES_PoolSizeTool_SizePool(&CFE_ES_PoolSizeTool_Pools[i], &Options);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
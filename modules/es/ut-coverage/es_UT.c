@@ -129,6 +129,12 @@ static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_CLEAR_ER_LOG_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_CLEAR_ER_LOG_CC, ClearERLogCmd) };
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_ER_LOG_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_WRITE_ER_LOG_CC, WriteERLogCmd) };
+static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_WRITE_LOCK_PROFILE_CC, WriteLockProfileCmd) };
+static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_POOL_PROFILE_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_WRITE_POOL_PROFILE_CC, WritePoolProfileCmd) };
+static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_STARTUP_TIMELINE_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_WRITE_STARTUP_TIMELINE_CC, WriteStartupTimelineCmd) };
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_START_PERF_DATA_CC, StartPerfDataCmd) };
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC =
@@ -137,6 +143,10 @@ static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SET_PERF_FILTER_MASK_CC
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_SET_PERF_FILTER_MASK_CC, SetPerfFilterMaskCmd) };
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SET_PERF_TRIGGER_MASK_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_SET_PERF_TRIGGER_MASK_CC, SetPerfTriggerMaskCmd) };
+static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SET_PERF_STATS_MASK_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_SET_PERF_STATS_MASK_CC, SetPerfStatsMaskCmd) };
+static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SEND_PERF_STATS_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_SEND_PERF_STATS_CC, SendPerfStatsCmd) };
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_RESET_PR_COUNT_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_RESET_PR_COUNT_CC, ResetPRCountCmd) };
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SET_MAX_PR_COUNT_CC =
@@ -227,6 +237,35 @@ void ES_UT_SysLog_snprintf(char *Buffer, size_t BufferSize, const char *SpecStri
     va_end(ap);
 }
 
+/*
+ * Helper function to set the indices of the system log, with no appends in progress
+ */
+void ES_UT_SetSysLogIndex(size_t WriteIdx, size_t EndIdx)
+{
+    CFE_ES_Global.ResetDataPtr->SystemLogState     = CFE_ES_SYSLOG_STATE(WriteIdx, EndIdx, 0, 0, 0);
+    CFE_ES_Global.ResetDataPtr->SystemLogCommitted = CFE_ES_Global.ResetDataPtr->SystemLogState;
+}
+
+/*
+ * Helper function to find text in the data read from the system log,
+ * returns the offset of the text, or the size of the data if it is not found
+ */
+size_t ES_UT_SysLogFind(const CFE_ES_SysLogReadBuffer_t *Buffer, const char *Text)
+{
+    size_t Offset;
+    size_t Len = strlen(Text);
+
+    for (Offset = 0; (Offset + Len) <= Buffer->BlockSize; ++Offset)
+    {
+        if (memcmp(&Buffer->Data[Offset], Text, Len) == 0)
+        {
+            return Offset;
+        }
+    }
+
+    return Buffer->BlockSize;
+}
+
 void ES_UT_FillBuffer(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     char * PrintBuffer = UT_Hook_GetArgValueByName(Context, "PrintBuffer", char *);
@@ -442,6 +481,48 @@ int32 ES_UT_PoolRetrieveFail(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Offset,
     return CFE_ES_CDS_ACCESS_ERROR;
 }
 
+/*
+ * Number of retrieves that ES_UT_PoolRetrieveCountdown() lets through before failing
+ */
+static uint32 ES_UT_PoolRetrieveCount = 0;
+
+/*
+ * Retrieve function that fails after a number of successful calls,
+ * to test failures in the middle of an operation
+ */
+static int32 ES_UT_PoolRetrieveCountdown(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Offset,
+                                         CFE_ES_GenPoolBD_t **BdPtr)
+{
+    if (ES_UT_PoolRetrieveCount == 0)
+    {
+        return CFE_ES_CDS_ACCESS_ERROR;
+    }
+
+    --ES_UT_PoolRetrieveCount;
+    return ES_UT_PoolDirectRetrieve(PoolRecPtr, Offset, BdPtr);
+}
+
+/*
+ * Free stack that ES_UT_PoolRetrieveConcurrent() changes on its next call
+ */
+static uint64 *ES_UT_PoolConcurrentTop = NULL;
+
+/*
+ * Retrieve function that changes the tag of a lock-free free stack once,
+ * as if another task had updated the stack at the same time
+ */
+static int32 ES_UT_PoolRetrieveConcurrent(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Offset,
+                                          CFE_ES_GenPoolBD_t **BdPtr)
+{
+    if (ES_UT_PoolConcurrentTop != NULL)
+    {
+        *ES_UT_PoolConcurrentTop += (uint64)1 << 32;
+        ES_UT_PoolConcurrentTop = NULL;
+    }
+
+    return ES_UT_PoolDirectRetrieve(PoolRecPtr, Offset, BdPtr);
+}
+
 void ES_UT_SetupMemPoolId(CFE_ES_MemPoolRecord_t **OutPoolRecPtr)
 {
     CFE_ResourceId_t        UtPoolID;
@@ -479,6 +560,7 @@ void ES_UT_SetupCDSGlobal(size_t CDS_Size)
     if (CDS_Size > CDS_RESERVED_MIN_SIZE)
     {
         OS_MutSemCreate(&CDS->GenMutex, "UT", 0);
+        OS_MutSemCreate(&CDS->FlushMutex, "UT", 0);
         CDS->TotalSize = CDS_Size;
         CDS->DataSize  = CDS->TotalSize;
         CDS->DataSize -= CDS_RESERVED_MIN_SIZE;
@@ -491,6 +573,20 @@ void ES_UT_SetupCDSGlobal(size_t CDS_Size)
     }
 }
 
+/*
+ * Writes to the first byte of a CDS block while the block is being written to the CDS
+ */
+static int32 ES_UT_CDSWriteDuringFlushHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                           const UT_StubContext_t *Context)
+{
+    CFE_ES_CDSHandle_t *HandlePtr = UserObj;
+    uint8               Value     = 0x77;
+
+    CFE_ES_CDSBlockWriteRange(*HandlePtr, 0, 1, &Value);
+
+    return StubRetcode;
+}
+
 void ES_UT_SetupSingleCDSRegistry(const char *CDSName, size_t BlockSize, bool IsTable, CFE_ES_CDS_RegRec_t **OutRegRec)
 {
     CFE_ES_CDS_RegRec_t *LocalRegRecPtr;
@@ -624,6 +720,44 @@ static int32 ES_UT_SetAppStateHook(void *UserObj, int32 StubRetcode, uint32 Call
     return StubRetcode;
 }
 
+static int32 ES_UT_SystemStateWaitHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                       const UT_StubContext_t *Context)
+{
+    /* Advance the system state as the ES main task would while the caller is blocked */
+    CFE_ES_SetSystemState(*((uint32 *)UserObj));
+
+    return StubRetcode;
+}
+
+static int32 ES_UT_StartupWorkerHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                     const UT_StubContext_t *Context)
+{
+    osal_task_entry EntryFunc = UT_Hook_GetArgValueByName(Context, "function_pointer", osal_task_entry);
+
+    /* Run the startup workers right at their creation, other tasks are not run */
+    if (StubRetcode == OS_SUCCESS && EntryFunc == CFE_ES_StartupWorkerMain)
+    {
+        (*EntryFunc)();
+    }
+
+    return StubRetcode;
+}
+
+static int32 ES_UT_StartupEntryDoneHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                        const UT_StubContext_t *Context)
+{
+    CFE_ES_StartupEntry_t *EntryPtr = UserObj;
+
+    /* Simulates another startup task finishing the entry while waiting */
+    if (EntryPtr->State != CFE_ES_STARTUP_ENTRY_DONE)
+    {
+        EntryPtr->State = CFE_ES_STARTUP_ENTRY_DONE;
+        ++CFE_ES_Global.StartupQueue.NumDone;
+    }
+
+    return StubRetcode;
+}
+
 void UtTest_Setup(void)
 {
     UT_Init("es");
@@ -637,12 +771,22 @@ void UtTest_Setup(void)
     UT_ADD_TEST(TestERLog);
     UT_ADD_TEST(TestTask);
     UT_ADD_TEST(TestPerf);
+    UT_ADD_TEST(TestPerfStream);
+    UT_ADD_TEST(TestPerfTrace);
+    UT_ADD_TEST(TestPerfStats);
+    UT_ADD_TEST(TestLockProfile);
     UT_ADD_TEST(TestAPI);
     UT_ADD_TEST(TestGenericCounterAPI);
+    UT_ADD_TEST(TestCRC);
+    UT_ADD_TEST(TestChunkedCRC);
     UT_ADD_TEST(TestCDS);
     UT_ADD_TEST(TestGenericPool);
     UT_ADD_TEST(TestCDSMempool);
+    UT_ADD_TEST(TestCDSWriteBehind);
     UT_ADD_TEST(TestESMempool);
+    UT_ADD_TEST(TestESMempoolMagazines);
+    UT_ADD_TEST(TestPoolProfile);
+    UT_ADD_TEST(TestStartupTimeline);
     UT_ADD_TEST(TestSysLog);
     UT_ADD_TEST(TestBackground);
     UT_ADD_TEST(TestStatusToString);
@@ -751,6 +895,15 @@ void TestStartupErrorPaths(void)
     UtAssert_UINT32_EQ(PanicStatus, CFE_PSP_PANIC_STARTUP_SEM);
     UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_Panic)), 1);
 
+    /* Perform ES main startup with a system state semaphore creation failure, which is not fatal */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, OS_ERROR);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
+    CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, 1, 1, "ut_startup");
+    UtAssert_STUB_COUNT(CFE_PSP_Panic, 0);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CFE_ES_Global.SystemStateSemId));
+    UtAssert_INT32_EQ(CFE_ES_Global.SystemState, CFE_ES_SystemState_OPERATIONAL);
+
     /* Perform ES main startup with an ES Shared Data mutex creation failure */
     ES_ResetUnitTest();
     UT_SetDummyFuncRtn(OS_SUCCESS);
@@ -836,6 +989,15 @@ void TestStartupErrorPaths(void)
     UtAssert_UINT32_EQ(PanicStatus, CFE_PSP_PANIC_MEMORY_ALLOC);
     UtAssert_STUB_COUNT(CFE_PSP_Panic, 1);
 
+    /* Perform a processor reset with a reset area that is not aligned for the syslog state */
+    ES_ResetUnitTest();
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetResetArea), (uint8 *)ES_UT_PersistentResetData + 1, sizeof(CFE_ES_ResetData_t),
+                     false);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_Panic), &PanicStatus, sizeof(PanicStatus), false);
+    CFE_ES_SetupResetVariables(CFE_PSP_RST_TYPE_PROCESSOR, CFE_PSP_RST_SUBTYPE_POWER_CYCLE, 1);
+    UtAssert_UINT32_EQ(PanicStatus, CFE_PSP_PANIC_MEMORY_ALLOC);
+    UtAssert_STUB_COUNT(CFE_PSP_Panic, 1);
+
     /* Test initialization of the file systems specifying a power on reset
      * following a failure to create the RAM volume
      */
@@ -1107,6 +1269,43 @@ static void ES_UT_SetPerfIdle(void *UserObj, UT_EntryKey_t FuncKey, const UT_Stu
     CFE_ES_Global.ResetDataPtr->Perf.MetaData.State = CFE_ES_PERF_IDLE;
 }
 
+/*
+ * Start a new perf collection run and claim the task buffer for the calling task
+ */
+static CFE_ES_PerfTaskBuffer_t *ES_UT_SetupPerfTaskBuffer(CFE_ES_PerfData_t *Perf)
+{
+    CFE_ES_PerfTaskBuffer_t *BufPtr;
+    CFE_ES_PerfTaskMap_t *   MapPtr;
+    uint32                   State;
+
+    /* buffers are only claimed while collecting, the caller sets the state for the test */
+    State                = Perf->MetaData.State;
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    ++Perf->Generation;
+    Perf->BuffersInUse = 0;
+    MapPtr             = NULL;
+    BufPtr             = CFE_ES_PerfLogGetTaskBuffer(Perf, &MapPtr);
+    UtAssert_NOT_NULL(BufPtr);
+    UtAssert_NOT_NULL(MapPtr);
+    MapPtr->Writing      = 0;
+    Perf->MetaData.State = State;
+
+    return BufPtr;
+}
+
+/*
+ * Reports the timebase from a stamp set by the test, so lock profiler durations are known
+ */
+static void ES_UT_LockProfileTimebase(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 *                   Tbus = UT_Hook_GetArgValueByName(Context, "Tbus", uint32 *);
+    uint32 *                   Tbls = UT_Hook_GetArgValueByName(Context, "Tbls", uint32 *);
+    CFE_ES_LockProfileStamp_t *Now  = UserObj;
+
+    *Tbus = Now->Upper32;
+    *Tbls = Now->Lower32;
+}
+
 static void ES_UT_ForEachObjectIncrease(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     OS_ArgCallback_t callback_ptr = UT_Hook_GetArgValueByName(Context, "callback_ptr", OS_ArgCallback_t);
@@ -1247,6 +1446,97 @@ void TestApps(void)
     ES_ResetUnitTest();
     UtAssert_INT32_EQ(CFE_ES_ParseFileEntry(NULL, 0), CFE_ES_BAD_ARGUMENT);
 
+    /* Test queueing startup script entries, and running them on startup worker tasks */
+    ES_ResetUnitTest();
+    CFE_ES_Global.StartupQueue.IsActive = true;
+    {
+        const char *LibTokens[]  = {"CFE_LIB", "/cf/apps/tst_lib.bundle", "TST_LIB_Init", "TST_LIB", "0", "0", "0x0",
+                                   "0"};
+        const char *App1Tokens[] = {"CFE_APP", "/cf/apps/ci.bundle", "CI_task_main", "CI_APP", "70", "4096", "0x0",
+                                    "0", "TST_LIB"};
+        const char *App2Tokens[] = {"CFE_APP", "/cf/apps/to.bundle", "TO_task_main", "TO_APP", "74", "4096", "0x0",
+                                    "0", "NONE"};
+        const char *App3Tokens[] = {"CFE_APP", "/cf/apps/sch.bundle", "SCH_TaskMain", "SCH_APP", "120", "4096", "0x0",
+                                    "0", "CI_APP:UNKNOWN"};
+
+        CFE_UtAssert_SUCCESS(CFE_ES_ParseFileEntry(LibTokens, 8));
+        CFE_UtAssert_SUCCESS(CFE_ES_ParseFileEntry(App1Tokens, 9));
+        CFE_UtAssert_SUCCESS(CFE_ES_ParseFileEntry(App2Tokens, 9));
+        CFE_UtAssert_SUCCESS(CFE_ES_ParseFileEntry(App3Tokens, 9));
+    }
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.NumEntries, 4);
+    UtAssert_BOOL_TRUE(CFE_ES_Global.StartupQueue.Entries[0].IsLibrary);
+    UtAssert_BOOL_TRUE(CFE_ES_Global.StartupQueue.Entries[0].WaitForAll);
+    UtAssert_BOOL_FALSE(CFE_ES_Global.StartupQueue.Entries[1].WaitForAll);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.Entries[1].NumDeps, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.Entries[1].DepIndex[0], 0);
+    UtAssert_BOOL_FALSE(CFE_ES_Global.StartupQueue.Entries[2].WaitForAll);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.Entries[2].NumDeps, 0);
+    UtAssert_BOOL_TRUE(CFE_ES_Global.StartupQueue.Entries[3].WaitForAll);
+    UtAssert_STUB_COUNT(OS_ModuleLoad, 0);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_StartupWorkerHook, NULL);
+    CFE_ES_RunStartupQueue(2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.Entries[0].State, CFE_ES_STARTUP_ENTRY_DONE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.Entries[3].State, CFE_ES_STARTUP_ENTRY_DONE);
+    CFE_UtAssert_SUCCESS(CFE_ES_Global.StartupQueue.Entries[3].Status);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredLibs, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.ActiveWorkers, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.NumEntries, 0);
+    UtAssert_BOOL_FALSE(CFE_ES_Global.StartupQueue.IsActive);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 1);
+
+    /* Test running the startup queue when a startup worker cannot be created */
+    ES_ResetUnitTest();
+    CFE_ES_Global.StartupQueue.IsActive = true;
+    ES_UT_SetupAppStartParams(&StartParams, "ut/filename", "EntryPoint", 170, 4096, 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_StartupQueueAdd("AppName", false, &StartParams, NULL));
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskCreate), 1, OS_ERROR);
+    CFE_ES_RunStartupQueue(1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.ActiveWorkers, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 1);
+
+    /* Test running the startup queue when the startup semaphore cannot be created */
+    ES_ResetUnitTest();
+    CFE_ES_Global.StartupQueue.IsActive = true;
+    CFE_UtAssert_SUCCESS(CFE_ES_StartupQueueAdd("AppName", false, &StartParams, NULL));
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemCreate), 1, OS_ERROR);
+    CFE_ES_RunStartupQueue(1);
+    UtAssert_STUB_COUNT(OS_TaskCreate, 1);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 1);
+
+    /* Test queueing a startup script entry when the startup queue is full */
+    ES_ResetUnitTest();
+    CFE_ES_Global.StartupQueue.NumEntries = CFE_ES_STARTUP_QUEUE_SIZE;
+    UtAssert_INT32_EQ(CFE_ES_StartupQueueAdd("AppName", false, &StartParams, "NONE"),
+                      CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
+
+    /*
+     * Test processing the startup queue while an entry is loaded by another task.
+     * The entries that do not depend on it are started first.
+     */
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(CFE_ES_StartupQueueAdd("Lib1", true, &StartParams, NULL));
+    CFE_UtAssert_SUCCESS(CFE_ES_StartupQueueAdd("App1", false, &StartParams, "Lib1"));
+    CFE_UtAssert_SUCCESS(CFE_ES_StartupQueueAdd("App2", false, &StartParams, ":"));
+    CFE_ES_Global.StartupQueue.Entries[0].State = CFE_ES_STARTUP_ENTRY_LOADING;
+    UT_SetHookFunction(UT_KEY(OS_BinSemTimedWait), ES_UT_StartupEntryDoneHook,
+                       &CFE_ES_Global.StartupQueue.Entries[0]);
+    CFE_ES_StartupQueueProcess();
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 1);
+    UtAssert_STUB_COUNT(OS_ModuleLoad, 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.NumDone, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.Entries[1].State, CFE_ES_STARTUP_ENTRY_DONE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.Entries[2].State, CFE_ES_STARTUP_ENTRY_DONE);
+
+    /* Test queueing a startup script entry with too many dependencies */
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(CFE_ES_StartupQueueAdd("App1", false, &StartParams, "NONE"));
+    CFE_UtAssert_SUCCESS(
+        CFE_ES_StartupQueueAdd("App2", false, &StartParams, "App1:App1:App1:App1:App1:App1:App1:App1:App1"));
+    UtAssert_BOOL_TRUE(CFE_ES_Global.StartupQueue.Entries[1].WaitForAll);
+
     /* Test application loading and creation with a task creation failure */
     ES_ResetUnitTest();
     UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreate), OS_ERROR);
@@ -2178,8 +2468,13 @@ void TestGenericPool(void)
          * so that the implementation will sort them.
          */
         16, 56, 60, 40, 44, 48, 64, 128, 20, 24, 28, 12, 52, 32, 4, 8, 36};
+    static const size_t UT_BUDDY_BLOCK_SIZES[2] = {96, 1};
     uint16              i;
+    uint16              BucketId;
     uint32              ExpectedCount;
+    int32               Status;
+    CFE_ES_MemOffset_t  FreeBlockBytes;
+    CFE_ES_MemOffset_t  LargestFreeBlock;
     CFE_ES_GenPoolBD_t *BdPtr;
 
     ES_ResetUnitTest();
@@ -2476,6 +2771,226 @@ void TestGenericPool(void)
     ES_ResetUnitTest();
     UtAssert_INT32_EQ(CFE_ES_GenPoolRecyclePoolBlock(&Pool1, 0, Pool1.Buckets[0].BlockSize, &Offset1),
                       CFE_ES_BUFFER_NOT_IN_POOL);
+
+    /* Test the size class lookup, which must find the smallest bucket that fits */
+    ES_ResetUnitTest();
+    memset(&UT_MemPoolDirectBuffer, 0xee, sizeof(UT_MemPoolDirectBuffer));
+    OffsetEnd = sizeof(UT_MemPoolDirectBuffer.Data);
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolInitialize(&Pool1, 0, OffsetEnd, 32, CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
+                                                UT_POOL_BLOCK_SIZES, ES_UT_PoolRetrieveConcurrent,
+                                                ES_UT_PoolDirectCommit));
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 0), Pool1.NumBuckets);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 4), Pool1.NumBuckets);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 5), Pool1.NumBuckets - 1);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 44), Pool1.NumBuckets - 10);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 45), Pool1.NumBuckets - 11);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 65), 1);
+    UtAssert_ZERO(CFE_ES_GenPoolFindBucket(&Pool1, 129));
+
+    /*
+     * Test a lock-free pool, which returns and recycles blocks with atomic operations.
+     * Without concurrent tasks the fallbacks behave the same, so the lock-free
+     * paths are tested even if the target does not support them.
+     */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolEnableLockFree(&Pool1), CFE_ES_ATOMIC_LOCK_FREE);
+    Pool1.LockFree = true;
+
+    /* Nothing to recycle yet, and nothing for sizes that do not fit any bucket */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetFreeBlock(&Pool1, &Offset1, 42), CFE_ES_BUFFER_NOT_IN_POOL);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetFreeBlock(&Pool1, &Offset1, 1000), CFE_ES_BUFFER_NOT_IN_POOL);
+
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 42));
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 42));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1));
+    UtAssert_EQ(size_t, BlockSize, 42);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset2));
+
+    /* A block returned twice is rejected */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset2), CFE_ES_POOL_BLOCK_INVALID);
+
+    /* The last block returned is recycled first, also if another task changes the stack meanwhile */
+    ES_UT_PoolConcurrentTop = &Pool1.Buckets[10].FreeStackTop; /* 44 byte bucket */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetFreeBlock(&Pool1, &Offset3, 42));
+    UtAssert_EQ(size_t, Offset3, Offset2);
+    UtAssert_NULL(ES_UT_PoolConcurrentTop);
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, Pool1.NumBuckets - 10, &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumCreated, 2);
+    UtAssert_UINT32_EQ(BlockStats.NumFree, 1);
+
+    /* A corrupted block on top of the stack is not recycled */
+    CFE_UtAssert_SETUP(ES_UT_PoolDirectRetrieve(&Pool1, Offset1 - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr));
+    BdPtr->Allocated        = 0;
+    ES_UT_PoolConcurrentTop = &Pool1.Buckets[10].FreeStackTop;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetFreeBlock(&Pool1, &Offset4, 42), CFE_ES_BUFFER_NOT_IN_POOL);
+
+    /* Retrieve failure */
+    Pool1.Retrieve = ES_UT_PoolRetrieveFail;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetFreeBlock(&Pool1, &Offset4, 42), CFE_ES_CDS_ACCESS_ERROR);
+
+    /* A block held in a cache is neither allocated nor free */
+    ES_ResetUnitTest();
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolInitialize(&Pool1, 0, OffsetEnd, 32, CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
+                                                UT_POOL_BLOCK_SIZES, ES_UT_PoolDirectRetrieve, ES_UT_PoolDirectCommit));
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 42));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolCacheBlock(&Pool1, &BlockSize, &BucketId, Offset1));
+    UtAssert_EQ(size_t, BlockSize, 42);
+    UtAssert_UINT32_EQ(BucketId, Pool1.NumBuckets - 10);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockSize(&Pool1, &BlockSize, Offset1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolCacheBlock(&Pool1, &BlockSize, &BucketId, Offset1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_UINT32_EQ(Pool1.ValidationErrorCount, 2);
+
+    /* Uncaching keeps the size of the block if the new size is 0 */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolUncacheBlock(&Pool1, Offset1, 0));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlockSize(&Pool1, &BlockSize, Offset1));
+    UtAssert_EQ(size_t, BlockSize, 42);
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolCacheBlock(&Pool1, &BlockSize, &BucketId, Offset1));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolUncacheBlock(&Pool1, Offset1, 43));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlockSize(&Pool1, &BlockSize, Offset1));
+    UtAssert_EQ(size_t, BlockSize, 43);
+
+    /* Only cached blocks can be uncached, with a size that fits the bucket */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolUncacheBlock(&Pool1, Offset1, 0), CFE_ES_POOL_BLOCK_INVALID);
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolCacheBlock(&Pool1, &BlockSize, &BucketId, Offset1));
+    UtAssert_INT32_EQ(CFE_ES_GenPoolUncacheBlock(&Pool1, Offset1, 45), CFE_ES_POOL_BLOCK_INVALID);
+    CFE_UtAssert_SETUP(ES_UT_PoolDirectRetrieve(&Pool1, Offset1 - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr));
+    BdPtr->CheckBits = ~CFE_ES_CHECK_PATTERN;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolUncacheBlock(&Pool1, Offset1, 0), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolCacheBlock(&Pool1, &BlockSize, &BucketId, Offset1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_UINT32_EQ(Pool1.ValidationErrorCount, 6);
+
+    /* Offsets outside of the pool */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolCacheBlock(&Pool1, &BlockSize, &BucketId, 0), CFE_ES_BUFFER_NOT_IN_POOL);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolUncacheBlock(&Pool1, OffsetEnd, 0), CFE_ES_BUFFER_NOT_IN_POOL);
+
+    /* Retrieve failure */
+    Pool1.Retrieve = ES_UT_PoolRetrieveFail;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolCacheBlock(&Pool1, &BlockSize, &BucketId, Offset1), CFE_ES_CDS_ACCESS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolUncacheBlock(&Pool1, Offset1, 0), CFE_ES_CDS_ACCESS_ERROR);
+
+    /* The fragmentation counts free blocks, and new blocks that still fit at the tail */
+    ES_ResetUnitTest();
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolInitialize(&Pool1, 0, 64, 32, 2, UT_BUDDY_BLOCK_SIZES, ES_UT_PoolDirectRetrieve,
+                                                ES_UT_PoolDirectCommit));
+    CFE_ES_GenPoolGetFragmentation(&Pool1, &FreeBlockBytes, &LargestFreeBlock);
+    UtAssert_ZERO(FreeBlockBytes);
+    UtAssert_EQ(CFE_ES_MemOffset_t, LargestFreeBlock, 1);
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 1));
+    CFE_ES_GenPoolGetFragmentation(&Pool1, &FreeBlockBytes, &LargestFreeBlock);
+    UtAssert_ZERO(LargestFreeBlock);
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1));
+    CFE_ES_GenPoolGetFragmentation(&Pool1, &FreeBlockBytes, &LargestFreeBlock);
+    UtAssert_EQ(CFE_ES_MemOffset_t, FreeBlockBytes, 1);
+    UtAssert_EQ(CFE_ES_MemOffset_t, LargestFreeBlock, 1);
+    UtAssert_VOIDCALL(CFE_ES_GenPoolGetFragmentation(&Pool1, NULL, NULL));
+
+    /*
+     * Buddy pools split and merge blocks.  With an alignment of 32 the descriptor
+     * takes 32 bytes, so these sizes give blocks of 64 and 128 bytes in total.
+     */
+    ES_ResetUnitTest();
+    memset(&UT_MemPoolDirectBuffer, 0xee, sizeof(UT_MemPoolDirectBuffer));
+    OffsetEnd = sizeof(UT_MemPoolDirectBuffer.Data);
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolInitialize(&Pool1, 0, OffsetEnd, 32, 2, UT_BUDDY_BLOCK_SIZES,
+                                                ES_UT_PoolDirectRetrieve, ES_UT_PoolDirectCommit));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolEnableBuddy(&Pool1));
+    UtAssert_BOOL_TRUE(Pool1.Buddy);
+    UtAssert_UINT32_EQ(Pool1.NumBuckets, 2);
+    UtAssert_EQ(size_t, Pool1.Buckets[0].BlockSize, 32);
+    UtAssert_EQ(size_t, Pool1.Buckets[1].BlockSize, 96);
+
+    /* Small blocks are split from large blocks, which are made at the tail */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 20));
+    UtAssert_EQ(size_t, Offset1, 32);
+    UtAssert_EQ(size_t, Pool1.TailPosition, 128);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 20));
+    UtAssert_EQ(size_t, Offset2, 96);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset3, 20));
+    UtAssert_EQ(size_t, Offset3, 160);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset4, 20));
+    UtAssert_EQ(size_t, Offset4, 224);
+    UtAssert_EQ(size_t, Pool1.TailPosition, 256);
+
+    /* The rest of the pool is too small for another block */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 20), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    CFE_ES_GenPoolGetFragmentation(&Pool1, &FreeBlockBytes, &LargestFreeBlock);
+    UtAssert_ZERO(FreeBlockBytes);
+    UtAssert_ZERO(LargestFreeBlock);
+
+    /* A block is only merged with its buddy once both are free */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1));
+    UtAssert_EQ(size_t, BlockSize, 20);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset3));
+    CFE_ES_GenPoolGetFragmentation(&Pool1, &FreeBlockBytes, &LargestFreeBlock);
+    UtAssert_EQ(CFE_ES_MemOffset_t, FreeBlockBytes, 64);
+    UtAssert_EQ(CFE_ES_MemOffset_t, LargestFreeBlock, 32);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset4));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset2));
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, 2, &BlockStats);
+    UtAssert_ZERO(BlockStats.NumCreated);
+    UtAssert_ZERO(BlockStats.NumFree);
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, 1, &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumCreated, 2);
+    UtAssert_UINT32_EQ(BlockStats.NumFree, 2);
+    CFE_ES_GenPoolGetFragmentation(&Pool1, &FreeBlockBytes, &LargestFreeBlock);
+    UtAssert_EQ(CFE_ES_MemOffset_t, FreeBlockBytes, 192);
+    UtAssert_EQ(CFE_ES_MemOffset_t, LargestFreeBlock, 96);
+
+    /* The upper halves of merged blocks are no longer valid blocks */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset2), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset4), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockSize(&Pool1, &BlockSize, Offset1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_UINT32_EQ(Pool1.ValidationErrorCount, 2);
+
+    /* The memory of the small blocks is reused for large blocks */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 96));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 96));
+    UtAssert_BOOL_TRUE(Offset1 != Offset2);
+    UtAssert_EQ(size_t, Pool1.TailPosition, 256);
+
+    /* A corrupted free block is not used */
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1));
+    CFE_UtAssert_SETUP(ES_UT_PoolDirectRetrieve(&Pool1, Offset1 - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr));
+    BdPtr->Allocated = 0;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 20), CFE_ES_BUFFER_NOT_IN_POOL);
+
+    /* Too many sizes between the smallest and the largest block */
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolInitialize(&Pool1, 0, OffsetEnd, 32, CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
+                                                UT_POOL_BLOCK_SIZES, ES_UT_PoolDirectRetrieve,
+                                                ES_UT_PoolDirectCommit));
+    Pool1.Buckets[Pool1.NumBuckets - 1].BlockSize = (size_t)1 << (CFE_PLATFORM_ES_POOL_MAX_BUCKETS + 6);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolEnableBuddy(&Pool1), CFE_ES_BAD_ARGUMENT);
+    UtAssert_BOOL_FALSE(Pool1.Buddy);
+
+    /* Retrieve failures at each step of making, splitting and merging blocks */
+    for (i = 0; i < 9; ++i)
+    {
+        CFE_UtAssert_SETUP(CFE_ES_GenPoolInitialize(&Pool1, 0, OffsetEnd, 32, 2, UT_BUDDY_BLOCK_SIZES,
+                                                    ES_UT_PoolDirectRetrieve, ES_UT_PoolDirectCommit));
+        CFE_UtAssert_SETUP(CFE_ES_GenPoolEnableBuddy(&Pool1));
+        Pool1.Retrieve          = ES_UT_PoolRetrieveCountdown;
+        ES_UT_PoolRetrieveCount = i;
+
+        Status = CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 20);
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset1);
+        }
+        UtAssert_INT32_EQ(Status, CFE_ES_CDS_ACCESS_ERROR);
+    }
+
+    /* Retrieve failures when recycling a free block */
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolInitialize(&Pool1, 0, OffsetEnd, 32, 2, UT_BUDDY_BLOCK_SIZES,
+                                                ES_UT_PoolDirectRetrieve, ES_UT_PoolDirectCommit));
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolEnableBuddy(&Pool1));
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 20));
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 20));
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset2));
+    Pool1.Retrieve          = ES_UT_PoolRetrieveCountdown;
+    ES_UT_PoolRetrieveCount = 1;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 20), CFE_ES_CDS_ACCESS_ERROR);
+    Pool1.Retrieve = ES_UT_PoolRetrieveFail;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 20), CFE_ES_CDS_ACCESS_ERROR);
 }
 
 void TestTask(void)
@@ -2516,6 +3031,7 @@ void TestTask(void)
     CFE_ES_TaskId_t         TaskId;
     uint32                  Idx;
     uint32                  Idx1;
+    size_t                  SysLogSize;
 
     UtPrintf("Begin Test Task");
 
@@ -2524,8 +3040,7 @@ void TestTask(void)
      * depending on the value that the index has reached from previous tests
      */
     memset(&CmdBuf, 0, sizeof(CmdBuf));
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = 0;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx;
+    ES_UT_SetSysLogIndex(0, 0);
 
     /* Test task main process loop with a command pipe error */
     ES_ResetUnitTest();
@@ -3102,11 +3617,10 @@ void TestTask(void)
     ES_ResetUnitTest();
     memset(&CmdBuf, 0, sizeof(CmdBuf));
     UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx =
-        snprintf(CFE_ES_Global.ResetDataPtr->SystemLog, sizeof(CFE_ES_Global.ResetDataPtr->SystemLog),
-                 "0000-000-00:00:00.00000 Test Message\n");
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx = CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx;
-    CmdBuf.WriteSysLogCmd.Payload.FileName[0]   = '\0';
+    SysLogSize = snprintf(CFE_ES_Global.ResetDataPtr->SystemLog, sizeof(CFE_ES_Global.ResetDataPtr->SystemLog),
+                          "0000-000-00:00:00.00000 Test Message\n");
+    ES_UT_SetSysLogIndex(SysLogSize, SysLogSize);
+    CmdBuf.WriteSysLogCmd.Payload.FileName[0] = '\0';
     UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteSysLogCmd),
                     UT_TPID_CFE_ES_CMD_WRITE_SYS_LOG_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
@@ -3584,8 +4098,12 @@ void TestPerf(void)
 
     UtPrintf("Begin Test Performance Log");
 
-    CFE_ES_PerfData_t *Perf;
-    void *             TempBuff;
+    CFE_ES_PerfData_t *      Perf;
+    CFE_ES_PerfTaskBuffer_t *BufPtr;
+    CFE_ES_PerfTaskMap_t *   MapPtr;
+    void *                   TempBuff;
+    uint32                   BufferIdx;
+    uint32                   i;
 
     /*
     ** Set the pointer to the data area
@@ -3637,7 +4155,7 @@ void TestPerf(void)
      */
     ES_ResetUnitTest();
     memset(&CmdBuf, 0, sizeof(CmdBuf));
-    CmdBuf.PerfStartCmd.Payload.TriggerMode = (CFE_ES_PerfTrigger_END + 1);
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = (CFE_ES_PerfTrigger_STREAM + 1);
     UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
                     UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_TRIG_ERR_EID);
@@ -3670,6 +4188,26 @@ void TestPerf(void)
                     UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_ERR_EID);
 
+    /* Test performance data collection start while a task is still writing
+     * an entry in the buffers of the previous run
+     */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    Perf->MetaData.State                    = CFE_ES_PERF_TRIGGERED;
+    Perf->Generation                        = 0xffffffff;
+    Perf->BuffersInUse                      = 2;
+    CFE_ES_Global.PerfTaskMap[1].Writing    = 1;
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PerfTrigger_START;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_ERR_EID);
+    UtAssert_STUB_COUNT(OS_TaskDelay, CFE_ES_PERF_WRITER_WAIT_LIMIT);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    UtAssert_UINT32_EQ(Perf->Generation, 1);
+    UtAssert_UINT32_EQ(Perf->BuffersInUse, 2);
+    UtAssert_ZERO(CFE_ES_Global.TaskData.CommandCounter);
+
     /* Test performance data collection by sending another valid
      * start command
      */
@@ -3773,9 +4311,7 @@ void TestPerf(void)
     /* Test successful addition of a new entry to the performance log */
     ES_ResetUnitTest();
     Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER;
-    Perf->MetaData.TriggerCount          = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 1;
     Perf->MetaData.InvalidMarkerReported = false;
-    Perf->MetaData.DataEnd               = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 1;
     CFE_ES_PerfLogAdd(CFE_MISSION_ES_PERF_MAX_IDS, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.InvalidMarkerReported, true);
 
@@ -3783,9 +4319,11 @@ void TestPerf(void)
      * trigger mode
      */
     ES_ResetUnitTest();
+    BufPtr                               = ES_UT_SetupPerfTaskBuffer(Perf);
+    BufPtr->TriggerCount                 = CFE_ES_PERF_TASK_BUFFER_SIZE;
     Perf->MetaData.InvalidMarkerReported = true;
+    Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER;
     Perf->MetaData.Mode                  = CFE_ES_PerfTrigger_START;
-    Perf->MetaData.DataCount             = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 1;
     Perf->MetaData.TriggerMask[0]        = 0xFFFF;
     CFE_ES_PerfLogAdd(1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PerfTrigger_START);
@@ -3795,9 +4333,10 @@ void TestPerf(void)
      * trigger mode
      */
     ES_ResetUnitTest();
-    Perf->MetaData.State        = CFE_ES_PERF_TRIGGERED;
-    Perf->MetaData.Mode         = CFE_ES_PerfTrigger_CENTER;
-    Perf->MetaData.TriggerCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 + 1;
+    BufPtr                      = ES_UT_SetupPerfTaskBuffer(Perf);
+    BufPtr->TriggerCount = CFE_ES_PERF_TASK_BUFFER_SIZE / 2 + 1;
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode  = CFE_ES_PerfTrigger_CENTER;
     CFE_ES_PerfLogAdd(1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PerfTrigger_CENTER);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
@@ -3806,17 +4345,46 @@ void TestPerf(void)
      * trigger mode
      */
     ES_ResetUnitTest();
+    ES_UT_SetupPerfTaskBuffer(Perf);
     Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
     Perf->MetaData.Mode  = CFE_ES_PerfTrigger_END;
     CFE_ES_PerfLogAdd(1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PerfTrigger_END);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
 
-    /* Test addition where state goes to idle after first check */
+    /* Test addition where state goes to idle before claiming the buffer, no buffer is claimed */
     ES_ResetUnitTest();
     Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    Perf->BuffersInUse   = 0;
     UT_SetHandlerFunction(UT_KEY(OS_MutSemTake), ES_UT_SetPerfIdle, NULL);
     CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_ZERO(Perf->BuffersInUse);
+    UtAssert_ZERO(Perf->TaskBuffer[0].WriteCount);
+
+    /* Test addition where state goes to idle after claiming the buffer, the task is not left writing */
+    ES_ResetUnitTest();
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    Perf->BuffersInUse   = 0;
+    UT_SetHandlerFunction(UT_KEY(OS_MutSemGive), ES_UT_SetPerfIdle, NULL);
+    CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(Perf->BuffersInUse, 1);
+    UtAssert_ZERO(Perf->TaskBuffer[0].WriteCount);
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        UtAssert_ZERO(CFE_ES_Global.PerfTaskMap[i].Writing);
+    }
+
+    /* Test that the writing flag is cleared once an entry is recorded */
+    ES_ResetUnitTest();
+    BufPtr                       = ES_UT_SetupPerfTaskBuffer(Perf);
+    Perf->MetaData.State         = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.FilterMask[0] = 0xffff;
+    CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(BufPtr->WriteCount, 1);
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        UtAssert_ZERO(CFE_ES_Global.PerfTaskMap[i].Writing);
+    }
 
     /* Test addition of a new entry to the performance log with an invalid
      * marker after an invalid marker has already been reported
@@ -3831,26 +4399,28 @@ void TestPerf(void)
      * is not in the filter mask
      */
     ES_ResetUnitTest();
+    BufPtr                       = ES_UT_SetupPerfTaskBuffer(Perf);
     Perf->MetaData.State         = CFE_ES_PERF_TRIGGERED;
     Perf->MetaData.FilterMask[0] = 0x0;
-    Perf->MetaData.DataEnd       = 0;
     CFE_ES_PerfLogAdd(0x1, 0);
-    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 0);
+    UtAssert_ZERO(BufPtr->WriteCount);
 
     /* Test addition of a new entry to the performance log with the data count
      * below the maximum allowed
      */
     ES_ResetUnitTest();
+    BufPtr                       = ES_UT_SetupPerfTaskBuffer(Perf);
     Perf->MetaData.State         = CFE_ES_PERF_WAITING_FOR_TRIGGER;
-    Perf->MetaData.DataCount     = 0;
     Perf->MetaData.FilterMask[0] = 0xffff;
     CFE_ES_PerfLogAdd(0x1, 0);
-    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 1);
+    UtAssert_UINT32_EQ(BufPtr->WriteCount, 1);
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogCountEntries(NULL, NULL), 1);
 
     /* Test addition of a new entry to the performance log with a marker that
      * is not in the trigger mask
      */
     ES_ResetUnitTest();
+    ES_UT_SetupPerfTaskBuffer(Perf);
     Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
     Perf->MetaData.TriggerMask[0] = 0x0;
     CFE_ES_PerfLogAdd(0x1, 0);
@@ -3860,20 +4430,21 @@ void TestPerf(void)
      * trigger mode and the trigger count is less the buffer size
      */
     ES_ResetUnitTest();
-    Perf->MetaData.TriggerCount   = 0;
+    BufPtr                        = ES_UT_SetupPerfTaskBuffer(Perf);
     Perf->MetaData.State          = CFE_ES_PERF_TRIGGERED;
     Perf->MetaData.Mode           = CFE_ES_PerfTrigger_START;
     Perf->MetaData.TriggerMask[0] = 0xffff;
     CFE_ES_PerfLogAdd(0x1, 0);
-    UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, 1);
+    UtAssert_UINT32_EQ(BufPtr->TriggerCount, 1);
 
     /* Test addition of a new entry to the performance log with a center
      * trigger mode and the trigger count is less than half the buffer size
      */
     ES_ResetUnitTest();
-    Perf->MetaData.TriggerCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 - 2;
-    Perf->MetaData.State        = CFE_ES_PERF_TRIGGERED;
-    Perf->MetaData.Mode         = CFE_ES_PerfTrigger_CENTER;
+    BufPtr               = ES_UT_SetupPerfTaskBuffer(Perf);
+    BufPtr->TriggerCount = CFE_ES_PERF_TASK_BUFFER_SIZE / 2 - 2;
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode  = CFE_ES_PerfTrigger_CENTER;
     CFE_ES_PerfLogAdd(0x1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
 
@@ -3881,12 +4452,40 @@ void TestPerf(void)
      * trigger mode
      */
     ES_ResetUnitTest();
-    Perf->MetaData.TriggerCount = 0;
-    Perf->MetaData.State        = CFE_ES_PERF_TRIGGERED;
-    Perf->MetaData.Mode         = -1;
+    ES_UT_SetupPerfTaskBuffer(Perf);
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode  = -1;
     CFE_ES_PerfLogAdd(0x1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
 
+    /* Entries wrap within the task buffer, keeping the newest */
+    ES_ResetUnitTest();
+    BufPtr               = ES_UT_SetupPerfTaskBuffer(Perf);
+    BufPtr->WriteCount            = CFE_ES_PERF_TASK_BUFFER_SIZE + 5;
+    Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.FilterMask[0]  = 0xffff;
+    Perf->MetaData.TriggerMask[0] = 0x0;
+    CFE_ES_PerfLogAdd(0x3, 1);
+    UtAssert_UINT32_EQ(BufPtr->Entries[5].Data, 0x3 | (1 << CFE_MISSION_ES_PERF_EXIT_BIT));
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogCountEntries(NULL, NULL), CFE_ES_PERF_TASK_BUFFER_SIZE);
+
+    /* Tasks that log after all buffers are claimed have their entries dropped */
+    ES_ResetUnitTest();
+    ES_UT_SetupPerfTaskBuffer(Perf);
+    CFE_ES_Global.PerfTaskMap[0].Generation = 0;
+    CFE_ES_Global.PerfTaskMap[1].Generation = 0;
+    Perf->BuffersInUse                      = CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS;
+    Perf->MetaData.State                    = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.FilterMask[0]            = 0xffff;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogCountDropped(), 2);
+
+    /* Buffer lookup fails if the calling task is not known to OSAL */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdToArrayIndex), 1, OS_ERR_INVALID_ID);
+    UtAssert_NULL(CFE_ES_PerfLogGetTaskBuffer(Perf, &MapPtr));
+
     /* Test performance data collection start with an invalid message length */
     ES_ResetUnitTest();
     UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), 0, UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
@@ -3942,22 +4541,67 @@ void TestPerf(void)
     UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.CurrentState, CFE_ES_PerfDumpState_IDLE);
     CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
 
-    /* Test the ability of the file writer to handle the "wrap around" from the end of
-     * the perflog buffer back to the beginning.  Just need to set up the metadata
-     * so that the writing position is toward the end of the buffer.
+    /* Test a task that is still writing an entry when the log is merged */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_INIT;
+    CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.CurrentState, CFE_ES_PerfDumpState_DELAY);
+    CFE_ES_Global.PerfTaskMap[1].Writing = 1;
+    CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.CurrentState, CFE_ES_PerfDumpState_IDLE);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_LOG_ERR_EID);
+    UtAssert_STUB_COUNT(OS_TaskDelay, CFE_ES_PERF_WRITER_WAIT_LIMIT);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    CFE_ES_Global.PerfTaskMap[1].Writing = 0;
+
+    /* Test the ability of the file writer to merge the task buffers into a single
+     * time-ordered stream, including the "wrap around" from the end of a task buffer
+     * back to the beginning.  Set up two buffers with interleaved time stamps, where
+     * the first one is positioned toward the end of the buffer.
      */
     ES_ResetUnitTest();
     memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    memset(Perf->TaskBuffer, 0, sizeof(Perf->TaskBuffer));
+    Perf->TaskBuffer[0].Entries[CFE_ES_PERF_TASK_BUFFER_SIZE - 1].TimerLower32 = 1;
+    Perf->TaskBuffer[0].Entries[0].TimerLower32                                = 3;
+    Perf->TaskBuffer[1].Entries[0].TimerLower32                                = 2;
+    Perf->TaskBuffer[1].Entries[1].TimerLower32                                = 4;
     OS_OpenCreate(&CFE_ES_Global.BackgroundPerfDumpState.FileDesc, "UT", 0, OS_WRITE_ONLY);
     CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
     CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
-    CFE_ES_Global.BackgroundPerfDumpState.DataPos      = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 2;
+    CFE_ES_Global.BackgroundPerfDumpState.MergePos[0]  = CFE_ES_PERF_TASK_BUFFER_SIZE - 1;
+    CFE_ES_Global.BackgroundPerfDumpState.MergeEnd[0]  = CFE_ES_PERF_TASK_BUFFER_SIZE + 1;
+    CFE_ES_Global.BackgroundPerfDumpState.MergePos[1]  = 0;
+    CFE_ES_Global.BackgroundPerfDumpState.MergeEnd[1]  = 2;
     CFE_ES_Global.BackgroundPerfDumpState.StateCounter = 4;
     CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
-    /* check that the wraparound occurred */
-    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.DataPos, 2);
+    /* check that both buffers were consumed, including the wraparound */
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.MergePos[0], CFE_ES_PERF_TASK_BUFFER_SIZE + 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.MergePos[1], 2);
     /* should have written 4 entries to the log */
     UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.FileSize, sizeof(CFE_ES_PerfDataEntry_t) * 4);
+    /* nothing left to merge */
+    UtAssert_NULL(CFE_ES_PerfLogMergeNext(CFE_ES_Global.BackgroundPerfDumpState.MergePos,
+                                          CFE_ES_Global.BackgroundPerfDumpState.MergeEnd, NULL));
+
+    /* Merge order follows the time stamps, with the upper word taking precedence */
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    Perf->TaskBuffer[0].Entries[0].TimerUpper32       = 1;
+    Perf->TaskBuffer[0].Entries[0].TimerLower32       = 0;
+    Perf->TaskBuffer[1].Entries[0].TimerUpper32       = 0;
+    Perf->TaskBuffer[1].Entries[0].TimerLower32       = 5;
+    CFE_ES_Global.BackgroundPerfDumpState.MergeEnd[0] = 1;
+    CFE_ES_Global.BackgroundPerfDumpState.MergeEnd[1] = 1;
+    UtAssert_ADDRESS_EQ(CFE_ES_PerfLogMergeNext(CFE_ES_Global.BackgroundPerfDumpState.MergePos,
+                                                CFE_ES_Global.BackgroundPerfDumpState.MergeEnd, &BufferIdx),
+                        &Perf->TaskBuffer[1].Entries[0]);
+    UtAssert_UINT32_EQ(BufferIdx, 1);
+    UtAssert_ADDRESS_EQ(CFE_ES_PerfLogMergeNext(CFE_ES_Global.BackgroundPerfDumpState.MergePos,
+                                                CFE_ES_Global.BackgroundPerfDumpState.MergeEnd, &BufferIdx),
+                        &Perf->TaskBuffer[0].Entries[0]);
+    UtAssert_UINT32_EQ(BufferIdx, 0);
 
     /* Cover close file branch with undefined file descriptor */
     ES_ResetUnitTest();
@@ -3991,54 +4635,735 @@ void TestPerf(void)
     UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDumpRemaining(), 10);
 }
 
-void TestAPI(void)
+void TestPerfStream(void)
 {
-    osal_id_t            TestObjId;
-    char                 AppName[OS_MAX_API_NAME + 12];
-    char                 SysLogBuf[CFE_TIME_PRINTED_STRING_SIZE + 20];
-    size_t               SysLogBufSize;
-    uint32               StackBuf[8];
-    uint8                Data[12];
-    uint32               ResetType;
-    CFE_ES_AppId_t       AppId;
-    CFE_ES_TaskId_t      TaskId;
-    uint32               RunStatus;
-    CFE_ES_TaskInfo_t    TaskInfo;
-    CFE_ES_AppInfo_t     AppInfo;
-    CFE_ES_AppRecord_t * UtAppRecPtr;
-    CFE_ES_TaskRecord_t *UtTaskRecPtr;
-
-    UtPrintf("Begin Test API");
+    union
+    {
+        CFE_MSG_Message_t         Msg;
+        CFE_ES_StartPerfDataCmd_t PerfStartCmd;
+        CFE_ES_StopPerfDataCmd_t  PerfStopCmd;
+        CFE_ES_SendHkCmd_t        SendHkCmd;
+    } CmdBuf;
+    CFE_ES_PerfData_t *        Perf;
+    CFE_ES_PerfTaskBuffer_t *  BufPtr;
+    CFE_ES_PerfStreamGlobal_t *State;
+    void *                     TempBuff;
+    void *                     LocalBuffer;
+    size_t                     LocalBufSize;
 
-    /* Coverage for processing async event */
-    UtAssert_VOIDCALL(CFE_ES_ProcessAsyncEvent());
+    UtPrintf("Begin Test Performance Log Streaming");
 
-    /* Test resetting the cFE with a processor reset */
-    ES_ResetUnitTest();
-    ResetType = CFE_PSP_RST_TYPE_PROCESSOR;
-    CFE_ES_Global.ResetDataPtr->ResetVars.ProcessorResetCount =
-        CFE_ES_Global.ResetDataPtr->ResetVars.MaxProcessorResetCount - 1;
-    CFE_ES_ResetCFE(ResetType);
-    CFE_ES_Global.ResetDataPtr->ResetVars.ProcessorResetCount =
-        CFE_ES_Global.ResetDataPtr->ResetVars.MaxProcessorResetCount;
-    UtAssert_INT32_EQ(CFE_ES_ResetCFE(ResetType), CFE_ES_NOT_IMPLEMENTED);
-    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_POR_MAX_PROC_RESETS]);
+    /*
+    ** Set the pointer to the data area
+    */
+    UT_GetDataBuffer(UT_KEY(CFE_PSP_GetResetArea), &TempBuff, NULL, NULL);
+    ES_UT_PersistentResetData = TempBuff;
 
-    /* Test getting the reset type using a valid pointer and a null pointer */
-    ES_ResetUnitTest();
-    UtAssert_INT32_EQ(CFE_ES_GetResetType(&ResetType), CFE_PSP_RST_TYPE_PROCESSOR);
-    UtAssert_INT32_EQ(CFE_ES_GetResetType(NULL), CFE_PSP_RST_TYPE_PROCESSOR);
+    Perf  = &ES_UT_PersistentResetData->Perf;
+    State = &CFE_ES_Global.BackgroundPerfStreamState;
 
-    /* Test resetting the cFE with a power on reset */
+    /* Test starting a collection in the STREAM mode */
     ES_ResetUnitTest();
-    UtAssert_INT32_EQ(CFE_ES_ResetCFE(CFE_PSP_RST_TYPE_POWERON), CFE_ES_NOT_IMPLEMENTED);
-    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_POR_COMMANDED]);
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PerfTrigger_STREAM;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_EID);
+    UtAssert_BOOL_TRUE(State->Active);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+    UtAssert_NOT_NULL(State->FileWrite.GetData);
+    UtAssert_NOT_NULL(State->FileWrite.OnEvent);
 
-    /* Test resetting the cFE with an invalid argument */
-    ES_ResetUnitTest();
-    UtAssert_INT32_EQ(CFE_ES_ResetCFE(CFE_PSP_RST_TYPE_POWERON + 3), CFE_ES_BAD_ARGUMENT);
+    /* A new collection cannot start while streaming */
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PerfTrigger_START;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_ERR_EID);
 
-    /* Test restarting an app that doesn't exist */
+    /* Stopping a stream does not start a dump */
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStopCmd),
+                    UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STOPCMD_EID);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.PendingState, CFE_ES_PerfDumpState_IDLE);
+    UtAssert_BOOL_TRUE(State->Active);
+
+    /* A second stop is rejected while the final file is written */
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStopCmd),
+                    UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STOPCMD_ERR2_EID);
+
+    /* Entries not yet streamed are never overwritten */
+    ES_ResetUnitTest();
+    BufPtr                       = ES_UT_SetupPerfTaskBuffer(Perf);
+    BufPtr->WriteCount           = CFE_ES_PERF_TASK_BUFFER_SIZE + 3;
+    BufPtr->ReadCount            = 3;
+    Perf->MetaData.State         = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode          = CFE_ES_PerfTrigger_STREAM;
+    Perf->MetaData.FilterMask[0] = 0xffff;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(BufPtr->WriteCount, CFE_ES_PERF_TASK_BUFFER_SIZE + 3);
+    UtAssert_UINT32_EQ(BufPtr->OverflowCount, 1);
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogCountDropped(), 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+
+    /* Once there is room again the entry is recorded, and only unread entries are counted */
+    BufPtr->ReadCount = 10;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(BufPtr->WriteCount, CFE_ES_PERF_TASK_BUFFER_SIZE + 4);
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogCountEntries(NULL, NULL), CFE_ES_PERF_TASK_BUFFER_SIZE - 6);
+
+    /* The counters wrap without losing entries or stalling the stream */
+    BufPtr->WriteCount = 0xFFFFFFFF;
+    BufPtr->ReadCount  = 0xFFFFFFFF - CFE_ES_PERF_TASK_BUFFER_SIZE + 2;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_ZERO(BufPtr->WriteCount);
+    UtAssert_UINT32_EQ(BufPtr->Entries[CFE_ES_PERF_TASK_BUFFER_SIZE - 1].Data, 0x1);
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogCountEntries(NULL, NULL), CFE_ES_PERF_TASK_BUFFER_SIZE - 1);
+    CFE_ES_PerfLogAdd(0x2, 0);
+    UtAssert_UINT32_EQ(BufPtr->WriteCount, 1);
+    UtAssert_UINT32_EQ(BufPtr->Entries[0].Data, 0x2);
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogCountEntries(State->MergePos, State->MergeEnd), CFE_ES_PERF_TASK_BUFFER_SIZE);
+    State->MergePos[0] = 0xFFFFFFFF;
+    UtAssert_ADDRESS_EQ(CFE_ES_PerfLogMergeNext(State->MergePos, State->MergeEnd, NULL),
+                        &BufPtr->Entries[CFE_ES_PERF_TASK_BUFFER_SIZE - 1]);
+    UtAssert_ADDRESS_EQ(CFE_ES_PerfLogMergeNext(State->MergePos, State->MergeEnd, NULL), &BufPtr->Entries[0]);
+    UtAssert_NULL(CFE_ES_PerfLogMergeNext(State->MergePos, State->MergeEnd, NULL));
+    CFE_ES_PerfLogAdd(0x3, 0);
+    UtAssert_UINT32_EQ(BufPtr->OverflowCount, 2);
+
+    /* The stream job is idle when no stream is active */
+    ES_ResetUnitTest();
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(100, State));
+
+    /* Nothing is written while the previous file is pending */
+    ES_ResetUnitTest();
+    State->Active = true;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(100, State));
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
+
+    /* Nothing is written when no entries are waiting */
+    ES_ResetUnitTest();
+    ES_UT_SetupPerfTaskBuffer(Perf);
+    State->Active        = true;
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(CFE_PLATFORM_ES_PERF_STREAM_MS_PERIOD, State));
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
+
+    /* Entries are held until the period has passed */
+    ES_ResetUnitTest();
+    BufPtr               = ES_UT_SetupPerfTaskBuffer(Perf);
+    BufPtr->WriteCount   = 4;
+    State->Active        = true;
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(CFE_PLATFORM_ES_PERF_STREAM_MS_PERIOD - 1, State));
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
+
+    /* If the FS request queue is full the request is retried later */
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_BackgroundFileDumpRequest), 1, CFE_STATUS_REQUEST_ALREADY_PENDING);
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(1, State));
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    UtAssert_UINT32_EQ(State->ElapsedTime, CFE_PLATFORM_ES_PERF_STREAM_MS_PERIOD);
+
+    /* Once the period has passed the next file is requested */
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(1, State));
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 2);
+    UtAssert_ZERO(State->ElapsedTime);
+    UtAssert_UINT32_EQ(State->SegmentCount, 4);
+    UtAssert_UINT32_EQ(State->MetaData.DataCount, 4);
+    UtAssert_STRINGBUF_EQ(State->FileWrite.FileName, sizeof(State->FileWrite.FileName),
+                          CFE_PLATFORM_ES_DEFAULT_PERF_STREAM_FILENAME "_00.dat", -1);
+
+    /* Write the file: record 0 is the metadata, then the entries, the last one is EOF */
+    UtAssert_BOOL_FALSE(CFE_ES_PerfStreamFileDataGetter(State, 0, &LocalBuffer, &LocalBufSize));
+    UtAssert_ADDRESS_EQ(LocalBuffer, &State->MetaData);
+    UtAssert_UINT32_EQ(LocalBufSize, sizeof(CFE_ES_PerfMetaData_t));
+    UtAssert_BOOL_FALSE(CFE_ES_PerfStreamFileDataGetter(State, 1, &LocalBuffer, &LocalBufSize));
+    UtAssert_ADDRESS_EQ(LocalBuffer, &State->EntryBuffer);
+    UtAssert_UINT32_EQ(LocalBufSize, sizeof(CFE_ES_PerfDataEntry_t));
+    UtAssert_BOOL_FALSE(CFE_ES_PerfStreamFileDataGetter(State, 2, &LocalBuffer, &LocalBufSize));
+    UtAssert_BOOL_FALSE(CFE_ES_PerfStreamFileDataGetter(State, 3, &LocalBuffer, &LocalBufSize));
+    UtAssert_BOOL_TRUE(CFE_ES_PerfStreamFileDataGetter(State, 4, &LocalBuffer, &LocalBufSize));
+    UtAssert_UINT32_EQ(LocalBufSize, sizeof(CFE_ES_PerfDataEntry_t));
+    UtAssert_BOOL_TRUE(CFE_ES_PerfStreamFileDataGetter(State, 5, &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    /* Completing the file releases the entries and advances the rolling set */
+    Perf->MetaData.DataCount = 0;
+    CFE_ES_PerfStreamFileEventHandler(State, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 5, 0, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_EID);
+    UtAssert_UINT32_EQ(BufPtr->ReadCount, 4);
+    UtAssert_UINT32_EQ(State->FileIndex, 1);
+    UtAssert_UINT32_EQ(State->FileCount, 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 4);
+    UtAssert_ZERO(CFE_ES_PerfLogCountEntries(NULL, NULL));
+
+    /* A half full task buffer is written before the period has passed */
+    BufPtr->WriteCount = BufPtr->ReadCount + CFE_ES_PERF_TASK_BUFFER_SIZE / 2;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(1, State));
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 3);
+    UtAssert_STRINGBUF_EQ(State->FileWrite.FileName, sizeof(State->FileWrite.FileName),
+                          CFE_PLATFORM_ES_DEFAULT_PERF_STREAM_FILENAME "_01.dat", -1);
+
+    /* Entries of files that could not be written are discarded and counted */
+    CFE_ES_PerfStreamFileEventHandler(State, CFE_FS_FileWriteEvent_CREATE_ERROR, -1, 0, 0, 0);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_LOG_ERR_EID);
+    UtAssert_UINT32_EQ(State->DiscardCount, CFE_ES_PERF_TASK_BUFFER_SIZE / 2);
+    UtAssert_UINT32_EQ(BufPtr->ReadCount, BufPtr->WriteCount);
+
+    State->SegmentCount = 1;
+    CFE_ES_PerfStreamFileEventHandler(State, CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR, -1, 0, 10, 0);
+    CFE_ES_PerfStreamFileEventHandler(State, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, -1, 0, 10, 0);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+    UtAssert_UINT32_EQ(State->DiscardCount, CFE_ES_PERF_TASK_BUFFER_SIZE / 2 + 1);
+
+    /* Unhandled events are ignored */
+    State->FileIndex = 0;
+    CFE_ES_PerfStreamFileEventHandler(State, CFE_FS_FileWriteEvent_UNDEFINED, CFE_SUCCESS, 0, 0, 0);
+    UtAssert_ZERO(State->FileIndex);
+
+    /* The rolling set wraps around */
+    State->FileIndex = CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES - 1;
+    CFE_ES_PerfStreamFileEventHandler(State, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 0, 0, 0);
+    UtAssert_ZERO(State->FileIndex);
+
+    /* After the stop the remaining entries are written right away, then the stream ends */
+    BufPtr->WriteCount   = BufPtr->ReadCount + 1;
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(1, State));
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 4);
+    CFE_ES_PerfStreamFileEventHandler(State, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 0, 0, 0);
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(1, State));
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_STOPPED_EID);
+    UtAssert_BOOL_FALSE(State->Active);
+
+    /* The drop counters and file count are reported in housekeeping */
+    ES_ResetUnitTest();
+    ES_UT_SetupPerfTaskBuffer(Perf)->OverflowCount = 2;
+    State->DiscardCount                            = 3;
+    State->FileCount                               = 4;
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.SendHkCmd), UT_TPID_CFE_ES_SEND_HK);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.HkPacket.Payload.PerfDroppedCount, 5);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.HkPacket.Payload.PerfStreamFileCount, 4);
+}
+
+void TestPerfTrace(void)
+{
+    union
+    {
+        CFE_MSG_Message_t        Msg;
+        CFE_ES_StopPerfDataCmd_t PerfStopCmd;
+    } CmdBuf;
+    CFE_ES_PerfData_t *      Perf;
+    CFE_ES_PerfMetaData_t    MetaData;
+    CFE_ES_PerfDataEntry_t   Entry;
+    CFE_ES_PerfDumpGlobal_t *State;
+    void *                   TempBuff;
+    char                     LineBuf[CFE_ES_PERF_TRACE_LINE_SIZE];
+
+    UtPrintf("Begin Test Performance Log Trace Format");
+
+    /*
+    ** Set the pointer to the data area
+    */
+    UT_GetDataBuffer(UT_KEY(CFE_PSP_GetResetArea), &TempBuff, NULL, NULL);
+    ES_UT_PersistentResetData = TempBuff;
+
+    Perf  = &ES_UT_PersistentResetData->Perf;
+    State = &CFE_ES_Global.BackgroundPerfDumpState;
+
+    /* Test performance data collection stop with an invalid dump format */
+    ES_ResetUnitTest();
+    memset(State, 0, sizeof(*State));
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CmdBuf.PerfStopCmd.Payload.DumpFormat = CFE_ES_PerfDumpFormat_TRACE_JSON + 1;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStopCmd),
+                    UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_LOG_ERR_EID);
+    UtAssert_UINT32_EQ(State->PendingState, CFE_ES_PerfDumpState_IDLE);
+
+    /* Test successful stop with the trace format selected */
+    ES_ResetUnitTest();
+    memset(State, 0, sizeof(*State));
+    CmdBuf.PerfStopCmd.Payload.DumpFormat = CFE_ES_PerfDumpFormat_TRACE_JSON;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStopCmd),
+                    UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STOPCMD_EID);
+    UtAssert_UINT32_EQ(State->DumpFormat, CFE_ES_PerfDumpFormat_TRACE_JSON);
+
+    /* Nominal trace dump of an empty log, should only write the prologue and trailer */
+    ES_ResetUnitTest();
+    memset(State, 0, sizeof(*State));
+    State->DumpFormat   = CFE_ES_PerfDumpFormat_TRACE_JSON;
+    State->PendingState = CFE_ES_PerfDumpState_INIT;
+    CFE_ES_RunPerfLogDump(1000, State);
+    CFE_ES_RunPerfLogDump(1000, State);
+    UtAssert_UINT32_EQ(State->CurrentState, CFE_ES_PerfDumpState_IDLE);
+    UtAssert_NONZERO(State->FileSize);
+
+    /* Tracks are only written for task buffers that have entries */
+    ES_ResetUnitTest();
+    memset(State, 0, sizeof(*State));
+    memset(Perf->TaskBuffer, 0, sizeof(Perf->TaskBuffer));
+    OS_OpenCreate(&State->FileDesc, "UT", 0, OS_WRITE_ONLY);
+    State->DumpFormat   = CFE_ES_PerfDumpFormat_TRACE_JSON;
+    State->CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_METADATA;
+    State->PendingState = CFE_ES_PerfDumpState_WRITE_PERF_METADATA;
+    State->StateCounter = CFE_PLATFORM_ES_PERF_MAX_TASK_BUFFERS;
+    State->MergeEnd[1]  = 1;
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetInfo), 1, OS_ERROR);
+    CFE_ES_RunPerfLogDump(1000, State);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_NONZERO(State->FileSize);
+
+    /* Each merged entry becomes one line, attributed to the track of its task buffer */
+    State->FileSize     = 0;
+    State->CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    State->PendingState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    State->StateCounter = 1;
+    CFE_ES_RunPerfLogDump(1000, State);
+    UtAssert_UINT32_EQ(State->MergePos[1], 1);
+    UtAssert_NONZERO(State->FileSize);
+
+    /* Test the marker name lookup */
+    UtAssert_STRINGBUF_EQ(CFE_ES_PerfLogMarkerName(CFE_MISSION_ES_MAIN_PERF_ID), -1, "ES_Main", -1);
+    UtAssert_NULL(CFE_ES_PerfLogMarkerName(CFE_MISSION_ES_PERF_MAX_IDS - 1));
+
+    /* Test formatting an entry marker with a time under one second */
+    memset(&MetaData, 0, sizeof(MetaData));
+    memset(&Entry, 0, sizeof(Entry));
+    MetaData.TimerTicksPerSecond = 1000000;
+    Entry.Data                   = CFE_MISSION_ES_MAIN_PERF_ID;
+    Entry.TimerLower32           = 1500;
+    UtAssert_NONZERO(CFE_ES_PerfTraceFormatEntry(LineBuf, sizeof(LineBuf), &MetaData, &Entry, 7));
+    UtAssert_STRINGBUF_EQ(LineBuf, sizeof(LineBuf),
+                          ",\n{\"name\":\"ES_Main\",\"ph\":\"B\",\"pid\":1,\"tid\":7,\"ts\":1500.000}", -1);
+
+    /* Test formatting an exit marker with no name, using the rollover value */
+    MetaData.TimerTicksPerSecond = 1000;
+    MetaData.TimerLow32Rollover  = 1000;
+    Entry.Data                   = 999 | (1U << CFE_MISSION_ES_PERF_EXIT_BIT);
+    Entry.TimerUpper32           = 2;
+    Entry.TimerLower32           = 500;
+    UtAssert_NONZERO(CFE_ES_PerfTraceFormatEntry(LineBuf, sizeof(LineBuf), &MetaData, &Entry, 7));
+    UtAssert_STRINGBUF_EQ(
+        LineBuf, sizeof(LineBuf),
+        ",\n{\"name\":\"Marker999\",\"ph\":\"E\",\"pid\":1,\"tid\":7,\"ts\":2500000.000}", -1);
+
+    /* A zero tick rate must not cause a divide by zero */
+    MetaData.TimerTicksPerSecond = 0;
+    UtAssert_NONZERO(CFE_ES_PerfTraceFormatEntry(LineBuf, sizeof(LineBuf), &MetaData, &Entry, 7));
+
+    /* Lines that do not fit are truncated to the buffer, and a missing entry writes nothing */
+    UtAssert_UINT32_EQ(CFE_ES_PerfTraceFormatEntry(LineBuf, 10, &MetaData, &Entry, 7), 9);
+    UtAssert_ZERO(CFE_ES_PerfTraceFormatEntry(LineBuf, sizeof(LineBuf), &MetaData, NULL, 7));
+
+    /* Test the track name of a task that no longer exists */
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetInfo), 1, OS_ERROR);
+    UtAssert_NONZERO(CFE_ES_PerfTraceFormatTrack(LineBuf, sizeof(LineBuf), 7));
+    UtAssert_STRINGBUF_EQ(
+        LineBuf, sizeof(LineBuf),
+        ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":7,\"args\":{\"name\":\"Task7\"}}", -1);
+    UtAssert_UINT32_EQ(CFE_ES_PerfTraceFormatTrack(LineBuf, 10, 7), 9);
+}
+
+void TestPerfStats(void)
+{
+    union
+    {
+        CFE_MSG_Message_t            Msg;
+        CFE_ES_SetPerfStatsMaskCmd_t PerfSetStatsMaskCmd;
+        CFE_ES_SendPerfStatsCmd_t    PerfSendStatsCmd;
+    } CmdBuf;
+    CFE_ES_PerfData_t *            Perf;
+    CFE_ES_PerfStatsGlobal_t *     Stats;
+    CFE_ES_PerfStatsEntry_t *      StatPtr;
+    CFE_ES_PerfStatsTlm_Payload_t *TlmPtr;
+    void *                         TempBuff;
+
+    UtPrintf("Begin Test Performance Marker Statistics");
+
+    /*
+    ** Set the pointer to the data area
+    */
+    UT_GetDataBuffer(UT_KEY(CFE_PSP_GetResetArea), &TempBuff, NULL, NULL);
+    ES_UT_PersistentResetData = TempBuff;
+
+    Perf   = &ES_UT_PersistentResetData->Perf;
+    Stats  = &CFE_ES_Global.PerfStats;
+    TlmPtr = &CFE_ES_Global.TaskData.PerfStatsPacket.Payload;
+
+    /* Test the histogram bins, including both ends of the 32 bit range */
+    UtAssert_UINT32_EQ(CFE_ES_PerfStatsBin(0), 0);
+    UtAssert_UINT32_EQ(CFE_ES_PerfStatsBin(3), 3);
+    UtAssert_UINT32_EQ(CFE_ES_PerfStatsBin(4), 4);
+    UtAssert_UINT32_EQ(CFE_ES_PerfStatsBin(7), 7);
+    UtAssert_UINT32_EQ(CFE_ES_PerfStatsBin(8), 8);
+    UtAssert_UINT32_EQ(CFE_ES_PerfStatsBin(9), 8);
+    UtAssert_UINT32_EQ(CFE_ES_PerfStatsBin(10), 9);
+    UtAssert_UINT32_EQ(CFE_ES_PerfStatsBin(0xFFFFFFFF), CFE_ES_PERF_STATS_HIST_BINS - 1);
+    UtAssert_UINT32_EQ(CFE_ES_PerfStatsBinLimit(3), 3);
+    UtAssert_UINT32_EQ(CFE_ES_PerfStatsBinLimit(8), 9);
+    UtAssert_UINT32_EQ(CFE_ES_PerfStatsBinLimit(CFE_ES_PERF_STATS_HIST_BINS - 1), 0xFFFFFFFF);
+
+    /* Test setting the statistics mask, which also clears the statistics collected so far */
+    ES_ResetUnitTest();
+    Stats->NumEntries     = 1;
+    Stats->UntrackedCount = 1;
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CmdBuf.PerfSetStatsMaskCmd.Payload.StatsMaskNum = 0;
+    CmdBuf.PerfSetStatsMaskCmd.Payload.StatsMask    = 0x2;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfSetStatsMaskCmd),
+                    UT_TPID_CFE_ES_CMD_SET_PERF_STATS_MASK_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STATSMSKCMD_EID);
+    UtAssert_UINT32_EQ(Stats->Mask[0], 0x2);
+    UtAssert_ZERO(Stats->NumEntries);
+    UtAssert_ZERO(Stats->UntrackedCount);
+
+    /* Test setting the statistics mask with an out of range index */
+    ES_ResetUnitTest();
+    CmdBuf.PerfSetStatsMaskCmd.Payload.StatsMaskNum = CFE_ES_PERF_32BIT_WORDS_IN_MASK;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfSetStatsMaskCmd),
+                    UT_TPID_CFE_ES_CMD_SET_PERF_STATS_MASK_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STATSMSKERR_EID);
+
+    /* Test that a selected marker is measured from entry to exit while the log is idle */
+    ES_ResetUnitTest();
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    Stats->Mask[0]       = 0x2;
+    StatPtr              = &Stats->Entries[0];
+    CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(Stats->NumEntries, 1);
+    UtAssert_UINT32_EQ(StatPtr->Marker, 1);
+    UtAssert_BOOL_TRUE(StatPtr->InEntry);
+    CFE_ES_PerfLogAdd(1, 1);
+    UtAssert_UINT32_EQ(StatPtr->Count, 1);
+    UtAssert_BOOL_FALSE(StatPtr->InEntry);
+
+    /* An exit without an entry is not measured */
+    CFE_ES_PerfLogAdd(1, 1);
+    UtAssert_UINT32_EQ(StatPtr->Count, 1);
+
+    /* Markers that are not selected, or out of range, are not measured */
+    CFE_ES_PerfLogAdd(2, 0);
+    CFE_ES_PerfLogAdd(CFE_MISSION_ES_PERF_MAX_IDS, 0);
+    UtAssert_UINT32_EQ(Stats->NumEntries, 1);
+
+    /* An exit of a selected marker that was never entered does not claim an entry */
+    Stats->Mask[0] = 0xA;
+    CFE_ES_PerfLogAdd(3, 1);
+    UtAssert_UINT32_EQ(Stats->NumEntries, 1);
+
+    /* A duration beyond 32 bits is saturated */
+    CFE_ES_PerfLogAdd(1, 0);
+    StatPtr->EntryUpper32 = 0xFFFFFFFF;
+    CFE_ES_PerfLogAdd(1, 1);
+    UtAssert_UINT32_EQ(StatPtr->Count, 2);
+    UtAssert_UINT32_EQ(StatPtr->MaxTicks, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(StatPtr->Histogram[CFE_ES_PERF_STATS_HIST_BINS - 1], 1);
+
+    /* No entry is claimed if the task cannot be identified */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdToArrayIndex), 1, OS_ERROR);
+    CFE_ES_PerfLogAdd(3, 0);
+    UtAssert_UINT32_EQ(Stats->NumEntries, 1);
+
+    /* Markers are counted as untracked once all entries are in use */
+    Stats->NumEntries = CFE_MISSION_ES_PERF_MAX_STATS;
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    CFE_ES_PerfLogAdd(3, 0);
+    UtAssert_UINT32_EQ(Stats->UntrackedCount, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, !CFE_ES_ATOMIC_LOCK_FREE);
+
+    /* Test sending the statistics, which are converted to microseconds */
+    ES_ResetUnitTest();
+    Perf->MetaData.TimerTicksPerSecond = 1000000;
+    Stats->NumEntries                  = 2;
+    StatPtr                            = &Stats->Entries[0];
+    StatPtr->Marker                    = 1;
+    StatPtr->Count                     = 100;
+    StatPtr->MinTicks                  = 10;
+    StatPtr->MaxTicks                  = 1000;
+    StatPtr->SumTicks                  = 2000;
+
+    StatPtr->Histogram[CFE_ES_PerfStatsBin(10)]   = 99;
+    StatPtr->Histogram[CFE_ES_PerfStatsBin(1000)] = 1;
+
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfSendStatsCmd),
+                    UT_TPID_CFE_ES_CMD_SEND_PERF_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STATS_TLM_EID);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(TlmPtr->NumStats, 2);
+    UtAssert_UINT32_EQ(TlmPtr->Stats[0].Marker, 1);
+    UtAssert_UINT32_EQ(TlmPtr->Stats[0].Count, 100);
+    UtAssert_UINT32_EQ(TlmPtr->Stats[0].MinTime, 10);
+    UtAssert_UINT32_EQ(TlmPtr->Stats[0].AvgTime, 20);
+    UtAssert_UINT32_EQ(TlmPtr->Stats[0].MaxTime, 1000);
+    UtAssert_UINT32_EQ(TlmPtr->Stats[0].P99Time, CFE_ES_PerfStatsBinLimit(CFE_ES_PerfStatsBin(10)));
+    UtAssert_ZERO(TlmPtr->Stats[1].Count);
+    UtAssert_ZERO(TlmPtr->Stats[1].MaxTime);
+
+    /* The 99th percentile is limited to the longest duration */
+    StatPtr->Histogram[CFE_ES_PerfStatsBin(10)]   = 1;
+    StatPtr->Histogram[CFE_ES_PerfStatsBin(1000)] = 99;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfSendStatsCmd),
+                    UT_TPID_CFE_ES_CMD_SEND_PERF_STATS_CC);
+    UtAssert_UINT32_EQ(TlmPtr->Stats[0].P99Time, 1000);
+
+    /* Times too long for the telemetry are saturated, and without a tick rate the ticks are reported */
+    Perf->MetaData.TimerTicksPerSecond = 1;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfSendStatsCmd),
+                    UT_TPID_CFE_ES_CMD_SEND_PERF_STATS_CC);
+    UtAssert_UINT32_EQ(TlmPtr->Stats[0].MaxTime, 0xFFFFFFFF);
+    Perf->MetaData.TimerTicksPerSecond = 0;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfSendStatsCmd),
+                    UT_TPID_CFE_ES_CMD_SEND_PERF_STATS_CC);
+    UtAssert_UINT32_EQ(TlmPtr->Stats[0].MaxTime, 1000);
+}
+
+void TestLockProfile(void)
+{
+    union
+    {
+        CFE_MSG_Message_t            Msg;
+        CFE_ES_WriteLockProfileCmd_t WriteLockProfileCmd;
+    } CmdBuf;
+    CFE_ES_LockProfileRecord_t *    RecPtr;
+    CFE_ES_LockProfileSite_t *      SitePtr;
+    CFE_ES_LockProfileDumpState_t * StatePtr;
+    CFE_ES_LockProfile_FileEntry_t *EntryPtr;
+    CFE_ES_LockProfileStamp_t       Stamp;
+    CFE_ES_LockProfileStamp_t       Now;
+    uint32                          i;
+    void *                          Buffer;
+    size_t                          BufSize;
+
+    UtPrintf("Begin Test Lock Profile");
+
+    /* Test the histogram bins, including a duration beyond the last bin */
+    UtAssert_UINT32_EQ(CFE_ES_LockProfileBin(0), 0);
+    UtAssert_UINT32_EQ(CFE_ES_LockProfileBin(1), 1);
+    UtAssert_UINT32_EQ(CFE_ES_LockProfileBin(2), 2);
+    UtAssert_UINT32_EQ(CFE_ES_LockProfileBin(3), 2);
+    UtAssert_UINT32_EQ(CFE_ES_LockProfileBin(4), 3);
+    UtAssert_UINT32_EQ(CFE_ES_LockProfileBin(0xFFFFFFFFFFFFULL), CFE_ES_LOCKPROF_HIST_BINS - 1);
+
+    /* Test the wait and hold times of a single acquisition */
+    ES_ResetUnitTest();
+    memset(&Now, 0, sizeof(Now));
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Get_Timebase), ES_UT_LockProfileTimebase, &Now);
+    RecPtr      = &CFE_ES_Global.LockProfile.Locks[CFE_ES_LockProfileId_ES_SHARED_DATA];
+    Now.Lower32 = 100;
+    CFE_ES_LockProfileBegin(&Stamp);
+    Now.Lower32 = 103;
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_ES_SHARED_DATA, "Func", 10, &Stamp);
+    UtAssert_UINT32_EQ(RecPtr->NumSites, 1);
+    UtAssert_UINT32_EQ(RecPtr->HoldDepth, 1);
+    SitePtr = &RecPtr->Sites[0];
+    UtAssert_STRINGBUF_EQ(SitePtr->FunctionName, -1, "Func", -1);
+    UtAssert_INT32_EQ(SitePtr->LineNumber, 10);
+    UtAssert_UINT32_EQ(SitePtr->Count, 1);
+    UtAssert_UINT32_EQ(SitePtr->MaxWaitTicks, 3);
+    UtAssert_UINT32_EQ(SitePtr->TotalWaitTicks, 3);
+    UtAssert_UINT32_EQ(SitePtr->WaitHistogram[2], 1);
+
+    /* A recursive take is counted, but the hold time is measured from the outermost one */
+    CFE_ES_LockProfileBegin(&Stamp);
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_ES_SHARED_DATA, "Func", 10, &Stamp);
+    UtAssert_UINT32_EQ(SitePtr->Count, 2);
+    UtAssert_UINT32_EQ(SitePtr->WaitHistogram[0], 1);
+    UtAssert_UINT32_EQ(RecPtr->HoldDepth, 2);
+    Now.Lower32 = 110;
+    CFE_ES_LockProfileReleased(CFE_ES_LockProfileId_ES_SHARED_DATA);
+    UtAssert_UINT32_EQ(RecPtr->HoldDepth, 1);
+    UtAssert_ZERO(SitePtr->TotalHoldTicks);
+    Now.Lower32 = 113;
+    CFE_ES_LockProfileReleased(CFE_ES_LockProfileId_ES_SHARED_DATA);
+    UtAssert_ZERO(RecPtr->HoldDepth);
+    UtAssert_NULL(RecPtr->HolderSite);
+    UtAssert_UINT32_EQ(SitePtr->MaxHoldTicks, 10);
+    UtAssert_UINT32_EQ(SitePtr->TotalHoldTicks, 10);
+    UtAssert_UINT32_EQ(SitePtr->HoldHistogram[4], 1);
+
+    /* A release without a recorded acquisition is ignored */
+    CFE_ES_LockProfileReleased(CFE_ES_LockProfileId_ES_SHARED_DATA);
+    UtAssert_ZERO(RecPtr->HoldDepth);
+    UtAssert_UINT32_EQ(SitePtr->TotalHoldTicks, 10);
+
+    /* A timebase that goes backwards is counted as no time */
+    CFE_ES_LockProfileBegin(&Stamp);
+    Now.Lower32 = 50;
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_ES_SHARED_DATA, "Func", 10, &Stamp);
+    UtAssert_UINT32_EQ(SitePtr->TotalWaitTicks, 3);
+    RecPtr->AcquireTicks = 60;
+    CFE_ES_LockProfileReleased(CFE_ES_LockProfileId_ES_SHARED_DATA);
+    UtAssert_UINT32_EQ(SitePtr->HoldHistogram[0], 1);
+
+    /* Times too long for 32 bits are saturated */
+    memset(&Stamp, 0, sizeof(Stamp));
+    Now.Upper32 = 2;
+    Now.Lower32 = 0;
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_SB_SHARED_DATA, "Func", 10, &Stamp);
+    RecPtr  = &CFE_ES_Global.LockProfile.Locks[CFE_ES_LockProfileId_SB_SHARED_DATA];
+    SitePtr = &RecPtr->Sites[0];
+    UtAssert_UINT32_EQ(SitePtr->MaxWaitTicks, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(SitePtr->WaitHistogram[CFE_ES_LOCKPROF_HIST_BINS - 1], 1);
+    RecPtr->AcquireTicks = 0;
+    CFE_ES_LockProfileReleased(CFE_ES_LockProfileId_SB_SHARED_DATA);
+    UtAssert_UINT32_EQ(SitePtr->MaxHoldTicks, 0xFFFFFFFF);
+
+    /* The timebase rollover is applied to the upper word */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_GetTimerLow32Rollover), 1000);
+    Stamp.Lower32 = 990;
+    Now.Upper32   = 1;
+    Now.Lower32   = 5;
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_FS_SHARED_DATA, "Func", 10, &Stamp);
+    SitePtr = &CFE_ES_Global.LockProfile.Locks[CFE_ES_LockProfileId_FS_SHARED_DATA].Sites[0];
+    UtAssert_UINT32_EQ(SitePtr->MaxWaitTicks, 15);
+
+    /* Invalid locks are ignored */
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_MAX, "Func", 10, &Stamp);
+    CFE_ES_LockProfileReleased(CFE_ES_LockProfileId_MAX);
+
+    /* Call sites beyond the table are combined */
+    ES_ResetUnitTest();
+    memset(&Now, 0, sizeof(Now));
+    memset(&Stamp, 0, sizeof(Stamp));
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Get_Timebase), ES_UT_LockProfileTimebase, &Now);
+    RecPtr = &CFE_ES_Global.LockProfile.Locks[CFE_ES_LockProfileId_TBL_REGISTRY];
+    for (i = 0; i <= CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES; ++i)
+    {
+        CFE_ES_LockProfileAcquired(CFE_ES_LockProfileId_TBL_REGISTRY, "Func", i + 1, &Stamp);
+        CFE_ES_LockProfileReleased(CFE_ES_LockProfileId_TBL_REGISTRY);
+    }
+    UtAssert_UINT32_EQ(RecPtr->NumSites, CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES);
+    UtAssert_UINT32_EQ(RecPtr->Sites[CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES].Count, 1);
+    UtAssert_NULL(RecPtr->Sites[CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES].FunctionName);
+
+    /* Test the entries written to the file */
+    StatePtr = &CFE_ES_Global.LockProfile.BackgroundDumpState;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_GetTimerTicksPerSecond), 1000);
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundLockProfileDataGetter(StatePtr, 0, &Buffer, &BufSize));
+    UtAssert_NULL(Buffer);
+    UtAssert_ZERO(BufSize);
+    i = (CFE_ES_LockProfileId_TBL_REGISTRY * (CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES + 1)) + 1;
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundLockProfileDataGetter(StatePtr, i, &Buffer, &BufSize));
+    UtAssert_ADDRESS_EQ(Buffer, &StatePtr->EntryBuffer);
+    UtAssert_UINT32_EQ(BufSize, sizeof(CFE_ES_LockProfile_FileEntry_t));
+    EntryPtr = Buffer;
+    UtAssert_UINT32_EQ(EntryPtr->LockId, CFE_ES_LockProfileId_TBL_REGISTRY);
+    UtAssert_UINT32_EQ(EntryPtr->LineNumber, 2);
+    UtAssert_STRINGBUF_EQ(EntryPtr->FunctionName, sizeof(EntryPtr->FunctionName), "Func", -1);
+    UtAssert_UINT32_EQ(EntryPtr->TimerTicksPerSecond, 1000);
+    UtAssert_UINT32_EQ(EntryPtr->Count, 1);
+    UtAssert_UINT32_EQ(EntryPtr->WaitHistogram[0], 1);
+    UtAssert_UINT32_EQ(EntryPtr->HoldHistogram[0], 1);
+    i += CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES - 1;
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundLockProfileDataGetter(StatePtr, i, &Buffer, &BufSize));
+    UtAssert_NOT_NULL(Buffer);
+    UtAssert_STRINGBUF_EQ(EntryPtr->FunctionName, sizeof(EntryPtr->FunctionName), "(other)", -1);
+    UtAssert_ZERO(EntryPtr->LineNumber);
+    i = (CFE_ES_LockProfileId_MAX * (CFE_PLATFORM_ES_LOCK_PROFILE_MAX_SITES + 1)) - 1;
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundLockProfileDataGetter(StatePtr, i, &Buffer, &BufSize));
+    UtAssert_NULL(Buffer);
+
+    /* Test the events of the background file write */
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundLockProfileEventHandler(StatePtr, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 10, 0, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LOCKPROF_EID);
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundLockProfileEventHandler(StatePtr, CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR, -1, 10, 10, 1000);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundLockProfileEventHandler(StatePtr, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, -1, 10, 10, 1000);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundLockProfileEventHandler(StatePtr, CFE_FS_FileWriteEvent_CREATE_ERROR, OS_ERROR, 10, 0, 0);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LOCKPROF_ERR_EID);
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundLockProfileEventHandler(StatePtr, CFE_FS_FileWriteEvent_UNDEFINED, OS_SUCCESS, 0, 0, 0);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Test the command to write the profile, which starts a background file write */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteLockProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandCounter, 1);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Failure of parsing the file name */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteLockProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LOCKPROF_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandErrorCounter, 1);
+
+    /* A write that is already pending */
+    UT_ClearEventHistory();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteLockProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LOCKPROF_PENDING_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandErrorCounter, 2);
+}
+
+void TestAPI(void)
+{
+    osal_id_t            TestObjId;
+    char                 AppName[OS_MAX_API_NAME + 12];
+    char                 SysLogBuf[CFE_TIME_PRINTED_STRING_SIZE + 20];
+    size_t               SysLogBufSize;
+    uint32               StackBuf[8];
+    uint8                Data[12];
+    uint32               ResetType;
+    CFE_ES_AppId_t       AppId;
+    CFE_ES_TaskId_t      TaskId;
+    uint32               RunStatus;
+    uint32               NextSystemState;
+    CFE_ES_TaskInfo_t    TaskInfo;
+    CFE_ES_AppInfo_t     AppInfo;
+    CFE_ES_AppRecord_t * UtAppRecPtr;
+    CFE_ES_TaskRecord_t *UtTaskRecPtr;
+
+    UtPrintf("Begin Test API");
+
+    /* Coverage for processing async event */
+    UtAssert_VOIDCALL(CFE_ES_ProcessAsyncEvent());
+
+    /* Test resetting the cFE with a processor reset */
+    ES_ResetUnitTest();
+    ResetType = CFE_PSP_RST_TYPE_PROCESSOR;
+    CFE_ES_Global.ResetDataPtr->ResetVars.ProcessorResetCount =
+        CFE_ES_Global.ResetDataPtr->ResetVars.MaxProcessorResetCount - 1;
+    CFE_ES_ResetCFE(ResetType);
+    CFE_ES_Global.ResetDataPtr->ResetVars.ProcessorResetCount =
+        CFE_ES_Global.ResetDataPtr->ResetVars.MaxProcessorResetCount;
+    UtAssert_INT32_EQ(CFE_ES_ResetCFE(ResetType), CFE_ES_NOT_IMPLEMENTED);
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_POR_MAX_PROC_RESETS]);
+
+    /* Test getting the reset type using a valid pointer and a null pointer */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(CFE_ES_GetResetType(&ResetType), CFE_PSP_RST_TYPE_PROCESSOR);
+    UtAssert_INT32_EQ(CFE_ES_GetResetType(NULL), CFE_PSP_RST_TYPE_PROCESSOR);
+
+    /* Test resetting the cFE with a power on reset */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(CFE_ES_ResetCFE(CFE_PSP_RST_TYPE_POWERON), CFE_ES_NOT_IMPLEMENTED);
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_POR_COMMANDED]);
+
+    /* Test resetting the cFE with an invalid argument */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(CFE_ES_ResetCFE(CFE_PSP_RST_TYPE_POWERON + 3), CFE_ES_BAD_ARGUMENT);
+
+    /* Test restarting an app that doesn't exist */
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_STOPPED, NULL, &UtAppRecPtr, NULL);
     AppId = CFE_ES_APPID_C(
@@ -4439,15 +5764,14 @@ void TestAPI(void)
      * must be truncated
      */
     ES_ResetUnitTest();
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - CFE_TIME_PRINTED_STRING_SIZE - 4;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx;
-    CFE_ES_Global.ResetDataPtr->SystemLogMode     = CFE_ES_LogMode_DISCARD;
+    ES_UT_SetSysLogIndex(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - CFE_TIME_PRINTED_STRING_SIZE - 4,
+                         CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - CFE_TIME_PRINTED_STRING_SIZE - 4);
+    CFE_ES_Global.ResetDataPtr->SystemLogMode = CFE_ES_LogMode_DISCARD;
     UtAssert_INT32_EQ(CFE_ES_SysLogWrite_Unsync("SysLogText This message should be truncated"),
                       CFE_ES_ERR_SYS_LOG_TRUNCATED);
 
     /* Reset the system log index to prevent an overflow in later tests */
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = 0;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = 0;
+    ES_UT_SetSysLogIndex(0, 0);
 
     /* Test calculating a CRC on a range of memory using CRC type 8
      * NOTE: This capability is not currently implemented in cFE
@@ -4522,24 +5846,62 @@ void TestAPI(void)
      */
     UtAssert_VOIDCALL(CFE_ES_WaitForStartupSync(99));
 
+    /* Test waiting for the system state on the semaphore, which is given on the state change */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_EARLY_INIT, "UT", NULL, NULL);
+    OS_CountSemCreate(&CFE_ES_Global.SystemStateSemId, "UT", 0, 0);
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_APPS_INIT;
+    NextSystemState           = CFE_ES_SystemState_OPERATIONAL;
+    UT_SetHookFunction(UT_KEY(OS_CountSemTimedWait), ES_UT_SystemStateWaitHook, &NextSystemState);
+    CFE_UtAssert_SUCCESS(CFE_ES_WaitForSystemState(CFE_ES_SystemState_OPERATIONAL, 1000));
+    UtAssert_STUB_COUNT(OS_CountSemTimedWait, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    UtAssert_ZERO(CFE_ES_Global.SystemStateWaiters);
+
+    /* A state that is already reached does not block */
+    CFE_UtAssert_SUCCESS(CFE_ES_WaitForSystemState(CFE_ES_SystemState_APPS_INIT, 1000));
+    UtAssert_STUB_COUNT(OS_CountSemTimedWait, 1);
+
+    /* A state change right as the wait times out is not missed */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_EARLY_INIT, "UT", NULL, NULL);
+    OS_CountSemCreate(&CFE_ES_Global.SystemStateSemId, "UT", 0, 0);
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_APPS_INIT;
+    UT_SetHookFunction(UT_KEY(OS_CountSemTimedWait), ES_UT_SystemStateWaitHook, &NextSystemState);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 1, OS_SEM_TIMEOUT);
+    CFE_UtAssert_SUCCESS(CFE_ES_WaitForSystemState(CFE_ES_SystemState_OPERATIONAL, 1000));
+    UtAssert_ZERO(CFE_ES_Global.SystemStateWaiters);
+
+    /* Test timing out while blocked on the semaphore, and without any time left */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_EARLY_INIT, "UT", NULL, NULL);
+    OS_CountSemCreate(&CFE_ES_Global.SystemStateSemId, "UT", 0, 0);
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 1, OS_SEM_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_ES_WaitForSystemState(CFE_ES_SystemState_OPERATIONAL, 1000), CFE_ES_OPERATION_TIMED_OUT);
+    UtAssert_ZERO(CFE_ES_Global.SystemStateWaiters);
+    UtAssert_INT32_EQ(CFE_ES_WaitForSystemState(CFE_ES_SystemState_OPERATIONAL, 0), CFE_ES_OPERATION_TIMED_OUT);
+    UtAssert_STUB_COUNT(OS_CountSemTimedWait, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+
     /* Test successfully adding a time-stamped message to the system log that
      * causes the log index to be reset
      */
     ES_ResetUnitTest();
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx;
-    CFE_ES_Global.ResetDataPtr->SystemLogMode     = CFE_ES_LogMode_DISCARD;
+    ES_UT_SetSysLogIndex(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE, CFE_PLATFORM_ES_SYSTEM_LOG_SIZE);
+    CFE_ES_Global.ResetDataPtr->SystemLogMode = CFE_ES_LogMode_DISCARD;
     UtAssert_INT32_EQ(CFE_ES_WriteToSysLog("SysLogText"), CFE_ES_ERR_SYS_LOG_FULL);
 
     /* Test successfully adding a time-stamped message to the system log that
      * causes the log index to be reset
      */
     ES_ResetUnitTest();
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx;
-    CFE_ES_Global.ResetDataPtr->SystemLogMode     = CFE_ES_LogMode_OVERWRITE;
+    ES_UT_SetSysLogIndex(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE, CFE_PLATFORM_ES_SYSTEM_LOG_SIZE);
+    CFE_ES_Global.ResetDataPtr->SystemLogMode = CFE_ES_LogMode_OVERWRITE;
     CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("SysLogText"));
-    UtAssert_UINT32_LTEQ(CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx, CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - 1);
+    UtAssert_UINT32_LTEQ(CFE_ES_SYSLOG_STATE_WRITEIDX(CFE_ES_Global.ResetDataPtr->SystemLogCommitted),
+                         CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - 1);
 
     /* Test NULL spec string */
     ES_ResetUnitTest();
@@ -4735,6 +6097,171 @@ void TestGenericCounterAPI(void)
     UtAssert_INT32_EQ(CFE_ES_GetGenCounterIDByName(&CounterId, NULL), CFE_ES_BAD_ARGUMENT);
 }
 
+/*
+ * Bit at a time reference implementation of a reflected CRC, to compare
+ * the table driven and hardware implementations with
+ */
+static uint32 ES_UT_ReferenceCRC(const uint8 *DataPtr, size_t DataLength, uint32 Crc, uint32 Poly)
+{
+    uint32 Bit;
+
+    while (DataLength > 0)
+    {
+        Crc ^= *DataPtr;
+        for (Bit = 0; Bit < 8; ++Bit)
+        {
+            Crc = (Crc & 1) ? ((Crc >> 1) ^ Poly) : (Crc >> 1);
+        }
+
+        ++DataPtr;
+        --DataLength;
+    }
+
+    return Crc;
+}
+
+void TestCRC(void)
+{
+    static const char CRC_CHECK_INPUT[] = "123456789";
+    uint8             Data[96];
+    size_t            Offset;
+    size_t            Length;
+    uint32            Count;
+
+    UtPrintf("Begin Test CRC");
+
+    /* Test the check values of the algorithms */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0, CFE_ES_CrcType_16_ARC),
+                       0xBB3D);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0, CFE_ES_CrcType_32C),
+                       0xE3069283);
+
+    /* The CRC-32C of a block can be continued with the next block */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&CRC_CHECK_INPUT[4], 5,
+                                           CFE_ES_CalculateCRC(CRC_CHECK_INPUT, 4, 0, CFE_ES_CrcType_32C),
+                                           CFE_ES_CrcType_32C),
+                       0xE3069283);
+
+    /*
+     * Compare with the bit at a time reference for all lengths up to several
+     * times the number of bytes processed at once, and all alignments of the data
+     */
+    for (Offset = 0; Offset < sizeof(Data); ++Offset)
+    {
+        Data[Offset] = (uint8)((Offset * 37) + 11);
+    }
+
+    Count = 0;
+    for (Offset = 0; Offset < 8; ++Offset)
+    {
+        for (Length = 1; Length <= (sizeof(Data) - 8); ++Length)
+        {
+            if (CFE_ES_CalculateCRC(&Data[Offset], Length, 0x1234, CFE_ES_CrcType_16_ARC) !=
+                    ES_UT_ReferenceCRC(&Data[Offset], Length, 0x1234, 0xA001) ||
+                CFE_ES_CalculateCRC(&Data[Offset], Length, 0x1234, CFE_ES_CrcType_32C) !=
+                    ~ES_UT_ReferenceCRC(&Data[Offset], Length, ~(uint32)0x1234, 0x82F63B78))
+            {
+                ++Count;
+            }
+        }
+    }
+    UtAssert_ZERO(Count);
+}
+
+void TestChunkedCRC(void)
+{
+    static uint8          Data[1000];
+    CFE_ES_ChunkedCRC_t   ChunkedCRC;
+    CFE_ES_CrcType_Enum_t CrcType;
+    size_t                Offset;
+    size_t                Length;
+    uint32                CrcA;
+    uint32                CrcB;
+    uint32                Count;
+
+    UtPrintf("Begin Test Chunked CRC");
+
+    for (Offset = 0; Offset < sizeof(Data); ++Offset)
+    {
+        Data[Offset] = (uint8)((Offset * 37) + 11);
+    }
+
+    /* Combining the CRCs of two blocks gives the CRC of both blocks */
+    Count = 0;
+    for (Offset = 0; Offset <= sizeof(Data); Offset += 97)
+    {
+        Length = sizeof(Data) - Offset;
+        for (CrcType = CFE_ES_CrcType_16_ARC; CrcType <= CFE_ES_CrcType_32C; ++CrcType)
+        {
+            CrcA = CFE_ES_CalculateCRC(Data, Offset, 0, CrcType);
+            CrcB = CFE_ES_CalculateCRC(&Data[Offset], Length, 0, CrcType);
+            if (CFE_ES_CombineCRC(CrcA, CrcB, Length, CrcType) != CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CrcType))
+            {
+                ++Count;
+            }
+        }
+    }
+    UtAssert_ZERO(Count);
+    UtAssert_ZERO(CFE_ES_CombineCRC(1, 2, 3, CFE_ES_CrcType_NONE));
+
+    /* Initializing gives the CRC of the whole block, for any number of chunks */
+    Count = 0;
+    for (Length = 1; Length <= sizeof(Data); Length += 33)
+    {
+        if (CFE_ES_ChunkedCRCInit(&ChunkedCRC, Data, Length, CFE_ES_CrcType_16_ARC) !=
+                CFE_ES_CalculateCRC(Data, Length, 0, CFE_ES_CrcType_16_ARC) ||
+            CFE_ES_ChunkedCRCInit(&ChunkedCRC, Data, Length, CFE_ES_CrcType_32C) !=
+                CFE_ES_CalculateCRC(Data, Length, 0, CFE_ES_CrcType_32C))
+        {
+            ++Count;
+        }
+    }
+    UtAssert_ZERO(Count);
+    UtAssert_UINT32_LTEQ(ChunkedCRC.NumChunks, CFE_MISSION_ES_CRC_MAX_CHUNKS);
+
+    /* Updating a range gives the CRC of the changed block, including a range past the end */
+    Count = 0;
+    for (Offset = 0; Offset < sizeof(Data); Offset += 61)
+    {
+        Length = (Offset % 200) + 1;
+        if (Offset + Length <= sizeof(Data))
+        {
+            memset(&Data[Offset], (int)Offset, Length);
+        }
+        else
+        {
+            memset(&Data[Offset], (int)Offset, sizeof(Data) - Offset);
+        }
+
+        if (CFE_ES_ChunkedCRCUpdate(&ChunkedCRC, Data, Offset, Length) !=
+            CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CFE_ES_CrcType_32C))
+        {
+            ++Count;
+        }
+    }
+    UtAssert_ZERO(Count);
+
+    /* An empty range or a range beyond the end changes nothing */
+    UtAssert_UINT32_EQ(CFE_ES_ChunkedCRCUpdate(&ChunkedCRC, Data, 0, 0),
+                       CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CFE_ES_CrcType_32C));
+    UtAssert_UINT32_EQ(CFE_ES_ChunkedCRCUpdate(&ChunkedCRC, Data, sizeof(Data), 1),
+                       CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CFE_ES_CrcType_32C));
+
+    /* The type without CRC */
+    UtAssert_ZERO(CFE_ES_ChunkedCRCInit(&ChunkedCRC, Data, sizeof(Data), CFE_ES_CrcType_NONE));
+    UtAssert_ZERO(CFE_ES_ChunkedCRCUpdate(&ChunkedCRC, Data, 0, 1));
+
+    /* Bad arguments leave the state not initialized */
+    UtAssert_ZERO(CFE_ES_ChunkedCRCInit(NULL, Data, sizeof(Data), CFE_ES_CrcType_32C));
+    UtAssert_ZERO(CFE_ES_ChunkedCRCInit(&ChunkedCRC, NULL, sizeof(Data), CFE_ES_CrcType_32C));
+    UtAssert_ZERO(ChunkedCRC.NumChunks);
+    UtAssert_ZERO(CFE_ES_ChunkedCRCInit(&ChunkedCRC, Data, 0, CFE_ES_CrcType_32C));
+    UtAssert_ZERO(CFE_ES_ChunkedCRCUpdate(&ChunkedCRC, Data, 0, 1));
+    UtAssert_ZERO(CFE_ES_ChunkedCRCUpdate(NULL, Data, 0, 1));
+    CFE_ES_ChunkedCRCInit(&ChunkedCRC, Data, sizeof(Data), CFE_ES_CrcType_32C);
+    UtAssert_ZERO(CFE_ES_ChunkedCRCUpdate(&ChunkedCRC, NULL, 0, 1));
+}
+
 void TestCDS()
 {
     size_t               CdsSize;
@@ -4744,6 +6271,7 @@ void TestCDS()
     CFE_ES_CDS_RegRec_t *UtCDSRegRecPtr;
     uint32               i;
     size_t               TempSize;
+    size_t               RegIdx;
     uint8                BlockData[ES_UT_CDS_BLOCK_SIZE];
 
     UtPrintf("Begin Test CDS");
@@ -4754,6 +6282,10 @@ void TestCDS()
     UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, OS_ERROR);
     UtAssert_INT32_EQ(CFE_ES_CDS_EarlyInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
 
+    /* Test init with a flush mutex create failure */
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDS_EarlyInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
     /* Test locking the CDS registry with a mutex take failure */
     UT_SetDeferredRetcode(UT_KEY(OS_MutSemTake), 1, OS_ERROR);
     UtAssert_INT32_EQ(CFE_ES_LockCDS(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
@@ -4871,9 +6403,20 @@ void TestCDS()
     /* Copy to CDS with NULL */
     UtAssert_INT32_EQ(CFE_ES_CopyToCDS(CDSHandle, NULL), CFE_ES_BAD_ARGUMENT);
 
+    /* Test successfully copying a range to a CDS, and with NULL */
+    CFE_UtAssert_SUCCESS(CFE_ES_CopyToCDSRange(CDSHandle, 1, 2, &BlockData[1]));
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandle, 1, 2, NULL), CFE_ES_BAD_ARGUMENT);
+
     /* Test successfully restoring from a CDS */
     CFE_UtAssert_SUCCESS(CFE_ES_RestoreFromCDS(&BlockData, CDSHandle));
 
+    /* Test write-behind mode with a bad handle, and flushing the CDS */
+    UtAssert_INT32_EQ(CFE_ES_SetCDSWriteBehind(CFE_ES_CDS_BAD_HANDLE, true), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    CFE_UtAssert_SUCCESS(CFE_ES_FlushCDS());
+    CFE_ES_Global.CDSIsAvailable = false;
+    CFE_UtAssert_SUCCESS(CFE_ES_FlushCDS());
+    CFE_ES_Global.CDSIsAvailable = true;
+
     /* Restore from CDS with NULL */
     UtAssert_INT32_EQ(CFE_ES_RestoreFromCDS(NULL, CDSHandle), CFE_ES_BAD_ARGUMENT);
 
@@ -5002,6 +6545,16 @@ void TestCDS()
     UtAssert_NONZERO(UtCDSRegRecPtr->BlockOffset);
     UtAssert_NONZERO(UtCDSRegRecPtr->BlockSize);
 
+    /* Test rebuilding the CDS where the record of the entry fails its CRC, only the entry is discarded */
+    RegIdx = UtCDSRegRecPtr - CFE_ES_Global.CDSVars.Registry;
+    UT_GetDataBuffer(UT_KEY(CFE_PSP_ReadFromCDS), &CdsPtr, &CdsSize, NULL);
+    *((unsigned char *)CdsPtr + CDS_REG_OFFSET + (RegIdx * sizeof(CFE_ES_CDS_PersistentRegRec_t)) +
+      offsetof(CFE_ES_CDS_PersistentRegRec_t, Crc)) ^= 0x01;
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(CFE_ES_CDS_EarlyInit());
+    UtAssert_ZERO(UtCDSRegRecPtr->BlockOffset);
+    UtAssert_ZERO(UtCDSRegRecPtr->BlockSize);
+
     /* Test rebuilding the CDS with the registry unreadable */
     ES_ResetUnitTest();
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 2, OS_ERROR);
@@ -5088,6 +6641,8 @@ void TestCDSMempool(void)
 {
     CFE_ES_CDS_RegRec_t *UtCdsRegRecPtr;
     int                  Data;
+    int                  ExpectedData;
+    uint8                RangeData[2];
     CFE_ES_CDSHandle_t   BlockHandle;
     size_t               SavedSize;
     size_t               SavedOffset;
@@ -5134,6 +6689,7 @@ void TestCDSMempool(void)
     ES_ResetUnitTest();
     BlockHandle = CFE_ES_CDSHANDLE_C(CFE_ResourceId_FromInteger(7));
     UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, &Data), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, 0, 1, &Data), CFE_ES_ERR_RESOURCEID_NOT_VALID);
     UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(&Data, BlockHandle), CFE_ES_ERR_RESOURCEID_NOT_VALID);
 
     /* Test CDS block access */
@@ -5143,22 +6699,58 @@ void TestCDSMempool(void)
     BlockHandle = CFE_ES_CDSBlockRecordGetID(UtCdsRegRecPtr);
     Data        = 42;
 
-    /* Basic success path */
+    /* Basic success path, which also keeps the chunk CRCs of the block */
     CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, &Data));
+    UtAssert_UINT32_EQ(CFE_ES_CDSBlockRecordGetCrcState(UtCdsRegRecPtr)->NumChunks, 1);
     Data = 0;
+    memset(CFE_ES_CDSBlockRecordGetCrcState(UtCdsRegRecPtr), 0, sizeof(CFE_ES_ChunkedCRC_t));
     CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(&Data, BlockHandle));
+    UtAssert_UINT32_EQ(CFE_ES_CDSBlockRecordGetCrcState(UtCdsRegRecPtr)->NumChunks, 1);
 
     UtAssert_INT32_EQ(Data, 42);
 
+    /* Range writes keep the CRC of the block valid */
+    RangeData[0] = 0xA5;
+    RangeData[1] = 0x5A;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, 1, 2, RangeData));
+    UtAssert_ZERO(CFE_ES_CDSBlockRecordGetCrcState(UtCdsRegRecPtr)->NumChunks);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, sizeof(Data) - 1, 1, RangeData));
+    ExpectedData = 42;
+    memcpy((uint8 *)&ExpectedData + 1, RangeData, 2);
+    memcpy((uint8 *)&ExpectedData + sizeof(Data) - 1, RangeData, 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(&Data, BlockHandle));
+    UtAssert_INT32_EQ(Data, ExpectedData);
+
+    /* Range writes that are empty or not within the block */
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, 0, 0, RangeData), CFE_ES_CDS_INVALID_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, sizeof(Data), 1, RangeData), CFE_ES_CDS_INVALID_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, 1, sizeof(Data), RangeData), CFE_ES_CDS_INVALID_SIZE);
+
+    /* Range write with a CDS read error (block header and old data content) */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, 1, 2, RangeData), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 3, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, 1, 2, RangeData), CFE_ES_CDS_ACCESS_ERROR);
+
+    /* Range write with a CDS write error (block header and data content) */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, 1, 2, RangeData), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, 1, 2, RangeData), CFE_ES_CDS_ACCESS_ERROR);
+    Data = 42;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, &Data));
+
     /* Corrupt/change the block offset, should fail validation */
     --UtCdsRegRecPtr->BlockOffset;
     UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, &Data), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, 0, 1, &Data), CFE_ES_POOL_BLOCK_INVALID);
     UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(&Data, BlockHandle), CFE_ES_POOL_BLOCK_INVALID);
     ++UtCdsRegRecPtr->BlockOffset;
 
     /* Corrupt/change the block size, should trigger invalid size error */
     --UtCdsRegRecPtr->BlockSize;
     UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, &Data), CFE_ES_CDS_INVALID_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, 0, 1, &Data), CFE_ES_CDS_INVALID_SIZE);
     UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(&Data, BlockHandle), CFE_ES_CDS_INVALID_SIZE);
     ++UtCdsRegRecPtr->BlockSize;
 
@@ -5188,6 +6780,7 @@ void TestCDSMempool(void)
     UT_GetDataBuffer(UT_KEY(CFE_PSP_ReadFromCDS), &CdsPtr, NULL, NULL);
     *((unsigned char *)CdsPtr + UtCdsRegRecPtr->BlockOffset) ^= 0x02; /* Bit flip */
     UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(&Data, BlockHandle), CFE_ES_CDS_BLOCK_CRC_ERR);
+    UtAssert_ZERO(CFE_ES_CDSBlockRecordGetCrcState(UtCdsRegRecPtr)->NumChunks);
     *((unsigned char *)CdsPtr + UtCdsRegRecPtr->BlockOffset) ^= 0x02; /* Fix Bit */
 
     /* Set up again with a CDS that is too small to get branch coverage */
@@ -5200,6 +6793,166 @@ void TestCDSMempool(void)
     UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(&Data, BlockHandle), CFE_ES_CDS_INVALID_SIZE);
 }
 
+void TestCDSWriteBehind(void)
+{
+    CFE_ES_CDS_Instance_t *   CDS = &CFE_ES_Global.CDSVars;
+    CFE_ES_CDS_RegRec_t *     UtCdsRegRecPtr;
+    CFE_ES_CDS_WriteBehind_t *WriteBehindPtr;
+    CFE_ES_CDSHandle_t        BlockHandle;
+    int                       Data;
+    int                       ExpectedData;
+    uint8                     RangeData[2];
+    uint32                    WriteCount;
+    uint32                    ReadCount;
+    size_t                    SavedTail;
+
+    UtPrintf("Begin Test CDS write-behind");
+
+    ES_ResetUnitTest();
+    ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
+    ES_UT_SetupSingleCDSRegistry("UT", sizeof(Data) + sizeof(CFE_ES_CDS_BlockHeader_t), false, &UtCdsRegRecPtr);
+    BlockHandle    = CFE_ES_CDSBlockRecordGetID(UtCdsRegRecPtr);
+    WriteBehindPtr = CFE_ES_CDSBlockRecordGetWriteBehind(UtCdsRegRecPtr);
+
+    /* Test enabling write-behind mode using an invalid handle */
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockSetWriteBehind(CFE_ES_CDS_BAD_HANDLE, true), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* Test enabling write-behind mode with the shadow pool full */
+    SavedTail                    = CDS->ShadowPool.TailPosition;
+    CDS->ShadowPool.TailPosition = CDS->ShadowPool.PoolMaxOffset;
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockSetWriteBehind(BlockHandle, true), CFE_ES_CDS_INSUFFICIENT_MEMORY);
+    CDS->ShadowPool.TailPosition = SavedTail;
+
+    /* Enabling twice is not an error, and only allocates one shadow */
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockSetWriteBehind(BlockHandle, true));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockSetWriteBehind(BlockHandle, true));
+    UtAssert_BOOL_TRUE(WriteBehindPtr->Enabled);
+    UtAssert_BOOL_FALSE(WriteBehindPtr->Valid);
+
+    /* A range write before the shadow is valid goes to the CDS directly */
+    WriteCount   = UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS));
+    RangeData[0] = 0xA5;
+    RangeData[1] = 0x5A;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, 1, 2, RangeData));
+    UtAssert_UINT32_GT(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount);
+    UtAssert_BOOL_FALSE(WriteBehindPtr->Dirty);
+
+    /* Writes only go to the shadow, and are coalesced */
+    WriteCount = UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS));
+    Data       = 42;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, &Data));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, 1, 2, RangeData));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount);
+    UtAssert_UINT32_EQ(CDS->DirtyBlocks, 1);
+    UtAssert_UINT32_EQ(WriteBehindPtr->DirtyStart, 0);
+    UtAssert_UINT32_EQ(WriteBehindPtr->DirtyEnd, sizeof(Data));
+
+    /* An invalid range is still reported */
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, sizeof(Data), 1, RangeData), CFE_ES_CDS_INVALID_SIZE);
+
+    /* Reads come from the shadow */
+    ExpectedData = 42;
+    memcpy((uint8 *)&ExpectedData + 1, RangeData, 2);
+    Data      = 0;
+    ReadCount = UT_GetStubCount(UT_KEY(CFE_PSP_ReadFromCDS));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(&Data, BlockHandle));
+    UtAssert_INT32_EQ(Data, ExpectedData);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_ReadFromCDS)), ReadCount);
+
+    /*
+     * The background job writes the block before the flush rate has passed since the
+     * change, allowing for the poll period of the job.  It stays active while blocks are dirty.
+     */
+    UtAssert_BOOL_TRUE(CFE_ES_RunCDSWriteBehind(0, CDS));
+    UtAssert_BOOL_TRUE(CFE_ES_RunCDSWriteBehind(
+        CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE - (2 * CFE_ES_CDS_WRITE_BEHIND_POLL) - 1, CDS));
+    UtAssert_UINT32_EQ(CDS->DirtyBlocks, 1);
+    UtAssert_BOOL_FALSE(CFE_ES_RunCDSWriteBehind(CFE_ES_CDS_WRITE_BEHIND_POLL + 1, CDS));
+    UtAssert_UINT32_EQ(CDS->DirtyBlocks, 0);
+    UtAssert_BOOL_FALSE(WriteBehindPtr->Dirty);
+    UtAssert_UINT32_GT(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount);
+    UtAssert_BOOL_FALSE(CFE_ES_RunCDSWriteBehind(CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE, CDS));
+    UtAssert_UINT32_EQ(CDS->FlushTimer, CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE - CFE_ES_CDS_WRITE_BEHIND_POLL);
+
+    /* The job stays active if the flush fails, so the block is tried again */
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, 1, 2, RangeData));
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
+    UtAssert_BOOL_TRUE(CFE_ES_RunCDSWriteBehind(CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE, CDS));
+    UtAssert_UINT32_EQ(CDS->DirtyBlocks, 1);
+    UtAssert_BOOL_FALSE(CFE_ES_RunCDSWriteBehind(CFE_PLATFORM_ES_CDS_WRITE_BEHIND_RATE, CDS));
+    UtAssert_UINT32_EQ(CDS->DirtyBlocks, 0);
+
+    /* A change made while the block is written to the CDS is kept for the next flush */
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, 2, 1, RangeData));
+    UT_SetHookFunction(UT_KEY(CFE_PSP_WriteToCDS), ES_UT_CDSWriteDuringFlushHook, &BlockHandle);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSWriteBehindFlush());
+    UT_SetHookFunction(UT_KEY(CFE_PSP_WriteToCDS), NULL, NULL);
+    UtAssert_BOOL_TRUE(WriteBehindPtr->Dirty);
+    UtAssert_UINT32_EQ(CDS->DirtyBlocks, 1);
+    UtAssert_UINT32_EQ(WriteBehindPtr->DirtyStart, 0);
+    UtAssert_UINT32_EQ(WriteBehindPtr->DirtyEnd, 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSWriteBehindFlush());
+    UtAssert_UINT32_EQ(CDS->DirtyBlocks, 0);
+    ((uint8 *)&ExpectedData)[0] = 0x77;
+    ((uint8 *)&ExpectedData)[2] = RangeData[0];
+
+    /* The CDS has the same content, with a valid CRC, and reading it makes the shadow valid again */
+    WriteBehindPtr->Valid = false;
+    Data                  = 0;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(&Data, BlockHandle));
+    UtAssert_INT32_EQ(Data, ExpectedData);
+    UtAssert_BOOL_TRUE(WriteBehindPtr->Valid);
+
+    /* A range write to a valid shadow only writes the range, and updates the chunk CRCs */
+    RangeData[0] = 0x3C;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRange(BlockHandle, 2, 1, RangeData));
+    UtAssert_UINT32_EQ(WriteBehindPtr->DirtyStart, 2);
+    UtAssert_UINT32_EQ(WriteBehindPtr->DirtyEnd, 3);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSWriteBehindFlush());
+    UtAssert_UINT32_EQ(CFE_ES_CDSBlockRecordGetCrcState(UtCdsRegRecPtr)->NumChunks, 1);
+    memcpy((uint8 *)&ExpectedData + 2, RangeData, 1);
+    WriteBehindPtr->Valid = false;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(&Data, BlockHandle));
+    UtAssert_INT32_EQ(Data, ExpectedData);
+
+    /* Flush with CDS errors, the block stays dirty until it is written */
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, &Data));
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSWriteBehindFlush(), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSWriteBehindFlush(), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSWriteBehindFlush(), CFE_ES_CDS_ACCESS_ERROR);
+    --UtCdsRegRecPtr->BlockSize;
+    UtAssert_INT32_EQ(CFE_ES_CDSWriteBehindFlush(), CFE_ES_CDS_INVALID_SIZE);
+    ++UtCdsRegRecPtr->BlockSize;
+    UtAssert_UINT32_EQ(CDS->DirtyBlocks, 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSWriteBehindFlush());
+    UtAssert_UINT32_EQ(CDS->DirtyBlocks, 0);
+
+    /* Disabling writes the pending changes first, and keeps the mode if that fails */
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, &Data));
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockSetWriteBehind(BlockHandle, false), CFE_ES_CDS_ACCESS_ERROR);
+    UtAssert_BOOL_TRUE(WriteBehindPtr->Enabled);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockSetWriteBehind(BlockHandle, false));
+    UtAssert_BOOL_FALSE(WriteBehindPtr->Enabled);
+    UtAssert_UINT32_EQ(CDS->DirtyBlocks, 0);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockSetWriteBehind(BlockHandle, false));
+
+    /* Releasing the shadow (block deleted or reallocated) discards pending changes */
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockSetWriteBehind(BlockHandle, true));
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, &Data));
+    CFE_ES_CDSWriteBehindRelease(UtCdsRegRecPtr);
+    UtAssert_BOOL_FALSE(WriteBehindPtr->Enabled);
+    UtAssert_UINT32_EQ(CDS->DirtyBlocks, 0);
+
+    /* Enabling without a shadow pool, as configured with no memory for it */
+    CDS->ShadowPool.NumBuckets = 0;
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockSetWriteBehind(BlockHandle, true), CFE_ES_CDS_INSUFFICIENT_MEMORY);
+    UtAssert_BOOL_FALSE(WriteBehindPtr->Enabled);
+}
+
 void TestESMempool(void)
 {
     CFE_ES_MemHandle_t      PoolID1 = CFE_ES_MEMHANDLE_UNDEFINED; /* Poo1 1 handle, no mutex */
@@ -5211,6 +6964,7 @@ void TestESMempool(void)
     CFE_ES_MemPoolRecord_t *PoolPtr;
     CFE_ES_MemPoolStats_t   Stats;
     size_t                  BlockSizes[CFE_PLATFORM_ES_POOL_MAX_BUCKETS + 2];
+    CFE_ES_MemPoolBuf_t     SmallBufs[64];
     CFE_ES_GenPoolBD_t *    BdPtr;
     uint32                  i;
 
@@ -5575,6 +7329,635 @@ void TestESMempool(void)
     /* Test getting the size of a pool buffer with an invalid memory handle, NULL buffer */
     UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(CFE_ES_MEMHANDLE_UNDEFINED, addressp1), CFE_ES_ERR_RESOURCEID_NOT_VALID);
     UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, NULL), CFE_ES_BAD_ARGUMENT);
+
+    /* Test that a lock-free pool only takes the mutex to create new blocks */
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolCreate(&PoolID1, Buffer1, sizeof(Buffer1)));
+    PoolPtr = CFE_ES_LocateMemPoolRecordByID(PoolID1);
+    UtAssert_BOOL_TRUE(PoolPtr->Pool.LockFree == (CFE_PLATFORM_ES_POOL_LOCK_FREE && CFE_ES_ATOMIC_LOCK_FREE));
+    PoolPtr->Pool.LockFree = true;
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 256), 256);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), 256);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID1, 256), 256);
+    UtAssert_ADDRESS_EQ(addressp2, addressp1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+
+    /* Test that a buddy pool reuses the memory of small buffers for large buffers */
+    ES_ResetUnitTest();
+    BlockSizes[0] = 16;
+    BlockSizes[1] = 400;
+    CFE_UtAssert_SUCCESS(
+        CFE_ES_PoolCreateBuddy(&PoolID1, Buffer1, sizeof(Buffer1), 2, BlockSizes, CFE_ES_USE_MUTEX));
+    PoolPtr = CFE_ES_LocateMemPoolRecordByID(PoolID1);
+    UtAssert_BOOL_TRUE(PoolPtr->Pool.Buddy);
+    UtAssert_BOOL_FALSE(PoolPtr->Pool.LockFree);
+
+    /* the smallest blocks are half the size of the next ones, including the descriptor */
+    for (i = 0; i < 64; ++i)
+    {
+        if (CFE_ES_GetPoolBuf(&SmallBufs[i], PoolID1, 16) != 16)
+        {
+            break;
+        }
+    }
+    UtAssert_UINT32_EQ(i, sizeof(Buffer1) / (PoolPtr->Pool.Buckets[1].BlockSize - PoolPtr->Pool.Buckets[0].BlockSize));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 400), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID1));
+    UtAssert_ZERO(Stats.FreeBlockBytes);
+    UtAssert_ZERO(Stats.LargestFreeBlock);
+
+    while (i > 0)
+    {
+        --i;
+        UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, SmallBufs[i]), 16);
+    }
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID1));
+    UtAssert_EQ(CFE_ES_MemOffset_t, Stats.LargestFreeBlock,
+                PoolPtr->Pool.Buckets[PoolPtr->Pool.NumBuckets - 1].BlockSize);
+    UtAssert_UINT32_EQ(Stats.FreeBlockBytes, 2 * Stats.LargestFreeBlock);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 400), 400);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID1, 400), 400);
+
+    /* Test creating a buddy pool with too many sizes between the smallest and the largest block */
+    BlockSizes[0] = 1;
+    BlockSizes[1] = (size_t)1 << (CFE_PLATFORM_ES_POOL_MAX_BUCKETS + 8);
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateBuddy(&PoolID2, Buffer2, sizeof(Buffer2), 2, BlockSizes, CFE_ES_USE_MUTEX),
+                      CFE_ES_BAD_ARGUMENT);
+    CFE_UtAssert_RESOURCEID_EQ(PoolID2, CFE_ES_MEMHANDLE_UNDEFINED);
+}
+
+void TestESMempoolMagazines(void)
+{
+    CFE_ES_MemHandle_t        PoolID1 = CFE_ES_MEMHANDLE_UNDEFINED;
+    uint8                     Buffer1[2048];
+    CFE_ES_MemPoolBuf_t       Bufs[CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE + 1];
+    CFE_ES_MemPoolBuf_t       addressp1 = CFE_ES_MEMPOOLBUF_C(0);
+    size_t                    BlockSize = 0;
+    CFE_ES_MemPoolRecord_t *  PoolPtr;
+    CFE_ES_PoolMagazineSet_t *SetPtr;
+    CFE_ES_PoolTaskCache_t *  CachePtr;
+    CFE_ES_PoolMagazine_t *   MagPtr;
+    CFE_ES_GenPoolBD_t *      BdPtr;
+    uint32                    i;
+
+    UtPrintf("Begin Test ES memory pool magazines");
+
+    /* Enabling magazines needs a valid pool and a free magazine set */
+    ES_ResetUnitTest();
+    CFE_UtAssert_SETUP(CFE_ES_PoolCreate(&PoolID1, Buffer1, sizeof(Buffer1)));
+    UtAssert_INT32_EQ(CFE_ES_PoolEnableMagazines(CFE_ES_MEMHANDLE_UNDEFINED), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    for (i = 0; i < CFE_PLATFORM_ES_POOL_MAX_MAGAZINE_POOLS; ++i)
+    {
+        CFE_ES_Global.PoolMagazineSets[i].PoolID = PoolID1;
+    }
+    UtAssert_INT32_EQ(CFE_ES_PoolEnableMagazines(PoolID1), CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
+    SetPtr         = &CFE_ES_Global.PoolMagazineSets[CFE_PLATFORM_ES_POOL_MAX_MAGAZINE_POOLS - 1];
+    SetPtr->PoolID = CFE_ES_MEMHANDLE_UNDEFINED;
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolEnableMagazines(PoolID1));
+    PoolPtr = CFE_ES_LocateMemPoolRecordByID(PoolID1);
+    UtAssert_ADDRESS_EQ(PoolPtr->MagazineSet, SetPtr);
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolEnableMagazines(PoolID1));
+
+    /* Deleting the pool frees its magazine set */
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolDelete(PoolID1));
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(SetPtr->PoolID));
+
+    /*
+     * Blocks returned by a task are kept in its magazine and given out again
+     * without the pool mutex.  The pool is not lock-free here, so the mutex
+     * shows when the shared pool is used.
+     */
+    ES_ResetUnitTest();
+    CFE_UtAssert_SETUP(CFE_ES_PoolCreate(&PoolID1, Buffer1, sizeof(Buffer1)));
+    CFE_UtAssert_SETUP(CFE_ES_PoolEnableMagazines(PoolID1));
+    PoolPtr                = CFE_ES_LocateMemPoolRecordByID(PoolID1);
+    PoolPtr->Pool.LockFree = false;
+    CachePtr               = CFE_ES_MemPoolGetTaskCache(PoolPtr);
+    UtAssert_NOT_NULL(CachePtr);
+    MagPtr = &CachePtr->Magazines[0];
+
+    /* Sizes that do not fit any bucket are not mistaken for unassigned magazines */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, CFE_PLATFORM_ES_MAX_BLOCK_SIZE + 1),
+                      CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 10), 10);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), 10);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&Bufs[0], PoolID1, 12), 12);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_ADDRESS_EQ(Bufs[0], addressp1);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID1, Bufs[0]), 12);
+
+    /* A cached block is no longer valid for the user */
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, Bufs[0]), 12);
+    UtAssert_UINT32_EQ(MagPtr->Count, 1);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID1, Bufs[0]), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, Bufs[0]), CFE_ES_POOL_BLOCK_INVALID);
+
+    /* A full magazine returns its older half to the pool as one batch */
+    for (i = 0; i <= CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&Bufs[i], PoolID1, 10), 10);
+    }
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    for (i = 0; i <= CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, Bufs[i]), 10);
+    }
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_UINT32_EQ(MagPtr->Count, (CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE / 2) + 1);
+    UtAssert_EQ(cpuaddr, PoolPtr->BaseAddr + MagPtr->Offsets[0], (cpuaddr)Bufs[CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE / 2]);
+
+    /* An empty magazine is refilled from the free blocks of the pool as one batch */
+    for (i = 0; i <= CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE / 2; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&Bufs[i], PoolID1, 10), 10);
+    }
+    UtAssert_ZERO(MagPtr->Count);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 10), 10);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+    UtAssert_UINT32_EQ(MagPtr->Count, (CFE_PLATFORM_ES_POOL_MAGAZINE_SIZE / 2) - 1);
+
+    /*
+     * Blocks of other sizes use the other magazines, after that the oldest magazine
+     * is emptied.  The first two (smallest) buckets are not used by these.
+     */
+    for (i = 1; i <= CFE_PLATFORM_ES_POOL_MAGAZINES_PER_TASK; ++i)
+    {
+        BlockSize = PoolPtr->Pool.Buckets[i + 1].BlockSize;
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&Bufs[i], PoolID1, BlockSize), BlockSize);
+        UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, Bufs[i]), BlockSize);
+    }
+    UtAssert_UINT32_EQ(MagPtr->BucketId, CFE_ES_GenPoolFindBucket(&PoolPtr->Pool, BlockSize));
+    UtAssert_UINT32_EQ(MagPtr->Count, 1);
+    UtAssert_UINT32_EQ(CachePtr->NextEvict, 1);
+
+    /* If the pool has no free blocks to refill the magazine, a new block is made */
+    MagPtr = &CachePtr->Magazines[1];
+    UtAssert_UINT32_EQ(MagPtr->BucketId, CFE_ES_GenPoolFindBucket(&PoolPtr->Pool, 20));
+    UtAssert_UINT32_EQ(MagPtr->Count, 1);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&Bufs[0], PoolID1, 20), 20);
+    UtAssert_ZERO(MagPtr->Count);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&Bufs[1], PoolID1, 20), 20);
+    UtAssert_ZERO(MagPtr->Count);
+    UtAssert_BOOL_TRUE(Bufs[1] != Bufs[0]);
+
+    /* A cached block that was overwritten is dropped */
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, Bufs[0]), 20);
+    BdPtr            = (CFE_ES_GenPoolBD_t *)((cpuaddr)Bufs[0] - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE);
+    BdPtr->CheckBits = 0;
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 20), 20);
+    UtAssert_BOOL_TRUE(addressp1 != Bufs[0]);
+    UtAssert_ZERO(MagPtr->Count);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, Bufs[1]), 20);
+    BdPtr            = (CFE_ES_GenPoolBD_t *)((cpuaddr)Bufs[1] - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE);
+    BdPtr->CheckBits = 0;
+    CFE_ES_MemPoolMagazineFlush(PoolPtr, MagPtr, 1);
+    UtAssert_ZERO(MagPtr->Count);
+    UtAssert_UINT32_EQ(PoolPtr->Pool.ValidationErrorCount, 3);
+
+    /* Tasks unknown to OSAL use the shared pool directly */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdToArrayIndex), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), 20);
+    UtAssert_ZERO(MagPtr->Count);
+
+    /* All blocks cached by a task are returned to the pool when it is deleted */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 20), 20);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), 20);
+    UtAssert_UINT32_EQ(MagPtr->Count, 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdToArrayIndex), 1, OS_ERROR);
+    CFE_ES_MemPoolFlushTaskCaches(CFE_ES_TaskId_FromOSAL(OS_TaskGetId()));
+    UtAssert_UINT32_EQ(MagPtr->Count, 1);
+    CFE_ES_MemPoolFlushTaskCaches(CFE_ES_TaskId_FromOSAL(OS_TaskGetId()));
+    for (i = 0; i < CFE_PLATFORM_ES_POOL_MAGAZINES_PER_TASK; ++i)
+    {
+        UtAssert_ZERO(CachePtr->Magazines[i].Count);
+    }
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID1, addressp1), CFE_ES_POOL_BLOCK_INVALID);
+    CFE_UtAssert_RESOURCEID_EQ(CachePtr->Owner, CFE_ES_TASKID_UNDEFINED);
+
+    /*
+     * A cache taken over by a new task of the same OSAL slot is not flushed
+     * again for the deleted task, the new task returns the blocks it finds
+     */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, 20), 20);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, addressp1), 20);
+    UtAssert_UINT32_EQ(MagPtr->Count, 1);
+    CFE_UtAssert_RESOURCEID_EQ(CachePtr->Owner, CFE_ES_TaskId_FromOSAL(OS_TaskGetId()));
+    CachePtr->Owner = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(CFE_ES_TASKID_BASE + 1));
+    CFE_ES_MemPoolFlushTaskCaches(CFE_ES_TaskId_FromOSAL(OS_TaskGetId()));
+    UtAssert_UINT32_EQ(MagPtr->Count, 1);
+    UtAssert_ADDRESS_EQ(CFE_ES_MemPoolGetTaskCache(PoolPtr), CachePtr);
+    UtAssert_ZERO(MagPtr->Count);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID1, addressp1), CFE_ES_POOL_BLOCK_INVALID);
+    CFE_UtAssert_RESOURCEID_EQ(CachePtr->Owner, CFE_ES_TaskId_FromOSAL(OS_TaskGetId()));
+
+    /* A cache whose blocks are being returned for a deleted task is not used */
+    CachePtr->Owner = CFE_ES_POOL_CACHE_FLUSHING;
+    UtAssert_NULL(CFE_ES_MemPoolGetTaskCache(PoolPtr));
+    CFE_UtAssert_RESOURCEID_EQ(CachePtr->Owner, CFE_ES_POOL_CACHE_FLUSHING);
+    CachePtr->Owner = CFE_ES_TASKID_UNDEFINED;
+}
+
+void TestPoolProfile(void)
+{
+    union
+    {
+        CFE_MSG_Message_t            Msg;
+        CFE_ES_WritePoolProfileCmd_t WritePoolProfileCmd;
+    } CmdBuf;
+    CFE_ES_MemHandle_t              PoolID1 = CFE_ES_MEMHANDLE_UNDEFINED;
+    uint8                           Buffer1[1024];
+    CFE_ES_MemPoolBuf_t             Bufs[2];
+    CFE_ES_MemPoolBuf_t             addressp1 = CFE_ES_MEMPOOLBUF_C(0);
+    CFE_ES_MemPoolRecord_t *        PoolPtr;
+    CFE_ES_GenPoolProfile_t         Profile;
+    CFE_ES_GenPoolProfile_t         CDSProfile;
+    CFE_ES_GenPoolProfileBin_t *    BinPtr;
+    CFE_ES_PoolProfileDumpState_t * StatePtr;
+    CFE_ES_PoolProfile_FileEntry_t *EntryPtr;
+    uint32                          PoolIdx;
+    uint32                          i;
+    void *                          Buffer;
+    size_t                          BufSize;
+
+    UtPrintf("Begin Test Pool Profile");
+
+    /* Test the size bins, exact for small sizes and 1/8 of a power of two above that */
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolProfileBin(0), 0);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolProfileBin(15), 15);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolProfileBin(16), 16);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolProfileBin(17), 16);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolProfileBin(31), 23);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolProfileBin(32), 24);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolProfileBin(1000), 63);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolProfileBinMinSize(63), 960);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolProfileBin(0x3FFFF), CFE_ES_POOLPROF_HIST_BINS - 1);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolProfileBin(0x40000), CFE_ES_POOLPROF_HIST_BINS - 1);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolProfileBin((size_t)-1), CFE_ES_POOLPROF_HIST_BINS - 1);
+
+    /* Each bin starts right after the previous one */
+    for (i = 1; i < CFE_ES_POOLPROF_HIST_BINS; ++i)
+    {
+        if (CFE_ES_GenPoolProfileBin(CFE_ES_GenPoolProfileBinMinSize(i)) != i ||
+            CFE_ES_GenPoolProfileBin(CFE_ES_GenPoolProfileBinMinSize(i) - 1) != (i - 1))
+        {
+            break;
+        }
+    }
+    UtAssert_UINT32_EQ(i, CFE_ES_POOLPROF_HIST_BINS);
+
+    /* Enabling the profile resets it */
+    ES_ResetUnitTest();
+    CFE_UtAssert_SETUP(CFE_ES_PoolCreate(&PoolID1, Buffer1, sizeof(Buffer1)));
+    PoolPtr = CFE_ES_LocateMemPoolRecordByID(PoolID1);
+    memset(&Profile, 0xFF, sizeof(Profile));
+    CFE_ES_GenPoolEnableProfile(&PoolPtr->Pool, &Profile);
+    UtAssert_ADDRESS_EQ(PoolPtr->Pool.Profile, &Profile);
+    UtAssert_ZERO(Profile.Bins[0].RequestCount);
+
+    /* Requests are counted in the bin of their size, with the most blocks in use at once */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&Bufs[0], PoolID1, 100), 100);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&Bufs[1], PoolID1, 98), 98);
+    BinPtr = &Profile.Bins[CFE_ES_GenPoolProfileBin(100)];
+    UtAssert_UINT32_EQ(BinPtr->RequestCount, 2);
+    UtAssert_UINT32_EQ(BinPtr->InUse, 2);
+    UtAssert_UINT32_EQ(BinPtr->PeakInUse, 2);
+    UtAssert_UINT32_EQ(BinPtr->MaxSize, 100);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, Bufs[0]), 100);
+    UtAssert_UINT32_EQ(BinPtr->InUse, 1);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&Bufs[0], PoolID1, 100), 100);
+    UtAssert_UINT32_EQ(BinPtr->RequestCount, 3);
+    UtAssert_UINT32_EQ(BinPtr->PeakInUse, 2);
+
+    /* Requests that are not given a block are counted as failed */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID1, (size_t)-1), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(Profile.Bins[CFE_ES_POOLPROF_HIST_BINS - 1].FailCount, 1);
+    UtAssert_ZERO(Profile.Bins[CFE_ES_POOLPROF_HIST_BINS - 1].RequestCount);
+    UtAssert_UINT32_EQ(Profile.Bins[CFE_ES_POOLPROF_HIST_BINS - 1].MaxSize, 0xFFFFFFFF);
+
+    /* Returning blocks that were not counted does not take the count below zero */
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, Bufs[1]), 98);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, Bufs[0]), 100);
+    UtAssert_ZERO(BinPtr->InUse);
+
+    /* Test the entries written to the file, skipping bins without requests */
+    StatePtr = &CFE_ES_Global.PoolProfile.BackgroundDumpState;
+    PoolIdx  = PoolPtr - CFE_ES_Global.MemPoolTable;
+    i        = PoolIdx * CFE_ES_POOLPROF_HIST_BINS;
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundPoolProfileDataGetter(StatePtr, i, &Buffer, &BufSize));
+    UtAssert_NULL(Buffer);
+    UtAssert_ZERO(BufSize);
+    i += CFE_ES_GenPoolProfileBin(100);
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundPoolProfileDataGetter(StatePtr, i, &Buffer, &BufSize));
+    UtAssert_ADDRESS_EQ(Buffer, &StatePtr->EntryBuffer);
+    UtAssert_UINT32_EQ(BufSize, sizeof(CFE_ES_PoolProfile_FileEntry_t));
+    EntryPtr = Buffer;
+    UtAssert_UINT32_EQ(EntryPtr->PoolId, CFE_RESOURCEID_TO_ULONG(PoolID1));
+    UtAssert_UINT32_EQ(EntryPtr->PoolSize, sizeof(Buffer1));
+    UtAssert_UINT32_EQ(EntryPtr->AlignSize, PoolPtr->Pool.AlignMask + 1);
+    UtAssert_UINT32_EQ(EntryPtr->BinIndex, CFE_ES_GenPoolProfileBin(100));
+    UtAssert_UINT32_EQ(EntryPtr->BinMinSize, 96);
+    UtAssert_UINT32_EQ(EntryPtr->MaxSize, 100);
+    UtAssert_UINT32_EQ(EntryPtr->RequestCount, 3);
+    UtAssert_ZERO(EntryPtr->FailCount);
+    UtAssert_ZERO(EntryPtr->InUse);
+    UtAssert_UINT32_EQ(EntryPtr->PeakInUse, 2);
+    i = (PoolIdx * CFE_ES_POOLPROF_HIST_BINS) + CFE_ES_POOLPROF_HIST_BINS - 1;
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundPoolProfileDataGetter(StatePtr, i, &Buffer, &BufSize));
+    UtAssert_NOT_NULL(Buffer);
+    UtAssert_UINT32_EQ(EntryPtr->FailCount, 1);
+
+    /* Pools without a profile and unused pool slots have no entries */
+    PoolPtr->Pool.Profile = NULL;
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundPoolProfileDataGetter(StatePtr, i, &Buffer, &BufSize));
+    UtAssert_NULL(Buffer);
+    PoolIdx = (PoolIdx + 1) % CFE_PLATFORM_ES_MAX_MEMORY_POOLS;
+    CFE_ES_Global.MemPoolTable[PoolIdx].Pool.Profile = &Profile;
+    i = (PoolIdx * CFE_ES_POOLPROF_HIST_BINS) + CFE_ES_GenPoolProfileBin(100);
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundPoolProfileDataGetter(StatePtr, i, &Buffer, &BufSize));
+    UtAssert_NULL(Buffer);
+
+    /* The CDS pool follows the memory pools, with a pool ID of 0 */
+    CFE_ES_GenPoolEnableProfile(&CFE_ES_Global.CDSVars.Pool, &CDSProfile);
+    CFE_ES_GenPoolProfileRequest(&CFE_ES_Global.CDSVars.Pool, 40, true);
+    i = (CFE_PLATFORM_ES_MAX_MEMORY_POOLS * CFE_ES_POOLPROF_HIST_BINS) + CFE_ES_GenPoolProfileBin(40);
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundPoolProfileDataGetter(StatePtr, i, &Buffer, &BufSize));
+    UtAssert_NOT_NULL(Buffer);
+    UtAssert_ZERO(EntryPtr->PoolId);
+    UtAssert_UINT32_EQ(EntryPtr->RequestCount, 1);
+    UtAssert_UINT32_EQ(EntryPtr->InUse, 1);
+    CFE_ES_GenPoolProfileRelease(&CFE_ES_Global.CDSVars.Pool, 40);
+    UtAssert_ZERO(CDSProfile.Bins[CFE_ES_GenPoolProfileBin(40)].InUse);
+    i = ((CFE_PLATFORM_ES_MAX_MEMORY_POOLS + 1) * CFE_ES_POOLPROF_HIST_BINS) - 1;
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundPoolProfileDataGetter(StatePtr, i, &Buffer, &BufSize));
+    UtAssert_NULL(Buffer);
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundPoolProfileDataGetter(StatePtr, i + 1, &Buffer, &BufSize));
+    UtAssert_NULL(Buffer);
+
+    /* Pools without a profile are not counted */
+    CFE_ES_Global.CDSVars.Pool.Profile = NULL;
+    CFE_ES_GenPoolProfileRequest(&CFE_ES_Global.CDSVars.Pool, 40, true);
+    CFE_ES_GenPoolProfileRelease(&CFE_ES_Global.CDSVars.Pool, 40);
+    UtAssert_UINT32_EQ(CDSProfile.Bins[CFE_ES_GenPoolProfileBin(40)].RequestCount, 1);
+
+    /* Test the events of the background file write */
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundPoolProfileEventHandler(StatePtr, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 10, 0, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOLPROF_EID);
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundPoolProfileEventHandler(StatePtr, CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR, -1, 10, 10, 1000);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundPoolProfileEventHandler(StatePtr, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, -1, 10, 10, 1000);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundPoolProfileEventHandler(StatePtr, CFE_FS_FileWriteEvent_CREATE_ERROR, OS_ERROR, 10, 0, 0);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOLPROF_ERR_EID);
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundPoolProfileEventHandler(StatePtr, CFE_FS_FileWriteEvent_UNDEFINED, OS_SUCCESS, 0, 0, 0);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Test the command to write the profile, which starts a background file write */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WritePoolProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_POOL_PROFILE_CC);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandCounter, 1);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Failure of parsing the file name */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WritePoolProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_POOL_PROFILE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOLPROF_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandErrorCounter, 1);
+
+    /* A write that is already pending */
+    UT_ClearEventHistory();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WritePoolProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_POOL_PROFILE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_POOLPROF_PENDING_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandErrorCounter, 2);
+}
+
+void TestStartupTimeline(void)
+{
+    union
+    {
+        CFE_MSG_Message_t                Msg;
+        CFE_ES_WriteStartupTimelineCmd_t WriteStartupTimelineCmd;
+    } CmdBuf;
+    CFE_ES_LockProfileStamp_t    Now;
+    CFE_ES_AppRecord_t *         UtAppRecPtr;
+    CFE_ES_TimelineModule_t *    ModulePtr;
+    CFE_ES_TimelineDumpState_t * StatePtr;
+    CFE_ES_Timeline_FileEntry_t *EntryPtr;
+    CFE_ResourceId_t             AppId;
+    CFE_ResourceId_t             LibId;
+    uint32                       Idx;
+    void *                       Buffer;
+    size_t                       BufSize;
+
+    UtPrintf("Begin Test Startup Timeline");
+
+    /* Times are kept relative to the start, with one tick per millisecond */
+    ES_ResetUnitTest();
+    memset(&Now, 0, sizeof(Now));
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Get_Timebase), ES_UT_LockProfileTimebase, &Now);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_GetTimerTicksPerSecond), 1000);
+    Now.Lower32 = 1000;
+    CFE_ES_TimelineStart();
+    UtAssert_EQ(uint64, CFE_ES_Global.Timeline.PhaseTicks[CFE_ES_TimelinePhase_EARLY_INIT], 1);
+    Now.Lower32 = 1010;
+    CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_CORE_READY);
+    UtAssert_EQ(uint64, CFE_ES_Global.Timeline.PhaseTicks[CFE_ES_TimelinePhase_CORE_READY], 11);
+    UtAssert_UINT32_EQ(CFE_ES_TimelineToUsec(11), 10000);
+
+    /* Only the first time a phase is entered is kept */
+    Now.Lower32 = 1020;
+    CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_CORE_READY);
+    UtAssert_EQ(uint64, CFE_ES_Global.Timeline.PhaseTicks[CFE_ES_TimelinePhase_CORE_READY], 11);
+    CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_MAX);
+
+    /* Conversion of times that were not reached, without a timer rate, and out of range */
+    UtAssert_UINT32_EQ(CFE_ES_TimelineToUsec(0), CFE_ES_TIMELINE_NOT_REACHED);
+    UtAssert_UINT32_EQ(CFE_ES_TimelineToUsec(0x100000000000), CFE_ES_TIMELINE_NOT_REACHED - 1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_GetTimerTicksPerSecond), 1, 0);
+    UtAssert_UINT32_EQ(CFE_ES_TimelineToUsec(11), 10);
+
+    /* A timebase before the start is recorded as the start */
+    Now.Lower32 = 900;
+    CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_FILESYSTEMS);
+    UtAssert_EQ(uint64, CFE_ES_Global.Timeline.PhaseTicks[CFE_ES_TimelinePhase_FILESYSTEMS], 1);
+
+    /* The milestones of an app are recorded in the entry of its table slot */
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_EARLY_INIT, "UT", &UtAppRecPtr, NULL);
+    AppId = CFE_RESOURCEID_UNWRAP(CFE_ES_AppRecordGetID(UtAppRecPtr));
+    CFE_UtAssert_SETUP(CFE_ES_AppID_ToIndex(CFE_ES_APPID_C(AppId), &Idx));
+    ModulePtr   = &CFE_ES_Global.Timeline.Modules[Idx];
+    Now.Lower32 = 1020;
+    CFE_ES_TimelineAddModule(AppId, "UT", CFE_ES_TimelineRecordType_APP);
+    UtAssert_STRINGBUF_EQ(ModulePtr->Name, sizeof(ModulePtr->Name), "UT", -1);
+    UtAssert_UINT32_EQ(ModulePtr->RecordType, CFE_ES_TimelineRecordType_APP);
+    UtAssert_EQ(uint64, ModulePtr->Ticks[CFE_ES_TimelineMilestone_CREATE], 21);
+    UtAssert_ZERO(ModulePtr->Ticks[CFE_ES_TimelineMilestone_LOADED]);
+    Now.Lower32 = 1030;
+    CFE_ES_TimelineMarkModule(AppId, CFE_ES_TimelineMilestone_LOADED);
+    UtAssert_EQ(uint64, ModulePtr->Ticks[CFE_ES_TimelineMilestone_LOADED], 31);
+    CFE_ES_TimelineMarkModule(AppId, CFE_ES_TimelineMilestone_MAX);
+
+    /* Waiting for the system state records the app state it implies */
+    Now.Lower32               = 1040;
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_APPS_INIT;
+    CFE_UtAssert_SUCCESS(CFE_ES_WaitForSystemState(CFE_ES_SystemState_APPS_INIT, 0));
+    UtAssert_EQ(uint64, ModulePtr->Ticks[CFE_ES_TimelineMilestone_LATE_INIT], 41);
+    UtAssert_ZERO(ModulePtr->Ticks[CFE_ES_TimelineMilestone_RUNNING]);
+    Now.Lower32                               = 1050;
+    UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_APP_RUN;
+    UtAssert_BOOL_TRUE(CFE_ES_RunLoop(NULL));
+    UtAssert_EQ(uint64, ModulePtr->Ticks[CFE_ES_TimelineMilestone_RUNNING], 51);
+    UtAssert_UINT32_EQ(UtAppRecPtr->AppState, CFE_ES_AppState_RUNNING);
+    Now.Lower32 = 1060;
+    UtAssert_BOOL_TRUE(CFE_ES_RunLoop(NULL));
+    UtAssert_EQ(uint64, ModulePtr->Ticks[CFE_ES_TimelineMilestone_RUNNING], 51);
+
+    /* Another ID of the same slot, and IDs of other resource types, are not recorded */
+    CFE_ES_TimelineMarkModule(ES_UT_MakeAppIdForIndex(Idx + CFE_PLATFORM_ES_MAX_APPLICATIONS),
+                              CFE_ES_TimelineMilestone_STARTED);
+    CFE_ES_TimelineMarkModule(CFE_RESOURCEID_UNDEFINED, CFE_ES_TimelineMilestone_STARTED);
+    CFE_ES_TimelineAddModule(CFE_RESOURCEID_UNDEFINED, "UT", CFE_ES_TimelineRecordType_APP);
+    UtAssert_ZERO(ModulePtr->Ticks[CFE_ES_TimelineMilestone_STARTED]);
+
+    /* Libraries follow the apps */
+    LibId = CFE_ResourceId_FromInteger(CFE_ES_LIBID_BASE);
+    CFE_ES_TimelineAddModule(LibId, "UTLib", CFE_ES_TimelineRecordType_LIB);
+    UtAssert_UINT32_EQ(CFE_ES_Global.Timeline.Modules[CFE_PLATFORM_ES_MAX_APPLICATIONS].RecordType,
+                       CFE_ES_TimelineRecordType_LIB);
+
+    /* An app that has not reached RUNNING is not a candidate for the slowest */
+    CFE_ES_TimelineAddModule(ES_UT_MakeAppIdForIndex((Idx + 2) % CFE_PLATFORM_ES_MAX_APPLICATIONS), "UT3",
+                             CFE_ES_TimelineRecordType_APP);
+
+    /* Nothing is recorded, and nothing is reported before the system is operational */
+    UT_ClearEventHistory();
+    CFE_ES_TimelineReport();
+    CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
+
+    Now.Lower32 = 1100;
+    CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_APPS_LOADED);
+    Now.Lower32 = 1200;
+    CFE_ES_TimelineMarkPhase(CFE_ES_TimelinePhase_OPERATIONAL);
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+    CFE_ES_TimelineMarkModule(AppId, CFE_ES_TimelineMilestone_STARTED);
+    UtAssert_ZERO(ModulePtr->Ticks[CFE_ES_TimelineMilestone_STARTED]);
+    CFE_ES_TimelineAddModule(AppId, "UT2", CFE_ES_TimelineRecordType_APP);
+    UtAssert_STRINGBUF_EQ(ModulePtr->Name, sizeof(ModulePtr->Name), "UT", -1);
+
+    /* The summary is reported once, from the housekeeping request, together with a file write */
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CFE_ES_SendHkCmd_t), UT_TPID_CFE_ES_SEND_HK);
+    CFE_UtAssert_EVENTSENT(CFE_ES_TIMELINE_INF_EID);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    UtAssert_BOOL_TRUE(CFE_ES_Global.Timeline.ReportSent);
+    UT_ClearEventHistory();
+    CFE_ES_TimelineReport();
+    CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+
+    /* A failure to start the file write is reported, a write already in progress is not */
+    CFE_ES_Global.Timeline.ReportSent = false;
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    CFE_ES_TimelineReport();
+    CFE_UtAssert_EVENTSENT(CFE_ES_TIMELINE_ERR_EID);
+    UT_ClearEventHistory();
+    CFE_ES_Global.Timeline.ReportSent = false;
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), 1, true);
+    CFE_ES_TimelineReport();
+    CFE_UtAssert_EVENTSENT(CFE_ES_TIMELINE_INF_EID);
+    CFE_UtAssert_EVENTNOTSENT(CFE_ES_TIMELINE_ERR_EID);
+
+    /* Test the entries written to the file, the phases first, skipping unused slots */
+    StatePtr = &CFE_ES_Global.Timeline.BackgroundDumpState;
+    EntryPtr = &StatePtr->EntryBuffer;
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundTimelineDataGetter(StatePtr, 0, &Buffer, &BufSize));
+    UtAssert_ADDRESS_EQ(Buffer, EntryPtr);
+    UtAssert_UINT32_EQ(BufSize, sizeof(CFE_ES_Timeline_FileEntry_t));
+    UtAssert_UINT32_EQ(EntryPtr->RecordType, CFE_ES_TimelineRecordType_PHASES);
+    UtAssert_ZERO(EntryPtr->TimeUsec[CFE_ES_TimelinePhase_EARLY_INIT]);
+    UtAssert_UINT32_EQ(EntryPtr->TimeUsec[CFE_ES_TimelinePhase_CORE_READY], 10000);
+    UtAssert_UINT32_EQ(EntryPtr->TimeUsec[CFE_ES_TimelinePhase_CORE_STARTUP], CFE_ES_TIMELINE_NOT_REACHED);
+    UtAssert_UINT32_EQ(EntryPtr->TimeUsec[CFE_ES_TimelinePhase_OPERATIONAL], 200000);
+    UtAssert_UINT32_EQ(EntryPtr->TimeUsec[CFE_ES_TimelinePhase_MAX], CFE_ES_TIMELINE_NOT_REACHED);
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundTimelineDataGetter(StatePtr, Idx + 1, &Buffer, &BufSize));
+    UtAssert_NOT_NULL(Buffer);
+    UtAssert_STRINGBUF_EQ(EntryPtr->Name, sizeof(EntryPtr->Name), "UT", -1);
+    UtAssert_UINT32_EQ(EntryPtr->RecordType, CFE_ES_TimelineRecordType_APP);
+    UtAssert_UINT32_EQ(EntryPtr->ResourceId, CFE_ResourceId_ToInteger(AppId));
+    UtAssert_UINT32_EQ(EntryPtr->TimeUsec[CFE_ES_TimelineMilestone_CREATE], 20000);
+    UtAssert_UINT32_EQ(EntryPtr->TimeUsec[CFE_ES_TimelineMilestone_STARTED], CFE_ES_TIMELINE_NOT_REACHED);
+    UtAssert_UINT32_EQ(EntryPtr->TimeUsec[CFE_ES_TimelineMilestone_RUNNING], 50000);
+    Idx = (Idx + 1) % CFE_PLATFORM_ES_MAX_APPLICATIONS;
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundTimelineDataGetter(StatePtr, Idx + 1, &Buffer, &BufSize));
+    UtAssert_NULL(Buffer);
+    UtAssert_ZERO(BufSize);
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundTimelineDataGetter(StatePtr, CFE_ES_TIMELINE_MAX_MODULES, &Buffer, &BufSize));
+    UtAssert_BOOL_TRUE(
+        CFE_ES_BackgroundTimelineDataGetter(StatePtr, CFE_ES_TIMELINE_MAX_MODULES + 1, &Buffer, &BufSize));
+    UtAssert_NULL(Buffer);
+
+    /* Test the events of the background file write */
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundTimelineEventHandler(StatePtr, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 10, 0, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_TIMELINE_EID);
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundTimelineEventHandler(StatePtr, CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR, -1, 10, 10, 1000);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundTimelineEventHandler(StatePtr, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, -1, 10, 10, 1000);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundTimelineEventHandler(StatePtr, CFE_FS_FileWriteEvent_CREATE_ERROR, OS_ERROR, 10, 0, 0);
+    CFE_UtAssert_EVENTSENT(CFE_ES_TIMELINE_ERR_EID);
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundTimelineEventHandler(StatePtr, CFE_FS_FileWriteEvent_UNDEFINED, OS_SUCCESS, 0, 0, 0);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Test the command to write the timeline, which starts a background file write */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteStartupTimelineCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_STARTUP_TIMELINE_CC);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandCounter, 1);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Failure of parsing the file name */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteStartupTimelineCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_STARTUP_TIMELINE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_TIMELINE_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandErrorCounter, 1);
+
+    /* A write that is already pending */
+    UT_ClearEventHistory();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteStartupTimelineCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_STARTUP_TIMELINE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_TIMELINE_PENDING_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandErrorCounter, 2);
 }
 
 /* Tests to fill gaps in coverage in SysLog */
@@ -5583,20 +7966,23 @@ void TestSysLog(void)
     CFE_ES_SysLogReadBuffer_t SysLogBuffer;
     char                      LogString[(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2) + 2];
 
-    char TmpString[CFE_ES_MAX_SYSLOG_MSG_SIZE + 1];
+    char   TmpString[CFE_ES_MAX_SYSLOG_MSG_SIZE + 1];
+    uint32 Idx;
+    uint32 Format;
+    size_t Lines;
+    size_t Offset;
 
     UtPrintf("Begin Test Sys Log");
 
-    /* Test loop in CFE_ES_SysLogReadStart_Unsync that ensures
+    /* Test loop in CFE_ES_SysLogReadStart that ensures
      * reading at the start of a message */
     ES_ResetUnitTest();
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = 0;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 1;
+    ES_UT_SetSysLogIndex(0, sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 1);
 
-    memset(CFE_ES_Global.ResetDataPtr->SystemLog, 'a', CFE_ES_Global.ResetDataPtr->SystemLogEndIdx);
-    CFE_ES_Global.ResetDataPtr->SystemLog[CFE_ES_Global.ResetDataPtr->SystemLogEndIdx - 1] = '\n';
+    memset(CFE_ES_Global.ResetDataPtr->SystemLog, 'a', sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 1);
+    CFE_ES_Global.ResetDataPtr->SystemLog[sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 2] = '\n';
 
-    CFE_ES_SysLogReadStart_Unsync(&SysLogBuffer);
+    CFE_ES_SysLogReadStart(&SysLogBuffer);
 
     UtAssert_EQ(size_t, SysLogBuffer.EndIdx, sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 1);
     UtAssert_EQ(size_t, SysLogBuffer.LastOffset, sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 1);
@@ -5608,20 +7994,53 @@ void TestSysLog(void)
     ES_ResetUnitTest();
     memset(LogString, 'a', (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2) + 1);
     LogString[(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2) + 1] = '\0';
-    UtAssert_INT32_EQ(CFE_ES_SysLogAppend_Unsync(LogString), CFE_ES_ERR_SYS_LOG_TRUNCATED);
+    UtAssert_INT32_EQ(CFE_ES_SysLogAppend(LogString), CFE_ES_ERR_SYS_LOG_TRUNCATED);
 
     /* Test code that skips writing an empty string to the sys log */
     ES_ResetUnitTest();
     memset(LogString, 'a', (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2) + 1);
     LogString[0] = '\0';
-    CFE_UtAssert_SUCCESS(CFE_ES_SysLogAppend_Unsync(LogString));
+    CFE_UtAssert_SUCCESS(CFE_ES_SysLogAppend(LogString));
+
+    /* Test that an append is only visible to readers once no other append is in progress */
+    ES_ResetUnitTest();
+    CFE_ES_Global.ResetDataPtr->SystemLogState     = CFE_ES_SYSLOG_STATE(10, 10, 1, 1, 0);
+    CFE_ES_Global.ResetDataPtr->SystemLogCommitted = CFE_ES_SYSLOG_STATE(0, 0, 0, 0, 0);
+    CFE_UtAssert_SUCCESS(CFE_ES_SysLogAppend("SysLogText\n"));
+    UtAssert_UINT32_EQ(CFE_ES_SYSLOG_STATE_WRITEIDX(CFE_ES_Global.ResetDataPtr->SystemLogState), 21);
+    UtAssert_UINT32_EQ(CFE_ES_SYSLOG_STATE_PENDING(CFE_ES_Global.ResetDataPtr->SystemLogState), 1);
+    UtAssert_ZERO(CFE_ES_Global.ResetDataPtr->SystemLogCommitted);
+    CFE_ES_SysLogReadStart(&SysLogBuffer);
+    UtAssert_ZERO(SysLogBuffer.EndIdx);
+
+    /* Test that clearing the log with an append in progress leaves it to that append to publish */
+    CFE_ES_SysLogClear();
+    UtAssert_ZERO(CFE_ES_SYSLOG_STATE_ENDIDX(CFE_ES_Global.ResetDataPtr->SystemLogState));
+    UtAssert_UINT32_EQ(CFE_ES_SYSLOG_STATE_PENDING(CFE_ES_Global.ResetDataPtr->SystemLogState), 1);
+    UtAssert_ZERO(CFE_ES_Global.ResetDataPtr->SystemLogCommitted);
+
+    /* Test recovering appends that were in progress at a reset */
+    CFE_ES_SysLogRecover();
+    UtAssert_ZERO(CFE_ES_SYSLOG_STATE_PENDING(CFE_ES_Global.ResetDataPtr->SystemLogState));
+    UtAssert_True(CFE_ES_Global.ResetDataPtr->SystemLogCommitted == CFE_ES_Global.ResetDataPtr->SystemLogState,
+                  "Recovered system log state is published");
+
+    /* Test an append when too many appends are in progress */
+    ES_ResetUnitTest();
+    CFE_ES_Global.ResetDataPtr->SystemLogState = CFE_ES_SYSLOG_STATE(0, 0, CFE_ES_SYSLOG_PENDING_MAX, 0, 0);
+    UtAssert_INT32_EQ(CFE_ES_SysLogAppend("SysLogText\n"), CFE_ES_ERR_SYS_LOG_FULL);
+    ES_UT_SetSysLogIndex(0, 0);
 
     /* Test Reading space between the current read offset and end of the log buffer */
     ES_ResetUnitTest();
+    ES_UT_SetSysLogIndex(0, 0);
     SysLogBuffer.EndIdx     = 3;
     SysLogBuffer.LastOffset = 0;
     SysLogBuffer.BlockSize  = 3;
     SysLogBuffer.SizeLeft   = 1;
+    SysLogBuffer.StartIdx   = 0;
+    SysLogBuffer.TotalSize  = 1;
+    SysLogBuffer.State      = CFE_ES_Global.ResetDataPtr->SystemLogState;
 
     CFE_ES_SysLogReadData(&SysLogBuffer);
 
@@ -5632,8 +8051,12 @@ void TestSysLog(void)
 
     /* Test case where calculated blocksize results in 0 */
     ES_ResetUnitTest();
-    SysLogBuffer.EndIdx   = 0;
-    SysLogBuffer.SizeLeft = 1;
+    ES_UT_SetSysLogIndex(0, 0);
+    SysLogBuffer.EndIdx    = 0;
+    SysLogBuffer.SizeLeft  = 1;
+    SysLogBuffer.StartIdx  = 0;
+    SysLogBuffer.TotalSize = 1;
+    SysLogBuffer.State     = CFE_ES_Global.ResetDataPtr->SystemLogState;
 
     CFE_ES_SysLogReadData(&SysLogBuffer);
 
@@ -5645,8 +8068,7 @@ void TestSysLog(void)
     /* Test nominal flow through CFE_ES_SysLogDump
      * with multiple reads and writes  */
     ES_ResetUnitTest();
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = 0;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 1;
+    ES_UT_SetSysLogIndex(0, sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 1);
 
     UtAssert_VOIDCALL(CFE_ES_SysLogDump("fakefilename"));
 
@@ -5656,6 +8078,131 @@ void TestSysLog(void)
     TmpString[CFE_ES_MAX_SYSLOG_MSG_SIZE] = '\0';
 
     CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("%s", TmpString));
+
+    /* Test a system log in binary format, which is only formatted when it is read */
+    ES_ResetUnitTest();
+    ES_UT_SetSysLogIndex(0, 0);
+    CFE_ES_Global.ResetDataPtr->SystemLogFormat = CFE_ES_SYSLOG_FORMAT_BINARY;
+    CFE_ES_Global.ResetDataPtr->SystemLogMode   = CFE_ES_LogMode_DISCARD;
+    CFE_UtAssert_SUCCESS(
+        CFE_ES_SysLogWrite_Unsync("%s: %d %5.2f %-*s|%c%%%lu %.*s\n", "Test", -5, 1.5, 4, "ab", 'x', 7UL, -1, "cd"));
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("%s: %lld %hhu %zx", "Api", -1LL, 257, (size_t)26));
+    UtAssert_STUB_COUNT(OS_printf, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum, 2);
+
+    CFE_ES_SysLogReadStart(&SysLogBuffer);
+    CFE_ES_SysLogReadData(&SysLogBuffer);
+    UtAssert_NONZERO(SysLogBuffer.BlockSize);
+    UtAssert_ZERO(SysLogBuffer.SizeLeft);
+    SysLogBuffer.Data[SysLogBuffer.BlockSize] = 0;
+    UtAssert_NOT_NULL(strstr(SysLogBuffer.Data, " Test: -5  1.50 ab  |x%7 cd\n"));
+    UtAssert_NOT_NULL(strstr(SysLogBuffer.Data, " Api: -1 1 1a\n"));
+
+    /* Test that reading starts at the oldest complete record after the log wrapped */
+    ES_ResetUnitTest();
+    ES_UT_SetSysLogIndex(0, 0);
+    CFE_ES_Global.ResetDataPtr->SystemLogMode = CFE_ES_LogMode_OVERWRITE;
+    Idx = 0;
+    do
+    {
+        CFE_UtAssert_SUCCESS(CFE_ES_SysLogWrite_Unsync("Message %u\n", (unsigned int)Idx));
+        ++Idx;
+    } while (CFE_ES_SYSLOG_STATE_WRITEIDX(CFE_ES_Global.ResetDataPtr->SystemLogCommitted) >=
+             CFE_ES_SYSLOG_STATE_ENDIDX(CFE_ES_Global.ResetDataPtr->SystemLogCommitted));
+
+    CFE_ES_SysLogReadStart(&SysLogBuffer);
+    Lines = 0;
+    do
+    {
+        CFE_ES_SysLogReadData(&SysLogBuffer);
+        SysLogBuffer.Data[SysLogBuffer.BlockSize] = 0;
+        for (Offset = 0; Offset < SysLogBuffer.BlockSize; ++Offset)
+        {
+            if (SysLogBuffer.Data[Offset] == '\n')
+            {
+                ++Lines;
+            }
+        }
+        if (SysLogBuffer.BlockSize > 0 && SysLogBuffer.SizeLeft == 0)
+        {
+            snprintf(TmpString, sizeof(TmpString), " Message %u\n", (unsigned int)(Idx - 1));
+            UtAssert_NOT_NULL(strstr(SysLogBuffer.Data, TmpString));
+        }
+    } while (SysLogBuffer.BlockSize > 0);
+    UtAssert_NONZERO(Lines);
+    UtAssert_True(Lines < Idx, "Oldest records overwritten (%lu of %lu read)", (unsigned long)Lines,
+                  (unsigned long)Idx);
+
+    /* Test reading a record that was overwritten while reading */
+    CFE_ES_SysLogReadStart(&SysLogBuffer);
+    CFE_ES_Global.ResetDataPtr->SystemLog[SysLogBuffer.LastOffset] ^= 0xFF;
+    CFE_ES_SysLogReadData(&SysLogBuffer);
+    UtAssert_ZERO(SysLogBuffer.BlockSize);
+    UtAssert_ZERO(SysLogBuffer.SizeLeft);
+
+    /* Test reads that are lapped by appends, which drop the oldest messages that were overwritten */
+    for (Format = CFE_ES_SYSLOG_FORMAT_TEXT; Format <= CFE_ES_SYSLOG_FORMAT_BINARY; ++Format)
+    {
+        ES_ResetUnitTest();
+        ES_UT_SetSysLogIndex(0, 0);
+        CFE_ES_Global.ResetDataPtr->SystemLogFormat = Format;
+        CFE_ES_Global.ResetDataPtr->SystemLogMode   = CFE_ES_LogMode_OVERWRITE;
+        Idx                                         = 0;
+        do
+        {
+            CFE_UtAssert_SUCCESS(CFE_ES_SysLogWrite_Unsync("Message %u\n", (unsigned int)Idx));
+            ++Idx;
+        } while (CFE_ES_SYSLOG_STATE_WRITEIDX(CFE_ES_Global.ResetDataPtr->SystemLogCommitted) >=
+                 CFE_ES_SYSLOG_STATE_ENDIDX(CFE_ES_Global.ResetDataPtr->SystemLogCommitted));
+
+        /* the oldest message, after its timestamp */
+        CFE_ES_SysLogReadStart(&SysLogBuffer);
+        CFE_ES_SysLogReadData(&SysLogBuffer);
+        Lines = ES_UT_SysLogFind(&SysLogBuffer, " - ");
+        for (Offset = 0; Offset < (sizeof(TmpString) - 2) && SysLogBuffer.Data[Lines + Offset] != '\n'; ++Offset)
+        {
+            TmpString[Offset] = SysLogBuffer.Data[Lines + Offset];
+        }
+        TmpString[Offset]     = '\n';
+        TmpString[Offset + 1] = 0;
+
+        CFE_ES_SysLogReadStart(&SysLogBuffer);
+        CFE_UtAssert_SUCCESS(CFE_ES_SysLogWrite_Unsync("Message %u\n", (unsigned int)Idx));
+        CFE_UtAssert_SUCCESS(CFE_ES_SysLogWrite_Unsync("Message %u\n", (unsigned int)(Idx + 1)));
+        CFE_ES_SysLogReadData(&SysLogBuffer);
+        UtAssert_NONZERO(SysLogBuffer.BlockSize);
+        UtAssert_True(strncmp(SysLogBuffer.Data, "UT ", 3) == 0, "Reading continues at a complete message");
+        UtAssert_EQ(size_t, ES_UT_SysLogFind(&SysLogBuffer, TmpString), SysLogBuffer.BlockSize);
+
+        /* Test a read while the log is cleared, which drops everything */
+        CFE_ES_SysLogReadStart(&SysLogBuffer);
+        CFE_ES_SysLogClear();
+        CFE_ES_SysLogReadData(&SysLogBuffer);
+        UtAssert_ZERO(SysLogBuffer.BlockSize);
+        UtAssert_ZERO(SysLogBuffer.SizeLeft);
+        UtAssert_ZERO(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum);
+    }
+
+    /* Test a record that does not fit in discard mode, and a conversion that is not supported */
+    ES_ResetUnitTest();
+    ES_UT_SetSysLogIndex(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - 8, CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - 8);
+    CFE_ES_Global.ResetDataPtr->SystemLogMode = CFE_ES_LogMode_DISCARD;
+    UtAssert_INT32_EQ(CFE_ES_SysLogWrite_Unsync("SysLogText\n"), CFE_ES_ERR_SYS_LOG_FULL);
+    ES_UT_SetSysLogIndex(0, 0);
+    UtAssert_INT32_EQ(CFE_ES_SysLogWrite_Unsync("Bad %y %d\n", 1), CFE_ES_ERR_SYS_LOG_TRUNCATED);
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum, 1);
+
+    /* Test a string argument that has to be cut off to fit in a record */
+    memset(TmpString, 'a', CFE_ES_MAX_SYSLOG_MSG_SIZE);
+    TmpString[CFE_ES_MAX_SYSLOG_MSG_SIZE] = '\0';
+    UtAssert_INT32_EQ(CFE_ES_SysLogWrite_Unsync("%s%s%s", TmpString, TmpString, TmpString),
+                      CFE_ES_ERR_SYS_LOG_TRUNCATED);
+
+    /* Test that the log is cleared when it was written in a different format before a reset */
+    CFE_ES_SysLogRecover();
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogFormat, CFE_ES_SYSLOG_FORMAT_TEXT);
+    UtAssert_ZERO(CFE_ES_SYSLOG_STATE_ENDIDX(CFE_ES_Global.ResetDataPtr->SystemLogCommitted));
+    UtAssert_ZERO(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum);
 }
 
 void TestBackground(void)
@@ -178,6 +178,73 @@ void TestBackground(void);
 ******************************************************************************/
 void TestPerf(void);
 
+/*****************************************************************************/
+/**
+** \brief Performs tests on the STREAM mode of the performance log
+**        contained in cfe_es_perf.c
+**
+** \par Description
+**        This function tests the streaming of performance log entries
+**        to a rolling set of files.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestPerfStream(void);
+
+/*****************************************************************************/
+/**
+** \brief Performs tests on the trace format of the performance log
+**        dump contained in cfe_es_perf.c
+**
+** \par Description
+**        This function tests dumping the performance log in the
+**        Trace Event JSON format.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestPerfTrace(void);
+
+/*****************************************************************************/
+/**
+** \brief Performs tests on the performance marker statistics
+**        contained in cfe_es_perf.c
+**
+** \par Description
+**        This function tests the entry to exit latency statistics
+**        and the commands to select and telemeter them.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestPerfStats(void);
+
+/*****************************************************************************/
+/**
+** \brief Performs tests on the lock profiler contained in cfe_es_lockprof.c
+**
+** \par Description
+**        This function tests the lock profiler wait and hold time statistics
+**        and writing them to a file.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestLockProfile(void);
+
 /*****************************************************************************/
 /**
 ** \brief Perform tests on the ES API functions contained in cfe_es_api.c
@@ -226,6 +293,24 @@ void TestCDS(void);
 ******************************************************************************/
 void TestCDSMempool(void);
 
+/*****************************************************************************/
+/**
+** \brief Performs tests on the write-behind mode of CDS blocks contained in
+**        cfe_es_cds_mempool.c
+**
+** \par Description
+**        This function tests enabling and disabling write-behind mode, writing
+**        to and reading from the shadow of a block, and flushing the changes
+**        to the CDS from the background job.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestCDSWriteBehind(void);
+
 /*****************************************************************************/
 /**
 ** \brief Perform tests on the set of services for management of discrete sized
@@ -243,9 +328,89 @@ void TestCDSMempool(void);
 ******************************************************************************/
 void TestESMempool(void);
 
+/*****************************************************************************/
+/**
+** \brief Tests the per-task magazine caches of ES memory pools
+**
+** \par Description
+**        This function tests enabling magazines, getting and returning
+**        buffers through them, and flushing them when a task is deleted.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestESMempoolMagazines(void);
+
+/*****************************************************************************/
+/**
+** \brief Performs tests on the pool size profiler
+**
+** \par Description
+**        This function tests counting the requested sizes of memory pools
+**        and writing the size profiles to a file.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestPoolProfile(void);
+
+/*****************************************************************************/
+/**
+** \brief Test the startup timeline
+**
+** \par Description
+**        This function tests the recording and reporting of the startup timeline.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestStartupTimeline(void);
+
 void TestSysLog(void);
 void TestResourceID(void);
 void TestGenericCounterAPI(void);
+
+/*****************************************************************************/
+/**
+** \brief Performs tests on the CRC algorithms
+**
+** \par Description
+**        This function tests the CRC algorithms against their check values
+**        and against a bit at a time reference implementation.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestCRC(void);
+
+/*****************************************************************************/
+/**
+** \brief Performs tests on the CRC combine and chunked CRC functions
+**
+** \par Description
+**        This function tests that combined and updated chunked CRCs
+**        match the CRC computed over the whole block.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestChunkedCRC(void);
+
 void TestGenericPool(void);
 void TestLibs(void);
 void TestStatusToString(void);
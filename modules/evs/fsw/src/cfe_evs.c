@@ -129,6 +129,8 @@ CFE_Status_t CFE_EVS_SendEvent(uint16 EventID, CFE_EVS_EventType_Enum_t EventTyp
         return CFE_EVS_INVALID_PARAMETER;
     }
 
+    CFE_CORE_PERF_ENTRY(CFE_MISSION_EVS_SENDEVENT_PERF_ID);
+
     /* Query and verify the caller's AppID */
     Status = EVS_GetCurrentContext(&AppDataPtr, &AppID);
     if (Status == CFE_SUCCESS)
@@ -157,6 +159,8 @@ CFE_Status_t CFE_EVS_SendEvent(uint16 EventID, CFE_EVS_EventType_Enum_t EventTyp
         }
     }
 
+    CFE_CORE_PERF_EXIT(CFE_MISSION_EVS_SENDEVENT_PERF_ID);
+
     return Status;
 }
 
@@ -36,6 +36,7 @@
 
 #include "cfe_msgids.h"
 #include "cfe_perfids.h"
+#include "cfe_core_perf_markers.h"
 
 #include "cfe_evs_core_internal.h"
 
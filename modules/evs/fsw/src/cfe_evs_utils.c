@@ -314,7 +314,10 @@ bool EVS_CheckAndIncrementSquelchTokens(EVS_AppData_t *AppDataPtr)
          * We use a timer here since configurations are not guaranteed to send EVS HK wakeups at 1Hz
          * Use a non-settable timer to prevent this from breaking w/ time changes
          */
+        CFE_CORE_PERF_ENTRY(CFE_MISSION_EVS_LOCK_PERF_ID);
         OS_MutSemTake(CFE_EVS_Global.EVS_SharedDataMutexID);
+        CFE_CORE_PERF_EXIT(CFE_MISSION_EVS_LOCK_PERF_ID);
+
         CFE_PSP_GetTime(&CurrentTime);
         DeltaTimeMs = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(CurrentTime, AppDataPtr->LastSquelchCreditableTime));
 
@@ -518,7 +521,9 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, CFE_E
     }
 
     /* Serialize access to event log control variables */
+    CFE_CORE_PERF_ENTRY(CFE_MISSION_EVS_LOCK_PERF_ID);
     OS_MutSemTake(CFE_EVS_Global.EVS_SharedDataMutexID);
+    CFE_CORE_PERF_EXIT(CFE_MISSION_EVS_LOCK_PERF_ID);
 
     /* Increment message send counters (prevent rollover) */
     if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageSendCounter < CFE_EVS_MAX_EVENT_SEND_COUNT)
@@ -165,7 +165,37 @@ enum CFE_FS_SubType
      * command.
      *
      */
-    CFE_FS_SubType_ES_QUERYALLTASKS = 23
+    CFE_FS_SubType_ES_QUERYALLTASKS = 23,
+
+    /**
+     * @brief Executive Services Lock Profile Data File
+     *
+     * Executive Services Lock Profile Data File which is generated in response to a
+     * \link #CFE_ES_WRITE_LOCK_PROFILE_CC \ES_WRITELOCKPROF2FILE \endlink
+     * command.
+     *
+     */
+    CFE_FS_SubType_ES_LOCKPROF = 24,
+
+    /**
+     * @brief Executive Services Pool Profile Data File
+     *
+     * Executive Services Pool Profile Data File which is generated in response to a
+     * \link #CFE_ES_WRITE_POOL_PROFILE_CC \ES_WRITEPOOLPROF2FILE \endlink
+     * command.
+     *
+     */
+    CFE_FS_SubType_ES_POOLPROF = 25,
+
+    /**
+     * @brief Executive Services Startup Timeline Data File
+     *
+     * Executive Services Startup Timeline Data File which is generated in response to a
+     * \link #CFE_ES_WRITE_STARTUP_TIMELINE_CC \ES_WRITETIMELINE2FILE \endlink
+     * command, or once the system is OPERATIONAL.
+     *
+     */
+    CFE_FS_SubType_ES_TIMELINE = 26
 };
 
 /**
@@ -36,4 +36,9 @@
 #include "cfe_fs_priv.h"
 #include "cfe_fs_core_internal.h"
 
+/*
+ * Additionally the lock functions use the ES lock profiler hooks
+ */
+#include "cfe_es_core_internal.h"
+
 #endif /* CFE_FS_MODULE_ALL_H */
@@ -70,8 +70,11 @@ int32 CFE_FS_EarlyInit(void)
  *-----------------------------------------------------------------*/
 void CFE_FS_LockSharedData(const char *FunctionName)
 {
-    int32          OsStatus;
-    CFE_ES_AppId_t AppId;
+    int32                     OsStatus;
+    CFE_ES_AppId_t            AppId;
+    CFE_ES_LockProfileStamp_t Stamp;
+
+    CFE_ES_LOCKPROF_BEGIN(&Stamp);
 
     OsStatus = OS_MutSemTake(CFE_FS_Global.SharedDataMutexId);
     if (OsStatus != OS_SUCCESS)
@@ -80,6 +83,11 @@ void CFE_FS_LockSharedData(const char *FunctionName)
         CFE_ES_WriteToSysLog("%s: SharedData Mutex Take Err Stat=%ld,App=%lu,Function=%s\n", __func__, (long)OsStatus,
                              CFE_RESOURCEID_TO_ULONG(AppId), FunctionName);
     }
+    else
+    {
+        /* callers only pass the function name */
+        CFE_ES_LOCKPROF_ACQUIRED(CFE_ES_LockProfileId_FS_SHARED_DATA, FunctionName, 0, &Stamp);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -93,6 +101,8 @@ void CFE_FS_UnlockSharedData(const char *FunctionName)
     int32          OsStatus;
     CFE_ES_AppId_t AppId;
 
+    CFE_ES_LOCKPROF_RELEASED(CFE_ES_LockProfileId_FS_SHARED_DATA);
+
     OsStatus = OS_MutSemGive(CFE_FS_Global.SharedDataMutexId);
     if (OsStatus != OS_SUCCESS)
     {
@@ -459,4 +459,77 @@
 */
 #define CFE_SB_SEND_PREV_SUBS_CC 11
 
+/** \cfesbcmd Send Application Buffer Usage
+**
+**  \par Description
+**       This command will cause the SB task to send a packet containing the
+**       amount of SB buffer memory currently attributed to each application,
+**       along with its high water mark and quota.  Memory is attributed to an
+**       application for each zero copy buffer it holds and for each message
+**       reference queued on a pipe that it owns.
+**
+**  \cfecmdmnemonic \SB_DUMPAPPUSAGE
+**
+**  \par Command Structure
+**       #CFE_SB_SendAppUsageCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with the
+**       following telemetry:
+**       - \b \c \SB_CMDPC - command execution counter will increment
+**       - Receipt of application usage packet with MsgId #CFE_SB_APP_USAGE_TLM_MID
+**       - The #CFE_SB_SND_APP_USAGE_EID debug event message will be generated
+**
+**  \par Error Conditions
+**       There are no error conditions for this command. If the Software
+**       Bus receives the command, the debug event is sent and the counter
+**       is incremented unconditionally.
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create and send
+**       a message on the software bus. If performed repeatedly, it is
+**       possible that receiver pipes may overflow.
+**
+**  \sa #CFE_SB_SET_APP_QUOTA_CC, #CFE_SB_AppUsageTlm_t
+*/
+#define CFE_SB_SEND_APP_USAGE_CC 12
+
+/** \cfesbcmd Set Application Buffer Quota
+**
+**  \par Description
+**       This command sets the maximum number of SB buffer memory bytes which
+**       may be attributed to the specified application.  A quota of zero
+**       disables enforcement for that application.  The quota applies until
+**       the application is deleted; a newly started application always begins
+**       with the #CFE_PLATFORM_SB_DEFAULT_APP_BUF_QUOTA quota.
+**
+**  \cfecmdmnemonic \SB_SETAPPQUOTA
+**
+**  \par Command Structure
+**       #CFE_SB_SetAppQuotaCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with the
+**       following telemetry:
+**       - \b \c \SB_CMDPC - command execution counter will increment
+**       - The #CFE_SB_SET_APP_QUOTA_EID informational event message will be generated
+**       - The new quota will be reported in the #CFE_SB_APP_USAGE_TLM_MID packet
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The specified application name is not a registered application
+**       - The specified quota is larger than #CFE_PLATFORM_SB_BUF_MEMORY_BYTES
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \SB_CMDEC - command error counter will increment
+**       - The #CFE_SB_SET_APP_QUOTA_ERR_EID error event message will be generated
+**
+**  \par Criticality
+**       Setting a quota that is too small for the nominal traffic of an application
+**       will cause messages destined for that application to be discarded.
+**
+**  \sa #CFE_SB_SEND_APP_USAGE_CC
+*/
+#define CFE_SB_SET_APP_QUOTA_CC 13
+
 #endif
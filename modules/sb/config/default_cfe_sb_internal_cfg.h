@@ -69,6 +69,37 @@
 */
 #define CFE_PLATFORM_SB_MAX_PIPES 64
 
+/**
+**  \cfesbcfg Initial Number of Message IDs and Pipes in the SB Tables
+**
+**  \par Description:
+**       Dictates how many routing table and pipe table entries are statically
+**       allocated.  These are build time settings, not startup parameters.  When
+**       either table fills up, SB extends it at run time by another block of the
+**       same number of entries, allocated from the SB buffer memory pool, until
+**       the corresponding maximum (#CFE_PLATFORM_SB_MAX_MSG_IDS or
+**       #CFE_PLATFORM_SB_MAX_PIPES) is reached.  The pool memory taken by the
+**       extensions is reported in the TableMemInUse housekeeping telemetry point.
+**       Extensions are never released or moved, so references to existing entries
+**       remain valid while the table grows.  Setting these equal to the maximums
+**       allocates the full tables statically and disables run-time growth.
+**
+**       These defaults may also be overridden from the build, which the unit
+**       tests use to exercise run-time growth.
+**
+**  \par Limits
+**       These parameters have a lower limit of 1 and must not exceed the
+**       corresponding maximum.  Each extension block must also fit within
+**       #CFE_PLATFORM_SB_MAX_BLOCK_SIZE.
+**
+*/
+#ifndef CFE_PLATFORM_SB_INITIAL_MSG_IDS
+#define CFE_PLATFORM_SB_INITIAL_MSG_IDS CFE_PLATFORM_SB_MAX_MSG_IDS
+#endif
+#ifndef CFE_PLATFORM_SB_INITIAL_PIPES
+#define CFE_PLATFORM_SB_INITIAL_PIPES CFE_PLATFORM_SB_MAX_PIPES
+#endif
+
 /**
 **  \cfesbcfg Maximum Number of unique local destinations a single MsgId can have
 **
@@ -122,6 +153,97 @@
 */
 #define CFE_PLATFORM_SB_BUF_MEMORY_BYTES 524288
 
+/**
+**  \cfesbcfg Default Per-Application SB Buffer Memory Quota
+**
+**  \par Description:
+**       Dictates the default number of SB buffer memory bytes that may be
+**       attributed to any single application at one time.  Bytes are charged
+**       to an application for every zero copy buffer it holds, and for every
+**       message reference queued on a pipe that it owns.  Once an application
+**       reaches its quota, further zero copy allocations by that application
+**       are rejected, as are deliveries to any of its pipes, so that a single
+**       application which does not release buffers or drain its pipes cannot
+**       exhaust the memory shared by all other applications.
+**
+**       The quota for an individual application may be changed at runtime with
+**       the #CFE_SB_SET_APP_QUOTA_CC command.  Current usage may be obtained
+**       with the #CFE_SB_SEND_APP_USAGE_CC command.
+**
+**       The default of 0 leaves quota enforcement disabled for applications
+**       that have not been given a quota by command.  A mission may opt in for
+**       all applications by setting a nonzero value, e.g. half of
+**       #CFE_PLATFORM_SB_BUF_MEMORY_BYTES.
+**
+**  \par Limits
+**       A value of 0 disables quota enforcement by default.  This parameter cannot
+**       be greater than #CFE_PLATFORM_SB_BUF_MEMORY_BYTES.
+*/
+#define CFE_PLATFORM_SB_DEFAULT_APP_BUF_QUOTA 0
+
+/**
+**  \cfesbcfg Maximum Number of Continuation Segments in a Chained Message
+**
+**  \par Description:
+**       Dictates the maximum number of continuation segments that may be linked
+**       to a message buffer obtained with CFE_SB_AllocateChainedMessageBuffer().
+**       Each segment holds up to #CFE_MISSION_SB_MAX_SB_MSG_SIZE bytes of content
+**       beyond that held by the head buffer, so the largest chained message is
+**       #CFE_MISSION_SB_MAX_SB_MSG_SIZE * (1 + this value) bytes.
+**
+**       A chained message is routed once and delivered as a single reference,
+**       so large products (e.g. image frames) do not need to be split into
+**       many individually routed packets.
+**
+**  \par Limits
+**       This parameter may be 0, which disables chaining.  The whole chain is
+**       allocated from the SB buffer pool, so the resulting maximum message size
+**       cannot be greater than #CFE_PLATFORM_SB_BUF_MEMORY_BYTES, and should also
+**       fit within #CFE_PLATFORM_SB_DEFAULT_APP_BUF_QUOTA when that is nonzero.
+*/
+#define CFE_PLATFORM_SB_MAX_MSG_SEGMENTS 6
+
+/**
+**  \cfesbcfg Maximum Number of Buffers Held from a Single Pipe
+**
+**  \par Description:
+**       Dictates the maximum number of received buffers that an application
+**       may hold at once from a pipe that has the #CFE_SB_PIPEOPTS_HOLDBUFFERS
+**       option set.  Once this limit is met, CFE_SB_ReceiveBuffer() returns
+**       #CFE_SB_HOLD_LIMIT_MET until a buffer is released with
+**       CFE_SB_ReleaseReceivedBuffer().
+**
+**       This constant has a direct effect on the size of the pipe table.
+**       Held buffers also count against the owning application's buffer quota.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 65535.
+*/
+#define CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS 4
+
+/**
+**  \cfesbcfg Maximum Number of Aggregated Transmit Errors
+**
+**  \par Description:
+**       Dictates the number of distinct (pipe, message ID, event ID) transmit
+**       errors that can be aggregated between housekeeping requests.
+**
+**       Only the first occurrence of a pipe overflow, message limit, quota or
+**       pipe write error for a given pipe and message ID is reported with its
+**       own event in each housekeeping period.  Further occurrences are counted
+**       and reported with a single #CFE_SB_SND_ERR_SUMMARY_EID event on the
+**       next housekeeping request, so an overloaded bus does not also have to
+**       carry one event message per failed delivery.
+**
+**       Errors which do not fit in the table are not reported individually,
+**       only their total is included in the summary.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1.  Each entry is searched on every
+**       transmit error, so this should be kept small.
+*/
+#define CFE_PLATFORM_SB_MAX_ERR_AGGREGATES 16
+
 /**
 **  \cfesbcfg Highest Valid Message Id
 **
@@ -219,8 +341,8 @@
 #define CFE_PLATFORM_SB_FILTERED_EVENT4 CFE_SB_Q_FULL_ERR_EID
 #define CFE_PLATFORM_SB_FILTER_MASK4    CFE_EVS_FIRST_16_STOP
 
-#define CFE_PLATFORM_SB_FILTERED_EVENT5 0
-#define CFE_PLATFORM_SB_FILTER_MASK5    CFE_EVS_NO_FILTER
+#define CFE_PLATFORM_SB_FILTERED_EVENT5 CFE_SB_APP_QUOTA_ERR_EID
+#define CFE_PLATFORM_SB_FILTER_MASK5    CFE_EVS_FIRST_16_STOP
 
 #define CFE_PLATFORM_SB_FILTERED_EVENT6 0
 #define CFE_PLATFORM_SB_FILTER_MASK6    CFE_EVS_NO_FILTER
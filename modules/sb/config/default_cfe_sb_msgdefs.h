@@ -57,6 +57,18 @@ typedef struct CFE_SB_RouteCmd_Payload
     uint8           Spare; /**<\brief Spare byte to make command even number of bytes */
 } CFE_SB_RouteCmd_Payload_t;
 
+/**
+**  \brief Set Application Quota Command Payload
+**
+**  This structure contains the definition used by the 'Set Application Buffer Quota'
+**  command #CFE_SB_SET_APP_QUOTA_CC.
+*/
+typedef struct CFE_SB_SetAppQuotaCmd_Payload
+{
+    char   Application[CFE_MISSION_MAX_API_LEN]; /**< \brief Name of the application to set the quota for */
+    uint32 QuotaBytes;                           /**< \brief New buffer memory quota, in bytes (0 = unlimited) */
+} CFE_SB_SetAppQuotaCmd_Payload_t;
+
 /****************************
 **  SB Telemetry Formats   **
 *****************************/
@@ -105,6 +117,10 @@ typedef struct CFE_SB_HousekeepingTlm_Payload
 
     uint32 UnmarkedMem; /**< \cfetlmmnemonic \SB_UNMARKEDMEM
                              \brief cfg param CFE_PLATFORM_SB_BUF_MEMORY_BYTES minus Peak Memory in use */
+
+    uint32 TableMemInUse; /**< \cfetlmmnemonic \SB_TBLMEMINUSE
+                               \brief Memory taken from the SB pool to extend the pipe and routing tables,
+                               included in MemInUse */
 } CFE_SB_HousekeepingTlm_Payload_t;
 
 /**
@@ -153,6 +169,9 @@ typedef struct CFE_SB_PipeInfoEntry
     uint16          SendErrors;                        /**< Number of errors when writing to this pipe */
     uint8           Opts;                              /**< Pipe options set (bitmask) */
     uint8           Spare[3];                          /**< Padding to make this structure a multiple of 4 bytes */
+    uint32          QueuedBytes;                       /**< Buffer memory referenced by messages queued on this pipe */
+    uint32          AppBytesInUse;                     /**< Total buffer memory attributed to the owning application */
+    uint32          AppQuotaBytes;                     /**< Buffer memory quota of the owning application (0 = none) */
 } CFE_SB_PipeInfoEntry_t;
 
 /**
@@ -203,6 +222,43 @@ typedef struct CFE_SB_StatsTlm_Payload
                                                \brief Pipe Depth Statistics #CFE_SB_PipeDepthStats_t*/
 } CFE_SB_StatsTlm_Payload_t;
 
+/**
+** \brief SB Application Buffer Usage
+**
+** Used in SB Application Usage Telemetry Packet #CFE_SB_AppUsageTlm_t
+*/
+typedef struct CFE_SB_AppBufUsage
+{
+    CFE_ES_AppId_t AppId;   /**< \cfetlmmnemonic \SB_AUAPPID
+                                 \brief Application Id associated with the usage below */
+    uint32 ZeroCopyBytes;   /**< \cfetlmmnemonic \SB_AUZCBYTES
+                                 \brief Bytes held by the application as zero copy buffers */
+    uint32 QueuedBytes;     /**< \cfetlmmnemonic \SB_AUQBYTES
+                                 \brief Bytes referenced by messages queued on pipes owned by the application */
+    uint32 PeakBytesInUse;  /**< \cfetlmmnemonic \SB_AUPKBYTES
+                                 \brief Peak number of bytes attributed to the application */
+    uint32 QuotaBytes;      /**< \cfetlmmnemonic \SB_AUQUOTA
+                                 \brief Maximum bytes that may be attributed to the application (0 = unlimited) */
+    uint16 QuotaErrorCount; /**< \cfetlmmnemonic \SB_AUQUOTAEC
+                                 \brief Number of allocations or deliveries rejected due to the quota */
+    uint16 Spare;           /**< \cfetlmmnemonic \SB_AUSPARE
+                                 \brief Spare word to ensure alignment */
+} CFE_SB_AppBufUsage_t;
+
+/**
+** \cfesbtlm SB Application Usage Telemetry Packet
+**
+** SB Application Usage packet sent in response to #CFE_SB_SEND_APP_USAGE_CC
+*/
+typedef struct CFE_SB_AppUsageTlm_Payload
+{
+    uint32 DefaultQuotaBytes; /**< \cfetlmmnemonic \SB_AUDEFQUOTA
+                                   \brief cFE Cfg Param \link #CFE_PLATFORM_SB_DEFAULT_APP_BUF_QUOTA \endlink */
+    CFE_SB_AppBufUsage_t
+        AppUsage[CFE_MISSION_ES_MAX_APPLICATIONS]; /**< \cfetlmmnemonic \SB_AUAPPS
+                                                        \brief Per-application usage #CFE_SB_AppBufUsage_t */
+} CFE_SB_AppUsageTlm_Payload_t;
+
 /**
 ** \brief SB Routing File Entry
 **
@@ -36,9 +36,10 @@
 /*
 ** CFE Telemetry Message Id's
 */
-#define CFE_SB_HK_TLM_MID      CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SB_HK_TLM_TOPICID)      /* 0x0803 */
-#define CFE_SB_STATS_TLM_MID   CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SB_STATS_TLM_TOPICID)   /* 0x080A */
-#define CFE_SB_ALLSUBS_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SB_ALLSUBS_TLM_TOPICID) /* 0x080D */
-#define CFE_SB_ONESUB_TLM_MID  CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SB_ONESUB_TLM_TOPICID)  /* 0x080E */
+#define CFE_SB_HK_TLM_MID        CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SB_HK_TLM_TOPICID)        /* 0x0803 */
+#define CFE_SB_STATS_TLM_MID     CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SB_STATS_TLM_TOPICID)     /* 0x080A */
+#define CFE_SB_ALLSUBS_TLM_MID   CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SB_ALLSUBS_TLM_TOPICID)   /* 0x080D */
+#define CFE_SB_ONESUB_TLM_MID    CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SB_ONESUB_TLM_TOPICID)    /* 0x080E */
+#define CFE_SB_APP_USAGE_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SB_APP_USAGE_TLM_TOPICID) /* 0x080F */
 
 #endif
@@ -84,6 +84,11 @@ typedef struct CFE_SB_SendHkCmd
     CFE_MSG_CommandHeader_t CommandHeader;
 } CFE_SB_SendHkCmd_t;
 
+typedef struct CFE_SB_SendAppUsageCmd
+{
+    CFE_MSG_CommandHeader_t CommandHeader;
+} CFE_SB_SendAppUsageCmd_t;
+
 /*
  * Create a unique typedef for each of the commands that share this format.
  */
@@ -120,6 +125,12 @@ typedef struct CFE_SB_DisableRouteCmd
     CFE_SB_RouteCmd_Payload_t Payload;       /**< \brief Command payload */
 } CFE_SB_DisableRouteCmd_t;
 
+typedef struct CFE_SB_SetAppQuotaCmd
+{
+    CFE_MSG_CommandHeader_t         CommandHeader; /**< \brief Command header */
+    CFE_SB_SetAppQuotaCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_SB_SetAppQuotaCmd_t;
+
 /****************************
 **  SB Telemetry Formats   **
 *****************************/
@@ -136,6 +147,12 @@ typedef struct CFE_SB_StatsTlm
     CFE_SB_StatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
 } CFE_SB_StatsTlm_t;
 
+typedef struct CFE_SB_AppUsageTlm
+{
+    CFE_MSG_TelemetryHeader_t    TelemetryHeader; /**< \brief Telemetry header */
+    CFE_SB_AppUsageTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_SB_AppUsageTlm_t;
+
 typedef struct CFE_SB_SingleSubscriptionTlm
 {
     CFE_MSG_TelemetryHeader_t              TelemetryHeader; /**< \brief Telemetry header */
@@ -45,9 +45,10 @@
 **  \par Limits
 **      Not Applicable
 */
-#define CFE_MISSION_SB_HK_TLM_TOPICID      3
-#define CFE_MISSION_SB_STATS_TLM_TOPICID   10
-#define CFE_MISSION_SB_ALLSUBS_TLM_TOPICID 13
-#define CFE_MISSION_SB_ONESUB_TLM_TOPICID  14
+#define CFE_MISSION_SB_HK_TLM_TOPICID        3
+#define CFE_MISSION_SB_STATS_TLM_TOPICID     10
+#define CFE_MISSION_SB_ALLSUBS_TLM_TOPICID   13
+#define CFE_MISSION_SB_ONESUB_TLM_TOPICID    14
+#define CFE_MISSION_SB_APP_USAGE_TLM_TOPICID 15
 
 #endif
@@ -784,6 +784,68 @@
  */
 #define CFE_SB_RCV_MESSAGE_INTEGRITY_FAIL_EID 72
 
+/**
+ * \brief SB Application Buffer Quota Exceeded Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  A message could not be delivered to a pipe, or a message buffer could not
+ *  be allocated, because the buffer memory attributed to the owning application
+ *  would exceed its quota.  See #CFE_SB_SET_APP_QUOTA_CC.
+ */
+#define CFE_SB_APP_QUOTA_ERR_EID 73
+
+/**
+ * \brief SB Send Application Usage Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_SB_SEND_APP_USAGE_CC SB Send Application Usage Command \endlink success.
+ */
+#define CFE_SB_SND_APP_USAGE_EID 74
+
+/**
+ * \brief SB Set Application Quota Command Success Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_SB_SET_APP_QUOTA_CC SB Set Application Quota Command \endlink success.
+ */
+#define CFE_SB_SET_APP_QUOTA_EID 75
+
+/**
+ * \brief SB Set Application Quota Command Failure Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_SB_SET_APP_QUOTA_CC SB Set Application Quota Command \endlink failure
+ *  due to an unknown application name or a quota larger than the buffer pool.
+ */
+#define CFE_SB_SET_APP_QUOTA_ERR_EID 76
+
+/**
+ * \brief SB Transmit Error Summary Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Repeated transmit errors for the same pipe, message ID and event ID were
+ *  suppressed since the previous housekeeping request.  The first occurrence in
+ *  each housekeeping period is reported with its own event, this event reports
+ *  the number of further occurrences.  Also sent if errors could not be
+ *  aggregated because #CFE_PLATFORM_SB_MAX_ERR_AGGREGATES entries were in use.
+ */
+#define CFE_SB_SND_ERR_SUMMARY_EID 77
+
 /**\}*/
 
 #endif /* CFE_SB_EVENTS_H */
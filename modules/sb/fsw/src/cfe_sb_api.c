@@ -139,6 +139,14 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
             CFE_ResourceId_FindNext(CFE_SB_Global.LastPipeId, CFE_PLATFORM_SB_MAX_PIPES, CFE_SB_CheckPipeDescSlotUsed);
         PipeDscPtr = CFE_SB_LocatePipeDescByID(CFE_SB_PIPEID_C(PendingPipeId));
 
+        /* if the allocated part of the pipe table is full, extend it and try again */
+        if (PipeDscPtr == NULL && CFE_SB_GrowPipeTbl() == CFE_SUCCESS)
+        {
+            PendingPipeId =
+                CFE_ResourceId_FindNext(CFE_SB_Global.LastPipeId, CFE_PLATFORM_SB_MAX_PIPES, CFE_SB_CheckPipeDescSlotUsed);
+            PipeDscPtr = CFE_SB_LocatePipeDescByID(CFE_SB_PIPEID_C(PendingPipeId));
+        }
+
         /* if pipe table is full, send event and return error */
         if (PipeDscPtr == NULL)
         {
@@ -341,6 +349,7 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     size_t                      BufDscSize;
     CFE_SB_RemovePipeCallback_t Args;
     uint16                      PendingEventID;
+    bool                        IsQueued;
 
     Status         = CFE_SUCCESS;
     PendingEventID = 0;
@@ -381,6 +390,9 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
         SysQueueId = PipeDscPtr->SysQueueId;
         BufDscPtr  = PipeDscPtr->LastBuffer;
 
+        /* Release anything the app was still holding from this pipe */
+        CFE_SB_ReleaseHeldBuffer(PipeDscPtr, NULL);
+
         /*
          * Mark entry as "reserved" so other resources can be deleted
          * while the SB global is unlocked.  This prevents other tasks
@@ -395,17 +407,26 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     /* remove any messages that might be on the pipe */
     if (Status == CFE_SUCCESS)
     {
+        /* The last received buffer was already released from the app quota when it was exported */
+        IsQueued = false;
+
         while (true)
         {
             /* decrement refcount of any previous buffer */
             if (BufDscPtr != NULL)
             {
                 CFE_SB_LockSharedData(__func__, __LINE__);
+                if (IsQueued)
+                {
+                    CFE_SB_ReleaseAppUsage(AppId, BufDscPtr->AllocatedSize, false);
+                }
                 CFE_SB_DecrBufUseCnt(BufDscPtr);
                 CFE_SB_UnlockSharedData(__func__, __LINE__);
                 BufDscPtr = NULL;
             }
 
+            IsQueued = true;
+
             if (OS_QueueGet(SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, OS_CHECK) != OS_SUCCESS)
             {
                 /* no more messages */
@@ -805,17 +826,17 @@ CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *Pipe
 
     if (Status == CFE_SUCCESS)
     {
-        Idx        = CFE_PLATFORM_SB_MAX_PIPES;
-        PipeDscPtr = CFE_SB_Global.PipeTbl;
+        Idx = 0;
         while (true)
         {
-            if (Idx == 0)
+            if (Idx >= CFE_SB_Global.PipeTblCapacity)
             {
                 PendingEventID = CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID;
                 Status         = CFE_SB_BAD_ARGUMENT;
                 break;
             }
 
+            PipeDscPtr = CFE_SB_PipeDescByIndex(Idx);
             if (OS_ObjectIdEqual(PipeDscPtr->SysQueueId, SysQueueId))
             {
                 /* grab the ID before we release the lock */
@@ -823,8 +844,7 @@ CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *Pipe
                 break;
             }
 
-            --Idx;
-            ++PipeDscPtr;
+            ++Idx;
         }
     }
 
@@ -927,6 +947,8 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
     char                   PipeName[OS_MAX_API_NAME];
     uint32                 Collisions;
     uint16                 PendingEventID;
+    size_t                 ExtSize;
+    void *                 ExtPtr;
 
     PendingEventID = 0;
     Status         = CFE_SUCCESS;
@@ -967,6 +989,17 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
 
         if (!CFE_SBR_IsValidRouteId(RouteId))
         {
+            /* If the allocated part of the routing table is full, extend it first */
+            ExtSize = CFE_SBR_GetExtensionSize();
+            if (ExtSize != 0)
+            {
+                ExtPtr = CFE_SB_GetTableExtensionBlk(ExtSize);
+                if (ExtPtr != NULL)
+                {
+                    CFE_SBR_Extend(ExtPtr);
+                }
+            }
+
             /* Add the route */
             RouteId = CFE_SBR_AddRoute(MsgId, &Collisions);
 
@@ -1340,6 +1373,9 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
 {
     CFE_SB_ReceiveTxn_State_t  TxnBuf;
     CFE_SB_MessageTxn_State_t *Txn;
+    CFE_Status_t               Status;
+
+    CFE_CORE_PERF_ENTRY(CFE_MISSION_SB_RECEIVE_PERF_ID);
 
     Txn = CFE_SB_ReceiveTxn_Init(&TxnBuf, BufPtr);
 
@@ -1372,7 +1408,11 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
 
     CFE_SB_MessageTxn_ReportEvents(Txn);
 
-    return CFE_SB_MessageTxn_GetStatus(Txn);
+    Status = CFE_SB_MessageTxn_GetStatus(Txn);
+
+    CFE_CORE_PERF_EXIT(CFE_MISSION_SB_RECEIVE_PERF_ID);
+
+    return Status;
 }
 
 /*----------------------------------------------------------------
@@ -1388,10 +1428,12 @@ CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
     CFE_SB_BufferD_t *BufDscPtr;
     CFE_SB_Buffer_t * BufPtr;
     CFE_Status_t      Status;
+    bool              QuotaExceeded;
 
-    AppId     = CFE_ES_APPID_UNDEFINED;
-    BufDscPtr = NULL;
-    BufPtr    = NULL;
+    AppId         = CFE_ES_APPID_UNDEFINED;
+    BufDscPtr     = NULL;
+    BufPtr        = NULL;
+    QuotaExceeded = false;
 
     Status = CFE_ES_GetAppID(&AppId);
 
@@ -1415,6 +1457,14 @@ CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
          */
         BufDscPtr = CFE_SB_GetBufferFromPool(MsgSize);
 
+        /* Charge the buffer to this app, and give it right back if over quota */
+        if (BufDscPtr != NULL && !CFE_SB_ChargeAppUsage(AppId, BufDscPtr->AllocatedSize, true))
+        {
+            CFE_SB_ReturnBufferToPool(BufDscPtr);
+            BufDscPtr     = NULL;
+            QuotaExceeded = true;
+        }
+
         if (BufDscPtr != NULL)
         {
             /* Track the buffer as a zero-copy assigned to this app ID */
@@ -1426,6 +1476,13 @@ CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
         CFE_SB_UnlockSharedData(__func__, __LINE__);
     }
 
+    if (QuotaExceeded)
+    {
+        CFE_ES_GetAppName(AppName, AppId, sizeof(AppName));
+        CFE_ES_WriteToSysLog("%s %s: Failed, requested size %zu exceeds app buffer quota\n", AppName, __func__,
+                             MsgSize);
+    }
+
     if (BufPtr != NULL)
     {
         /*
@@ -1439,6 +1496,140 @@ CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
     return BufPtr;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_Buffer_t *CFE_SB_AllocateChainedMessageBuffer(size_t MsgSize)
+{
+    CFE_ES_AppId_t      AppId;
+    char                AppName[OS_MAX_API_NAME] = {""};
+    CFE_SB_BufferD_t *  BufDscPtr;
+    CFE_SB_BufferSeg_t *SegPtr;
+    CFE_SB_Buffer_t *   BufPtr;
+    CFE_Status_t        Status;
+    bool                QuotaExceeded;
+
+    /* A message which fits in a single buffer does not need to be chained */
+    if (MsgSize <= CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+    {
+        return CFE_SB_AllocateMessageBuffer(MsgSize);
+    }
+
+    AppId         = CFE_ES_APPID_UNDEFINED;
+    BufDscPtr     = NULL;
+    BufPtr        = NULL;
+    QuotaExceeded = false;
+
+    Status = CFE_ES_GetAppID(&AppId);
+
+    if (MsgSize > CFE_SB_MAX_CHAINED_MSG_SIZE)
+    {
+        CFE_ES_GetAppName(AppName, AppId, sizeof(AppName));
+        CFE_ES_WriteToSysLog("%s %s: Failed, requested size %zu larger than allowed %lu\n", AppName, __func__,
+                             MsgSize, (unsigned long)CFE_SB_MAX_CHAINED_MSG_SIZE);
+        return NULL;
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        /* The head holds the message header and as much content as a normal buffer */
+        BufDscPtr = CFE_SB_GetBufferFromPool(CFE_MISSION_SB_MAX_SB_MSG_SIZE);
+
+        if (BufDscPtr != NULL &&
+            CFE_SB_AddBufferSegments(BufDscPtr, MsgSize - CFE_MISSION_SB_MAX_SB_MSG_SIZE) != CFE_SUCCESS)
+        {
+            CFE_SB_ReturnBufferToPool(BufDscPtr);
+            BufDscPtr = NULL;
+        }
+
+        /* The whole chain is charged to this app as one buffer */
+        if (BufDscPtr != NULL && !CFE_SB_ChargeAppUsage(AppId, BufDscPtr->AllocatedSize, true))
+        {
+            CFE_SB_ReturnBufferToPool(BufDscPtr);
+            BufDscPtr     = NULL;
+            QuotaExceeded = true;
+        }
+
+        if (BufDscPtr != NULL)
+        {
+            /* Track the buffer as a zero-copy assigned to this app ID */
+            BufDscPtr->AppId = AppId;
+            BufPtr           = &BufDscPtr->Content;
+            CFE_SB_TrackingListAdd(&CFE_SB_Global.ZeroCopyList, &BufDscPtr->Link);
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    if (QuotaExceeded)
+    {
+        CFE_ES_GetAppName(AppName, AppId, sizeof(AppName));
+        CFE_ES_WriteToSysLog("%s %s: Failed, requested size %zu exceeds app buffer quota\n", AppName, __func__,
+                             MsgSize);
+    }
+
+    if (BufPtr != NULL)
+    {
+        /* Wipe the head and all segments, as with a single buffer */
+        memset(BufPtr, 0, CFE_MISSION_SB_MAX_SB_MSG_SIZE);
+        for (SegPtr = BufDscPtr->Segments; SegPtr != NULL; SegPtr = SegPtr->Next)
+        {
+            memset(&SegPtr->Content, 0, SegPtr->ContentSize);
+        }
+    }
+
+    return BufPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_GetMessageSegment(CFE_SB_Buffer_t *BufPtr, uint32 SegmentNum, void **SegmentPtr,
+                                      size_t *SegmentSize)
+{
+    CFE_SB_BufferD_t *  BufDscPtr;
+    CFE_SB_BufferSeg_t *SegPtr;
+
+    if (BufPtr == NULL || SegmentPtr == NULL || SegmentSize == NULL)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    /*
+     * The caller holds a reference to the buffer (either zero copy or received)
+     * and the segment list does not change while any reference exists, so this
+     * does not need to be locked.
+     */
+    BufDscPtr = (CFE_SB_BufferD_t *)((cpuaddr)BufPtr - offsetof(CFE_SB_BufferD_t, Content));
+
+    SegPtr = BufDscPtr->Segments;
+    while (SegPtr != NULL && SegmentNum > 0)
+    {
+        SegPtr = SegPtr->Next;
+        --SegmentNum;
+    }
+
+    if (SegPtr == NULL)
+    {
+        *SegmentPtr  = NULL;
+        *SegmentSize = 0;
+        return CFE_SB_NO_MESSAGE;
+    }
+
+    *SegmentPtr  = &SegPtr->Content;
+    *SegmentSize = SegPtr->ContentSize;
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -1464,6 +1655,7 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr)
     if (Status == CFE_SUCCESS)
     {
         /* Clear the ownership app ID and decrement use count (may also free) */
+        CFE_SB_ReleaseAppUsage(BufDscPtr->AppId, BufDscPtr->AllocatedSize, true);
         BufDscPtr->AppId = CFE_ES_APPID_UNDEFINED;
         CFE_SB_DecrBufUseCnt(BufDscPtr);
     }
@@ -1473,6 +1665,60 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_ReleaseReceivedBuffer(CFE_SB_Buffer_t *BufPtr)
+{
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    CFE_SB_BufferD_t *BufDscPtr;
+    CFE_ES_AppId_t    AppId;
+    CFE_Status_t      Status;
+    uint32            i;
+
+    /*
+     * Sanity Check that the pointers are not NULL
+     */
+    if (BufPtr == NULL)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    /*
+     * Calculate descriptor pointer from buffer pointer.  This is only compared
+     * against the held sets and is not dereferenced unless a match is found.
+     */
+    BufDscPtr = (CFE_SB_BufferD_t *)((cpuaddr)BufPtr - offsetof(CFE_SB_BufferD_t, Content));
+    Status    = CFE_SB_BUFFER_INVALID;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* The buffer must be held from one of the caller's own pipes */
+    for (i = 0; i < CFE_SB_Global.PipeTblCapacity; ++i)
+    {
+        PipeDscPtr = CFE_SB_PipeDescByIndex(i);
+        if (CFE_SB_PipeDescIsUsed(PipeDscPtr) && PipeDscPtr->HeldCount > 0 &&
+            CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId) && CFE_SB_ReleaseHeldBuffer(PipeDscPtr, BufDscPtr))
+        {
+            Status = CFE_SUCCESS;
+            break;
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -1517,6 +1763,9 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
     CFE_SB_TransmitTxn_State_t TxnBuf;
     CFE_SB_MessageTxn_State_t *Txn;
     CFE_SB_Buffer_t *          BufPtr;
+    CFE_Status_t               Status;
+
+    CFE_CORE_PERF_ENTRY(CFE_MISSION_SB_TRANSMIT_PERF_ID);
 
     BufPtr = NULL;
     Txn    = CFE_SB_TransmitTxn_Init(&TxnBuf, MsgPtr);
@@ -1570,5 +1819,9 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
     /* send an event for each pipe write error that may have occurred */
     CFE_SB_MessageTxn_ReportEvents(Txn);
 
-    return CFE_SB_MessageTxn_GetStatus(Txn);
+    Status = CFE_SB_MessageTxn_GetStatus(Txn);
+
+    CFE_CORE_PERF_EXIT(CFE_MISSION_SB_TRANSMIT_PERF_ID);
+
+    return Status;
 }
@@ -40,6 +40,11 @@
  */
 #define CFE_SB_BUFFERD_CONTENT_OFFSET (offsetof(CFE_SB_BufferD_t, Content))
 
+/*
+ * Likewise for the content of a continuation segment
+ */
+#define CFE_SB_BUFFERSEG_CONTENT_OFFSET (offsetof(CFE_SB_BufferSeg_t, Content))
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -136,6 +141,72 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
     return bd;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_AddBufferSegments(CFE_SB_BufferD_t *bd, size_t ExtraSize)
+{
+    int32                stat1;
+    size_t               SegContentSize;
+    size_t               AllocSize;
+    CFE_ES_MemPoolBuf_t  addr;
+    CFE_SB_BufferSeg_t * seg;
+    CFE_SB_BufferSeg_t **NextPtr;
+
+    NextPtr = &bd->Segments;
+
+    while (ExtraSize > 0)
+    {
+        SegContentSize = ExtraSize;
+        if (SegContentSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+        {
+            SegContentSize = CFE_MISSION_SB_MAX_SB_MSG_SIZE;
+        }
+
+        AllocSize = SegContentSize + CFE_SB_BUFFERSEG_CONTENT_OFFSET;
+
+        addr  = NULL;
+        stat1 = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, AllocSize);
+        if (stat1 < 0)
+        {
+            return CFE_SB_BUF_ALOC_ERR;
+        }
+
+        seg = (CFE_SB_BufferSeg_t *)addr;
+        memset(seg, 0, CFE_SB_BUFFERSEG_CONTENT_OFFSET);
+
+        seg->AllocatedSize = AllocSize;
+        seg->ContentSize   = SegContentSize;
+
+        /* Segments are accounted as part of the head descriptor from here on */
+        *NextPtr = seg;
+        NextPtr  = &seg->Next;
+
+        bd->AllocatedSize += AllocSize;
+        bd->SegmentSize += AllocSize;
+
+        CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse++;
+        CFE_SB_Global.StatTlmMsg.Payload.MemInUse += AllocSize;
+
+        ExtraSize -= SegContentSize;
+    }
+
+    if (CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse)
+    {
+        CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
+    }
+
+    if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
+    {
+        CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
+    }
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -144,9 +215,21 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
  *-----------------------------------------------------------------*/
 void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd)
 {
+    CFE_SB_BufferSeg_t *seg;
+
     /* Remove from any tracking list (no effect if not in a list) */
     CFE_SB_TrackingListRemove(&bd->Link);
 
+    /* Give back any continuation segments first, their size is included in the head */
+    while (bd->Segments != NULL)
+    {
+        seg          = bd->Segments;
+        bd->Segments = seg->Next;
+
+        --CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
+        CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, seg);
+    }
+
     --CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
     CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= bd->AllocatedSize;
 
@@ -189,6 +272,118 @@ void CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd)
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_AppUsageD_t *CFE_SB_LocateAppUsageByID(CFE_ES_AppId_t AppId)
+{
+    uint32              AppIndex;
+    CFE_SB_AppUsageD_t *UsagePtr;
+
+    if (CFE_ES_AppID_ToIndex(AppId, &AppIndex) == CFE_SUCCESS && AppIndex < CFE_PLATFORM_ES_MAX_APPLICATIONS)
+    {
+        UsagePtr = &CFE_SB_Global.AppUsage[AppIndex];
+    }
+    else
+    {
+        UsagePtr = NULL;
+    }
+
+    return UsagePtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_ChargeAppUsage(CFE_ES_AppId_t AppId, size_t Bytes, bool IsZeroCopy)
+{
+    CFE_SB_AppUsageD_t *UsagePtr;
+    size_t              TotalBytes;
+
+    UsagePtr = CFE_SB_LocateAppUsageByID(AppId);
+    if (UsagePtr == NULL)
+    {
+        /* not attributable to a registered app, so no quota applies */
+        return true;
+    }
+
+    if (!CFE_RESOURCEID_TEST_EQUAL(UsagePtr->AppId, AppId))
+    {
+        /* First use of this entry by this app, start from the default quota */
+        memset(UsagePtr, 0, sizeof(*UsagePtr));
+        UsagePtr->AppId      = AppId;
+        UsagePtr->QuotaBytes = CFE_PLATFORM_SB_DEFAULT_APP_BUF_QUOTA;
+    }
+
+    TotalBytes = UsagePtr->ZeroCopyBytes + UsagePtr->QueuedBytes + Bytes;
+    if (UsagePtr->QuotaBytes != 0 && TotalBytes > UsagePtr->QuotaBytes)
+    {
+        if (UsagePtr->QuotaErrors < 0xFFFF)
+        {
+            ++UsagePtr->QuotaErrors;
+        }
+        return false;
+    }
+
+    if (IsZeroCopy)
+    {
+        UsagePtr->ZeroCopyBytes += Bytes;
+    }
+    else
+    {
+        UsagePtr->QueuedBytes += Bytes;
+    }
+
+    if (TotalBytes > UsagePtr->PeakBytes)
+    {
+        UsagePtr->PeakBytes = TotalBytes;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReleaseAppUsage(CFE_ES_AppId_t AppId, size_t Bytes, bool IsZeroCopy)
+{
+    CFE_SB_AppUsageD_t *UsagePtr;
+    size_t *            CountPtr;
+
+    UsagePtr = CFE_SB_LocateAppUsageByID(AppId);
+    if (UsagePtr == NULL || !CFE_RESOURCEID_TEST_EQUAL(UsagePtr->AppId, AppId))
+    {
+        return;
+    }
+
+    if (IsZeroCopy)
+    {
+        CountPtr = &UsagePtr->ZeroCopyBytes;
+    }
+    else
+    {
+        CountPtr = &UsagePtr->QueuedBytes;
+    }
+
+    if (*CountPtr > Bytes)
+    {
+        *CountPtr -= Bytes;
+    }
+    else
+    {
+        *CountPtr = 0;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -218,6 +413,36 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
     return (CFE_SB_DestinationD_t *)addr;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void *CFE_SB_GetTableExtensionBlk(size_t Size)
+{
+    int32               Stat;
+    CFE_ES_MemPoolBuf_t addr = NULL;
+
+    Stat = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, Size);
+    if (Stat < 0)
+    {
+        return NULL;
+    }
+
+    memset(addr, 0, Size);
+
+    /* table extensions are never released, they are also reported on their own */
+    CFE_SB_Global.HKTlmMsg.Payload.TableMemInUse += Stat;
+    CFE_SB_Global.StatTlmMsg.Payload.MemInUse += Stat;
+    if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
+    {
+        CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
+    }
+
+    return addr;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
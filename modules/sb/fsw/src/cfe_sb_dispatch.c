@@ -182,6 +182,20 @@ void CFE_SB_ProcessCmdPipePkt(const CFE_SB_Buffer_t *SBBufPtr)
                     }
                     break;
 
+                case CFE_SB_SEND_APP_USAGE_CC:
+                    if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_SendAppUsageCmd_t)))
+                    {
+                        CFE_SB_SendAppUsageCmd((const CFE_SB_SendAppUsageCmd_t *)SBBufPtr);
+                    }
+                    break;
+
+                case CFE_SB_SET_APP_QUOTA_CC:
+                    if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_SetAppQuotaCmd_t)))
+                    {
+                        CFE_SB_SetAppQuotaCmd((const CFE_SB_SetAppQuotaCmd_t *)SBBufPtr);
+                    }
+                    break;
+
                 default:
                     CFE_EVS_SendEvent(CFE_SB_BAD_CMD_CODE_EID, CFE_EVS_EventType_ERROR,
                                       "Invalid Cmd, Unexpected Command Code %u", FcnCode);
@@ -67,6 +67,13 @@ int32 CFE_SB_EarlyInit(void)
         return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
     }
 
+    OsStatus = OS_MutSemCreate(&CFE_SB_Global.ErrAggMutexId, "CFE_SB_ErrAggMutex", 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Error aggregation mutex creation failed! RC=%ld\n", __func__, (long)OsStatus);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
     /* Initialize the state of subscription reporting */
     CFE_SB_Global.SubscriptionReporting = CFE_SB_DISABLE;
 
@@ -130,5 +137,8 @@ int32 CFE_SB_InitBuffers(void)
  *-----------------------------------------------------------------*/
 void CFE_SB_InitPipeTbl(void)
 {
+    CFE_SB_Global.PipeTblChunks[0] = CFE_SB_Global.PipeTbl;
+    CFE_SB_Global.PipeTblCapacity  = CFE_PLATFORM_SB_INITIAL_PIPES;
+
     CFE_SB_Global.LastPipeId = CFE_ResourceId_FromInteger(CFE_SB_PIPEID_BASE);
 }
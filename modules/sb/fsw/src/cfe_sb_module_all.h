@@ -36,6 +36,7 @@
 #include "cfe_platform_cfg.h"
 #include "cfe_msgids.h"
 #include "cfe_perfids.h"
+#include "cfe_core_perf_markers.h"
 
 #include "cfe_sb_core_internal.h"
 
@@ -47,4 +48,9 @@
 #include "cfe_sbr.h"
 #include "cfe_core_resourceid_basevalues.h"
 
+/*
+ * Additionally the lock functions use the ES lock profiler hooks
+ */
+#include "cfe_es_core_internal.h"
+
 #endif /* CFE_SB_MODULE_ALL_H */
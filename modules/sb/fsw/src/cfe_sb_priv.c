@@ -86,25 +86,25 @@
  *-----------------------------------------------------------------*/
 int32 CFE_SB_CleanUpApp(CFE_ES_AppId_t AppId)
 {
-    uint32          i;
-    uint32          DelCount;
-    CFE_SB_PipeD_t *PipeDscPtr;
-    CFE_SB_PipeId_t DelList[CFE_PLATFORM_SB_MAX_PIPES];
+    uint32              i;
+    uint32              DelCount;
+    CFE_SB_PipeD_t *    PipeDscPtr;
+    CFE_SB_PipeId_t     DelList[CFE_PLATFORM_SB_MAX_PIPES];
+    CFE_SB_AppUsageD_t *UsagePtr;
 
-    PipeDscPtr = CFE_SB_Global.PipeTbl;
-    DelCount   = 0;
+    DelCount = 0;
 
     CFE_SB_LockSharedData(__func__, __LINE__);
 
     /* loop through the pipe table looking for pipes owned by AppId */
-    for (i = 0; i < CFE_PLATFORM_SB_MAX_PIPES; ++i)
+    for (i = 0; i < CFE_SB_Global.PipeTblCapacity; ++i)
     {
+        PipeDscPtr = CFE_SB_PipeDescByIndex(i);
         if (CFE_SB_PipeDescIsUsed(PipeDscPtr) && CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId))
         {
             DelList[DelCount] = CFE_SB_PipeDescGetID(PipeDscPtr);
             ++DelCount;
         }
-        ++PipeDscPtr;
     }
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
@@ -117,6 +117,17 @@ int32 CFE_SB_CleanUpApp(CFE_ES_AppId_t AppId)
     /* Release any zero copy buffers */
     CFE_SB_ZeroCopyReleaseAppId(AppId);
 
+    /* Nothing more can be attributed to this app, so forget its usage and quota */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    UsagePtr = CFE_SB_LocateAppUsageByID(AppId);
+    if (UsagePtr != NULL && CFE_RESOURCEID_TEST_EQUAL(UsagePtr->AppId, AppId))
+    {
+        memset(UsagePtr, 0, sizeof(*UsagePtr));
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
     return CFE_SUCCESS;
 }
 
@@ -128,16 +139,26 @@ int32 CFE_SB_CleanUpApp(CFE_ES_AppId_t AppId)
  *-----------------------------------------------------------------*/
 void CFE_SB_LockSharedData(const char *FuncName, int32 LineNumber)
 {
-    int32          OsStatus;
-    CFE_ES_AppId_t AppId;
+    int32                     OsStatus;
+    CFE_ES_AppId_t            AppId;
+    CFE_ES_LockProfileStamp_t Stamp;
+
+    CFE_ES_LOCKPROF_BEGIN(&Stamp);
 
+    CFE_CORE_PERF_ENTRY(CFE_MISSION_SB_LOCK_PERF_ID);
     OsStatus = OS_MutSemTake(CFE_SB_Global.SharedDataMutexId);
+    CFE_CORE_PERF_EXIT(CFE_MISSION_SB_LOCK_PERF_ID);
+
     if (OsStatus != OS_SUCCESS)
     {
         CFE_ES_GetAppID(&AppId);
         CFE_ES_WriteToSysLog("%s: SharedData Mutex Take Err Stat=%ld,App=%lu,Func=%s,Line=%d\n", __func__,
                              (long)OsStatus, CFE_RESOURCEID_TO_ULONG(AppId), FuncName, (int)LineNumber);
     }
+    else
+    {
+        CFE_ES_LOCKPROF_ACQUIRED(CFE_ES_LockProfileId_SB_SHARED_DATA, FuncName, LineNumber, &Stamp);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -151,6 +172,8 @@ void CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber)
     int32          OsStatus;
     CFE_ES_AppId_t AppId;
 
+    CFE_ES_LOCKPROF_RELEASED(CFE_ES_LockProfileId_SB_SHARED_DATA);
+
     OsStatus = OS_MutSemGive(CFE_SB_Global.SharedDataMutexId);
     if (OsStatus != OS_SUCCESS)
     {
@@ -216,9 +239,9 @@ CFE_SB_PipeD_t *CFE_SB_LocatePipeDescByID(CFE_SB_PipeId_t PipeId)
     CFE_SB_PipeD_t *PipeDscPtr;
     uint32          Idx;
 
-    if (CFE_SB_PipeId_ToIndex(PipeId, &Idx) == CFE_SUCCESS)
+    if (CFE_SB_PipeId_ToIndex(PipeId, &Idx) == CFE_SUCCESS && Idx < CFE_SB_Global.PipeTblCapacity)
     {
-        PipeDscPtr = &CFE_SB_Global.PipeTbl[Idx];
+        PipeDscPtr = CFE_SB_PipeDescByIndex(Idx);
     }
     else
     {
@@ -228,6 +251,51 @@ CFE_SB_PipeD_t *CFE_SB_LocatePipeDescByID(CFE_SB_PipeId_t PipeId)
     return PipeDscPtr;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_PipeD_t *CFE_SB_PipeDescByIndex(uint32 Idx)
+{
+    return &CFE_SB_Global.PipeTblChunks[Idx / CFE_PLATFORM_SB_INITIAL_PIPES][Idx % CFE_PLATFORM_SB_INITIAL_PIPES];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_GrowPipeTbl(void)
+{
+    CFE_SB_PipeD_t *ChunkPtr;
+    uint32          ChunkIdx;
+
+    ChunkIdx = CFE_SB_Global.PipeTblCapacity / CFE_PLATFORM_SB_INITIAL_PIPES;
+    if (CFE_SB_Global.PipeTblCapacity >= CFE_PLATFORM_SB_MAX_PIPES || ChunkIdx >= CFE_SB_PIPE_TBL_CHUNKS)
+    {
+        return CFE_SB_MAX_PIPES_MET;
+    }
+
+    ChunkPtr = CFE_SB_GetTableExtensionBlk(sizeof(CFE_SB_PipeD_t) * CFE_PLATFORM_SB_INITIAL_PIPES);
+    if (ChunkPtr == NULL)
+    {
+        return CFE_SB_BUF_ALOC_ERR;
+    }
+
+    /* Publish the fully initialized block before raising the capacity */
+    CFE_SB_Global.PipeTblChunks[ChunkIdx] = ChunkPtr;
+    CFE_SB_Global.PipeTblCapacity += CFE_PLATFORM_SB_INITIAL_PIPES;
+    if (CFE_SB_Global.PipeTblCapacity > CFE_PLATFORM_SB_MAX_PIPES)
+    {
+        CFE_SB_Global.PipeTblCapacity = CFE_PLATFORM_SB_MAX_PIPES;
+    }
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -238,9 +306,9 @@ bool CFE_SB_CheckPipeDescSlotUsed(CFE_ResourceId_t CheckId)
 {
     CFE_SB_PipeD_t *PipeDscPtr;
     /*
-     * Note - The pointer here should never be NULL because the ID should always be
-     * within the expected range, but if it ever is NULL, this should return true
-     * such that the caller will _not_ attempt to use the record.
+     * Note - The pointer here is NULL if the ID is beyond the currently allocated
+     * part of the pipe table.  In that case this should return true such that the
+     * caller will _not_ attempt to use the record.
      */
     PipeDscPtr = CFE_SB_LocatePipeDescByID(CFE_SB_PIPEID_C(CheckId));
     return (PipeDscPtr == NULL || CFE_SB_PipeDescIsUsed(PipeDscPtr));
@@ -341,6 +409,79 @@ void CFE_SB_FinishSendEvent(CFE_ES_TaskId_t TaskId, int32 Bit)
     CFE_CLR(CFE_SB_Global.StopRecurseFlags[Indx], Bit);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_AggregateTransmitError(CFE_SB_PipeId_t PipeId, CFE_SB_MsgId_t MsgId, uint16 EventId)
+{
+    CFE_SB_ErrAggD_t *EntryPtr;
+    CFE_SB_ErrAggD_t *FreePtr;
+    uint32            i;
+    bool              IsFirst;
+
+    switch (EventId)
+    {
+        case CFE_SB_Q_FULL_ERR_EID:
+        case CFE_SB_MSGID_LIM_ERR_EID:
+        case CFE_SB_APP_QUOTA_ERR_EID:
+        case CFE_SB_Q_WR_ERR_EID:
+            break;
+
+        default:
+            /* not a per-destination error, always report */
+            return true;
+    }
+
+    IsFirst  = false;
+    EntryPtr = CFE_SB_Global.ErrAgg;
+    FreePtr  = NULL;
+
+    OS_MutSemTake(CFE_SB_Global.ErrAggMutexId);
+
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_ERR_AGGREGATES; ++i)
+    {
+        if (EntryPtr->EventId == 0)
+        {
+            if (FreePtr == NULL)
+            {
+                FreePtr = EntryPtr;
+            }
+        }
+        else if (EntryPtr->EventId == EventId && CFE_SB_MsgId_Equal(EntryPtr->MsgId, MsgId) &&
+                 CFE_RESOURCEID_TEST_EQUAL(EntryPtr->PipeId, PipeId))
+        {
+            break;
+        }
+
+        ++EntryPtr;
+    }
+
+    if (i < CFE_PLATFORM_SB_MAX_ERR_AGGREGATES)
+    {
+        /* Already reported in this period, count it for the summary */
+        ++EntryPtr->Count;
+    }
+    else if (FreePtr != NULL)
+    {
+        FreePtr->PipeId  = PipeId;
+        FreePtr->MsgId   = MsgId;
+        FreePtr->EventId = EventId;
+        FreePtr->Count   = 0;
+        IsFirst          = true;
+    }
+    else
+    {
+        ++CFE_SB_Global.ErrAggOverflow;
+    }
+
+    OS_MutSemGive(CFE_SB_Global.ErrAggMutexId);
+
+    return IsFirst;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -471,6 +612,7 @@ int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId)
             if (CFE_RESOURCEID_TEST_EQUAL(DscPtr->AppId, AppId))
             {
                 /* If so, decrement the use count as the app has now gone away */
+                CFE_SB_ReleaseAppUsage(AppId, DscPtr->AllocatedSize, true);
                 CFE_SB_DecrBufUseCnt(DscPtr);
             }
         }
@@ -481,6 +623,45 @@ int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_ReleaseHeldBuffer(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_BufferD_t *BufDscPtr)
+{
+    CFE_SB_BufferD_t *HeldPtr;
+    uint32            i;
+    bool              IsReleased;
+
+    IsReleased = false;
+
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS; ++i)
+    {
+        HeldPtr = PipeDscPtr->HeldBuffers[i];
+
+        if (HeldPtr != NULL && (BufDscPtr == NULL || HeldPtr == BufDscPtr))
+        {
+            PipeDscPtr->HeldBuffers[i] = NULL;
+            --PipeDscPtr->HeldCount;
+
+            /* Held buffers remain charged to the pipe owner until released */
+            CFE_SB_ReleaseAppUsage(PipeDscPtr->AppId, HeldPtr->AllocatedSize, false);
+            CFE_SB_DecrBufUseCnt(HeldPtr);
+
+            IsReleased = true;
+
+            if (BufDscPtr != NULL)
+            {
+                break;
+            }
+        }
+    }
+
+    return IsReleased;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -650,6 +831,15 @@ void CFE_SB_MessageTxn_GetEventDetails(const CFE_SB_MessageTxn_State_t *TxnPtr,
                      CFE_SB_GetAppTskName(TskId, FullName));
             break;
 
+        case CFE_SB_APP_QUOTA_ERR_EID:
+            *ReqBit    = CFE_SB_APP_QUOTA_ERR_EID_BIT;
+            *EventType = CFE_EVS_EventType_ERROR;
+
+            snprintf(EvtMsg, EvtMsgSize, "App Quota Err,MsgId 0x%x,pipe %s,sender %s",
+                     (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId), PipeName,
+                     CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
         case CFE_SB_Q_FULL_ERR_EID:
             *ReqBit    = CFE_SB_Q_FULL_ERR_EID_BIT;
             *EventType = CFE_EVS_EventType_ERROR;
@@ -758,8 +948,18 @@ void CFE_SB_MessageTxn_ReportEvents(const CFE_SB_MessageTxn_State_t *TxnPtr)
     {
         if (TxnPtr->PipeSet[i].PendingEventId != 0)
         {
-            IsError =
-                CFE_SB_MessageTxn_ReportSingleEvent(TxnPtr, &TxnPtr->PipeSet[i], TxnPtr->PipeSet[i].PendingEventId);
+            if (TxnPtr->IsTransmit && !CFE_SB_AggregateTransmitError(TxnPtr->PipeSet[i].PipeId, TxnPtr->RoutingMsgId,
+                                                                     TxnPtr->PipeSet[i].PendingEventId))
+            {
+                /* Repeated (or unaggregated) error, it will be included in the next summary instead */
+                IsError = true;
+            }
+            else
+            {
+                IsError = CFE_SB_MessageTxn_ReportSingleEvent(TxnPtr, &TxnPtr->PipeSet[i],
+                                                              TxnPtr->PipeSet[i].PendingEventId);
+            }
+
             if (IsError)
             {
                 ++NumErrors;
@@ -1000,11 +1200,20 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
                     ++PipeDscPtr->SendErrors;
                     ++TxnPtr->NumPipeErrs;
                 }
+                /* if the pipe owner is over its buffer quota, drop it for this destination only */
+                else if (!CFE_SB_ChargeAppUsage(PipeDscPtr->AppId, BufDscPtr->AllocatedSize, false))
+                {
+                    ContextPtr->PendingEventId = CFE_SB_APP_QUOTA_ERR_EID;
+                    ++PipeDscPtr->SendErrors;
+                    ++TxnPtr->NumPipeErrs;
+                }
                 else
                 {
                     CFE_SB_IncrBufUseCnt(BufDscPtr);
                     ++DestPtr->BuffCount;
 
+                    PipeDscPtr->QueuedBytes += BufDscPtr->AllocatedSize;
+
                     ++PipeDscPtr->CurrentQueueDepth;
                     if (PipeDscPtr->CurrentQueueDepth > PipeDscPtr->PeakQueueDepth)
                     {
@@ -1034,6 +1243,7 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
 
     /* clear the AppID field in case it was a zero copy buffer,
      * as it is no longer owned by that app after broadcasting */
+    CFE_SB_ReleaseAppUsage(BufDscPtr->AppId, BufDscPtr->AllocatedSize, true);
     BufDscPtr->AppId = CFE_ES_APPID_UNDEFINED;
 
     /* track the buffer as an in-transit message */
@@ -1050,7 +1260,9 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
     if (CFE_SB_MessageTxn_IsOK(TxnPtr) && TxnPtr->IsEndpoint)
     {
         /* Update any other system-specific MSG headers based on the current sequence */
-        Status = CFE_MSG_OriginationAction(&BufDscPtr->Content.Msg, BufDscPtr->AllocatedSize, &IsAcceptable);
+        /* Only the head of a chained message is contiguous with the header */
+        Status = CFE_MSG_OriginationAction(&BufDscPtr->Content.Msg, BufDscPtr->AllocatedSize - BufDscPtr->SegmentSize,
+                                           &IsAcceptable);
         if (Status != CFE_SUCCESS || !IsAcceptable)
         {
             CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_MESSAGE_INTEGRITY_FAIL_EID, Status);
@@ -1138,9 +1350,19 @@ bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pi
         }
 
         PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
-        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId) && PipeDscPtr->CurrentQueueDepth > 0)
+        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId))
         {
-            --PipeDscPtr->CurrentQueueDepth;
+            if (PipeDscPtr->CurrentQueueDepth > 0)
+            {
+                --PipeDscPtr->CurrentQueueDepth;
+            }
+
+            if (PipeDscPtr->QueuedBytes >= BufDscPtr->AllocatedSize)
+            {
+                PipeDscPtr->QueuedBytes -= BufDscPtr->AllocatedSize;
+            }
+
+            CFE_SB_ReleaseAppUsage(PipeDscPtr->AppId, BufDscPtr->AllocatedSize, false);
         }
 
         DestPtr = CFE_SB_GetDestPtr(BufDscPtr->DestRouteId, ContextPtr->PipeId);
@@ -1307,6 +1529,9 @@ void CFE_SB_ReceiveTxn_SetPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeI
          * multiple child tasks in a worker pattern design.  This may be changed
          * in a future version of CFE to decouple these actions, to allow for
          * multiple workers to service the same pipe.
+         *
+         * Pipes with the HOLDBUFFERS option do not use LastBuffer, the app releases
+         * each buffer explicitly.  This only matters if the option was just set.
          */
         if (PipeDscPtr->LastBuffer != NULL)
         {
@@ -1314,6 +1539,16 @@ void CFE_SB_ReceiveTxn_SetPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeI
             CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
             PipeDscPtr->LastBuffer = NULL;
         }
+
+        /*
+         * In HOLDBUFFERS mode, refuse to dequeue another message if the app already
+         * holds as many as it is allowed.  The message stays on the queue.
+         */
+        if ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_HOLDBUFFERS) != 0 &&
+            PipeDscPtr->HeldCount >= CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS)
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_HOLD_LIMIT_MET);
+        }
     }
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
@@ -1330,6 +1565,8 @@ void CFE_SB_ReceiveTxn_ExportReference(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB
 {
     CFE_SB_PipeD_t *       PipeDscPtr;
     CFE_SB_DestinationD_t *DestPtr;
+    uint32                 i;
+    bool                   IsHeld;
 
     PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
 
@@ -1344,14 +1581,36 @@ void CFE_SB_ReceiveTxn_ExportReference(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB
     if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId))
     {
         /*
-        ** Load the pipe tables 'CurrentBuff' with the buffer descriptor
+        ** In HOLDBUFFERS mode the buffer is stored in a free slot of the held set,
+        ** where it stays until the app calls CFE_SB_ReleaseReceivedBuffer().
+        **
+        ** Otherwise load the pipe tables 'CurrentBuff' with the buffer descriptor
         ** ptr corresponding to the message just read. This is done so that
         ** the buffer can be released on the next receive call for this pipe.
         **
-        ** This counts as a new reference as it is being stored in the PipeDsc
+        ** Either way this counts as a new reference as it is being stored in the PipeDsc
         */
         CFE_SB_IncrBufUseCnt(BufDscPtr);
-        PipeDscPtr->LastBuffer = BufDscPtr;
+
+        IsHeld = false;
+        if ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_HOLDBUFFERS) != 0)
+        {
+            for (i = 0; i < CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS; ++i)
+            {
+                if (PipeDscPtr->HeldBuffers[i] == NULL)
+                {
+                    PipeDscPtr->HeldBuffers[i] = BufDscPtr;
+                    ++PipeDscPtr->HeldCount;
+                    IsHeld = true;
+                    break;
+                }
+            }
+        }
+
+        if (!IsHeld)
+        {
+            PipeDscPtr->LastBuffer = BufDscPtr;
+        }
 
         /*
          * Also set the Receivers pointer to the address of the actual message
@@ -1377,6 +1636,20 @@ void CFE_SB_ReceiveTxn_ExportReference(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB
         {
             --PipeDscPtr->CurrentQueueDepth;
         }
+
+        if (PipeDscPtr->QueuedBytes >= BufDscPtr->AllocatedSize)
+        {
+            PipeDscPtr->QueuedBytes -= BufDscPtr->AllocatedSize;
+        }
+
+        /*
+         * Once received the buffer no longer counts against the owner's quota,
+         * unless it is held, in which case it is released with the hold.
+         */
+        if (!IsHeld)
+        {
+            CFE_SB_ReleaseAppUsage(PipeDscPtr->AppId, BufDscPtr->AllocatedSize, false);
+        }
     }
     else
     {
@@ -1456,6 +1729,7 @@ bool CFE_SB_ReceiveTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pip
 const CFE_SB_Buffer_t *CFE_SB_ReceiveTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr)
 {
     CFE_SB_BufferD_t *     BufDscPtr;
+    CFE_SB_PipeD_t *       PipeDscPtr;
     const CFE_SB_Buffer_t *Result;
     bool                   IsAcceptable;
     CFE_Status_t           Status;
@@ -1519,8 +1793,16 @@ const CFE_SB_Buffer_t *CFE_SB_ReceiveTxn_Execute(CFE_SB_MessageTxn_State_t *TxnP
         /*
          * Also need to re-set the PipeId for proper accounting.  This buffer will be dropped,
          * and this decrements the use count and removes it from the LastBuffer pointer in the
-         * Pipe Descriptor
+         * Pipe Descriptor, or from the held set if the pipe is in HOLDBUFFERS mode
          */
+        PipeDscPtr = CFE_SB_LocatePipeDescByID(TxnPtr->PipeSet->PipeId);
+        CFE_SB_LockSharedData(__func__, __LINE__);
+        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, TxnPtr->PipeSet->PipeId))
+        {
+            CFE_SB_ReleaseHeldBuffer(PipeDscPtr, BufDscPtr);
+        }
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+
         CFE_SB_ReceiveTxn_SetPipeId(TxnPtr, TxnPtr->PipeSet->PipeId);
     }
 
@@ -87,6 +87,13 @@
 #define CFE_SB_USECNT_ERR    (-3)
 #define CFE_SB_FILE_IO_ERR   (-5)
 
+/* largest message which can be held by a head buffer plus continuation segments */
+#define CFE_SB_MAX_CHAINED_MSG_SIZE \
+    ((size_t)CFE_MISSION_SB_MAX_SB_MSG_SIZE * (1 + CFE_PLATFORM_SB_MAX_MSG_SEGMENTS))
+
+/* number of blocks needed for the pipe table to reach its maximum size */
+#define CFE_SB_PIPE_TBL_CHUNKS (((CFE_PLATFORM_SB_MAX_PIPES - 1) / CFE_PLATFORM_SB_INITIAL_PIPES) + 1)
+
 /* bit map for stopping recursive event problem */
 #define CFE_SB_SEND_NO_SUBS_EID_BIT   0
 #define CFE_SB_GET_BUF_ERR_EID_BIT    1
@@ -96,6 +103,7 @@
 #define CFE_SB_SEND_BAD_ARG_EID_BIT   5
 #define CFE_SB_SEND_INV_MSGID_EID_BIT 6
 #define CFE_SB_MSG_TOO_BIG_EID_BIT    7
+#define CFE_SB_APP_QUOTA_ERR_EID_BIT  8
 /*
 ** Type Definitions
 */
@@ -109,6 +117,26 @@ typedef struct CFE_SB_BufferLink
     struct CFE_SB_BufferLink *Prev;
 } CFE_SB_BufferLink_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_BufferSeg_t
+**
+**  Purpose:
+**     This structure defines a continuation segment of a chained message buffer.
+**     A message larger than #CFE_MISSION_SB_MAX_SB_MSG_SIZE is stored as a head
+**     buffer descriptor followed by a list of these segments.  The segments are
+**     owned by the head descriptor, so the whole chain is routed, reference
+**     counted and returned to the pool as a single object.
+*/
+typedef struct CFE_SB_BufferSeg
+{
+    struct CFE_SB_BufferSeg *Next; /**< Next segment in the chain, or NULL */
+
+    size_t AllocatedSize; /**< Total size of this segment (including the segment header itself) */
+    size_t ContentSize;   /**< Size of message content stored in this segment */
+
+    CFE_ES_PoolAlign_t Content; /* Variably sized content field, Keep last */
+} CFE_SB_BufferSeg_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_BufferD_t
 **
@@ -150,9 +178,12 @@ typedef struct CFE_SB_BufferD
 
     CFE_SB_MsgId_t MsgId;
 
-    size_t AllocatedSize; /**< Total size of this descriptor (including descriptor itself) */
+    size_t AllocatedSize; /**< Total size of this descriptor (including descriptor itself and any segments) */
     size_t ContentSize;   /**< Actual size of message content currently stored in the buffer */
 
+    CFE_SB_BufferSeg_t *Segments;    /**< Continuation segments of a chained message, NULL if not chained */
+    size_t              SegmentSize; /**< Portion of AllocatedSize used by the continuation segments */
+
     uint16 UseCount; /**< Number of active references to this buffer in the system */
 
     CFE_SB_Buffer_t Content; /* Variably sized content field, Keep last */
@@ -177,9 +208,49 @@ typedef struct
     uint16            MaxQueueDepth;
     uint16            CurrentQueueDepth;
     uint16            PeakQueueDepth;
+    size_t            QueuedBytes; /**< Buffer memory referenced by messages currently in the queue */
     CFE_SB_BufferD_t *LastBuffer;
+    uint16            HeldCount; /**< Number of entries in use in HeldBuffers */
+    CFE_SB_BufferD_t *HeldBuffers[CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS]; /**< Buffers held in HOLDBUFFERS mode */
 } CFE_SB_PipeD_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_AppUsageD_t
+**
+**  Purpose:
+**     This structure tracks the amount of SB buffer memory attributed to a
+**     single application, for enforcement of the per-application quota.
+**
+**     Zero copy buffers are charged to the app that allocated them.  Buffers
+**     queued on a pipe are charged to the app that owns the pipe, once for
+**     each pipe the buffer is queued on.
+*/
+typedef struct
+{
+    CFE_ES_AppId_t AppId;         /**< App this entry is associated with, undefined if not in use */
+    size_t         ZeroCopyBytes; /**< Bytes held by the app as zero copy buffers */
+    size_t         QueuedBytes;   /**< Bytes referenced by messages queued on (or held from) pipes owned by the app */
+    size_t         PeakBytes;     /**< High water mark of ZeroCopyBytes + QueuedBytes */
+    size_t         QuotaBytes;    /**< Limit on ZeroCopyBytes + QueuedBytes, 0 for no limit */
+    uint16         QuotaErrors;   /**< Number of charges rejected due to the quota */
+} CFE_SB_AppUsageD_t;
+
+/******************************************************************************
+**  Typedef:  CFE_SB_ErrAggD_t
+**
+**  Purpose:
+**     This structure counts repeats of a transmit error for a single
+**     pipe, message ID and event ID, between housekeeping requests.
+*/
+typedef struct
+{
+    CFE_SB_PipeId_t PipeId;  /**< Pipe the error occurred on */
+    CFE_SB_MsgId_t  MsgId;   /**< Message ID being transmitted */
+    uint16          EventId; /**< Event ID of the error, 0 if this entry is not in use */
+    uint16          Spare;
+    uint32          Count; /**< Number of occurrences suppressed after the first */
+} CFE_SB_ErrAggD_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_BufParams_t
 **
@@ -240,15 +311,22 @@ typedef struct
     uint32                       SubscriptionReporting;
     CFE_ES_AppId_t               AppId;
     uint32                       StopRecurseFlags[OS_MAX_TASKS];
-    CFE_SB_PipeD_t               PipeTbl[CFE_PLATFORM_SB_MAX_PIPES];
+    CFE_SB_PipeD_t               PipeTbl[CFE_PLATFORM_SB_INITIAL_PIPES];
+    CFE_SB_PipeD_t              *PipeTblChunks[CFE_SB_PIPE_TBL_CHUNKS]; /**< Pipe table blocks, first is PipeTbl */
+    uint32                       PipeTblCapacity;                       /**< Pipe table entries allocated so far */
     CFE_SB_HousekeepingTlm_t     HKTlmMsg;
     CFE_SB_StatsTlm_t            StatTlmMsg;
+    CFE_SB_AppUsageTlm_t         AppUsageTlmMsg;
     CFE_SB_PipeId_t              CmdPipe;
     CFE_SB_MemParams_t           Mem;
     CFE_SB_AllSubscriptionsTlm_t PrevSubMsg;
     CFE_EVS_BinFilter_t          EventFilters[CFE_SB_MAX_CFG_FILE_EVENTS_TO_FILTER];
     CFE_SB_Qos_t                 Default_Qos;
     CFE_ResourceId_t             LastPipeId;
+    CFE_SB_AppUsageD_t           AppUsage[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+    osal_id_t                    ErrAggMutexId;  /**< Guards ErrAgg and ErrAggOverflow */
+    CFE_SB_ErrAggD_t             ErrAgg[CFE_PLATFORM_SB_MAX_ERR_AGGREGATES];
+    uint32                       ErrAggOverflow; /**< Errors suppressed because ErrAgg was full */
 
     CFE_SB_BackgroundFileStateInfo_t BackgroundFile;
 
@@ -478,6 +556,22 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
  */
 int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Release a buffer held from a pipe in #CFE_SB_PIPEOPTS_HOLDBUFFERS mode.
+ *
+ * Removes the buffer from the held set of the pipe, releases it from the quota
+ * of the pipe owner, and decrements the use count (which may free the buffer).
+ *
+ * \note Global data must be locked prior to invoking this function.
+ *
+ * @param PipeDscPtr  Validated pointer to the pipe descriptor
+ * @param BufDscPtr   Buffer to release, or NULL to release all held buffers
+ *
+ * \return true if any held buffer was released, false if the buffer was not held from the pipe
+ */
+bool CFE_SB_ReleaseHeldBuffer(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_BufferD_t *BufDscPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Increment the UseCount of a buffer
@@ -563,6 +657,37 @@ uint32 CFE_SB_RequestToSendEvent(CFE_ES_TaskId_t TaskId, int32 Bit);
  */
 void CFE_SB_FinishSendEvent(CFE_ES_TaskId_t TaskId, int32 Bit);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Record a transmit error for aggregation.
+ *
+ * Pipe level transmit errors (overflow, message limit, quota and write errors) are
+ * counted per pipe, message ID and event ID.  Only the first occurrence in each
+ * housekeeping period should be reported with its own event, the remainder are
+ * reported in summary by CFE_SB_ReportAggregatedErrors().
+ *
+ * Other event IDs are not aggregated and should always be reported.
+ *
+ * The table has its own mutex, so a burst of failed deliveries does not contend
+ * for the SB global lock with the senders that still succeed.
+ *
+ * @param PipeId   Pipe the error occurred on
+ * @param MsgId    Message ID being transmitted
+ * @param EventId  Event ID of the error
+ *
+ * \return true if the event should be reported now, false if it was aggregated
+ */
+bool CFE_SB_AggregateTransmitError(CFE_SB_PipeId_t PipeId, CFE_SB_MsgId_t MsgId, uint16 EventId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Report and reset the aggregated transmit errors.
+ *
+ * Sends a summary event for each aggregated error that was suppressed at least
+ * once, then clears the table.  Called on each housekeeping request.
+ */
+void CFE_SB_ReportAggregatedErrors(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * This function gets a destination descriptor from the SB memory pool.
@@ -572,6 +697,20 @@ void CFE_SB_FinishSendEvent(CFE_ES_TaskId_t TaskId, int32 Bit);
  */
 CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * This function allocates a block of memory from the SB memory pool to extend
+ * one of the SB tables.  The block is zero filled and is never returned to the pool.
+ * Its size is counted both in the memory in use and in the table memory reported
+ * in housekeeping.
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * @param Size Size of the block in bytes
+ *
+ * @return Pointer to the block, or NULL if the pool is exhausted
+ */
+void *CFE_SB_GetTableExtensionBlk(size_t Size);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * This function returns a destination descriptor to the SB memory pool.
@@ -647,12 +786,30 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
  */
 CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Extends a buffer descriptor with continuation segments from the SB memory pool.
+ *
+ * Allocates as many segments as needed to hold ExtraSize bytes of content beyond
+ * what the head buffer holds, each of at most #CFE_MISSION_SB_MAX_SB_MSG_SIZE bytes,
+ * and links them to the descriptor.  On failure any segments that were allocated
+ * remain linked, and are released along with the descriptor.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] bd        Pointer to head descriptor, must not already have segments
+ * \param[in] ExtraSize Content size that the segments must be capable of holding
+ * \returns CFE_SUCCESS, or CFE_SB_BUF_ALOC_ERR if the pool is exhausted
+ */
+int32 CFE_SB_AddBufferSegments(CFE_SB_BufferD_t *bd, size_t ExtraSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Returns a buffer to SB memory pool
  *
  * This function will return a block of memory back to the SB memory pool,
- * so it can be re-used for a future message
+ * so it can be re-used for a future message.  Any continuation segments
+ * of a chained message are returned as well.
  *
  * @note This must only be invoked while holding the SB global lock
  * \param[in] bd Pointer to descriptor to return
@@ -670,6 +827,52 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
  */
 int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **BufDscPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Locate the buffer usage accounting entry for an application
+ *
+ * @note The entry may be stale, the caller must compare the AppId in the
+ * returned entry to determine whether it is actually in use.
+ *
+ * \param[in] AppId Application ID
+ * \returns Pointer to usage entry, or NULL if the AppId does not map to a table entry
+ */
+CFE_SB_AppUsageD_t *CFE_SB_LocateAppUsageByID(CFE_ES_AppId_t AppId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Attribute buffer memory to an application, enforcing its quota
+ *
+ * If the application quota is nonzero and the additional bytes would cause
+ * the total attributed to the application to exceed it, nothing is charged
+ * and the quota error counter is incremented.
+ *
+ * Buffers that cannot be attributed to a valid application (e.g. those sent
+ * before ES has registered the app) are always permitted.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] AppId      Application to charge
+ * \param[in] Bytes      Amount of buffer memory to charge
+ * \param[in] IsZeroCopy true if charged as a zero copy buffer, false if charged as a queued message
+ * \returns true if the memory was charged, false if it would exceed the quota
+ */
+bool CFE_SB_ChargeAppUsage(CFE_ES_AppId_t AppId, size_t Bytes, bool IsZeroCopy);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Release buffer memory previously charged to an application
+ *
+ * Reverses the effect of a successful CFE_SB_ChargeAppUsage() call.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] AppId      Application previously charged
+ * \param[in] Bytes      Amount of buffer memory to release
+ * \param[in] IsZeroCopy Must match the value used when charging
+ */
+void CFE_SB_ReleaseAppUsage(CFE_ES_AppId_t AppId, size_t Bytes, bool IsZeroCopy);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Add a destination node
@@ -1269,6 +1472,28 @@ int32 CFE_SB_DisableRouteCmd(const CFE_SB_DisableRouteCmd_t *data);
  */
 int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Command Message Handler function
+ *
+ * SB internal function to send the per-application buffer usage packet
+ *
+ * \param[in] data Pointer to command structure
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_SendAppUsageCmd(const CFE_SB_SendAppUsageCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Command Message Handler function
+ *
+ * SB internal function to handle processing of 'Set App Quota' Cmd
+ *
+ * \param[in] data Pointer to command structure
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_SetAppQuotaCmd(const CFE_SB_SetAppQuotaCmd_t *data);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Command Message Handler function
@@ -1343,6 +1568,35 @@ int32 CFE_SB_SendPrevSubsCmd(const CFE_SB_SendPrevSubsCmd_t *data);
  */
 CFE_SB_PipeD_t *CFE_SB_LocatePipeDescByID(CFE_SB_PipeId_t PipeId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the Pipe table entry at a given table index
+ *
+ * The pipe table is made up of fixed size blocks, so entries are
+ * not contiguous in memory.  Iterate using this function with an index
+ * below CFE_SB_Global.PipeTblCapacity rather than by pointer increment.
+ *
+ * @param[in]   Idx   the table index, must be less than the current capacity
+ * @return pointer to Pipe Table entry at the given index
+ */
+CFE_SB_PipeD_t *CFE_SB_PipeDescByIndex(uint32 Idx);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Extend the Pipe table by one block
+ *
+ * Allocates another #CFE_PLATFORM_SB_INITIAL_PIPES entries from the SB memory
+ * pool, up to #CFE_PLATFORM_SB_MAX_PIPES in total.  Existing entries are
+ * not moved, so previously located descriptors remain valid.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * @retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+ * @retval #CFE_SB_MAX_PIPES_MET \copybrief CFE_SB_MAX_PIPES_MET
+ * @retval #CFE_SB_BUF_ALOC_ERR  \copybrief CFE_SB_BUF_ALOC_ERR
+ */
+int32 CFE_SB_GrowPipeTbl(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Check if a Pipe descriptor is in use or free/empty
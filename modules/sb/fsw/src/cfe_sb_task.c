@@ -205,9 +205,15 @@ int32 CFE_SB_AppInit(void)
     CFE_MSG_Init(CFE_MSG_PTR(CFE_SB_Global.PrevSubMsg.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID),
                  sizeof(CFE_SB_Global.PrevSubMsg));
 
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_SB_Global.AppUsageTlmMsg.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(CFE_SB_APP_USAGE_TLM_MID), sizeof(CFE_SB_Global.AppUsageTlmMsg));
+
     /* Populate the fixed fields in the HK Tlm Msg */
     CFE_SB_Global.HKTlmMsg.Payload.MemPoolHandle = CFE_SB_Global.Mem.PoolHdl;
 
+    /* Populate the fixed fields in the App Usage Tlm Msg */
+    CFE_SB_Global.AppUsageTlmMsg.Payload.DefaultQuotaBytes = CFE_PLATFORM_SB_DEFAULT_APP_BUF_QUOTA;
+
     /* Populate the fixed fields in the Stat Tlm Msg */
     CFE_SB_Global.StatTlmMsg.Payload.MaxMsgIdsAllowed    = CFE_PLATFORM_SB_MAX_MSG_IDS;
     CFE_SB_Global.StatTlmMsg.Payload.MaxPipesAllowed     = CFE_PLATFORM_SB_MAX_PIPES;
@@ -356,9 +362,54 @@ int32 CFE_SB_SendHKTlmCmd(const CFE_SB_SendHkCmd_t *data)
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_SB_Global.HKTlmMsg.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_SB_Global.HKTlmMsg.TelemetryHeader), true);
 
+    /* Housekeeping also sets the period for summarizing repeated transmit errors */
+    CFE_SB_ReportAggregatedErrors();
+
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReportAggregatedErrors(void)
+{
+    CFE_SB_ErrAggD_t Pending[CFE_PLATFORM_SB_MAX_ERR_AGGREGATES];
+    uint32           Overflow;
+    uint32           i;
+    char             PipeName[OS_MAX_API_NAME];
+
+    /* Take a snapshot and reset, so events are not sent while locked */
+    OS_MutSemTake(CFE_SB_Global.ErrAggMutexId);
+
+    memcpy(Pending, CFE_SB_Global.ErrAgg, sizeof(Pending));
+    memset(CFE_SB_Global.ErrAgg, 0, sizeof(CFE_SB_Global.ErrAgg));
+    Overflow                     = CFE_SB_Global.ErrAggOverflow;
+    CFE_SB_Global.ErrAggOverflow = 0;
+
+    OS_MutSemGive(CFE_SB_Global.ErrAggMutexId);
+
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_ERR_AGGREGATES; ++i)
+    {
+        if (Pending[i].EventId != 0 && Pending[i].Count > 0)
+        {
+            CFE_SB_GetPipeName(PipeName, sizeof(PipeName), Pending[i].PipeId);
+            CFE_EVS_SendEvent(CFE_SB_SND_ERR_SUMMARY_EID, CFE_EVS_EventType_ERROR,
+                              "Suppressed %lu repeats of EID %u,MsgId 0x%x,pipe %s", (unsigned long)Pending[i].Count,
+                              (unsigned int)Pending[i].EventId, (unsigned int)CFE_SB_MsgIdToValue(Pending[i].MsgId),
+                              PipeName);
+        }
+    }
+
+    if (Overflow > 0)
+    {
+        CFE_EVS_SendEvent(CFE_SB_SND_ERR_SUMMARY_EID, CFE_EVS_EventType_ERROR,
+                          "Suppressed %lu transmit errors,aggregation table full", (unsigned long)Overflow);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -522,7 +573,7 @@ int32 CFE_SB_DisableRouteCmd(const CFE_SB_DisableRouteCmd_t *data)
  *-----------------------------------------------------------------*/
 int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
 {
-    uint32                   PipeDscCount;
+    uint32                   PipeDscIdx;
     uint32                   PipeStatCount;
     CFE_SB_PipeD_t *         PipeDscPtr;
     CFE_SB_PipeDepthStats_t *PipeStatPtr;
@@ -530,13 +581,13 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
     CFE_SB_LockSharedData(__FILE__, __LINE__);
 
     /* Collect data on pipes */
-    PipeDscCount  = CFE_PLATFORM_SB_MAX_PIPES;
+    PipeDscIdx    = 0;
     PipeStatCount = CFE_MISSION_SB_MAX_PIPES;
-    PipeDscPtr    = CFE_SB_Global.PipeTbl;
     PipeStatPtr   = CFE_SB_Global.StatTlmMsg.Payload.PipeDepthStats;
 
-    while (PipeDscCount > 0 && PipeStatCount > 0)
+    while (PipeDscIdx < CFE_SB_Global.PipeTblCapacity && PipeStatCount > 0)
     {
+        PipeDscPtr = CFE_SB_PipeDescByIndex(PipeDscIdx);
         if (CFE_SB_PipeDescIsUsed(PipeDscPtr))
         {
             PipeStatPtr->PipeId = PipeDscPtr->PipeId;
@@ -550,8 +601,7 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
             --PipeStatCount;
         }
 
-        --PipeDscCount;
-        ++PipeDscPtr;
+        ++PipeDscIdx;
     }
 
     CFE_SB_UnlockSharedData(__FILE__, __LINE__);
@@ -574,6 +624,123 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_SendAppUsageCmd(const CFE_SB_SendAppUsageCmd_t *data)
+{
+    uint32                i;
+    uint32                j;
+    CFE_SB_AppUsageD_t *  UsagePtr;
+    CFE_SB_AppBufUsage_t *TlmPtr;
+
+    UsagePtr = CFE_SB_Global.AppUsage;
+    TlmPtr   = CFE_SB_Global.AppUsageTlmMsg.Payload.AppUsage;
+
+    CFE_SB_LockSharedData(__FILE__, __LINE__);
+
+    /* Collect data on each application with buffer memory attributed to it */
+    for (i = 0, j = 0; j < CFE_MISSION_ES_MAX_APPLICATIONS && i < CFE_PLATFORM_ES_MAX_APPLICATIONS; ++i)
+    {
+        if (CFE_RESOURCEID_TEST_DEFINED(UsagePtr[i].AppId))
+        {
+            TlmPtr[j].AppId           = UsagePtr[i].AppId;
+            TlmPtr[j].ZeroCopyBytes   = UsagePtr[i].ZeroCopyBytes;
+            TlmPtr[j].QueuedBytes     = UsagePtr[i].QueuedBytes;
+            TlmPtr[j].PeakBytesInUse  = UsagePtr[i].PeakBytes;
+            TlmPtr[j].QuotaBytes      = UsagePtr[i].QuotaBytes;
+            TlmPtr[j].QuotaErrorCount = UsagePtr[i].QuotaErrors;
+            TlmPtr[j].Spare           = 0;
+            ++j;
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__FILE__, __LINE__);
+
+    /* Clear unused entries */
+    for (; j < CFE_MISSION_ES_MAX_APPLICATIONS; ++j)
+    {
+        memset(&TlmPtr[j], 0, sizeof(TlmPtr[j]));
+    }
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_SB_Global.AppUsageTlmMsg.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_SB_Global.AppUsageTlmMsg.TelemetryHeader), true);
+
+    CFE_EVS_SendEvent(CFE_SB_SND_APP_USAGE_EID, CFE_EVS_EventType_DEBUG, "Software Bus App Usage packet sent");
+
+    CFE_SB_Global.HKTlmMsg.Payload.CommandCounter++;
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_SetAppQuotaCmd(const CFE_SB_SetAppQuotaCmd_t *data)
+{
+    const CFE_SB_SetAppQuotaCmd_Payload_t *CmdPtr;
+    CFE_SB_AppUsageD_t *                   UsagePtr;
+    CFE_ES_AppId_t                         AppId;
+    char                                   LocalName[OS_MAX_API_NAME];
+    int32                                  Status;
+
+    CmdPtr   = &data->Payload;
+    UsagePtr = NULL;
+
+    /* Copy appname from command, ensures NULL termination */
+    CFE_SB_MessageStringGet(LocalName, CmdPtr->Application, NULL, sizeof(LocalName), sizeof(CmdPtr->Application));
+
+    Status = CFE_ES_GetAppIDByName(&AppId, LocalName);
+    if (Status == CFE_SUCCESS)
+    {
+        UsagePtr = CFE_SB_LocateAppUsageByID(AppId);
+    }
+
+    if (UsagePtr == NULL)
+    {
+        CFE_EVS_SendEvent(CFE_SB_SET_APP_QUOTA_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set App Quota Cmd:App %s not found", LocalName);
+        CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter++;
+        return CFE_SUCCESS;
+    }
+
+    if (CmdPtr->QuotaBytes > CFE_PLATFORM_SB_BUF_MEMORY_BYTES)
+    {
+        CFE_EVS_SendEvent(CFE_SB_SET_APP_QUOTA_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set App Quota Cmd:Quota %lu exceeds pool size %lu,App %s",
+                          (unsigned long)CmdPtr->QuotaBytes, (unsigned long)CFE_PLATFORM_SB_BUF_MEMORY_BYTES,
+                          LocalName);
+        CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter++;
+        return CFE_SUCCESS;
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    if (!CFE_RESOURCEID_TEST_EQUAL(UsagePtr->AppId, AppId))
+    {
+        memset(UsagePtr, 0, sizeof(*UsagePtr));
+        UsagePtr->AppId = AppId;
+    }
+
+    /* Lowering the quota below current usage does not discard anything, it only blocks new charges */
+    UsagePtr->QuotaBytes = CmdPtr->QuotaBytes;
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    CFE_EVS_SendEvent(CFE_SB_SET_APP_QUOTA_EID, CFE_EVS_EventType_INFORMATION, "App %s buffer quota set to %lu bytes",
+                      LocalName, (unsigned long)CmdPtr->QuotaBytes);
+
+    CFE_SB_Global.HKTlmMsg.Payload.CommandCounter++;
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -836,6 +1003,7 @@ bool CFE_SB_WritePipeInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer,
     CFE_SB_BackgroundFileStateInfo_t *BgFilePtr;
     CFE_SB_PipeInfoEntry_t *          PipeBufferPtr;
     CFE_SB_PipeD_t *                  PipeDscPtr;
+    CFE_SB_AppUsageD_t *              UsagePtr;
     osal_id_t                         SysQueueId = OS_OBJECT_ID_UNDEFINED;
     bool                              PipeIsValid;
 
@@ -845,9 +1013,9 @@ bool CFE_SB_WritePipeInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer,
 
     PipeBufferPtr = &BgFilePtr->Buffer.PipeInfo;
 
-    if (RecordNum < CFE_PLATFORM_SB_MAX_PIPES)
+    if (RecordNum < CFE_SB_Global.PipeTblCapacity)
     {
-        PipeDscPtr = &CFE_SB_Global.PipeTbl[RecordNum];
+        PipeDscPtr = CFE_SB_PipeDescByIndex(RecordNum);
 
         CFE_SB_LockSharedData(__FILE__, __LINE__);
 
@@ -872,6 +1040,19 @@ bool CFE_SB_WritePipeInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer,
             PipeBufferPtr->MaxQueueDepth     = PipeDscPtr->MaxQueueDepth;
             PipeBufferPtr->CurrentQueueDepth = PipeDscPtr->CurrentQueueDepth;
             PipeBufferPtr->PeakQueueDepth    = PipeDscPtr->PeakQueueDepth;
+            PipeBufferPtr->QueuedBytes       = PipeDscPtr->QueuedBytes;
+
+            /* copy the owning app's usage, which spans all of its pipes and zero copy buffers */
+            UsagePtr = CFE_SB_LocateAppUsageByID(PipeDscPtr->AppId);
+            if (UsagePtr != NULL && CFE_RESOURCEID_TEST_EQUAL(UsagePtr->AppId, PipeDscPtr->AppId))
+            {
+                PipeBufferPtr->AppBytesInUse = UsagePtr->ZeroCopyBytes + UsagePtr->QueuedBytes;
+                PipeBufferPtr->AppQuotaBytes = UsagePtr->QuotaBytes;
+            }
+            else
+            {
+                PipeBufferPtr->AppQuotaBytes = CFE_PLATFORM_SB_DEFAULT_APP_BUF_QUOTA;
+            }
 
             SysQueueId = PipeDscPtr->SysQueueId;
         }
@@ -900,7 +1081,7 @@ bool CFE_SB_WritePipeInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer,
     }
 
     /* Check for EOF (last entry)  */
-    return (RecordNum >= (CFE_PLATFORM_SB_MAX_PIPES - 1));
+    return (RecordNum >= (CFE_SB_Global.PipeTblCapacity - 1));
 }
 
 /*----------------------------------------------------------------
@@ -44,6 +44,22 @@
 #error CFE_PLATFORM_SB_MAX_PIPES cannot be greater than OS_MAX_QUEUES!
 #endif
 
+#if CFE_PLATFORM_SB_INITIAL_MSG_IDS < 1
+#error CFE_PLATFORM_SB_INITIAL_MSG_IDS cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_INITIAL_MSG_IDS > CFE_PLATFORM_SB_MAX_MSG_IDS
+#error CFE_PLATFORM_SB_INITIAL_MSG_IDS cannot be greater than CFE_PLATFORM_SB_MAX_MSG_IDS!
+#endif
+
+#if CFE_PLATFORM_SB_INITIAL_PIPES < 1
+#error CFE_PLATFORM_SB_INITIAL_PIPES cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_INITIAL_PIPES > CFE_PLATFORM_SB_MAX_PIPES
+#error CFE_PLATFORM_SB_INITIAL_PIPES cannot be greater than CFE_PLATFORM_SB_MAX_PIPES!
+#endif
+
 #if CFE_PLATFORM_SB_MAX_DEST_PER_PKT < 1
 #error CFE_PLATFORM_SB_MAX_DEST_PER_PKT cannot be less than 1!
 #endif
@@ -64,6 +80,26 @@
 #error CFE_PLATFORM_SB_BUF_MEMORY_BYTES cannot be greater than UINT32_MAX (4 Gigabytes)!
 #endif
 
+#if CFE_PLATFORM_SB_DEFAULT_APP_BUF_QUOTA > CFE_PLATFORM_SB_BUF_MEMORY_BYTES
+#error CFE_PLATFORM_SB_DEFAULT_APP_BUF_QUOTA cannot be greater than CFE_PLATFORM_SB_BUF_MEMORY_BYTES!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_MSG_SEGMENTS < 0
+#error CFE_PLATFORM_SB_MAX_MSG_SEGMENTS cannot be negative!
+#elif (CFE_MISSION_SB_MAX_SB_MSG_SIZE * (CFE_PLATFORM_SB_MAX_MSG_SEGMENTS + 1)) > CFE_PLATFORM_SB_BUF_MEMORY_BYTES
+#error CFE_PLATFORM_SB_MAX_MSG_SEGMENTS allows chained messages larger than CFE_PLATFORM_SB_BUF_MEMORY_BYTES!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS < 1
+#error CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS cannot be less than 1!
+#elif CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS > 65535
+#error CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS cannot be greater than 65535!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_ERR_AGGREGATES < 1
+#error CFE_PLATFORM_SB_MAX_ERR_AGGREGATES cannot be less than 1!
+#endif
+
 /*
  * Legacy time formats no longer supported in core cFE, this will pass
  * if default is selected or if both defines are removed
@@ -102,6 +102,10 @@ const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_ENABLE_ROUTE_CC =
     { SB_UT_CC_DISPATCH(CMD,CFE_SB_ENABLE_ROUTE_CC,EnableRouteCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_DISABLE_ROUTE_CC =
     { SB_UT_CC_DISPATCH(CMD,CFE_SB_DISABLE_ROUTE_CC,DisableRouteCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_SEND_APP_USAGE_CC =
+    { SB_UT_CC_DISPATCH(CMD,CFE_SB_SEND_APP_USAGE_CC,SendAppUsageCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_SET_APP_QUOTA_CC =
+    { SB_UT_CC_DISPATCH(CMD,CFE_SB_SET_APP_QUOTA_CC,SetAppQuotaCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_SEND_HK =
     { SB_UT_MSG_DISPATCH(SEND_HK,SendHkCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_SUB_RPT_CTL_SEND_PREV_SUBS_CC =
@@ -494,6 +498,8 @@ void Test_SB_Cmds(void)
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_DisRouteInvParam3);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_SendHK);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_SendPrevSubs);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_AppUsage);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_SetAppQuota);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_SubRptOn);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_SubRptOff);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_CmdUnexpCmdCode);
@@ -837,6 +843,14 @@ void Test_SB_Cmds_PipeInfoDataGetter(void)
     UtAssert_BOOL_FALSE(CFE_SB_WritePipeInfoDataGetter(&State, 1, &LocalBuffer, &LocalBufSize));
     UtAssert_NOT_NULL(LocalBuffer);
     UtAssert_NONZERO(LocalBufSize);
+    UtAssert_UINT32_EQ(State.Buffer.PipeInfo.AppQuotaBytes, CFE_PLATFORM_SB_DEFAULT_APP_BUF_QUOTA);
+    UtAssert_ZERO(State.Buffer.PipeInfo.AppBytesInUse);
+
+    /* Usage attributed to the owning app should be reported with each of its pipes */
+    UtAssert_BOOL_TRUE(CFE_SB_ChargeAppUsage(CFE_SB_Global.PipeTbl[2].AppId, 100, true));
+    UtAssert_BOOL_FALSE(CFE_SB_WritePipeInfoDataGetter(&State, 2, &LocalBuffer, &LocalBufSize));
+    UtAssert_UINT32_EQ(State.Buffer.PipeInfo.AppBytesInUse, 100);
+    UtAssert_UINT32_EQ(State.Buffer.PipeInfo.AppQuotaBytes, CFE_PLATFORM_SB_DEFAULT_APP_BUF_QUOTA);
 
     UtAssert_BOOL_TRUE(
         CFE_SB_WritePipeInfoDataGetter(&State, CFE_PLATFORM_SB_MAX_PIPES - 1, &LocalBuffer, &LocalBufSize));
@@ -1458,6 +1472,125 @@ void Test_SB_Cmds_SendPrevSubs(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId2));
 }
 
+/*
+** Test send application buffer usage command
+*/
+void Test_SB_Cmds_AppUsage(void)
+{
+    union
+    {
+        CFE_SB_Buffer_t          SBBuf;
+        CFE_SB_SendAppUsageCmd_t Cmd;
+    } SendAppUsage;
+    CFE_SB_MsgId_t  MsgId;
+    CFE_MSG_Size_t  Size;
+    CFE_ES_AppId_t  AppId;
+    CFE_SB_PipeId_t PipeId = CFE_SB_INVALID_PIPE;
+
+    memset(&SendAppUsage, 0, sizeof(SendAppUsage));
+
+    /* Make the usage table non-empty so the command reports something */
+    CFE_ES_GetAppID(&AppId);
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "TestPipe1"));
+    UtAssert_NOT_NULL(CFE_SB_AllocateMessageBuffer(10));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    /* Put stale data in the tail of the packet to confirm it gets cleared */
+    CFE_SB_Global.AppUsageTlmMsg.Payload.AppUsage[1].QuotaBytes = 1;
+
+    /* For internal TransmitMsg call */
+    MsgId = CFE_SB_ValueToMsgId(CFE_SB_APP_USAGE_TLM_MID);
+    Size  = sizeof(CFE_SB_Global.AppUsageTlmMsg);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(SendAppUsage.SBBuf), sizeof(SendAppUsage.Cmd),
+                    UT_TPID_CFE_SB_CMD_SEND_APP_USAGE_CC);
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_SND_APP_USAGE_EID);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandCounter, 1);
+    CFE_UtAssert_RESOURCEID_EQ(CFE_SB_Global.AppUsageTlmMsg.Payload.AppUsage[0].AppId, AppId);
+    UtAssert_NONZERO(CFE_SB_Global.AppUsageTlmMsg.Payload.AppUsage[0].ZeroCopyBytes);
+    UtAssert_UINT32_EQ(CFE_SB_Global.AppUsageTlmMsg.Payload.AppUsage[0].QuotaBytes,
+                       CFE_PLATFORM_SB_DEFAULT_APP_BUF_QUOTA);
+    UtAssert_ZERO(CFE_SB_Global.AppUsageTlmMsg.Payload.AppUsage[1].QuotaBytes);
+
+    /* Bad Size */
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(SendAppUsage.SBBuf), 0,
+                    UT_TPID_CFE_SB_CMD_SEND_APP_USAGE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_LEN_ERR_EID);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test set application buffer quota command
+*/
+void Test_SB_Cmds_SetAppQuota(void)
+{
+    union
+    {
+        CFE_SB_Buffer_t         SBBuf;
+        CFE_SB_SetAppQuotaCmd_t Cmd;
+    } SetAppQuota;
+    CFE_ES_AppId_t      AppId;
+    CFE_SB_AppUsageD_t *UsagePtr;
+
+    memset(&SetAppQuota, 0, sizeof(SetAppQuota));
+    strncpy(SetAppQuota.Cmd.Payload.Application, "UT_App", sizeof(SetAppQuota.Cmd.Payload.Application) - 1);
+
+    CFE_ES_GetAppID(&AppId);
+    UsagePtr = CFE_SB_LocateAppUsageByID(AppId);
+    UtAssert_NOT_NULL(UsagePtr);
+
+    /* Nominal, creates the usage entry if it did not exist */
+    SetAppQuota.Cmd.Payload.QuotaBytes = 1000;
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(SetAppQuota.SBBuf), sizeof(SetAppQuota.Cmd),
+                    UT_TPID_CFE_SB_CMD_SET_APP_QUOTA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SET_APP_QUOTA_EID);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandCounter, 1);
+    CFE_UtAssert_RESOURCEID_EQ(UsagePtr->AppId, AppId);
+    UtAssert_UINT32_EQ(UsagePtr->QuotaBytes, 1000);
+
+    /* Nominal, existing entry keeps its usage */
+    UsagePtr->QueuedBytes              = 500;
+    SetAppQuota.Cmd.Payload.QuotaBytes = 0;
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(SetAppQuota.SBBuf), sizeof(SetAppQuota.Cmd),
+                    UT_TPID_CFE_SB_CMD_SET_APP_QUOTA_CC);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandCounter, 2);
+    UtAssert_ZERO(UsagePtr->QuotaBytes);
+    UtAssert_UINT32_EQ(UsagePtr->QueuedBytes, 500);
+
+    /* Quota larger than the entire pool */
+    UT_ClearEventHistory();
+    SetAppQuota.Cmd.Payload.QuotaBytes = CFE_PLATFORM_SB_BUF_MEMORY_BYTES + 1;
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(SetAppQuota.SBBuf), sizeof(SetAppQuota.Cmd),
+                    UT_TPID_CFE_SB_CMD_SET_APP_QUOTA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SET_APP_QUOTA_ERR_EID);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter, 1);
+    UtAssert_ZERO(UsagePtr->QuotaBytes);
+
+    /* Application not found */
+    UT_ClearEventHistory();
+    SetAppQuota.Cmd.Payload.QuotaBytes = 1000;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppIDByName), 1, CFE_ES_ERR_NAME_NOT_FOUND);
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(SetAppQuota.SBBuf), sizeof(SetAppQuota.Cmd),
+                    UT_TPID_CFE_SB_CMD_SET_APP_QUOTA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SET_APP_QUOTA_ERR_EID);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter, 2);
+
+    /* App ID that does not map to a table index */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_AppID_ToIndex), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(SetAppQuota.SBBuf), sizeof(SetAppQuota.Cmd),
+                    UT_TPID_CFE_SB_CMD_SET_APP_QUOTA_CC);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter, 3);
+    UtAssert_ZERO(UsagePtr->QuotaBytes);
+
+    /* Bad Size */
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(SetAppQuota.SBBuf), 0, UT_TPID_CFE_SB_CMD_SET_APP_QUOTA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_LEN_ERR_EID);
+}
+
 /*
 ** Test command to enable subscription reporting
 */
@@ -1569,6 +1702,7 @@ void Test_SB_Cmds_UnexpMsgId(void)
 void Test_SB_EarlyInit(void)
 {
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_SemCreateError);
+    SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_ErrAggSemCreateError);
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_PoolCreateError);
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_NoErrors);
 }
@@ -1582,6 +1716,15 @@ void Test_SB_EarlyInit_SemCreateError(void)
     UtAssert_INT32_EQ(CFE_SB_EarlyInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
 }
 
+/*
+** Test early initialization response to an error aggregation semaphore create failure
+*/
+void Test_SB_EarlyInit_ErrAggSemCreateError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 2, OS_ERR_NO_FREE_IDS);
+    UtAssert_INT32_EQ(CFE_SB_EarlyInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+}
+
 /*
 ** Test early initialization response to a pool create ex failure
 */
@@ -1635,6 +1778,7 @@ void Test_CreatePipe_API(void)
     SB_UT_ADD_SUBTEST(Test_CreatePipe_ValPipeDepth);
     SB_UT_ADD_SUBTEST(Test_CreatePipe_InvalPipeDepth);
     SB_UT_ADD_SUBTEST(Test_CreatePipe_MaxPipes);
+    SB_UT_ADD_SUBTEST(Test_CreatePipe_GrowTable);
     SB_UT_ADD_SUBTEST(Test_CreatePipe_SamePipeName);
     SB_UT_ADD_SUBTEST(Test_CreatePipe_EmptyPipeName);
     SB_UT_ADD_SUBTEST(Test_CreatePipe_PipeName_NullPtr);
@@ -1716,9 +1860,9 @@ void Test_CreatePipe_MaxPipes(void)
     UT_ClearEventHistory();
 
     /* Create maximum number of pipes + 1. Only one 'create pipe' failure
-     * expected
+     * expected.  Each extension of the pipe table looks up the new ID once more.
      */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ResourceId_ToIndex), 1 + CFE_PLATFORM_SB_MAX_PIPES, -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ResourceId_ToIndex), CFE_SB_PIPE_TBL_CHUNKS + CFE_PLATFORM_SB_MAX_PIPES, -1);
     for (i = 0; i < (CFE_PLATFORM_SB_MAX_PIPES + 1); i++)
     {
         snprintf(PipeName, sizeof(PipeName), "TestPipe%ld", (long)i);
@@ -1759,6 +1903,67 @@ void Test_CreatePipe_MaxPipes(void)
     UtAssert_BOOL_TRUE(CFE_SB_CheckPipeDescSlotUsed(UT_SB_MakePipeIdForIndex(1)));
 }
 
+/*
+** Test pipe table extension helpers
+*/
+void Test_CreatePipe_GrowTable(void)
+{
+    CFE_SB_PipeD_t *PipeDscPtr;
+    uint8 *         ExtPtr;
+
+    /* The table starts with its initial block, entries beyond it cannot be located */
+    UtAssert_UINT32_EQ(CFE_SB_Global.PipeTblCapacity, CFE_PLATFORM_SB_INITIAL_PIPES);
+    UtAssert_UINT32_LT(CFE_SB_Global.PipeTblCapacity, CFE_PLATFORM_SB_MAX_PIPES);
+    UtAssert_NOT_NULL(CFE_SB_LocatePipeDescByID(CFE_SB_PIPEID_C(UT_SB_MakePipeIdForIndex(0))));
+    UtAssert_NULL(CFE_SB_LocatePipeDescByID(CFE_SB_PIPEID_C(UT_SB_MakePipeIdForIndex(CFE_PLATFORM_SB_INITIAL_PIPES))));
+    UtAssert_BOOL_TRUE(CFE_SB_CheckPipeDescSlotUsed(UT_SB_MakePipeIdForIndex(CFE_PLATFORM_SB_INITIAL_PIPES)));
+
+    /* Pool failure leaves the table as it was */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_SB_GrowPipeTbl(), CFE_SB_BUF_ALOC_ERR);
+    UtAssert_UINT32_EQ(CFE_SB_Global.PipeTblCapacity, CFE_PLATFORM_SB_INITIAL_PIPES);
+
+    /* Grow block by block up to the maximum */
+    CFE_SB_Global.StatTlmMsg.Payload.MemInUse = 0;
+    CFE_UtAssert_SUCCESS(CFE_SB_GrowPipeTbl());
+    UtAssert_UINT32_EQ(CFE_SB_Global.PipeTblCapacity, 2 * CFE_PLATFORM_SB_INITIAL_PIPES);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse,
+                       sizeof(CFE_SB_PipeD_t) * CFE_PLATFORM_SB_INITIAL_PIPES);
+    while (CFE_SB_Global.PipeTblCapacity < CFE_PLATFORM_SB_MAX_PIPES)
+    {
+        CFE_UtAssert_SUCCESS(CFE_SB_GrowPipeTbl());
+    }
+    UtAssert_UINT32_EQ(CFE_SB_Global.PipeTblCapacity, CFE_PLATFORM_SB_MAX_PIPES);
+    UtAssert_INT32_EQ(CFE_SB_GrowPipeTbl(), CFE_SB_MAX_PIPES_MET);
+    UtAssert_UINT32_EQ(CFE_SB_Global.PipeTblCapacity, CFE_PLATFORM_SB_MAX_PIPES);
+
+    /* Entries in the extension blocks can be located, and start out unused */
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(CFE_SB_PIPEID_C(UT_SB_MakePipeIdForIndex(CFE_PLATFORM_SB_MAX_PIPES - 1)));
+    UtAssert_NOT_NULL(PipeDscPtr);
+    UtAssert_ADDRESS_EQ(PipeDscPtr, CFE_SB_PipeDescByIndex(CFE_PLATFORM_SB_MAX_PIPES - 1));
+    UtAssert_BOOL_FALSE(CFE_SB_PipeDescIsUsed(PipeDscPtr));
+    UtAssert_BOOL_FALSE(CFE_SB_CheckPipeDescSlotUsed(UT_SB_MakePipeIdForIndex(CFE_PLATFORM_SB_MAX_PIPES - 1)));
+    UtAssert_NOT_NULL(CFE_SB_Global.PipeTblChunks[CFE_SB_PIPE_TBL_CHUNKS - 1]);
+
+    /* Extension blocks come zero filled from the pool and are counted as in use */
+    CFE_SB_Global.StatTlmMsg.Payload.MemInUse     = 0;
+    CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = 0;
+    CFE_SB_Global.HKTlmMsg.Payload.TableMemInUse  = 0;
+    ExtPtr                                        = CFE_SB_GetTableExtensionBlk(16);
+    UtAssert_NOT_NULL(ExtPtr);
+    UtAssert_ZERO(ExtPtr[0]);
+    UtAssert_ZERO(ExtPtr[15]);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, 16);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse, 16);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.TableMemInUse, 16);
+
+    /* Pool failure */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_NULL(CFE_SB_GetTableExtensionBlk(16));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, 16);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.TableMemInUse, 16);
+}
+
 /*
 ** Test create pipe response to duplicate pipe names
 */
@@ -3348,6 +3553,13 @@ void Test_MessageTxn_GetEventDetails(void)
     UtAssert_NOT_NULL(memchr(EvtMsg, 0, sizeof(EvtMsg)));
     UtAssert_UINT32_EQ(EvReqBit, CFE_SB_Q_FULL_ERR_EID_BIT);
 
+    memset(EvtMsg, 0xAA, sizeof(EvtMsg));
+    UtAssert_VOIDCALL(CFE_SB_MessageTxn_GetEventDetails(&Txn, &Entry, CFE_SB_APP_QUOTA_ERR_EID, MyTskId, EvtMsg,
+                                                        sizeof(EvtMsg), &EvType, &EvReqBit));
+    UtAssert_NONZERO(EvtMsg[0]);
+    UtAssert_NOT_NULL(memchr(EvtMsg, 0, sizeof(EvtMsg)));
+    UtAssert_UINT32_EQ(EvReqBit, CFE_SB_APP_QUOTA_ERR_EID_BIT);
+
     memset(EvtMsg, 0xAA, sizeof(EvtMsg));
     UtAssert_VOIDCALL(CFE_SB_MessageTxn_GetEventDetails(&Txn, NULL, CFE_SB_Q_WR_ERR_EID, MyTskId, EvtMsg,
                                                         sizeof(EvtMsg), &EvType, &EvReqBit));
@@ -3459,9 +3671,13 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_QueuePutError);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_PipeFull);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_MsgLimitExceeded);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsg_AppQuotaExceeded);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsg_ErrorAggregation);
+    SB_UT_ADD_SUBTEST(Test_AggregateTransmitError);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_GetPoolBufErr);
     SB_UT_ADD_SUBTEST(Test_TransmitBuffer_IncrementSeqCnt);
     SB_UT_ADD_SUBTEST(Test_TransmitBuffer_NoIncrement);
+    SB_UT_ADD_SUBTEST(Test_TransmitBuffer_Chained);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_ZeroCopyBufferValidate);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_DisabledDestination);
 
@@ -3478,6 +3694,9 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_TransmitTxn_Execute);
 
     SB_UT_ADD_SUBTEST(Test_AllocateMessageBuffer);
+    SB_UT_ADD_SUBTEST(Test_AllocateMessageBuffer_Quota);
+    SB_UT_ADD_SUBTEST(Test_AllocateChainedMessageBuffer);
+    SB_UT_ADD_SUBTEST(Test_GetMessageSegment);
     SB_UT_ADD_SUBTEST(Test_ReleaseMessageBuffer);
 }
 
@@ -3693,6 +3912,101 @@ void Test_TransmitMsg_QueuePutError(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId4Error));
 }
 
+/*
+** Test that repeated pipe overflows are reported once and then summarized
+*/
+void Test_TransmitMsg_ErrorAggregation(void)
+{
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t   MsgId  = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    int32            PipeDepth = 1;
+    CFE_MSG_Size_t   Size      = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type      = CFE_MSG_Type_Tlm;
+    uint32           i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "AggTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    /* Three overflows in a row - only the first is reported individually */
+    for (i = 0; i < 3; ++i)
+    {
+        UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+        CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    }
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_FULL_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 3);
+    UtAssert_UINT32_EQ(CFE_SB_Global.ErrAgg[0].EventId, CFE_SB_Q_FULL_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.ErrAgg[0].Count, 2);
+
+    /* The summary reports the suppressed repeats and starts a new period */
+    UT_ClearEventHistory();
+    UtAssert_VOIDCALL(CFE_SB_ReportAggregatedErrors());
+    CFE_UtAssert_EVENTCOUNT(1);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SND_ERR_SUMMARY_EID);
+    UtAssert_ZERO(CFE_SB_Global.ErrAgg[0].EventId);
+
+    /* Nothing further to summarize */
+    UT_ClearEventHistory();
+    UtAssert_VOIDCALL(CFE_SB_ReportAggregatedErrors());
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* First overflow of the new period is reported individually again */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_FULL_ERR_EID);
+    UtAssert_ZERO(CFE_SB_Global.ErrAgg[0].Count);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test aggregation of transmit errors when the aggregation table is full
+*/
+void Test_AggregateTransmitError(void)
+{
+    uint32 i;
+
+    /* Errors that are not per-destination are never aggregated */
+    UtAssert_BOOL_TRUE(CFE_SB_AggregateTransmitError(SB_UT_PIPEID_1, SB_UT_TLM_MID, CFE_SB_MSG_TOO_BIG_EID));
+    UtAssert_BOOL_TRUE(CFE_SB_AggregateTransmitError(SB_UT_PIPEID_1, SB_UT_TLM_MID, CFE_SB_SEND_NO_SUBS_EID));
+
+    /* Distinct pipe, MsgId and EventId combinations each use an entry */
+    UtAssert_BOOL_TRUE(CFE_SB_AggregateTransmitError(SB_UT_PIPEID_1, SB_UT_TLM_MID, CFE_SB_MSGID_LIM_ERR_EID));
+    UtAssert_BOOL_TRUE(CFE_SB_AggregateTransmitError(SB_UT_PIPEID_1, SB_UT_TLM_MID, CFE_SB_APP_QUOTA_ERR_EID));
+    UtAssert_BOOL_TRUE(CFE_SB_AggregateTransmitError(SB_UT_PIPEID_1, SB_UT_CMD_MID, CFE_SB_APP_QUOTA_ERR_EID));
+    UtAssert_BOOL_TRUE(CFE_SB_AggregateTransmitError(SB_UT_PIPEID_2, SB_UT_TLM_MID, CFE_SB_Q_WR_ERR_EID));
+    UtAssert_BOOL_FALSE(CFE_SB_AggregateTransmitError(SB_UT_PIPEID_2, SB_UT_TLM_MID, CFE_SB_Q_WR_ERR_EID));
+
+    /* Fill the rest of the table */
+    for (i = 4; i < CFE_PLATFORM_SB_MAX_ERR_AGGREGATES; ++i)
+    {
+        CFE_SB_Global.ErrAgg[i].EventId = CFE_SB_Q_FULL_ERR_EID;
+        CFE_SB_Global.ErrAgg[i].PipeId  = SB_UT_PIPEID_3;
+    }
+
+    /* New errors which do not fit are only counted */
+    UtAssert_BOOL_FALSE(CFE_SB_AggregateTransmitError(SB_UT_PIPEID_1, SB_UT_TLM_MID, CFE_SB_Q_FULL_ERR_EID));
+    UtAssert_UINT32_EQ(CFE_SB_Global.ErrAggOverflow, 1);
+
+    /* One summary for the repeated write error, and one for the overflow */
+    UtAssert_VOIDCALL(CFE_SB_ReportAggregatedErrors());
+    CFE_UtAssert_EVENTCOUNT(2);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SND_ERR_SUMMARY_EID);
+    UtAssert_ZERO(CFE_SB_Global.ErrAggOverflow);
+    UtAssert_BOOL_TRUE(CFE_SB_AggregateTransmitError(SB_UT_PIPEID_1, SB_UT_TLM_MID, CFE_SB_Q_FULL_ERR_EID));
+}
+
 /*
 ** Test send message response when the socket queue is full
 */
@@ -3776,6 +4090,66 @@ void Test_TransmitMsg_MsgLimitExceeded(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test send message response to the pipe owner exceeding its buffer quota
+*/
+void Test_TransmitMsg_AppQuotaExceeded(void)
+{
+    CFE_SB_PipeId_t     PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t      MsgId  = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t    TlmPkt;
+    CFE_SB_Buffer_t *   SBBufPtr;
+    CFE_MSG_Size_t      Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t      Type = CFE_MSG_Type_Tlm;
+    CFE_SB_PipeD_t *    PipeDscPtr;
+    CFE_SB_AppUsageD_t *UsagePtr;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 5, "QuotaTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UsagePtr   = CFE_SB_LocateAppUsageByID(PipeDscPtr->AppId);
+    UtAssert_NOT_NULL(UsagePtr);
+
+    /* Restrict the owner to a quota smaller than any buffer */
+    UsagePtr->AppId      = PipeDscPtr->AppId;
+    UsagePtr->QuotaBytes = 1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+
+    /* This send should be dropped for the destination, but return success */
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_EVENTSENT(CFE_SB_APP_QUOTA_ERR_EID);
+    UtAssert_UINT32_EQ(UsagePtr->QuotaErrors, 1);
+    UtAssert_UINT16_EQ(PipeDscPtr->SendErrors, 1);
+    UtAssert_ZERO(PipeDscPtr->CurrentQueueDepth);
+    UtAssert_ZERO(PipeDscPtr->QueuedBytes);
+
+    /* With no quota the message is queued and charged to the owner */
+    UsagePtr->QuotaBytes = 0;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_UINT16_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+    UtAssert_NONZERO(PipeDscPtr->QueuedBytes);
+    UtAssert_UINT32_EQ(UsagePtr->QueuedBytes, PipeDscPtr->QueuedBytes);
+    UtAssert_UINT32_EQ(UsagePtr->PeakBytes, PipeDscPtr->QueuedBytes);
+
+    /* Receiving the message releases the charge */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_ZERO(PipeDscPtr->QueuedBytes);
+    UtAssert_ZERO(UsagePtr->QueuedBytes);
+    UtAssert_NONZERO(UsagePtr->PeakBytes);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
 /*
 ** Test send message response to a buffer descriptor allocation failure
 */
@@ -3863,6 +4237,153 @@ void Test_AllocateMessageBuffer(void)
     CFE_UtAssert_EVENTCOUNT(0);
 }
 
+/*
+** Test getting a pointer to a buffer for zero copy mode when the
+** calling app is at its buffer quota
+*/
+void Test_AllocateMessageBuffer_Quota(void)
+{
+    size_t              MsgSize = 10;
+    size_t              MemUse;
+    CFE_ES_AppId_t      AppId;
+    CFE_SB_AppUsageD_t *UsagePtr;
+    CFE_SB_Buffer_t *   BufPtr;
+
+    /* predict memory use for a given descriptor (this needs to match what impl does) */
+    MemUse = MsgSize + offsetof(CFE_SB_BufferD_t, Content);
+
+    CFE_ES_GetAppID(&AppId);
+    UsagePtr = CFE_SB_LocateAppUsageByID(AppId);
+    UtAssert_NOT_NULL(UsagePtr);
+
+    /* First allocation initializes the entry with the default quota */
+    BufPtr = CFE_SB_AllocateMessageBuffer(MsgSize);
+    UtAssert_NOT_NULL(BufPtr);
+    CFE_UtAssert_RESOURCEID_EQ(UsagePtr->AppId, AppId);
+    UtAssert_UINT32_EQ(UsagePtr->QuotaBytes, CFE_PLATFORM_SB_DEFAULT_APP_BUF_QUOTA);
+    UtAssert_UINT32_EQ(UsagePtr->ZeroCopyBytes, MemUse);
+
+    /* At quota, the next allocation is refused and the buffer is not leaked */
+    UsagePtr->QuotaBytes = MemUse;
+    UtAssert_NULL(CFE_SB_AllocateMessageBuffer(MsgSize));
+    UtAssert_UINT32_EQ(UsagePtr->QuotaErrors, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, MemUse);
+
+    /* Releasing the buffer makes room again */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(BufPtr));
+    UtAssert_ZERO(UsagePtr->ZeroCopyBytes);
+    UtAssert_UINT32_EQ(UsagePtr->PeakBytes, MemUse);
+    UtAssert_NOT_NULL(CFE_SB_AllocateMessageBuffer(MsgSize));
+
+    /* An app ID which does not map to an entry is never restricted */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_AppID_ToIndex), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_NOT_NULL(CFE_SB_AllocateMessageBuffer(MsgSize));
+    UtAssert_UINT32_EQ(UsagePtr->QuotaErrors, 1);
+
+    CFE_UtAssert_EVENTCOUNT(0);
+}
+
+/*
+** Test getting a chained buffer for zero copy mode, including
+** allocation failures
+*/
+void Test_AllocateChainedMessageBuffer(void)
+{
+    static union
+    {
+        CFE_ES_PoolAlign_t Align;
+        uint8              Bytes[6 * CFE_MISSION_SB_MAX_SB_MSG_SIZE];
+    } PoolBuf;
+
+    CFE_SB_Buffer_t *   BufPtr;
+    CFE_ES_AppId_t      AppId;
+    CFE_SB_AppUsageD_t *UsagePtr;
+    CFE_SB_BufferD_t *  BufDscPtr;
+    void *              SegPtr;
+    size_t              SegSize;
+    size_t              MsgSize;
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), &PoolBuf, sizeof(PoolBuf), false);
+
+    /* Attempt to allocate a message larger than the chain can hold */
+    UtAssert_NULL(CFE_SB_AllocateChainedMessageBuffer(CFE_SB_MAX_CHAINED_MSG_SIZE + 1));
+
+    /* Small messages are not chained */
+    BufPtr = CFE_SB_AllocateChainedMessageBuffer(10);
+    UtAssert_NOT_NULL(BufPtr);
+    UtAssert_INT32_EQ(CFE_SB_GetMessageSegment(BufPtr, 0, &SegPtr, &SegSize), CFE_SB_NO_MESSAGE);
+    UtAssert_NULL(SegPtr);
+    UtAssert_ZERO(SegSize);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(BufPtr));
+
+    /* Attempt to allocate a message buffer from a non-CFE context */
+    MsgSize = CFE_MISSION_SB_MAX_SB_MSG_SIZE + 100;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_NULL(CFE_SB_AllocateChainedMessageBuffer(MsgSize));
+
+    /* Failure to get a continuation segment must also give back the head */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 2, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_NULL(CFE_SB_AllocateChainedMessageBuffer(MsgSize));
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MemInUse);
+
+    /* The whole chain counts against the app quota */
+    CFE_ES_GetAppID(&AppId);
+    UsagePtr             = CFE_SB_LocateAppUsageByID(AppId);
+    UsagePtr->AppId      = AppId;
+    UsagePtr->QuotaBytes = CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1;
+    UtAssert_NULL(CFE_SB_AllocateChainedMessageBuffer(MsgSize));
+    UtAssert_UINT32_EQ(UsagePtr->QuotaErrors, 1);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MemInUse);
+    UsagePtr->QuotaBytes = 0;
+
+    /* Nominal, content beyond the head is split into segments */
+    MsgSize = (2 * CFE_MISSION_SB_MAX_SB_MSG_SIZE) + 100;
+    BufPtr  = CFE_SB_AllocateChainedMessageBuffer(MsgSize);
+    UtAssert_NOT_NULL(BufPtr);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 3);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_GetMessageSegment(BufPtr, 0, &SegPtr, &SegSize));
+    UtAssert_UINT32_EQ(SegSize, CFE_MISSION_SB_MAX_SB_MSG_SIZE);
+    UtAssert_ZERO(*(uint8 *)SegPtr);
+    CFE_UtAssert_SUCCESS(CFE_SB_GetMessageSegment(BufPtr, 1, &SegPtr, &SegSize));
+    UtAssert_UINT32_EQ(SegSize, 100);
+    UtAssert_INT32_EQ(CFE_SB_GetMessageSegment(BufPtr, 2, &SegPtr, &SegSize), CFE_SB_NO_MESSAGE);
+
+    BufDscPtr = (CFE_SB_BufferD_t *)((cpuaddr)BufPtr - offsetof(CFE_SB_BufferD_t, Content));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, BufDscPtr->AllocatedSize);
+    UtAssert_UINT32_EQ(UsagePtr->ZeroCopyBytes, BufDscPtr->AllocatedSize);
+    UtAssert_NONZERO(BufDscPtr->SegmentSize);
+
+    /* Releasing the head releases the segments */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(BufPtr));
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MemInUse);
+    UtAssert_ZERO(UsagePtr->ZeroCopyBytes);
+
+    CFE_UtAssert_EVENTCOUNT(0);
+}
+
+/*
+** Test getting a continuation segment with bad arguments
+*/
+void Test_GetMessageSegment(void)
+{
+    CFE_SB_Buffer_t *BufPtr;
+    void *           SegPtr;
+    size_t           SegSize;
+
+    BufPtr = CFE_SB_AllocateMessageBuffer(10);
+    UtAssert_NOT_NULL(BufPtr);
+
+    UtAssert_INT32_EQ(CFE_SB_GetMessageSegment(NULL, 0, &SegPtr, &SegSize), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_GetMessageSegment(BufPtr, 0, NULL, &SegSize), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_GetMessageSegment(BufPtr, 0, &SegPtr, NULL), CFE_SB_BAD_ARGUMENT);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(BufPtr));
+}
+
 void Test_TransmitMsg_ZeroCopyBufferValidate(void)
 {
     CFE_SB_Buffer_t * SendPtr;
@@ -3955,6 +4476,58 @@ void Test_TransmitBuffer_IncrementSeqCnt(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test sending a chained message in zero copy mode, the whole chain
+** should be delivered as a single reference
+*/
+void Test_TransmitBuffer_Chained(void)
+{
+    static union
+    {
+        CFE_ES_PoolAlign_t Align;
+        uint8              Bytes[2 * CFE_MISSION_SB_MAX_SB_MSG_SIZE];
+    } PoolBuf;
+
+    CFE_SB_Buffer_t *SendPtr    = NULL;
+    CFE_SB_Buffer_t *ReceivePtr = NULL;
+    CFE_SB_PipeId_t  PipeId     = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t   MsgId      = SB_UT_TLM_MID;
+    CFE_MSG_Size_t   Size       = sizeof(SB_UT_Test_Tlm_t);
+    CFE_MSG_Type_t   Type       = CFE_MSG_Type_Tlm;
+    void *           SegPtr;
+    size_t           SegSize;
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), &PoolBuf, sizeof(PoolBuf), false);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "ChainTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    SendPtr = CFE_SB_AllocateChainedMessageBuffer(CFE_MISSION_SB_MAX_SB_MSG_SIZE + 100);
+    UtAssert_NOT_NULL(SendPtr);
+
+    /* Mark the continuation content so it can be recognized by the receiver */
+    CFE_UtAssert_SETUP(CFE_SB_GetMessageSegment(SendPtr, 0, &SegPtr, &SegSize));
+    memset(SegPtr, 0xA5, SegSize);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBuffer(SendPtr, true));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_ADDRESS_EQ(SendPtr, ReceivePtr);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_GetMessageSegment(ReceivePtr, 0, &SegPtr, &SegSize));
+    UtAssert_UINT32_EQ(SegSize, 100);
+    UtAssert_UINT8_EQ(*(uint8 *)SegPtr, 0xA5);
+    UtAssert_INT32_EQ(CFE_SB_GetMessageSegment(ReceivePtr, 1, &SegPtr, &SegSize), CFE_SB_NO_MESSAGE);
+
+    /* Deleting the pipe drops the last reference, which frees the head and segment together */
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+}
+
 /*
 ** Test successfully sending a message in zero copy mode (telemetry source
 ** sequence count is unchanged)
@@ -4088,6 +4661,8 @@ void Test_ReceiveBuffer_API(void)
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PipeReadError);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PendForever);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidBufferPtr);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_HoldBuffers);
+    SB_UT_ADD_SUBTEST(Test_ReleaseReceivedBuffer);
 }
 
 static void SB_UT_PipeIdModifyHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
@@ -4356,12 +4931,17 @@ void Test_CleanupApp_API(void)
     UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
 
     /* Attempt again with a valid application ID */
+    UtAssert_NONZERO(CFE_SB_LocateAppUsageByID(AppID)->ZeroCopyBytes);
     CFE_SB_CleanUpApp(AppID);
 
     /* This should have freed 2 out of the 3 buffers -
      * the ones which were gotten by this app. */
     UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
 
+    /* The usage entry of the app should have been discarded */
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(CFE_SB_LocateAppUsageByID(AppID)->AppId));
+    UtAssert_NONZERO(CFE_SB_LocateAppUsageByID(AppID2)->ZeroCopyBytes);
+
     /* Clean up the second App */
     CFE_SB_CleanUpApp(AppID2);
 
@@ -4391,6 +4971,130 @@ void Test_ReceiveBuffer_InvalidBufferPtr(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test receiving several messages from a pipe in HOLDBUFFERS mode
+*/
+void Test_ReceiveBuffer_HoldBuffers(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_Buffer_t *HeldPtr[CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS];
+    CFE_SB_MsgId_t   MsgId  = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    SB_UT_Test_Tlm_t TlmPkt;
+    uint32           PipeDepth = CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS + 2;
+    CFE_MSG_Type_t   Type      = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size      = sizeof(TlmPkt);
+    CFE_SB_PipeD_t * PipeDscPtr;
+    CFE_ES_AppId_t   AppId;
+    uint32           i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_ES_GetAppID(&AppId);
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "HoldTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_SetPipeOpts(PipeId, CFE_SB_PIPEOPTS_HOLDBUFFERS));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    for (i = 0; i < PipeDepth; ++i)
+    {
+        CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    }
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+
+    /* Each received buffer is held, rather than released by the next receive */
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS; ++i)
+    {
+        CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&HeldPtr[i], PipeId, CFE_SB_POLL));
+        UtAssert_NOT_NULL(HeldPtr[i]);
+        UtAssert_NULL(PipeDscPtr->LastBuffer);
+    }
+
+    UtAssert_UINT32_EQ(PipeDscPtr->HeldCount, CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->HeldBuffers[0]->Content, HeldPtr[0]);
+    UtAssert_NONZERO(CFE_SB_LocateAppUsageByID(AppId)->QueuedBytes);
+
+    /* At the limit, the remaining messages stay on the queue */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_HOLD_LIMIT_MET);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 2);
+
+    /* Releasing one out of order allows one more to be received */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseReceivedBuffer(HeldPtr[1]));
+    UtAssert_NULL(PipeDscPtr->HeldBuffers[1]);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->HeldBuffers[1]->Content, SBBufPtr);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+
+    /* Clearing the option returns to releasing the previous buffer on the next receive */
+    CFE_UtAssert_SETUP(CFE_SB_SetPipeOpts(PipeId, 0));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBuffer->Content, SBBufPtr);
+    UtAssert_UINT32_EQ(PipeDscPtr->HeldCount, CFE_PLATFORM_SB_MAX_PIPE_HELD_BUFFERS);
+
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
+
+    /* Deleting the pipe releases everything still held */
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+    UtAssert_ZERO(CFE_SB_LocateAppUsageByID(AppId)->QueuedBytes);
+}
+
+/*
+** Test releasing buffers held from a pipe
+*/
+void Test_ReleaseReceivedBuffer(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_Buffer_t *ZeroCpyBufPtr;
+    CFE_SB_MsgId_t   MsgId  = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_ES_AppId_t   AppId;
+    CFE_ES_AppId_t   AppId2;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_ES_GetAppID(&AppId);
+    AppId2 = CFE_ES_APPID_C(CFE_ResourceId_FromInteger(2));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "HoldTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_SetPipeOpts(PipeId, CFE_SB_PIPEOPTS_HOLDBUFFERS));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_SETUP(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    ZeroCpyBufPtr = CFE_SB_AllocateMessageBuffer(sizeof(TlmPkt));
+    UtAssert_NOT_NULL(ZeroCpyBufPtr);
+
+    UtAssert_INT32_EQ(CFE_SB_ReleaseReceivedBuffer(NULL), CFE_SB_BAD_ARGUMENT);
+
+    /* A zero copy buffer that was never received is not held */
+    UtAssert_INT32_EQ(CFE_SB_ReleaseReceivedBuffer(ZeroCpyBufPtr), CFE_SB_BUFFER_INVALID);
+
+    /* Failure to get the caller app ID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, -1);
+    UtAssert_INT32_EQ(CFE_SB_ReleaseReceivedBuffer(SBBufPtr), -1);
+
+    /* Only the owner of the pipe may release it */
+    UT_SetAppID(AppId2);
+    UtAssert_INT32_EQ(CFE_SB_ReleaseReceivedBuffer(SBBufPtr), CFE_SB_BUFFER_INVALID);
+    UT_SetAppID(AppId);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseReceivedBuffer(SBBufPtr));
+    UtAssert_INT32_EQ(CFE_SB_ReleaseReceivedBuffer(SBBufPtr), CFE_SB_BUFFER_INVALID);
+    UtAssert_ZERO(CFE_SB_LocatePipeDescByID(PipeId)->HeldCount);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_ReleaseMessageBuffer(ZeroCpyBufPtr));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+}
+
 /*
 ** Test SB Utility APIs
 */
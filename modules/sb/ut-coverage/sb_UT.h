@@ -950,6 +950,38 @@ void Test_SB_Cmds_SendHK(void);
 ******************************************************************************/
 void Test_SB_Cmds_SendPrevSubs(void);
 
+/*****************************************************************************/
+/**
+** \brief Test send application buffer usage command
+**
+** \par Description
+**        This function tests the command to send the per-application
+**        buffer usage packet.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_AppUsage(void);
+
+/*****************************************************************************/
+/**
+** \brief Test set application buffer quota command
+**
+** \par Description
+**        This function tests the command to set the buffer quota of an
+**        application, including the error cases.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_SetAppQuota(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test command to enable subscription reporting
@@ -1076,6 +1108,23 @@ void Test_SB_EarlyInit(void);
 ******************************************************************************/
 void Test_SB_EarlyInit_SemCreateError(void);
 
+/*****************************************************************************/
+/**
+** \brief Test early initialization response to an error aggregation
+**        semaphore create failure
+**
+** \par Description
+**        This function tests the early initialization response to a failure
+**        to create the semaphore of the transmit error aggregation table.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_EarlyInit_ErrAggSemCreateError(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test early initialization response to a pool create ex failure
@@ -1259,6 +1308,22 @@ void Test_CreatePipe_SamePipeName(void);
 ******************************************************************************/
 void Test_CreatePipe_MaxPipes(void);
 
+/*****************************************************************************/
+/**
+** \brief Test pipe table extension helpers
+**
+** \par Description
+**        This function tests growing the pipe table and allocating
+**        table extension blocks from the SB memory pool.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CreatePipe_GrowTable(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB delete pipe API test functions
@@ -1899,6 +1964,38 @@ void Test_TransmitMsg_UpdateHeader(void);
 ******************************************************************************/
 void Test_TransmitMsg_QueuePutError(void);
 
+/*****************************************************************************/
+/**
+** \brief Test aggregation of repeated transmit errors
+**
+** \par Description
+**        This function tests that repeated pipe overflows for the same pipe
+**        and message ID are reported individually once, then summarized.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsg_ErrorAggregation(void);
+
+/*****************************************************************************/
+/**
+** \brief Test the transmit error aggregation table
+**
+** \par Description
+**        This function tests which errors are aggregated, and the summary
+**        when the aggregation table is full.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_AggregateTransmitError(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send message response when the socket queue is full
@@ -1931,6 +2028,23 @@ void Test_TransmitMsg_PipeFull(void);
 ******************************************************************************/
 void Test_TransmitMsg_MsgLimitExceeded(void);
 
+/*****************************************************************************/
+/**
+** \brief Test send message response to the pipe owner exceeding its buffer quota
+**
+** \par Description
+**        This function tests that a message is dropped for a destination whose
+**        owning application is over its buffer quota, and that the charge is
+**        released when the message is received.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsg_AppQuotaExceeded(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send message response to a buffer descriptor allocation failure
@@ -1964,6 +2078,54 @@ void Test_TransmitMsg_GetPoolBufErr(void);
 ******************************************************************************/
 void Test_AllocateMessageBuffer(void);
 
+/*****************************************************************************/
+/**
+** \brief Test getting a pointer to a buffer for zero copy mode when the
+**        calling application is at its buffer quota
+**
+** \par Description
+**        This function tests the buffer quota enforcement on zero copy
+**        buffer allocation.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_AllocateMessageBuffer_Quota(void);
+
+/*****************************************************************************/
+/**
+** \brief Test getting a chained buffer for zero copy mode
+**
+** \par Description
+**        This function tests allocation of chained message buffers,
+**        including segment allocation and quota failures.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_AllocateChainedMessageBuffer(void);
+
+/*****************************************************************************/
+/**
+** \brief Test getting a continuation segment with bad arguments
+**
+** \par Description
+**        This function tests the argument checks of CFE_SB_GetMessageSegment.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_GetMessageSegment(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test successfully sending a message in zero copy mode (telemetry
@@ -2013,6 +2175,22 @@ void Test_TransmitMsg_ZeroCopyBufferValidate(void);
 ******************************************************************************/
 void Test_TransmitBuffer_NoIncrement(void);
 
+/*****************************************************************************/
+/**
+** \brief Test sending a chained message in zero copy mode
+**
+** \par Description
+**        This function tests that a chained message is routed and delivered
+**        as a single reference, and freed along with all of its segments.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitBuffer_Chained(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test releasing a pointer to a buffer for zero copy mode
@@ -2221,6 +2399,39 @@ void Test_ReceiveBuffer_PendForever(void);
 ******************************************************************************/
 void Test_ReceiveBuffer_InvalidBufferPtr(void);
 
+/*****************************************************************************/
+/**
+** \brief Test receiving messages from a pipe in HOLDBUFFERS mode
+**
+** \par Description
+**        This function tests that buffers received from a pipe with the
+**        HOLDBUFFERS option are held until released, that the per-pipe hold
+**        limit is enforced, and that held buffers are released with the pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffer_HoldBuffers(void);
+
+/*****************************************************************************/
+/**
+** \brief Test releasing buffers held from a pipe
+**
+** \par Description
+**        This function tests the CFE_SB_ReleaseReceivedBuffer API, including
+**        buffers that are not held and buffers held by another application.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReleaseReceivedBuffer(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test releasing zero copy buffers for all pipes owned by a
@@ -50,11 +50,16 @@ typedef struct
     CFE_MSG_SequenceCount_t SeqCnt;      /**< \brief Message sequence counter */
 } CFE_SBR_RouteEntry_t;
 
+/** \brief Number of blocks needed for the routing table to reach its maximum size */
+#define CFE_SBR_ROUTE_TBL_CHUNKS (((CFE_PLATFORM_SB_MAX_MSG_IDS - 1) / CFE_PLATFORM_SB_INITIAL_MSG_IDS) + 1)
+
 /** \brief Module data */
 typedef struct
 {
-    CFE_SBR_RouteEntry_t  RoutingTbl[CFE_PLATFORM_SB_MAX_MSG_IDS]; /**< \brief Routing table */
-    CFE_SB_RouteId_Atom_t RouteIdxTop;                             /**< \brief First unused entry in RoutingTbl */
+    CFE_SBR_RouteEntry_t  RoutingTbl[CFE_PLATFORM_SB_INITIAL_MSG_IDS]; /**< \brief Initial routing table block */
+    CFE_SBR_RouteEntry_t *Chunks[CFE_SBR_ROUTE_TBL_CHUNKS];           /**< \brief Table blocks, first is RoutingTbl */
+    CFE_SB_RouteId_Atom_t RouteIdxTop;                                 /**< \brief First unused entry in table */
+    CFE_SB_RouteId_Atom_t Capacity;                                    /**< \brief Entries allocated so far */
 } cfe_sbr_route_data_t;
 
 /******************************************************************************
@@ -66,26 +71,109 @@ cfe_sbr_route_data_t CFE_SBR_RDATA;
 
 /*----------------------------------------------------------------
  *
- * Internal helper routine only, not part of API.
+ * Local helper to get the table entry for a route id, NULL if not allocated
  *
  *-----------------------------------------------------------------*/
-void CFE_SBR_Init(void)
+static CFE_SBR_RouteEntry_t *CFE_SBR_LocateRouteEntry(CFE_SBR_RouteId_t RouteId)
 {
     CFE_SB_RouteId_Atom_t routeidx;
 
-    /* Clear the shared data */
-    memset(&CFE_SBR_RDATA, 0, sizeof(CFE_SBR_RDATA));
+    if (!CFE_SBR_IsValidRouteId(RouteId))
+    {
+        return NULL;
+    }
 
-    /* Only non-zero value for shared data initialization is the invalid MsgId */
-    for (routeidx = 0; routeidx < CFE_PLATFORM_SB_MAX_MSG_IDS; routeidx++)
+    routeidx = CFE_SBR_RouteIdToValue(RouteId);
+    if (routeidx >= CFE_SBR_RDATA.Capacity)
     {
-        CFE_SBR_RDATA.RoutingTbl[routeidx].MsgId = CFE_SB_INVALID_MSG_ID;
+        return NULL;
     }
 
+    return &CFE_SBR_RDATA.Chunks[routeidx / CFE_PLATFORM_SB_INITIAL_MSG_IDS]
+                                [routeidx % CFE_PLATFORM_SB_INITIAL_MSG_IDS];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper to initialize a block of routing table entries
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_SBR_InitChunk(CFE_SBR_RouteEntry_t *ChunkPtr)
+{
+    CFE_SB_RouteId_Atom_t routeidx;
+
+    memset(ChunkPtr, 0, sizeof(CFE_SBR_RouteEntry_t) * CFE_PLATFORM_SB_INITIAL_MSG_IDS);
+
+    /* Only non-zero value for initialization is the invalid MsgId */
+    for (routeidx = 0; routeidx < CFE_PLATFORM_SB_INITIAL_MSG_IDS; routeidx++)
+    {
+        ChunkPtr[routeidx].MsgId = CFE_SB_INVALID_MSG_ID;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_Init(void)
+{
+    /* Clear the shared data */
+    memset(&CFE_SBR_RDATA, 0, sizeof(CFE_SBR_RDATA));
+
+    CFE_SBR_InitChunk(CFE_SBR_RDATA.RoutingTbl);
+    CFE_SBR_RDATA.Chunks[0] = CFE_SBR_RDATA.RoutingTbl;
+    CFE_SBR_RDATA.Capacity  = CFE_PLATFORM_SB_INITIAL_MSG_IDS;
+
     /* Initialize map */
     CFE_SBR_Init_Map();
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+size_t CFE_SBR_GetExtensionSize(void)
+{
+    size_t extsize = 0;
+
+    if (CFE_SBR_RDATA.RouteIdxTop >= CFE_SBR_RDATA.Capacity && CFE_SBR_RDATA.Capacity < CFE_PLATFORM_SB_MAX_MSG_IDS)
+    {
+        extsize = sizeof(CFE_SBR_RouteEntry_t) * CFE_PLATFORM_SB_INITIAL_MSG_IDS;
+    }
+
+    return extsize;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_Extend(void *MemPtr)
+{
+    uint32 chunkidx;
+
+    if (MemPtr != NULL && CFE_SBR_GetExtensionSize() != 0)
+    {
+        chunkidx = CFE_SBR_RDATA.Capacity / CFE_PLATFORM_SB_INITIAL_MSG_IDS;
+
+        /* Fully initialize the block before making it reachable */
+        CFE_SBR_InitChunk(MemPtr);
+        CFE_SBR_RDATA.Chunks[chunkidx] = MemPtr;
+
+        if ((CFE_PLATFORM_SB_MAX_MSG_IDS - CFE_SBR_RDATA.Capacity) > CFE_PLATFORM_SB_INITIAL_MSG_IDS)
+        {
+            CFE_SBR_RDATA.Capacity += CFE_PLATFORM_SB_INITIAL_MSG_IDS;
+        }
+        else
+        {
+            CFE_SBR_RDATA.Capacity = CFE_PLATFORM_SB_MAX_MSG_IDS;
+        }
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -96,12 +184,12 @@ CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr)
     CFE_SBR_RouteId_t routeid    = CFE_SBR_INVALID_ROUTE_ID;
     uint32            collisions = 0;
 
-    if (CFE_SB_IsValidMsgId(MsgId) && (CFE_SBR_RDATA.RouteIdxTop < CFE_PLATFORM_SB_MAX_MSG_IDS))
+    if (CFE_SB_IsValidMsgId(MsgId) && (CFE_SBR_RDATA.RouteIdxTop < CFE_SBR_RDATA.Capacity))
     {
         routeid    = CFE_SBR_ValueToRouteId(CFE_SBR_RDATA.RouteIdxTop);
         collisions = CFE_SBR_SetRouteId(MsgId, routeid);
 
-        CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RDATA.RouteIdxTop].MsgId = MsgId;
+        CFE_SBR_LocateRouteEntry(routeid)->MsgId = MsgId;
         CFE_SBR_RDATA.RouteIdxTop++;
     }
 
@@ -120,11 +208,12 @@ CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr)
  *-----------------------------------------------------------------*/
 CFE_SB_MsgId_t CFE_SBR_GetMsgId(CFE_SBR_RouteId_t RouteId)
 {
-    CFE_SB_MsgId_t msgid = CFE_SB_INVALID_MSG_ID;
+    CFE_SB_MsgId_t        msgid    = CFE_SB_INVALID_MSG_ID;
+    CFE_SBR_RouteEntry_t *entryptr = CFE_SBR_LocateRouteEntry(RouteId);
 
-    if (CFE_SBR_IsValidRouteId(RouteId))
+    if (entryptr != NULL)
     {
-        msgid = CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].MsgId;
+        msgid = entryptr->MsgId;
     }
 
     return msgid;
@@ -137,11 +226,12 @@ CFE_SB_MsgId_t CFE_SBR_GetMsgId(CFE_SBR_RouteId_t RouteId)
  *-----------------------------------------------------------------*/
 CFE_SB_DestinationD_t *CFE_SBR_GetDestListHeadPtr(CFE_SBR_RouteId_t RouteId)
 {
-    CFE_SB_DestinationD_t *destptr = NULL;
+    CFE_SB_DestinationD_t *destptr  = NULL;
+    CFE_SBR_RouteEntry_t * entryptr = CFE_SBR_LocateRouteEntry(RouteId);
 
-    if (CFE_SBR_IsValidRouteId(RouteId))
+    if (entryptr != NULL)
     {
-        destptr = CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].ListHeadPtr;
+        destptr = entryptr->ListHeadPtr;
     }
 
     return destptr;
@@ -154,9 +244,11 @@ CFE_SB_DestinationD_t *CFE_SBR_GetDestListHeadPtr(CFE_SBR_RouteId_t RouteId)
  *-----------------------------------------------------------------*/
 void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr)
 {
-    if (CFE_SBR_IsValidRouteId(RouteId))
+    CFE_SBR_RouteEntry_t *entryptr = CFE_SBR_LocateRouteEntry(RouteId);
+
+    if (entryptr != NULL)
     {
-        CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].ListHeadPtr = DestPtr;
+        entryptr->ListHeadPtr = DestPtr;
     }
 }
 
@@ -167,12 +259,11 @@ void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t
  *-----------------------------------------------------------------*/
 void CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId)
 {
-    CFE_MSG_SequenceCount_t *cnt;
+    CFE_SBR_RouteEntry_t *entryptr = CFE_SBR_LocateRouteEntry(RouteId);
 
-    if (CFE_SBR_IsValidRouteId(RouteId))
+    if (entryptr != NULL)
     {
-        cnt  = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt;
-        *cnt = CFE_MSG_GetNextSequenceCount(*cnt);
+        entryptr->SeqCnt = CFE_MSG_GetNextSequenceCount(entryptr->SeqCnt);
     }
 }
 
@@ -183,11 +274,12 @@ void CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId)
  *-----------------------------------------------------------------*/
 CFE_MSG_SequenceCount_t CFE_SBR_GetSequenceCounter(CFE_SBR_RouteId_t RouteId)
 {
-    CFE_MSG_SequenceCount_t seqcnt = 0;
+    CFE_MSG_SequenceCount_t seqcnt   = 0;
+    CFE_SBR_RouteEntry_t *  entryptr = CFE_SBR_LocateRouteEntry(RouteId);
 
-    if (CFE_SBR_IsValidRouteId(RouteId))
+    if (entryptr != NULL)
     {
-        seqcnt = CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt;
+        seqcnt = entryptr->SeqCnt;
     }
 
     return seqcnt;
@@ -190,6 +190,66 @@ void Test_SBR_Route_Unsort_GetSet(void)
     UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[2]), &dest[0]);
 }
 
+void Test_SBR_Route_Unsort_Extend(void)
+{
+    static uint64     extmem[CFE_PLATFORM_SB_MAX_MSG_IDS * 4];
+    CFE_SBR_RouteId_t routeid;
+    size_t            extsize;
+    size_t            offset;
+    uint32            count;
+
+    /*
+     * Force valid msgid responses
+     * Note from here on msgids must be in the valid range since validation is forced true
+     * and if the underlying map implementation is direct it needs to be a valid array index
+     */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+
+    UtPrintf("Initialize map and route");
+    CFE_SBR_Init();
+
+    UtPrintf("No extension while table has free entries");
+    UtAssert_UINT32_LT(CFE_PLATFORM_SB_INITIAL_MSG_IDS, CFE_PLATFORM_SB_MAX_MSG_IDS);
+    UtAssert_ZERO(CFE_SBR_GetExtensionSize());
+    UtAssert_VOIDCALL(CFE_SBR_Extend(extmem));
+    UtAssert_VOIDCALL(CFE_SBR_Extend(NULL));
+
+    UtPrintf("Fill routing table, extending as needed");
+    count  = 0;
+    offset = 0;
+    while (true)
+    {
+        extsize = CFE_SBR_GetExtensionSize();
+        if (extsize != 0 && (offset + extsize) <= sizeof(extmem))
+        {
+            CFE_SBR_Extend((uint8 *)extmem + offset);
+            offset += extsize;
+        }
+
+        if (!CFE_SBR_IsValidRouteId(CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(count), NULL)))
+        {
+            break;
+        }
+
+        count++;
+    }
+
+    /* Full size is reachable through extensions, and no further extension is offered */
+    UtAssert_UINT32_EQ(count, CFE_PLATFORM_SB_MAX_MSG_IDS);
+    UtAssert_NONZERO(offset);
+    UtAssert_ZERO(CFE_SBR_GetExtensionSize());
+
+    /* An entry in the first extension block holds its route */
+    routeid = CFE_SBR_ValueToRouteId(CFE_PLATFORM_SB_INITIAL_MSG_IDS);
+    UtAssert_UINT32_EQ(CFE_SB_MsgIdToValue(CFE_SBR_GetMsgId(routeid)), CFE_PLATFORM_SB_INITIAL_MSG_IDS);
+
+    /* Last entry is accessible and initialized */
+    routeid = CFE_SBR_ValueToRouteId(CFE_PLATFORM_SB_MAX_MSG_IDS - 1);
+    UtAssert_UINT32_EQ(CFE_SB_MsgIdToValue(CFE_SBR_GetMsgId(routeid)), CFE_PLATFORM_SB_MAX_MSG_IDS - 1);
+    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid), NULL);
+    UtAssert_INT32_EQ(CFE_SBR_GetSequenceCounter(routeid), 0);
+}
+
 /* Main unit test routine */
 void UtTest_Setup(void)
 {
@@ -198,4 +258,5 @@ void UtTest_Setup(void)
 
     UT_ADD_TEST(Test_SBR_Route_Unsort_General);
     UT_ADD_TEST(Test_SBR_Route_Unsort_GetSet);
+    UT_ADD_TEST(Test_SBR_Route_Unsort_Extend);
 }
@@ -482,8 +482,8 @@ CFE_Status_t CFE_TBL_Load(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType,
             WorkingBufferPtr->FileTime = CFE_TIME_ZERO_VALUE;
 
             /* Compute the CRC on the specified table buffer */
-            WorkingBufferPtr->Crc =
-                CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
+            WorkingBufferPtr->Crc = CFE_ES_ChunkedCRCInit(&WorkingBufferPtr->CrcState, WorkingBufferPtr->BufferPtr,
+                                                          RegRecPtr->Size, CFE_MISSION_ES_DEFAULT_CRC);
 
             break;
         default:
@@ -680,6 +680,8 @@ CFE_Status_t CFE_TBL_GetAddress(void **TblPtr, CFE_TBL_Handle_t TblHandle)
         return CFE_TBL_BAD_ARGUMENT;
     }
 
+    CFE_CORE_PERF_ENTRY(CFE_MISSION_TBL_GETADDRESS_PERF_ID);
+
     /* Assume failure at returning the table address */
     *TblPtr = NULL;
 
@@ -702,6 +704,8 @@ CFE_Status_t CFE_TBL_GetAddress(void **TblPtr, CFE_TBL_Handle_t TblHandle)
         CFE_ES_WriteToSysLog("%s: Bad AppId=%lu\n", __func__, CFE_RESOURCEID_TO_ULONG(ThisAppId));
     }
 
+    CFE_CORE_PERF_EXIT(CFE_MISSION_TBL_GETADDRESS_PERF_ID);
+
     return Status;
 }
 
@@ -1161,6 +1165,18 @@ static void CFE_TBL_NotifyOtherAppHelper(CFE_TBL_AccessDescriptor_t *AccessDescP
  *
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_TBL_Modified(CFE_TBL_Handle_t TblHandle)
+{
+    /* The whole table is modified, the range is limited to the size of the table */
+    return CFE_TBL_ModifiedRange(TblHandle, 0, SIZE_MAX);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TBL_ModifiedRange(CFE_TBL_Handle_t TblHandle, size_t Offset, size_t Size)
 {
     CFE_TBL_TxnState_t     Txn;
     int32                  Status;
@@ -1180,32 +1196,45 @@ CFE_Status_t CFE_TBL_Modified(CFE_TBL_Handle_t TblHandle)
 
         CFE_TBL_TxnFinish(&Txn);
 
-        /* If the table is a critical table, update the appropriate CDS with the new data */
-        if (RegRecPtr->CriticalTable == true)
+        if (Size == 0 || Offset >= RegRecPtr->Size)
         {
-            CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
+            Status = CFE_TBL_ERR_INVALID_SIZE;
         }
+        else
+        {
+            /* Limit the range to the end of the table */
+            if (Size > (RegRecPtr->Size - Offset))
+            {
+                Size = RegRecPtr->Size - Offset;
+            }
 
-        /* Keep a record of change for the ground operators reference */
-        RegRecPtr->TimeOfLastUpdate                                      = CFE_TIME_GetTime();
-        RegRecPtr->LastFileLoaded[sizeof(RegRecPtr->LastFileLoaded) - 1] = '\0';
+            /* If the table is a critical table, update the appropriate CDS with the new data */
+            if (RegRecPtr->CriticalTable == true)
+            {
+                CFE_TBL_UpdateCriticalTblCDSRange(RegRecPtr, Offset, Size);
+            }
 
-        /* Update CRC on contents of table */
-        RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Crc = CFE_ES_CalculateCRC(
-            RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
+            /* Keep a record of change for the ground operators reference */
+            RegRecPtr->TimeOfLastUpdate                                      = CFE_TIME_GetTime();
+            RegRecPtr->LastFileLoaded[sizeof(RegRecPtr->LastFileLoaded) - 1] = '\0';
 
-        FilenameLen = strlen(RegRecPtr->LastFileLoaded);
-        if (FilenameLen < (sizeof(RegRecPtr->LastFileLoaded) - 4))
-        {
-            strncpy(&RegRecPtr->LastFileLoaded[FilenameLen], "(*)", 4);
-        }
-        else
-        {
-            strncpy(&RegRecPtr->LastFileLoaded[sizeof(RegRecPtr->LastFileLoaded) - 4], "(*)", 4);
-        }
+            /* Update CRC on contents of table, only the chunks in the modified range are recomputed */
+            CFE_TBL_UpdateBufferCrc(&RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex], RegRecPtr->Size, Offset,
+                                    Size);
+
+            FilenameLen = strlen(RegRecPtr->LastFileLoaded);
+            if (FilenameLen < (sizeof(RegRecPtr->LastFileLoaded) - 4))
+            {
+                strncpy(&RegRecPtr->LastFileLoaded[FilenameLen], "(*)", 4);
+            }
+            else
+            {
+                strncpy(&RegRecPtr->LastFileLoaded[sizeof(RegRecPtr->LastFileLoaded) - 4], "(*)", 4);
+            }
 
-        /* Only notify *OTHER* applications that the contents have changed */
-        CFE_TBL_ForeachAccessDescriptor(RegRecPtr, CFE_TBL_NotifyOtherAppHelper, &Txn);
+            /* Only notify *OTHER* applications that the contents have changed */
+            CFE_TBL_ForeachAccessDescriptor(RegRecPtr, CFE_TBL_NotifyOtherAppHelper, &Txn);
+        }
     }
     else
     {
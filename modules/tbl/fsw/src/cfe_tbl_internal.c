@@ -72,6 +72,8 @@ int32 CFE_TBL_EarlyInit(void)
     uint32 j;
     int32  OsStatus;
     int32  Status;
+    uint32 NumDiscarded;
+    bool   SaveCritReg;
 
     /* Clear task global */
     memset(&CFE_TBL_Global, 0, sizeof(CFE_TBL_Global));
@@ -172,8 +174,19 @@ int32 CFE_TBL_EarlyInit(void)
                                  (unsigned int)Status);
         }
 
-        /* Whether we recovered the Critical Table Registry or not, we are successful with initialization */
-        Status = CFE_SUCCESS;
+        /* Each entry has its own CRC, so the intact entries are kept even if the whole block is not */
+        NumDiscarded = CFE_TBL_ValidateCritReg();
+        if (NumDiscarded != 0)
+        {
+            CFE_ES_WriteToSysLog("%s: Discarded %u Critical Table Registry entries with bad CRC\n", __func__,
+                                 (unsigned int)NumDiscarded);
+        }
+
+        /*
+         * Single entry updates do not fix the block CRC of the registry, so unless the
+         * registry was recovered intact, the whole of it is written back once
+         */
+        SaveCritReg = (Status != CFE_SUCCESS || NumDiscarded != 0);
     }
     else if (Status != CFE_SUCCESS)
     {
@@ -182,12 +195,16 @@ int32 CFE_TBL_EarlyInit(void)
         CFE_ES_WriteToSysLog("%s: Failed to create Critical Table Registry (Err=0x%08X)\n", __func__,
                              (unsigned int)Status);
 
-        /* Failure to support critical tables is not a good enough reason to exit the cFE on start up */
-        Status = CFE_SUCCESS;
+        SaveCritReg = false;
     }
     else
     {
         /* Save the initial version of the Critical Table Registry in the CDS */
+        SaveCritReg = true;
+    }
+
+    if (SaveCritReg)
+    {
         Status = CFE_ES_CopyToCDS(CFE_TBL_Global.CritRegHandle, CFE_TBL_Global.CritReg);
 
         if (Status != CFE_SUCCESS)
@@ -196,13 +213,11 @@ int32 CFE_TBL_EarlyInit(void)
             /* Note the problem and move on */
             CFE_ES_WriteToSysLog("%s: Failed to save Critical Table Registry (Err=0x%08X)\n", __func__,
                                  (unsigned int)Status);
-
-            /* Failure to support critical tables is not a good enough reason to exit the cFE on start up */
-            Status = CFE_SUCCESS;
         }
     }
 
-    return Status;
+    /* Failure to support critical tables is not a good enough reason to exit the cFE on start up */
+    return CFE_SUCCESS;
 }
 
 /*----------------------------------------------------------------
@@ -272,13 +287,20 @@ void CFE_TBL_FormTableName(char *FullTblName, const char *TblName, CFE_ES_AppId_
  *-----------------------------------------------------------------*/
 int32 CFE_TBL_LockRegistry(void)
 {
-    int32 OsStatus;
-    int32 Status;
+    int32                     OsStatus;
+    int32                     Status;
+    CFE_ES_LockProfileStamp_t Stamp;
+
+    CFE_ES_LOCKPROF_BEGIN(&Stamp);
 
+    CFE_CORE_PERF_ENTRY(CFE_MISSION_TBL_LOCK_PERF_ID);
     OsStatus = OS_MutSemTake(CFE_TBL_Global.RegistryMutex);
+    CFE_CORE_PERF_EXIT(CFE_MISSION_TBL_LOCK_PERF_ID);
 
     if (OsStatus == OS_SUCCESS)
     {
+        /* the registry lock is not told its caller, so it is profiled as a single call site */
+        CFE_ES_LOCKPROF_ACQUIRED(CFE_ES_LockProfileId_TBL_REGISTRY, __func__, __LINE__, &Stamp);
         Status = CFE_SUCCESS;
     }
     else
@@ -300,6 +322,8 @@ int32 CFE_TBL_UnlockRegistry(void)
     int32 OsStatus;
     int32 Status;
 
+    CFE_ES_LOCKPROF_RELEASED(CFE_ES_LockProfileId_TBL_REGISTRY);
+
     OsStatus = OS_MutSemGive(CFE_TBL_Global.RegistryMutex);
 
     if (OsStatus == OS_SUCCESS)
@@ -545,6 +569,15 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
                 /* In case the file contains a partial table load, get the active buffer contents first */
                 memcpy((*WorkingBufferPtr)->BufferPtr, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr,
                        RegRecPtr->Size);
+
+                /*
+                 * The chunk CRCs of the active buffer are not copied, as the owner may have changed
+                 * it without reporting every change.  They are marked invalid instead, so the first
+                 * load into this buffer computes the CRC of the whole table, and any later partial
+                 * load into it only recomputes the chunks it changes.
+                 */
+                (*WorkingBufferPtr)->Crc = RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Crc;
+                memset(&(*WorkingBufferPtr)->CrcState, 0, sizeof((*WorkingBufferPtr)->CrcState));
             }
         }
     }
@@ -646,6 +679,12 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
         NumBytes = 0;
     }
 
+    /*
+     * Compute the CRC on the specified table buffer.  This is done for the whole range
+     * read into, even if the read failed, so the chunk CRCs always reflect the buffer.
+     */
+    CFE_TBL_UpdateBufferCrc(WorkingBufferPtr, RegRecPtr->Size, TblFileHeader.Offset, TblFileHeader.NumBytes);
+
     if (NumBytes != TblFileHeader.NumBytes)
     {
         CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_INCOMPLETE_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -685,10 +724,6 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
     WorkingBufferPtr->FileTime.Seconds    = StdFileHeader.TimeSeconds;
     WorkingBufferPtr->FileTime.Subseconds = StdFileHeader.TimeSubSeconds;
 
-    /* Compute the CRC on the specified table buffer */
-    WorkingBufferPtr->Crc =
-        CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
-
     OS_close(FileDescriptor);
 
     return Status;
@@ -710,6 +745,27 @@ static void CFE_TBL_CheckLockHelper(CFE_TBL_AccessDescriptor_t *AccDescPtr, void
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_UpdateBufferCrc(CFE_TBL_LoadBuff_t *BufferPtr, size_t TblSize, size_t Offset, size_t NumBytes)
+{
+    /* The chunk CRCs of another table or CRC type cannot be reused, so start over */
+    if (BufferPtr->CrcState.NumChunks != 0 && BufferPtr->CrcState.DataLength == TblSize &&
+        BufferPtr->CrcState.TypeCRC == CFE_MISSION_ES_DEFAULT_CRC)
+    {
+        BufferPtr->Crc = CFE_ES_ChunkedCRCUpdate(&BufferPtr->CrcState, BufferPtr->BufferPtr, Offset, NumBytes);
+    }
+    else
+    {
+        BufferPtr->Crc =
+            CFE_ES_ChunkedCRCInit(&BufferPtr->CrcState, BufferPtr->BufferPtr, TblSize, CFE_MISSION_ES_DEFAULT_CRC);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -783,7 +839,8 @@ int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *
                 RegRecPtr->Buffers[0].FileTime = CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].FileTime;
 
                 /* Save the previously computed CRC into the new buffer */
-                RegRecPtr->Buffers[0].Crc = CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].Crc;
+                RegRecPtr->Buffers[0].Crc      = CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].Crc;
+                RegRecPtr->Buffers[0].CrcState = CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].CrcState;
 
                 /* Free the working buffer */
                 CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].Taken = false;
@@ -1106,13 +1163,33 @@ void CFE_TBL_FindCriticalTblInfo(CFE_TBL_CritRegRec_t **CritRegRecPtr, CFE_ES_CD
  *
  *-----------------------------------------------------------------*/
 void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    CFE_TBL_UpdateCriticalTblCDSRange(RegRecPtr, 0, RegRecPtr->Size);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_UpdateCriticalTblCDSRange(CFE_TBL_RegistryRec_t *RegRecPtr, size_t Offset, size_t Size)
 {
     CFE_TBL_CritRegRec_t *CritRegRecPtr = NULL;
 
     int32 Status;
 
-    /* Copy an image of the updated table to the CDS for safekeeping */
-    Status = CFE_ES_CopyToCDS(RegRecPtr->CDSHandle, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr);
+    /* Copy an image of the updated table (or just the updated part of it) to the CDS for safekeeping */
+    if (Offset == 0 && Size >= RegRecPtr->Size)
+    {
+        Status = CFE_ES_CopyToCDS(RegRecPtr->CDSHandle, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr);
+    }
+    else
+    {
+        Status = CFE_ES_CopyToCDSRange(
+            RegRecPtr->CDSHandle, Offset, Size,
+            (const uint8 *)RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr + Offset);
+    }
 
     if (Status != CFE_SUCCESS)
     {
@@ -1133,8 +1210,8 @@ void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr)
             CritRegRecPtr->TimeOfLastUpdate                                          = RegRecPtr->TimeOfLastUpdate;
             CritRegRecPtr->TableLoadedOnce                                           = RegRecPtr->TableLoadedOnce;
 
-            /* Update copy of Critical Table Registry in the CDS */
-            Status = CFE_ES_CopyToCDS(CFE_TBL_Global.CritRegHandle, CFE_TBL_Global.CritReg);
+            /* Update the entry of this table in the copy of Critical Table Registry in the CDS */
+            Status = CFE_TBL_UpdateCritRegEntry(CritRegRecPtr);
 
             if (Status != CFE_SUCCESS)
             {
@@ -1151,6 +1228,65 @@ void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr)
     /* Don't bother notifying the caller of the problem since the active table is still legitimate */
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Computes the CRC of a Critical Table Registry Record, without the CRC itself
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_TBL_CritRegEntryCrc(const CFE_TBL_CritRegRec_t *CritRegRecPtr)
+{
+    return CFE_ES_CalculateCRC(CritRegRecPtr, offsetof(CFE_TBL_CritRegRec_t, Crc), 0, CFE_MISSION_ES_DEFAULT_CRC);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TBL_UpdateCritRegEntry(CFE_TBL_CritRegRec_t *CritRegRecPtr)
+{
+    size_t Offset;
+
+    CritRegRecPtr->Crc = CFE_TBL_CritRegEntryCrc(CritRegRecPtr);
+
+    /* Only the record of this entry is written to the CDS */
+    Offset = (CritRegRecPtr - CFE_TBL_Global.CritReg) * sizeof(CFE_TBL_CritRegRec_t);
+
+    return CFE_ES_CopyToCDSRange(CFE_TBL_Global.CritRegHandle, Offset, sizeof(*CritRegRecPtr), CritRegRecPtr);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_TBL_ValidateCritReg(void)
+{
+    CFE_TBL_CritRegRec_t *CritRegRecPtr;
+    uint32                NumDiscarded;
+    uint32                i;
+
+    NumDiscarded = 0;
+    for (i = 0; i < CFE_PLATFORM_TBL_MAX_CRITICAL_TABLES; i++)
+    {
+        CritRegRecPtr = &CFE_TBL_Global.CritReg[i];
+
+        /* Free entries are never used, so their content does not matter */
+        if (!CFE_RESOURCEID_TEST_EQUAL(CritRegRecPtr->CDSHandle, CFE_ES_CDS_BAD_HANDLE) &&
+            CritRegRecPtr->Crc != CFE_TBL_CritRegEntryCrc(CritRegRecPtr))
+        {
+            memset(CritRegRecPtr, 0, sizeof(*CritRegRecPtr));
+            CritRegRecPtr->CDSHandle = CFE_ES_CDS_BAD_HANDLE;
+            ++NumDiscarded;
+        }
+    }
+
+    return NumDiscarded;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1432,8 +1568,8 @@ CFE_Status_t CFE_TBL_RestoreTableDataFromCDS(CFE_TBL_RegistryRec_t *RegRecPtr, c
                 RegRecPtr->TableLoadedOnce  = CritRegRecPtr->TableLoadedOnce;
 
                 /* Compute the CRC on the specified table buffer */
-                WorkingBufferPtr->Crc =
-                    CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
+                WorkingBufferPtr->Crc = CFE_ES_ChunkedCRCInit(&WorkingBufferPtr->CrcState, WorkingBufferPtr->BufferPtr,
+                                                              RegRecPtr->Size, CFE_MISSION_ES_DEFAULT_CRC);
 
                 /* Make sure everyone who sees the table knows that it has been updated */
                 CFE_TBL_NotifyTblUsersOfUpdate(RegRecPtr);
@@ -1480,7 +1616,7 @@ void CFE_TBL_RegisterWithCriticalTableRegistry(CFE_TBL_CritRegRec_t *CritRegRecP
         CritRegRecPtr->FileTime         = CFE_TIME_ZERO_VALUE;
         CritRegRecPtr->TimeOfLastUpdate = CFE_TIME_ZERO_VALUE;
 
-        CFE_ES_CopyToCDS(CFE_TBL_Global.CritRegHandle, CFE_TBL_Global.CritReg);
+        CFE_TBL_UpdateCritRegEntry(CritRegRecPtr);
     }
     else
     {
@@ -208,6 +208,33 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
 int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr, CFE_TBL_RegistryRec_t *RegRecPtr,
                            const char *Filename);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Updates the CRC of a table buffer after a range of it was changed
+**
+** \par Description
+**        Recomputes the CRC of the specified buffer from the chunk CRCs
+**        kept with the buffer, so that only the chunks overlapping the
+**        changed range are read again.  If the chunk CRCs are not valid
+**        for a table of this size, the CRC is computed over the whole buffer.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# All parameters are assumed to be verified before function
+**           is called.
+**        -# The chunk CRCs are only valid if every change to the buffer
+**           contents since they were computed has been reported.
+**
+** \param[in]  BufferPtr      Pointer to the table buffer that was changed
+**
+** \param[in]  TblSize        Size of the table, in bytes
+**
+** \param[in]  Offset         Offset of the first changed byte within the table
+**
+** \param[in]  NumBytes       Number of changed bytes
+**
+*/
+void CFE_TBL_UpdateBufferCrc(CFE_TBL_LoadBuff_t *BufferPtr, size_t TblSize, size_t Offset, size_t NumBytes);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Updates the active table buffer with contents of inactive buffer
@@ -346,9 +373,9 @@ void CFE_TBL_FindCriticalTblInfo(CFE_TBL_CritRegRec_t **CritRegRecPtr, CFE_ES_CD
 **
 ** \par Description
 **        Copies the contents of the active buffer into a previously allocated
-**        CDS associated with the table.  The Critical Table Registry is also
-**        updated and copied into the CDS to keep relevant information on the
-**        source of the data contained in the table.
+**        CDS associated with the table.  The entry of the table in the Critical
+**        Table Registry is also updated and copied into the CDS to keep relevant
+**        information on the source of the data contained in the table.
 **
 ** \par Assumptions, External Events, and Notes:
 **          None
@@ -359,6 +386,63 @@ void CFE_TBL_FindCriticalTblInfo(CFE_TBL_CritRegRec_t **CritRegRecPtr, CFE_ES_CD
 */
 void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Updates a single entry of the Critical Table Registry in the CDS
+**
+** \par Description
+**        Computes the CRC of the Critical Table Registry Record and copies only
+**        this record into its location in the CDS of the Critical Table Registry.
+**
+** \par Assumptions, External Events, and Notes:
+**          The record must be an entry of CFE_TBL_Global.CritReg
+**
+** \param[in, out]  CritRegRecPtr Pointer to the Critical Table Registry Record that
+**                                changed.  The CRC of the record is updated.
+**
+** \return Any of the return values from #CFE_ES_CopyToCDSRange
+**
+*/
+int32 CFE_TBL_UpdateCritRegEntry(CFE_TBL_CritRegRec_t *CritRegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Checks the entries of the Critical Table Registry recovered from the CDS
+**
+** \par Description
+**        Every entry that is in use must have a valid CRC.  An entry with a bad
+**        CRC is freed, so that the other entries can still be used.
+**
+** \par Assumptions, External Events, and Notes:
+**          None
+**
+** \return The number of entries that were freed
+**
+*/
+uint32 CFE_TBL_ValidateCritReg(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Updates a range of a CDS associated with a Critical Table
+**
+** \par Description
+**        Same as CFE_TBL_UpdateCriticalTblCDS(), except that only the specified
+**        range of the active buffer is copied into the CDS, unless the range is
+**        the whole table.
+**
+** \par Assumptions, External Events, and Notes:
+**          The range is assumed to be within the table.
+**
+** \param[in]  RegRecPtr Pointer to Registry Record of Critical Table whose CDS
+**                       needs to be updated.
+**
+** \param[in]  Offset    Offset of the range within the table
+**
+** \param[in]  Size      Number of bytes in the range
+**
+*/
+void CFE_TBL_UpdateCriticalTblCDSRange(CFE_TBL_RegistryRec_t *RegRecPtr, size_t Offset, size_t Size);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief When enabled, will send a manage notification command message
@@ -154,11 +154,12 @@ typedef struct
 */
 typedef struct
 {
-    void *             BufferPtr;     /**< \brief Pointer to Load Buffer */
-    CFE_TIME_SysTime_t FileTime;      /**< \brief Time stamp from last file loaded into table */
-    uint32             Crc;           /**< \brief Last calculated CRC for this buffer's contents */
-    bool               Taken;         /**< \brief Flag indicating whether buffer is in use */
-    bool               Validated;     /**< \brief Flag indicating whether the buffer has been successfully validated */
+    void *              BufferPtr; /**< \brief Pointer to Load Buffer */
+    CFE_TIME_SysTime_t  FileTime;  /**< \brief Time stamp from last file loaded into table */
+    uint32              Crc;       /**< \brief Last calculated CRC for this buffer's contents */
+    CFE_ES_ChunkedCRC_t CrcState;  /**< \brief Chunk CRCs of this buffer's contents, to update the CRC */
+    bool                Taken;     /**< \brief Flag indicating whether buffer is in use */
+    bool                Validated; /**< \brief Flag indicating whether the buffer has been successfully validated */
     char DataSource[OS_MAX_PATH_LEN]; /**< \brief Source of data put into buffer (filename or memory address) */
 } CFE_TBL_LoadBuff_t;
 
@@ -237,6 +238,7 @@ typedef struct
 **
 **     Critical Table Registry Record that contains information about a Critical
 **     Table that must survive the reboot and repopulation of the Table Registry.
+**     Each record is written to the CDS on its own, see CFE_TBL_UpdateCritRegEntry().
 */
 typedef struct
 {
@@ -246,6 +248,7 @@ typedef struct
     char               LastFileLoaded[OS_MAX_PATH_LEN]; /**< \brief Filename of last file loaded into table */
     char               Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief Processor specific table name */
     bool               TableLoadedOnce; /**< \brief Flag indicating whether table has been loaded once or not */
+    uint32             Crc; /**< \brief CRC of the fields above, to validate the record when it is recovered */
 } CFE_TBL_CritRegRec_t;
 
 /*******************************************************************************/
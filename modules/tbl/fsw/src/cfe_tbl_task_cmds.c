@@ -423,6 +423,10 @@ int32 CFE_TBL_LoadCmd(const CFE_TBL_LoadCmd_t *data)
                                 OS_read(FileDescriptor, ((uint8 *)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset,
                                         TblFileHeader.NumBytes);
 
+                            /* Compute the CRC, only the chunks of the table that were read into are recomputed */
+                            CFE_TBL_UpdateBufferCrc(WorkingBufferPtr, RegRecPtr->Size, TblFileHeader.Offset,
+                                                    TblFileHeader.NumBytes);
+
                             /* Make sure the appropriate number of bytes were read */
                             if ((long)OsStatus == TblFileHeader.NumBytes)
                             {
@@ -450,10 +454,6 @@ int32 CFE_TBL_LoadCmd(const CFE_TBL_LoadCmd_t *data)
                                     WorkingBufferPtr->FileTime.Seconds    = StdFileHeader.TimeSeconds;
                                     WorkingBufferPtr->FileTime.Subseconds = StdFileHeader.TimeSubSeconds;
 
-                                    /* Compute the CRC on the specified table buffer */
-                                    WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(
-                                        WorkingBufferPtr->BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
-
                                     /* Initialize validation flag with true if no Validation Function is required to be
                                      * called */
                                     WorkingBufferPtr->Validated = (RegRecPtr->ValidationFuncPtr == NULL);
@@ -1311,6 +1311,7 @@ int32 CFE_TBL_DeleteCDSCmd(const CFE_TBL_DeleteCDSCmd_t *data)
 
                 /* Free the entry in the Critical Table Registry */
                 CritRegRecPtr->CDSHandle = CFE_ES_CDS_BAD_HANDLE;
+                CFE_TBL_UpdateCritRegEntry(CritRegRecPtr);
 
                 /* Increment Successful Command Counter */
                 ReturnCode = CFE_TBL_INC_CMD_CTR;
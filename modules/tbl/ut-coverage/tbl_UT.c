@@ -3165,6 +3165,15 @@ void Test_CFE_TBL_TblMod(void)
     UtAssert_StrCmp(TblInfo1.LastFileLoaded, "MyInputFile(*)", "TblInfo1.LastFileLoaded (%s)", TblInfo1.LastFileLoaded);
     UtAssert_MemCmp(CDS_Data, &File.TblData, sizeof(CDS_Data), "Table Data");
 
+    /* Notify Table Services that a range of the table has been modified, only the range goes to the CDS */
+    UT_ResetState(UT_KEY(CFE_ES_CopyToCDS));
+    UT_ResetState(UT_KEY(CFE_ES_CopyToCDSRange));
+    CFE_UtAssert_SUCCESS(CFE_TBL_ModifiedRange(App1TblHandle1, sizeof(uint32), sizeof(uint32)));
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+
+    /* The range of the table, and the entry of the table in the critical table registry */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDSRange, 2);
+
     /* Save the previous table's information for a subsequent test */
     AccessDescPtr  = &CFE_TBL_Global.Handles[App1TblHandle1];
     RegRecPtr      = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
@@ -3223,7 +3232,7 @@ void Test_CFE_TBL_TblMod(void)
      * calculated and table has been flagged as Updated
      */
     ExpectedCrc = 0x0000F00D;
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, ExpectedCrc);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_ChunkedCRCInit), 1, ExpectedCrc);
     CFE_TBL_Global.Handles[AccessIterator].Updated = false;
     CFE_UtAssert_SUCCESS(CFE_TBL_Modified(App1TblHandle1));
     UtAssert_BOOL_TRUE(CFE_TBL_Global.Handles[AccessIterator].Updated);
@@ -3252,6 +3261,33 @@ void Test_CFE_TBL_TblMod(void)
 
     /* Test response to an invalid handle */
     UtAssert_INT32_EQ(CFE_TBL_Modified(CFE_TBL_BAD_TABLE_HANDLE), CFE_TBL_ERR_INVALID_HANDLE);
+    UtAssert_INT32_EQ(CFE_TBL_ModifiedRange(CFE_TBL_BAD_TABLE_HANDLE, 0, 1), CFE_TBL_ERR_INVALID_HANDLE);
+
+    /* Test response to an invalid range */
+    UtAssert_INT32_EQ(CFE_TBL_ModifiedRange(App1TblHandle1, 0, 0), CFE_TBL_ERR_INVALID_SIZE);
+    UtAssert_INT32_EQ(CFE_TBL_ModifiedRange(App1TblHandle1, sizeof(UT_Table1_t), 1), CFE_TBL_ERR_INVALID_SIZE);
+
+    /*
+     * Notify Table Services that a range of the table has been modified.  With
+     * valid chunk CRCs, only the modified range is passed on to be recomputed,
+     * and a range past the end of the table is limited to the table.
+     */
+    AccessDescPtr = &CFE_TBL_Global.Handles[App1TblHandle1];
+    RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
+
+    RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].CrcState.NumChunks  = 1;
+    RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].CrcState.DataLength = sizeof(UT_Table1_t);
+    RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].CrcState.TypeCRC    = CFE_MISSION_ES_DEFAULT_CRC;
+    ExpectedCrc                                                          = 0x0000BEEF;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_ChunkedCRCUpdate), 1, ExpectedCrc);
+    CFE_UtAssert_SUCCESS(CFE_TBL_ModifiedRange(App1TblHandle1, sizeof(uint32), 2 * sizeof(UT_Table1_t)));
+    UtAssert_STUB_COUNT(CFE_ES_ChunkedCRCUpdate, 1);
+    UtAssert_UINT32_EQ(RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Crc, ExpectedCrc);
+
+    /* Chunk CRCs of a table of a different size are not reused */
+    RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].CrcState.DataLength = sizeof(UT_Table1_t) + 1;
+    CFE_UtAssert_SUCCESS(CFE_TBL_ModifiedRange(App1TblHandle1, 0, 1));
+    UtAssert_STUB_COUNT(CFE_ES_ChunkedCRCUpdate, 1);
 }
 
 /*
@@ -3271,6 +3307,10 @@ void Test_CFE_TBL_Internal(void)
     CFE_TBL_File_Hdr_t          TblFileHeader;
     osal_id_t                   FileDescriptor;
     void *                      TblPtr;
+    CFE_TBL_CritRegRec_t        CritRegData[CFE_PLATFORM_TBL_MAX_CRITICAL_TABLES];
+    UT_Table1_t                 InactiveData;
+    void *                      SavedBufferPtr;
+    uint8                       InactiveIndex;
 
     UtPrintf("Begin Test Internal");
 
@@ -3298,6 +3338,24 @@ void Test_CFE_TBL_Internal(void)
     CFE_UtAssert_EVENTCOUNT(0);
     UtAssert_ADDRESS_EQ(WorkingBufferPtr, &RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex]);
 
+    /* Test that a working buffer copied from the active buffer does not
+     * reuse the chunk CRCs of the active buffer
+     */
+    UT_InitData();
+    InactiveIndex                                                       = 1 - RegRecPtr->ActiveBufferIndex;
+    SavedBufferPtr                                                      = RegRecPtr->Buffers[InactiveIndex].BufferPtr;
+    RegRecPtr->TableLoadedOnce                                          = true;
+    RegRecPtr->LoadInProgress                                           = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    RegRecPtr->Buffers[InactiveIndex].BufferPtr                         = &InactiveData;
+    RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].CrcState.NumChunks = 1;
+    CFE_UtAssert_SUCCESS(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, false));
+    UtAssert_ADDRESS_EQ(WorkingBufferPtr, &RegRecPtr->Buffers[InactiveIndex]);
+    UtAssert_ZERO(WorkingBufferPtr->CrcState.NumChunks);
+    RegRecPtr->Buffers[InactiveIndex].BufferPtr                         = SavedBufferPtr;
+    RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].CrcState.NumChunks = 0;
+    RegRecPtr->TableLoadedOnce                                          = false;
+    RegRecPtr->LoadInProgress                                           = CFE_TBL_NO_LOAD_IN_PROGRESS;
+
     /* Test response to a single buffered table with a mutex sem take
      * failure
      */
@@ -3574,6 +3632,42 @@ void Test_CFE_TBL_Internal(void)
     UT_ResetState(UT_KEY(CFE_ES_GetPoolBuf));
     UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), &UT_TBL_LoadBuffer, sizeof(UT_TBL_LoadBuffer), false);
     CFE_UtAssert_SUCCESS(CFE_TBL_EarlyInit());
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Test CFE_TBL_EarlyInit response where the CDS already exists but
+     * restore fails and the registry can not be rewritten either
+     */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterCDSEx), 1, CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RestoreFromCDS), 1, CFE_ES_CDS_BLOCK_CRC_ERR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CopyToCDS), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UT_ResetState(UT_KEY(CFE_ES_GetPoolBuf));
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), &UT_TBL_LoadBuffer, sizeof(UT_TBL_LoadBuffer), false);
+    CFE_UtAssert_SUCCESS(CFE_TBL_EarlyInit());
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Test CFE_TBL_EarlyInit response where the CDS already exists and
+     * one entry of the recovered critical table registry has a bad CRC
+     */
+    UT_InitData();
+    memset(CritRegData, 0, sizeof(CritRegData));
+    for (i = 0; i < CFE_PLATFORM_TBL_MAX_CRITICAL_TABLES; i++)
+    {
+        CritRegData[i].CDSHandle = CFE_ES_CDS_BAD_HANDLE;
+    }
+    CritRegData[0].CDSHandle = CFE_ES_CDSHANDLE_C(CFE_ResourceId_FromInteger(1));
+    CritRegData[1].CDSHandle = CFE_ES_CDSHANDLE_C(CFE_ResourceId_FromInteger(2));
+    CritRegData[1].Crc       = 1;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterCDSEx), 1, CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_RestoreFromCDS), CritRegData, sizeof(CritRegData), false);
+    UT_ResetState(UT_KEY(CFE_ES_GetPoolBuf));
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), &UT_TBL_LoadBuffer, sizeof(UT_TBL_LoadBuffer), false);
+    CFE_UtAssert_SUCCESS(CFE_TBL_EarlyInit());
+    CFE_UtAssert_RESOURCEID_EQ(CFE_TBL_Global.CritReg[0].CDSHandle, CritRegData[0].CDSHandle);
+    CFE_UtAssert_RESOURCEID_EQ(CFE_TBL_Global.CritReg[1].CDSHandle, CFE_ES_CDS_BAD_HANDLE);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
     CFE_UtAssert_EVENTCOUNT(0);
 
     /* Test CFE_TBL_EarlyInit response when no CDS is available */
@@ -3740,7 +3834,7 @@ void Test_CFE_TBL_Internal(void)
     UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
     UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
     UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CopyToCDS), 2, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CopyToCDSRange), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
     CFE_UtAssert_SUCCESS(CFE_TBL_Load(App1TblHandle2, CFE_TBL_SRC_FILE, "TblSrcFileName.dat"));
     CFE_UtAssert_EVENTSENT(CFE_TBL_LOAD_SUCCESS_INF_EID);
     CFE_UtAssert_EVENTCOUNT(1);
@@ -3839,6 +3933,7 @@ void Test_CFE_TBL_Internal(void)
     UT_ResetState(UT_KEY(CFE_ES_GetPoolBuf));
     UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), &UT_TBL_LoadBuffer, sizeof(UT_TBL_LoadBuffer), false);
     CFE_UtAssert_SUCCESS(CFE_TBL_EarlyInit());
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
     CFE_UtAssert_EVENTCOUNT(0);
 
     /* Test starting a transaction where the handle is OK but the underlying registry record is invalid */